@@ -76,6 +76,9 @@ find_package_handle_standard_args(OpenSubdiv DEFAULT_MSG
 if(OPENSUBDIV_FOUND)
   set(OPENSUBDIV_LIBRARIES ${_opensubdiv_LIBRARIES})
   set(OPENSUBDIV_INCLUDE_DIRS ${OPENSUBDIV_INCLUDE_DIR})
+
+  # The TBB evaluator is only installed when OpenSubdiv was built with TBB.
+  OPENSUBDIV_CHECK_CONTROLLER("tbbEvaluator.h" OPENSUBDIV_HAS_TBB)
 endif()
 
 mark_as_advanced(
@@ -0,0 +1,103 @@
+"""
+**Persistent Render Process**
+
+This example shows how a command can keep Blender running to render frames on request.
+The blend-file is loaded once and reloaded only when it changes on disk,
+and persistent render data keeps the evaluated scene and render engine data between frames.
+
+Each request is a line with a frame number sent over a local socket,
+the path of the written image is sent back.
+"""
+
+import os
+import socket
+import sys
+
+import bpy
+
+
+def argparse_create():
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        prog=os.path.basename(sys.argv[0]) + " --command render_server",
+        description="Render frames of a blend-file on request.",
+    )
+
+    parser.add_argument(
+        "-f", "--file",
+        dest="file",
+        metavar='FILE',
+        type=str,
+        help="The blend-file to render.",
+        required=True,
+    )
+
+    parser.add_argument(
+        "-p", "--port",
+        dest="port",
+        type=int,
+        default=8765,
+        help="The local port to listen on.",
+        required=False,
+    )
+
+    return parser
+
+
+def blend_file_ensure_loaded(filepath, mtime_prev):
+    mtime = os.path.getmtime(filepath)
+    if mtime != mtime_prev:
+        bpy.ops.wm.open_mainfile(filepath=filepath)
+        bpy.context.scene.render.use_persistent_data = True
+    return mtime
+
+
+def render_frame(frame):
+    scene = bpy.context.scene
+    scene.frame_set(frame)
+    bpy.ops.render.render(write_still=True)
+    return scene.render.frame_path(frame=frame)
+
+
+def render_server(argv):
+    parser = argparse_create()
+    args = parser.parse_args(argv)
+
+    filepath = os.path.abspath(args.file)
+    mtime = blend_file_ensure_loaded(filepath, None)
+
+    with socket.create_server(("127.0.0.1", args.port)) as server:
+        while True:
+            connection, _address = server.accept()
+            with connection, connection.makefile("rw", encoding="utf-8") as stream:
+                for line in stream:
+                    request = line.strip()
+                    if request == "quit":
+                        return 0
+                    try:
+                        frame = int(request)
+                    except ValueError:
+                        stream.write("error invalid frame\n")
+                        stream.flush()
+                        continue
+                    mtime = blend_file_ensure_loaded(filepath, mtime)
+                    stream.write("ok " + render_frame(frame) + "\n")
+                    stream.flush()
+
+
+cli_commands = []
+
+
+def register():
+    cli_commands.append(bpy.utils.register_cli_command("render_server", render_server))
+
+
+def unregister():
+    for cmd in cli_commands:
+        bpy.utils.unregister_cli_command(cmd)
+    cli_commands.clear()
+
+
+if __name__ == "__main__":
+    register()
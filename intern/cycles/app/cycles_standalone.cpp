@@ -5,6 +5,7 @@
 #include <stdio.h>
 
 #include "device/device.h"
+#include "integrator/work_balancer.h"
 #include "scene/camera.h"
 #include "scene/integrator.h"
 #include "scene/scene.h"
@@ -49,6 +50,7 @@ struct Options {
   bool show_help, interactive, pause;
   string output_filepath;
   string output_pass;
+  string benchmark_filepath;
 } options;
 
 static void session_print(const string &str)
@@ -163,6 +165,67 @@ static void session_init()
   options.session->start();
 }
 
+static string benchmark_json_string(const string &str)
+{
+  string result = "\"";
+  for (const char c : str) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    }
+    else if (uchar(c) < 0x20) {
+      result += string_printf("\\u%04x", int(c));
+    }
+    else {
+      result += c;
+    }
+  }
+  return result + "\"";
+}
+
+/* Write the per-device work balance statistics of the render as JSON, so that the balancing of
+ * multi-device renders can be measured and compared between runs. */
+static void benchmark_write(const string &filepath)
+{
+  FILE *file = path_fopen(filepath, "w");
+  if (!file) {
+    fprintf(stderr, "Failed to write benchmark to %s\n", filepath.c_str());
+    return;
+  }
+
+  const WorkBalanceStatistics &stats = options.session->get_work_balance_statistics();
+  double total_time, render_time;
+  options.session->progress.get_time(total_time, render_time);
+
+  fprintf(file, "{\n");
+  fprintf(file, "  \"file\": %s,\n", benchmark_json_string(options.filepath).c_str());
+  fprintf(file, "  \"samples\": %d,\n", options.session->progress.get_current_sample());
+  fprintf(file, "  \"total_time\": %f,\n", total_time);
+  fprintf(file, "  \"render_time\": %f,\n", render_time);
+  fprintf(file, "  \"rebalance_count\": %d,\n", stats.num_rebalance);
+  fprintf(file, "  \"rebalance_changed_count\": %d,\n", stats.num_rebalance_changed);
+  fprintf(file, "  \"rebalance_time\": %f,\n", stats.rebalance_time);
+  fprintf(file, "  \"devices\": [");
+  for (int i = 0; i < stats.devices.size(); i++) {
+    const WorkBalanceStatistics::DeviceStatistics &device = stats.devices[i];
+    const double throughput = (device.render_time > 0.0) ?
+                                  double(device.num_pixel_samples) / device.render_time :
+                                  0.0;
+    fprintf(file, "%s\n    {\n", (i == 0) ? "" : ",");
+    fprintf(file, "      \"name\": %s,\n", benchmark_json_string(device.description).c_str());
+    fprintf(file,
+            "      \"pixel_samples\": %llu,\n",
+            (unsigned long long)device.num_pixel_samples);
+    fprintf(file, "      \"render_time\": %f,\n", device.render_time);
+    fprintf(file, "      \"idle_time\": %f,\n", device.idle_time);
+    fprintf(file, "      \"pixel_samples_per_second\": %f,\n", throughput);
+    fprintf(file, "      \"weight\": %f\n", device.weight);
+    fprintf(file, "    }");
+  }
+  fprintf(file, "\n  ]\n}\n");
+  fclose(file);
+}
+
 static void session_exit()
 {
   if (options.session) {
@@ -426,6 +489,9 @@ static void options_parse(int argc, const char **argv)
              "--tile-size %d",
              &options.session_params.tile_size,
              "Tile size in pixels",
+             "--benchmark %s",
+             &options.benchmark_filepath,
+             "Write per-device sample throughput and work balance statistics as JSON to file",
              "--list-devices",
              &list,
              "List information about all available devices",
@@ -550,6 +616,9 @@ int main(int argc, const char **argv)
 #endif
     session_init();
     options.session->wait();
+    if (!options.benchmark_filepath.empty()) {
+      benchmark_write(options.benchmark_filepath);
+    }
     session_exit();
 #ifdef WITH_CYCLES_STANDALONE_GUI
   }
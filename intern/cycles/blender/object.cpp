@@ -243,9 +243,12 @@ Object *BlenderSync::sync_object(BL::Depsgraph &b_depsgraph,
     return NULL;
   }
 
-  /* Use task pool only for non-instances, since sync_dupli_particle accesses
-   * geometry. This restriction should be removed for better performance. */
-  TaskPool *object_geom_task_pool = (is_instance) ? NULL : geom_task_pool;
+  /* Instances generated by particle systems are synced without the task pool, since
+   * sync_dupli_particle accesses the geometry right after it was synced. Other instances, like the
+   * ones from geometry nodes, only reference the geometry and can be synced in parallel. */
+  TaskPool *object_geom_task_pool = (is_instance && b_instance.particle_system()) ?
+                                        NULL :
+                                        geom_task_pool;
 
   /* key to lookup object */
   ObjectKey key(b_parent, persistent_id, b_ob_info.real_object, use_particle_hair);
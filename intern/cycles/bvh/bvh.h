@@ -59,6 +59,15 @@ struct PackedBVH {
   {
     root_index = 0;
   }
+
+  /* Memory used by the packed arrays. */
+  size_t size_in_bytes() const
+  {
+    return nodes.size() * sizeof(int4) + leaf_nodes.size() * sizeof(int4) +
+           object_node.size() * sizeof(int) + prim_type.size() * sizeof(int) +
+           prim_visibility.size() * sizeof(uint) + prim_index.size() * sizeof(int) +
+           prim_object.size() * sizeof(int) + prim_time.size() * sizeof(float2);
+  }
 };
 
 /* BVH */
@@ -13,10 +13,12 @@
 #include "scene/pointcloud.h"
 
 #include "bvh/build.h"
+#include "bvh/cache.h"
 #include "bvh/node.h"
 #include "bvh/unaligned.h"
 
 #include "util/foreach.h"
+#include "util/log.h"
 #include "util/progress.h"
 
 CCL_NAMESPACE_BEGIN
@@ -37,6 +39,13 @@ BVH2::BVH2(const BVHParams &params_,
 
 void BVH2::build(Progress &progress, Stats *)
 {
+  /* Geometry level trees of static geometry can be reused from a previous build. */
+  const string cache_key = (geometry.size() == 1) ? bvh_cache_key(params, geometry[0]) : "";
+  if (bvh_cache_read(cache_key, pack)) {
+    build_sah_cost = 0.0f;
+    return;
+  }
+
   progress.set_substatus("Building BVH");
 
   /* build nodes */
@@ -83,8 +92,12 @@ void BVH2::build(Progress &progress, Stats *)
   progress.set_substatus("Packing BVH nodes");
   pack_nodes(root);
 
+  build_sah_cost = params.top_level ? 0.0f : root->computeSubtreeSAHCost(params);
+
   /* free build nodes */
   root->deleteSubtree();
+
+  bvh_cache_write(cache_key, pack);
 }
 
 void BVH2::refit(Progress &progress)
@@ -97,7 +110,15 @@ void BVH2::refit(Progress &progress)
   }
 
   progress.set_substatus("Refitting BVH nodes");
-  refit_nodes();
+  const float sah_cost = refit_nodes();
+
+  /* Refitting keeps the topology of the tree, which becomes inefficient when primitives move
+   * far from where they were at build time. */
+  if (build_sah_cost > 0.0f && sah_cost > build_sah_cost * params.refit_max_sah_cost_factor) {
+    VLOG_WORK << "Rebuilding BVH, refitting increased SAH cost from " << build_sah_cost
+              << " to " << sah_cost << ".";
+    build(progress, nullptr);
+  }
 }
 
 BVHNode *BVH2::widen_children_nodes(const BVHNode *root)
@@ -303,16 +324,20 @@ void BVH2::pack_nodes(const BVHNode *root)
   pack.root_index = (root->is_leaf()) ? -1 : 0;
 }
 
-void BVH2::refit_nodes()
+float BVH2::refit_nodes()
 {
   assert(!params.top_level);
 
   BoundBox bbox = BoundBox::empty;
   uint visibility = 0;
-  refit_node(0, (pack.root_index == -1) ? true : false, bbox, visibility);
+  const float cost = refit_node(0, (pack.root_index == -1) ? true : false, bbox, visibility);
+
+  /* Normalize the same way as BVHNode::computeSubtreeSAHCost(). */
+  const float area = bbox.safe_area();
+  return (area > 0.0f) ? cost / area : 0.0f;
 }
 
-void BVH2::refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility)
+float BVH2::refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility)
 {
   if (leaf) {
     /* refit leaf node */
@@ -330,6 +355,8 @@ void BVH2::refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility)
     leaf_data[0].z = __uint_as_float(visibility);
     leaf_data[0].w = __uint_as_float(data[0].w);
     memcpy(&pack.leaf_nodes[idx], leaf_data, sizeof(float4) * BVH_NODE_LEAF_SIZE);
+
+    return bbox.safe_area() * params.cost(0, (c0 < 0) ? 1 : c1 - c0);
   }
   else {
     assert(idx + BVH_NODE_SIZE <= pack.nodes.size());
@@ -342,8 +369,8 @@ void BVH2::refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility)
     BoundBox bbox0 = BoundBox::empty, bbox1 = BoundBox::empty;
     uint visibility0 = 0, visibility1 = 0;
 
-    refit_node((c0 < 0) ? -c0 - 1 : c0, (c0 < 0), bbox0, visibility0);
-    refit_node((c1 < 0) ? -c1 - 1 : c1, (c1 < 0), bbox1, visibility1);
+    float cost = refit_node((c0 < 0) ? -c0 - 1 : c0, (c0 < 0), bbox0, visibility0);
+    cost += refit_node((c1 < 0) ? -c1 - 1 : c1, (c1 < 0), bbox1, visibility1);
 
     if (is_unaligned) {
       Transform aligned_space = transform_identity();
@@ -357,6 +384,8 @@ void BVH2::refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility)
     bbox.grow(bbox0);
     bbox.grow(bbox1);
     visibility = visibility0 | visibility1;
+
+    return cost + bbox.safe_area() * params.cost(2, 0);
   }
 }
 
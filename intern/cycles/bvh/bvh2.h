@@ -41,6 +41,10 @@ class BVH2 : public BVH {
   PackedBVH pack;
 
  protected:
+  /* SAH cost of the tree when it was last built, used to detect when refitting degraded the
+   * tree too much. Zero when unknown. */
+  float build_sah_cost = 0.0f;
+
   /* constructor */
   friend class BVH;
   BVH2(const BVHParams &params,
@@ -80,9 +84,9 @@ class BVH2 : public BVH {
                            uint visibility0,
                            uint visibility1);
 
-  /* refit */
-  void refit_nodes();
-  void refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility);
+  /* refit, returning the SAH cost of the refitted tree */
+  float refit_nodes();
+  float refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility);
 
   /* Refit range of primitives. */
   void refit_primitives(int start, int end, BoundBox &bbox, uint &visibility);
@@ -0,0 +1,268 @@
+/* SPDX-FileCopyrightText: 2011-2022 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "bvh/cache.h"
+#include "bvh/bvh.h"
+#include "bvh/params.h"
+
+#include "scene/hair.h"
+#include "scene/mesh.h"
+#include "scene/pointcloud.h"
+
+#include "util/log.h"
+#include "util/math.h"
+#include "util/md5.h"
+#include "util/path.h"
+#include "util/time.h"
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+CCL_NAMESPACE_BEGIN
+
+/* Bump when the packed BVH2 layout or the BVH builder changes in a way which changes the
+ * resulting tree. */
+static const uint32_t BVH_CACHE_VERSION = 1;
+static const char BVH_CACHE_MAGIC[8] = {'C', 'Y', 'C', 'L', 'B', 'V', 'H', '2'};
+
+/* Geometry with fewer primitives builds fast enough to not be worth a file in the cache. */
+static const size_t BVH_CACHE_MIN_PRIMITIVES = 16384;
+
+static const char *bvh_cache_path()
+{
+  static const char *path = getenv("CYCLES_BVH_CACHE_PATH");
+  return (path && path[0]) ? path : nullptr;
+}
+
+/* Hashing */
+
+static void hash_bytes(MD5Hash &md5, const void *data, const size_t size)
+{
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  for (size_t offset = 0; offset < size;) {
+    const int chunk = int(min(size - offset, size_t(INT_MAX / 2)));
+    md5.append(bytes + offset, chunk);
+    offset += chunk;
+  }
+}
+
+template<typename T> static void hash_value(MD5Hash &md5, const T &value)
+{
+  hash_bytes(md5, &value, sizeof(value));
+}
+
+template<typename T> static void hash_array(MD5Hash &md5, const array<T> &data)
+{
+  hash_value(md5, uint64_t(data.size()));
+  hash_bytes(md5, data.data(), sizeof(T) * data.size());
+}
+
+static void hash_motion_attribute(MD5Hash &md5, const Geometry *geom)
+{
+  const Attribute *attr = geom->attributes.find(ATTR_STD_MOTION_VERTEX_POSITION);
+  if (!geom->has_motion_blur() || attr == nullptr) {
+    hash_value(md5, uint64_t(0));
+    return;
+  }
+  hash_value(md5, uint64_t(attr->buffer.size()));
+  hash_bytes(md5, attr->buffer.data(), attr->buffer.size());
+  hash_value(md5, geom->get_motion_steps());
+}
+
+/* Hash all parameters individually, the struct itself has padding. */
+static void hash_params(MD5Hash &md5, const BVHParams &params)
+{
+  hash_value(md5, params.use_spatial_split);
+  hash_value(md5, params.spatial_split_alpha);
+  hash_value(md5, params.unaligned_split_threshold);
+  hash_value(md5, params.sah_node_cost);
+  hash_value(md5, params.sah_primitive_cost);
+  hash_value(md5, params.min_leaf_size);
+  hash_value(md5, params.max_triangle_leaf_size);
+  hash_value(md5, params.max_motion_triangle_leaf_size);
+  hash_value(md5, params.max_curve_leaf_size);
+  hash_value(md5, params.max_motion_curve_leaf_size);
+  hash_value(md5, params.max_point_leaf_size);
+  hash_value(md5, params.max_motion_point_leaf_size);
+  hash_value(md5, int(params.bvh_layout));
+  hash_value(md5, params.use_unaligned_nodes);
+  hash_value(md5, params.num_motion_triangle_steps);
+  hash_value(md5, params.num_motion_curve_steps);
+  hash_value(md5, params.num_motion_point_steps);
+  hash_value(md5, params.curve_subdivisions);
+}
+
+string bvh_cache_key(const BVHParams &params, const Geometry *geom)
+{
+  if (bvh_cache_path() == nullptr || params.top_level || params.bvh_layout != BVH_LAYOUT_BVH2 ||
+      params.bvh_type != BVH_TYPE_STATIC)
+  {
+    return "";
+  }
+
+  MD5Hash md5;
+  hash_value(md5, BVH_CACHE_VERSION);
+  hash_params(md5, params);
+  hash_value(md5, int(geom->geometry_type));
+
+  if (geom->is_mesh() || geom->is_volume()) {
+    const Mesh *mesh = static_cast<const Mesh *>(geom);
+    if (mesh->num_triangles() < BVH_CACHE_MIN_PRIMITIVES) {
+      return "";
+    }
+    hash_array(md5, mesh->get_verts());
+    hash_array(md5, mesh->get_triangles());
+  }
+  else if (geom->is_hair()) {
+    const Hair *hair = static_cast<const Hair *>(geom);
+    if (hair->num_keys() < BVH_CACHE_MIN_PRIMITIVES) {
+      return "";
+    }
+    hash_value(md5, int(hair->curve_shape));
+    hash_array(md5, hair->get_curve_keys());
+    hash_array(md5, hair->get_curve_radius());
+    hash_array(md5, hair->get_curve_first_key());
+  }
+  else if (geom->is_pointcloud()) {
+    const PointCloud *pointcloud = static_cast<const PointCloud *>(geom);
+    if (pointcloud->num_points() < BVH_CACHE_MIN_PRIMITIVES) {
+      return "";
+    }
+    hash_array(md5, pointcloud->get_points());
+    hash_array(md5, pointcloud->get_radius());
+  }
+  else {
+    return "";
+  }
+
+  hash_motion_attribute(md5, geom);
+
+  return md5.get_hex();
+}
+
+/* File IO */
+
+struct BVHCacheHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t int4_size;
+  int32_t root_index;
+  int32_t pad;
+  uint64_t num_nodes;
+  uint64_t num_leaf_nodes;
+  uint64_t num_prims;
+  uint64_t num_prim_times;
+};
+
+static string bvh_cache_filepath(const string &key)
+{
+  /* Split into sub-directories to keep the number of files per directory reasonable. */
+  return path_join(path_join(bvh_cache_path(), key.substr(0, 2)), key + ".bvh");
+}
+
+template<typename T> static bool write_array(FILE *f, const array<T> &data)
+{
+  return data.size() == 0 || fwrite(data.data(), sizeof(T), data.size(), f) == data.size();
+}
+
+template<typename T> static bool read_array(FILE *f, array<T> &data, const uint64_t size)
+{
+  data.resize(size);
+  return size == 0 || fread(data.data(), sizeof(T), size, f) == size;
+}
+
+bool bvh_cache_read(const string &key, PackedBVH &pack)
+{
+  if (key.empty()) {
+    return false;
+  }
+
+  const double start_time = time_dt();
+  const string filepath = bvh_cache_filepath(key);
+  FILE *f = path_fopen(filepath, "rb");
+  if (!f) {
+    return false;
+  }
+
+  BVHCacheHeader header;
+  bool ok = fread(&header, sizeof(header), 1, f) == 1 &&
+            memcmp(header.magic, BVH_CACHE_MAGIC, sizeof(header.magic)) == 0 &&
+            header.version == BVH_CACHE_VERSION && header.int4_size == sizeof(int4);
+
+  /* Read into a separate pack, so a truncated file does not leave a partial tree behind. */
+  PackedBVH cached;
+  if (ok) {
+    ok = read_array(f, cached.nodes, header.num_nodes) &&
+         read_array(f, cached.leaf_nodes, header.num_leaf_nodes) &&
+         read_array(f, cached.prim_type, header.num_prims) &&
+         read_array(f, cached.prim_visibility, header.num_prims) &&
+         read_array(f, cached.prim_index, header.num_prims) &&
+         read_array(f, cached.prim_object, header.num_prims) &&
+         read_array(f, cached.prim_time, header.num_prim_times);
+  }
+  fclose(f);
+
+  if (!ok) {
+    VLOG_WARNING << "Ignoring invalid BVH cache file " << filepath;
+    return false;
+  }
+
+  cached.root_index = header.root_index;
+  pack.nodes.steal_data(cached.nodes);
+  pack.leaf_nodes.steal_data(cached.leaf_nodes);
+  pack.prim_type.steal_data(cached.prim_type);
+  pack.prim_visibility.steal_data(cached.prim_visibility);
+  pack.prim_index.steal_data(cached.prim_index);
+  pack.prim_object.steal_data(cached.prim_object);
+  pack.prim_time.steal_data(cached.prim_time);
+  pack.root_index = cached.root_index;
+
+  VLOG_WORK << "Read BVH from cache " << filepath << " in " << time_dt() - start_time
+            << " seconds.";
+  return true;
+}
+
+void bvh_cache_write(const string &key, const PackedBVH &pack)
+{
+  if (key.empty()) {
+    return;
+  }
+
+  const string filepath = bvh_cache_filepath(key);
+  /* Write to a temporary file first, so that other processes never see a partial file. */
+  const string filepath_tmp = filepath +
+                              string_printf(".%llx.tmp", (unsigned long long)(time_dt() * 1e6));
+
+  path_create_directories(filepath_tmp);
+  FILE *f = path_fopen(filepath_tmp, "wb");
+  if (!f) {
+    VLOG_WARNING << "Failed to create BVH cache file " << filepath_tmp;
+    return;
+  }
+
+  BVHCacheHeader header = {};
+  memcpy(header.magic, BVH_CACHE_MAGIC, sizeof(header.magic));
+  header.version = BVH_CACHE_VERSION;
+  header.int4_size = sizeof(int4);
+  header.root_index = pack.root_index;
+  header.num_nodes = pack.nodes.size();
+  header.num_leaf_nodes = pack.leaf_nodes.size();
+  header.num_prims = pack.prim_index.size();
+  header.num_prim_times = pack.prim_time.size();
+
+  const bool ok = fwrite(&header, sizeof(header), 1, f) == 1 && write_array(f, pack.nodes) &&
+                  write_array(f, pack.leaf_nodes) && write_array(f, pack.prim_type) &&
+                  write_array(f, pack.prim_visibility) && write_array(f, pack.prim_index) &&
+                  write_array(f, pack.prim_object) && write_array(f, pack.prim_time);
+  const bool closed = fclose(f) == 0;
+
+  if (!ok || !closed || rename(filepath_tmp.c_str(), filepath.c_str()) != 0) {
+    VLOG_WARNING << "Failed to write BVH cache file " << filepath;
+    path_remove(filepath_tmp);
+  }
+}
+
+CCL_NAMESPACE_END
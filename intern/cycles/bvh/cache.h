@@ -0,0 +1,39 @@
+/* SPDX-FileCopyrightText: 2011-2022 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#ifndef __BVH_CACHE_H__
+#define __BVH_CACHE_H__
+
+#include "util/string.h"
+
+CCL_NAMESPACE_BEGIN
+
+class BVHParams;
+class Geometry;
+struct PackedBVH;
+
+/* Disk cache of packed geometry level BVH2 trees.
+ *
+ * Geometry level trees only depend on the geometry data and the build parameters, not on the
+ * object transforms or the position of the geometry in the scene, so static geometry can reuse
+ * the tree built for a previous frame or by a previous render process.
+ *
+ * The cache is enabled by pointing the CYCLES_BVH_CACHE_PATH environment variable to a
+ * directory. It is only used for static BVH builds of geometry which is large enough for the
+ * tree build to dominate over hashing its data. */
+
+/* Compute the key of the tree for the given geometry, or an empty string when the cache is not
+ * used for this build. */
+string bvh_cache_key(const BVHParams &params, const Geometry *geom);
+
+/* Read tree with the given key from the cache. Returns false if there is no valid cached tree,
+ * in which case the pack is left untouched. */
+bool bvh_cache_read(const string &key, PackedBVH &pack);
+
+/* Store the tree of a finished build in the cache. */
+void bvh_cache_write(const string &key, const PackedBVH &pack);
+
+CCL_NAMESPACE_END
+
+#endif /* __BVH_CACHE_H__ */
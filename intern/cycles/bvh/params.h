@@ -64,6 +64,10 @@ class BVHParams {
   /* Unaligned nodes creation threshold */
   float unaligned_split_threshold;
 
+  /* Refitted trees whose SAH cost grew by more than this factor compared to the freshly built
+   * tree are rebuilt from scratch instead, as deformation made them too inefficient to trace. */
+  float refit_max_sah_cost_factor;
+
   /* SAH costs */
   float sah_node_cost;
   float sah_primitive_cost;
@@ -118,6 +122,8 @@ class BVHParams {
 
     unaligned_split_threshold = 0.7f;
 
+    refit_max_sah_cost_factor = 1.5f;
+
     /* todo: see if splitting up primitive cost to be separate for triangles
      * and curves can help. so far in tests it doesn't help, but why? */
     sah_node_cost = 1.0f;
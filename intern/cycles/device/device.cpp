@@ -489,6 +489,11 @@ void *Device::get_cpu_osl_memory()
   return nullptr;
 }
 
+void Device::mem_copy_range_to(device_memory &mem, size_t /*size*/, size_t /*offset*/)
+{
+  mem_copy_to(mem);
+}
+
 GPUDevice::~GPUDevice() noexcept(false) {}
 
 bool GPUDevice::load_texture_info()
@@ -802,6 +807,29 @@ void GPUDevice::generic_copy_to(device_memory &mem)
   }
 }
 
+void GPUDevice::generic_copy_to(device_memory &mem, size_t size, size_t offset)
+{
+  if (!mem.host_pointer || !mem.device_pointer) {
+    return;
+  }
+
+  thread_scoped_lock lock(device_mem_map_mutex);
+  if (!device_mem_map[&mem].use_mapped_host || mem.host_pointer != mem.shared_pointer) {
+    copy_host_to_device(
+        (char *)mem.device_pointer + offset, (char *)mem.host_pointer + offset, size);
+  }
+}
+
+void GPUDevice::mem_copy_range_to(device_memory &mem, size_t size, size_t offset)
+{
+  if (mem.type == MEM_GLOBAL || mem.type == MEM_TEXTURE || !mem.device_pointer) {
+    mem_copy_to(mem);
+    return;
+  }
+
+  generic_copy_to(mem, size, offset);
+}
+
 /* DeviceInfo */
 
 CCL_NAMESPACE_END
@@ -311,6 +311,9 @@ class Device {
 
   virtual void mem_alloc(device_memory &mem) = 0;
   virtual void mem_copy_to(device_memory &mem) = 0;
+  /* Copy `size` bytes starting at byte `offset` of already allocated memory. The default
+   * implementation copies all of the memory. */
+  virtual void mem_copy_range_to(device_memory &mem, size_t size, size_t offset);
   virtual void mem_copy_from(device_memory &mem, size_t y, size_t w, size_t h, size_t elem) = 0;
   virtual void mem_zero(device_memory &mem) = 0;
   virtual void mem_free(device_memory &mem) = 0;
@@ -393,6 +396,9 @@ class GPUDevice : public Device {
   virtual GPUDevice::Mem *generic_alloc(device_memory &mem, size_t pitch_padding = 0);
   virtual void generic_free(device_memory &mem);
   virtual void generic_copy_to(device_memory &mem);
+  virtual void generic_copy_to(device_memory &mem, size_t size, size_t offset);
+
+  void mem_copy_range_to(device_memory &mem, size_t size, size_t offset) override;
 
   /* total - amount of device memory, free - amount of available device memory */
   virtual void get_device_memory_info(size_t &total, size_t &free) = 0;
@@ -282,6 +282,7 @@ class device_memory {
   void device_alloc();
   void device_free();
   void device_copy_to();
+  void device_copy_to(size_t size, size_t offset);
   void device_copy_from(size_t y, size_t w, size_t h, size_t elem);
   void device_zero();
 
@@ -384,7 +385,7 @@ template<typename T> class device_vector : public device_memory {
       device_free();
       host_free();
       host_pointer = host_alloc(sizeof(T) * new_size);
-      modified = true;
+      tag_modified();
       assert(device_pointer == 0);
     }
 
@@ -462,7 +463,7 @@ template<typename T> class device_vector : public device_memory {
     data_height = 0;
     data_depth = 0;
     host_pointer = 0;
-    modified = true;
+    tag_modified();
     need_realloc_ = true;
     assert(device_pointer == 0);
   }
@@ -487,6 +488,28 @@ template<typename T> class device_vector : public device_memory {
   void tag_modified()
   {
     modified = true;
+    modified_begin_ = 0;
+    modified_end_ = 0;
+  }
+
+  /* Tag `num` elements starting at `offset` as modified. Unless the whole vector is tagged as
+   * modified, copy_to_device_if_modified() only copies the modified elements. Multiple ranges
+   * are merged into a single one covering all of them. */
+  void tag_modified(size_t offset, size_t num)
+  {
+    if (num == 0) {
+      return;
+    }
+
+    if (!modified) {
+      modified = true;
+      modified_begin_ = offset;
+      modified_end_ = offset + num;
+    }
+    else if (modified_end_ > modified_begin_) {
+      modified_begin_ = min(modified_begin_, offset);
+      modified_end_ = max(modified_end_, offset + num);
+    }
   }
 
   void tag_realloc()
@@ -529,12 +552,20 @@ template<typename T> class device_vector : public device_memory {
       return;
     }
 
+    if (modified_end_ > modified_begin_ && device_pointer && !need_realloc_) {
+      assert(modified_end_ <= data_size);
+      device_copy_to(sizeof(T) * (modified_end_ - modified_begin_), sizeof(T) * modified_begin_);
+      return;
+    }
+
     copy_to_device();
   }
 
   void clear_modified()
   {
     modified = false;
+    modified_begin_ = 0;
+    modified_end_ = 0;
     need_realloc_ = false;
   }
 
@@ -566,6 +597,10 @@ template<typename T> class device_vector : public device_memory {
   {
     return width * ((height == 0) ? 1 : height) * ((depth == 0) ? 1 : depth);
   }
+
+  /* Range of elements tagged as modified, empty when the whole vector is modified. */
+  size_t modified_begin_ = 0;
+  size_t modified_end_ = 0;
 };
 
 /* Device Sub Memory
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include "util/types.h"
+#include "util/vector.h"
+
 CCL_NAMESPACE_BEGIN
 
 class AdaptiveSampling {
@@ -40,4 +43,33 @@ class AdaptiveSampling {
   float threshold = 0.0f;
 };
 
+/* Convergence history of the adaptive sampling filter, accumulated since the last reset of the
+ * rendering. Used to see how quickly the image converges and how much work is spent on pixels
+ * which are already converged. */
+struct AdaptiveSamplingStatistics {
+  struct Filter {
+    /* Index of the big tile the filter was applied to. */
+    int tile = 0;
+
+    /* Number of samples rendered in the tile at the time of filtering. */
+    int num_samples = 0;
+
+    /* Noise threshold used for the filter. Can be higher than the final threshold when the
+     * progressive noise floor is used. */
+    float threshold = 0.0f;
+
+    uint64_t num_active_pixels = 0;
+    uint64_t num_pixels = 0;
+
+    /* Time since the start of rendering. */
+    double time = 0.0;
+  };
+
+  vector<Filter> filters;
+
+  /* Time at which the rendering was reset. */
+  double start_time = 0.0;
+  int tile = 0;
+};
+
 CCL_NAMESPACE_END
@@ -112,6 +112,11 @@ bool DenoiserGPU::denoise_buffer(const DenoiseTask &task)
   /* Passes which do not need albedo and hence if real is present it needs to become fake. */
   denoise_pass(context, PASS_SHADOW_CATCHER);
 
+  /* All passes are denoised on the same queue, so their kernels are ordered and there is no need
+   * to wait for every pass. Wait once before the context buffers are freed and the result is
+   * accessed. */
+  denoiser_queue_->synchronize();
+
   return true;
 }
 
@@ -370,8 +375,6 @@ void DenoiserGPU::denoise_pass(DenoiseContext &context, PassType pass_type)
     LOG(ERROR) << "Error copying denoiser result to the denoised pass.";
     return;
   }
-
-  denoiser_queue_->synchronize();
 }
 
 CCL_NAMESPACE_END
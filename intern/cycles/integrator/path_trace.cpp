@@ -57,6 +57,13 @@ PathTrace::PathTrace(Device *device,
   work_balance_infos_.resize(path_trace_works_.size());
   work_balance_do_initial(work_balance_infos_);
 
+  work_balance_statistics_.devices.resize(path_trace_works_.size());
+  for (int i = 0; i < path_trace_works_.size(); ++i) {
+    work_balance_statistics_.devices[i].description =
+        path_trace_works_[i]->get_device()->info.description;
+    work_balance_statistics_.devices[i].weight = work_balance_infos_[i].weight;
+  }
+
   render_scheduler.set_need_schedule_rebalance(path_trace_works_.size() > 1);
 }
 
@@ -135,6 +142,25 @@ void PathTrace::reset(const BufferParams &full_params,
   render_state_.tile_written = false;
 
   did_draw_after_reset_ = false;
+
+  for (WorkBalanceStatistics::DeviceStatistics &device_stats : work_balance_statistics_.devices) {
+    device_stats.num_pixel_samples = 0;
+    device_stats.render_time = 0.0;
+    device_stats.idle_time = 0.0;
+  }
+  work_balance_statistics_.num_rebalance = 0;
+  work_balance_statistics_.num_rebalance_changed = 0;
+  work_balance_statistics_.rebalance_time = 0.0;
+
+  /* Keep the history of all tiles of the same render, and start over when rendering is reset. */
+  if (reset_rendering) {
+    adaptive_sampling_statistics_.filters.clear();
+    adaptive_sampling_statistics_.start_time = time_dt();
+    adaptive_sampling_statistics_.tile = 0;
+  }
+  else {
+    ++adaptive_sampling_statistics_.tile;
+  }
 }
 
 void PathTrace::device_free()
@@ -390,6 +416,8 @@ void PathTrace::path_trace(RenderWork &render_work)
 
   thread_capture_fp_settings();
 
+  vector<double> work_times(num_works, 0.0);
+
   parallel_for(0, num_works, [&](int i) {
     const double work_start_time = time_dt();
     const int num_samples = render_work.path_trace.num_samples;
@@ -409,11 +437,24 @@ void PathTrace::path_trace(RenderWork &render_work)
     work_balance_infos_[i].time_spent += work_time;
     work_balance_infos_[i].occupancy = statistics.occupancy;
 
+    const BufferParams &buffer_params = path_trace_work->get_effective_buffer_params();
+    WorkBalanceStatistics::DeviceStatistics &device_stats = work_balance_statistics_.devices[i];
+    device_stats.num_pixel_samples += uint64_t(buffer_params.width) * buffer_params.height *
+                                      num_samples;
+    device_stats.render_time += work_time;
+    work_times[i] = work_time;
+
     VLOG_INFO << "Rendered " << num_samples << " samples in " << work_time << " seconds ("
               << work_time / num_samples
               << " seconds per sample), occupancy: " << statistics.occupancy;
   });
 
+  /* Devices which finished early wait for the slowest one before the next step. */
+  const double path_trace_time = time_dt() - start_time;
+  for (int i = 0; i < num_works; ++i) {
+    work_balance_statistics_.devices[i].idle_time += max(0.0, path_trace_time - work_times[i]);
+  }
+
   float occupancy_accum = 0.0f;
   for (const WorkBalanceInfo &balance_info : work_balance_infos_) {
     occupancy_accum += balance_info.occupancy;
@@ -421,8 +462,7 @@ void PathTrace::path_trace(RenderWork &render_work)
   const float occupancy = occupancy_accum / num_works;
   render_scheduler_.report_path_trace_occupancy(render_work, occupancy);
 
-  render_scheduler_.report_path_trace_time(
-      render_work, time_dt() - start_time, is_cancel_requested());
+  render_scheduler_.report_path_trace_time(render_work, path_trace_time, is_cancel_requested());
 }
 
 void PathTrace::adaptive_sample(RenderWork &render_work)
@@ -455,6 +495,16 @@ void PathTrace::adaptive_sample(RenderWork &render_work)
     render_scheduler_.report_adaptive_filter_time(
         render_work, time_dt() - start_time, is_cancel_requested());
 
+    AdaptiveSamplingStatistics::Filter filter_stats;
+    filter_stats.tile = adaptive_sampling_statistics_.tile;
+    filter_stats.num_samples = render_work.path_trace.start_sample +
+                               render_work.path_trace.num_samples;
+    filter_stats.threshold = render_work.adaptive_sampling.threshold;
+    filter_stats.num_active_pixels = num_active_pixels;
+    filter_stats.num_pixels = uint64_t(big_tile_params_.width) * big_tile_params_.height;
+    filter_stats.time = time_dt() - adaptive_sampling_statistics_.start_time;
+    adaptive_sampling_statistics_.filters.push_back(filter_stats);
+
     if (num_active_pixels == 0) {
       VLOG_WORK << "All pixels converged.";
       if (!render_scheduler_.render_work_reschedule_on_converge(render_work)) {
@@ -746,8 +796,14 @@ void PathTrace::rebalance(const RenderWork &render_work)
     }
   }
 
+  work_balance_statistics_.num_rebalance++;
+  for (int i = 0; i < num_works; ++i) {
+    work_balance_statistics_.devices[i].weight = work_balance_infos_[i].weight;
+  }
+
   if (!did_rebalance) {
     VLOG_WORK << "Balance in path trace works did not change.";
+    work_balance_statistics_.rebalance_time += time_dt() - start_time;
     render_scheduler_.report_rebalance_time(render_work, time_dt() - start_time, false);
     return;
   }
@@ -762,6 +818,8 @@ void PathTrace::rebalance(const RenderWork &render_work)
 
   copy_from_render_buffers(&big_tile_cpu_buffers);
 
+  work_balance_statistics_.num_rebalance_changed++;
+  work_balance_statistics_.rebalance_time += time_dt() - start_time;
   render_scheduler_.report_rebalance_time(render_work, time_dt() - start_time, true);
 }
 
@@ -1292,6 +1350,16 @@ static string denoiser_device_report(const Denoiser *denoiser)
   return device_info_list_report("Denoising on", denoiser_device->info);
 }
 
+const WorkBalanceStatistics &PathTrace::get_work_balance_statistics() const
+{
+  return work_balance_statistics_;
+}
+
+const AdaptiveSamplingStatistics &PathTrace::get_adaptive_sampling_statistics() const
+{
+  return adaptive_sampling_statistics_;
+}
+
 string PathTrace::full_report() const
 {
   string result = "\nFull path tracing report\n";
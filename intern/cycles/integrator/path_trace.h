@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "integrator/adaptive_sampling.h"
 #include "integrator/denoiser.h"
 #include "integrator/guiding.h"
 #include "integrator/pass_accessor.h"
@@ -176,6 +177,12 @@ class PathTrace {
    * times, and so on. */
   string full_report() const;
 
+  /* Get statistics about the balancing of the work between devices since the last reset. */
+  const WorkBalanceStatistics &get_work_balance_statistics() const;
+
+  /* Get convergence history of the adaptive sampling since the last reset of the rendering. */
+  const AdaptiveSamplingStatistics &get_adaptive_sampling_statistics() const;
+
   /* Callback which is called to report current rendering progress.
    *
    * It is supposed to be cheaper than buffer update/write, hence can be called more often.
@@ -278,6 +285,12 @@ class PathTrace {
   /* Per-path trace work information needed for multi-device balancing. */
   vector<WorkBalanceInfo> work_balance_infos_;
 
+  /* Per-device statistics of the balancing, for benchmarking. */
+  WorkBalanceStatistics work_balance_statistics_;
+
+  /* Convergence history of the adaptive sampling filter. */
+  AdaptiveSamplingStatistics adaptive_sampling_statistics_;
+
   /* Render buffer parameters of the full frame and current big tile. */
   BufferParams full_params_;
   BufferParams big_tile_params_;
@@ -141,6 +141,12 @@ class PathTraceWork {
     return device_;
   }
 
+  /* Parameters of the part of the big tile which is path traced by this work. */
+  const BufferParams &get_effective_buffer_params() const
+  {
+    return effective_buffer_params_;
+  }
+
 #ifdef WITH_PATH_GUIDING
   /* Initializes the per-thread guiding kernel data. */
   virtual void guiding_init_kernel_globals(void *, void *, const bool) {}
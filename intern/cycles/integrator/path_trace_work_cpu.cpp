@@ -16,12 +16,18 @@
 #include "scene/scene.h"
 #include "session/buffers.h"
 
+#include "util/algorithm.h"
 #include "util/atomic.h"
 #include "util/log.h"
 #include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
+/* Size of the square blocks of pixels which are path traced by one thread. All pixels of a block
+ * are traced sample by sample, so that consecutive camera rays and the rays following them are
+ * spatially coherent and reuse the BVH nodes and textures which are in the CPU caches. */
+static const int CPU_WORK_BLOCK_SIZE = 8;
+
 /* Create TBB arena for execution of path tracing and rendering tasks. */
 static inline tbb::task_arena local_tbb_arena_create(const Device *device)
 {
@@ -65,7 +71,9 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
 {
   const int64_t image_width = effective_buffer_params_.width;
   const int64_t image_height = effective_buffer_params_.height;
-  const int64_t total_pixels_num = image_width * image_height;
+  const int64_t num_blocks_x = divide_up(image_width, CPU_WORK_BLOCK_SIZE);
+  const int64_t num_blocks_y = divide_up(image_height, CPU_WORK_BLOCK_SIZE);
+  const int64_t total_blocks_num = num_blocks_x * num_blocks_y;
 
   if (device_->profiler.active()) {
     for (CPUKernelThreadGlobals &kernel_globals : kernel_thread_globals_) {
@@ -75,19 +83,21 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
 
   tbb::task_arena local_arena = local_tbb_arena_create(device_);
   local_arena.execute([&]() {
-    parallel_for(int64_t(0), total_pixels_num, [&](int64_t work_index) {
+    parallel_for(int64_t(0), total_blocks_num, [&](int64_t work_index) {
       if (is_cancel_requested()) {
         return;
       }
 
-      const int y = work_index / image_width;
-      const int x = work_index - y * image_width;
+      const int block_y = work_index / num_blocks_x;
+      const int block_x = work_index - block_y * num_blocks_x;
+      const int x = block_x * CPU_WORK_BLOCK_SIZE;
+      const int y = block_y * CPU_WORK_BLOCK_SIZE;
 
       KernelWorkTile work_tile;
       work_tile.x = effective_buffer_params_.full_x + x;
       work_tile.y = effective_buffer_params_.full_y + y;
-      work_tile.w = 1;
-      work_tile.h = 1;
+      work_tile.w = min(CPU_WORK_BLOCK_SIZE, int(image_width - x));
+      work_tile.h = min(CPU_WORK_BLOCK_SIZE, int(image_height - y));
       work_tile.start_sample = start_sample;
       work_tile.sample_offset = sample_offset;
       work_tile.num_samples = 1;
@@ -124,43 +134,74 @@ void PathTraceWorkCPU::render_samples_full_pipeline(KernelGlobalsCPU *kernel_glo
     path_state_init_queues(shadow_catcher_state);
   }
 
-  KernelWorkTile sample_work_tile = work_tile;
   float *render_buffer = buffers_->buffer.data();
 
+  /* Pixels which are still to be sampled, cleared when the initialization kernel reports that a
+   * pixel does not need any more samples. */
+  bool pixel_active[CPU_WORK_BLOCK_SIZE * CPU_WORK_BLOCK_SIZE];
+  const int num_pixels = work_tile.w * work_tile.h;
+  DCHECK_LE(num_pixels, CPU_WORK_BLOCK_SIZE * CPU_WORK_BLOCK_SIZE);
+  std::fill(pixel_active, pixel_active + num_pixels, true);
+
+  KernelWorkTile pixel_work_tile = work_tile;
+  pixel_work_tile.w = 1;
+  pixel_work_tile.h = 1;
+
   for (int sample = 0; sample < samples_num; ++sample) {
     if (is_cancel_requested()) {
       break;
     }
 
-    if (has_bake) {
-      if (!kernels_.integrator_init_from_bake(
-              kernel_globals, state, &sample_work_tile, render_buffer))
-      {
-        break;
+    pixel_work_tile.start_sample = work_tile.start_sample + sample;
+
+    bool is_any_pixel_active = false;
+
+    for (int pixel_index = 0; pixel_index < num_pixels; ++pixel_index) {
+      if (!pixel_active[pixel_index]) {
+        continue;
       }
-    }
-    else {
-      if (!kernels_.integrator_init_from_camera(
-              kernel_globals, state, &sample_work_tile, render_buffer))
-      {
-        break;
+
+      const int y = pixel_index / work_tile.w;
+      const int x = pixel_index - y * work_tile.w;
+      pixel_work_tile.x = work_tile.x + x;
+      pixel_work_tile.y = work_tile.y + y;
+
+      if (has_bake) {
+        if (!kernels_.integrator_init_from_bake(
+                kernel_globals, state, &pixel_work_tile, render_buffer))
+        {
+          pixel_active[pixel_index] = false;
+          continue;
+        }
       }
-    }
+      else {
+        if (!kernels_.integrator_init_from_camera(
+                kernel_globals, state, &pixel_work_tile, render_buffer))
+        {
+          pixel_active[pixel_index] = false;
+          continue;
+        }
+      }
+
+      is_any_pixel_active = true;
 
-    kernels_.integrator_megakernel(kernel_globals, state, render_buffer);
+      kernels_.integrator_megakernel(kernel_globals, state, render_buffer);
 
 #ifdef WITH_PATH_GUIDING
-    if (kernel_globals->data.integrator.train_guiding) {
-      /* Push the generated sample data to the global sample data storage. */
-      guiding_push_sample_data_to_global_storage(kernel_globals, state, render_buffer);
-    }
+      if (kernel_globals->data.integrator.train_guiding) {
+        /* Push the generated sample data to the global sample data storage. */
+        guiding_push_sample_data_to_global_storage(kernel_globals, state, render_buffer);
+      }
 #endif
 
-    if (shadow_catcher_state) {
-      kernels_.integrator_megakernel(kernel_globals, shadow_catcher_state, render_buffer);
+      if (shadow_catcher_state) {
+        kernels_.integrator_megakernel(kernel_globals, shadow_catcher_state, render_buffer);
+      }
     }
 
-    ++sample_work_tile.start_sample;
+    if (!is_any_pixel_active) {
+      break;
+    }
   }
 }
 
@@ -69,7 +69,8 @@ class PathTraceWorkCPU : public PathTraceWork {
 #endif
 
  protected:
-  /* Core path tracing routine. Renders given work time on the given queue. */
+  /* Core path tracing routine. Renders all samples of the pixels of the given work tile, which
+   * is at most CPU_WORK_BLOCK_SIZE pixels wide and high. */
   void render_samples_full_pipeline(KernelGlobalsCPU *kernel_globals,
                                     const KernelWorkTile &work_tile,
                                     const int samples_num);
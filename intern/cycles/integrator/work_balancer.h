@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include "util/string.h"
+#include "util/types.h"
 #include "util/vector.h"
 
 CCL_NAMESPACE_BEGIN
@@ -20,6 +22,35 @@ struct WorkBalanceInfo {
   double weight = 1.0;
 };
 
+/* Statistics of how the work was balanced between devices, accumulated since the last reset of
+ * the path tracer. Used to measure the balancing of multi-device renders. */
+struct WorkBalanceStatistics {
+  struct DeviceStatistics {
+    string description;
+
+    /* Number of path traced samples, summed over all pixels rendered by the device. */
+    uint64_t num_pixel_samples = 0;
+
+    /* Time spent path tracing on the device. */
+    double render_time = 0.0;
+
+    /* Time the device was waiting for the other devices to finish their part of the samples. */
+    double idle_time = 0.0;
+
+    /* Weight of the device after the last balancing. */
+    double weight = 1.0;
+  };
+
+  vector<DeviceStatistics> devices;
+
+  /* Number of times rebalancing was performed, and how many of them changed the weights. */
+  int num_rebalance = 0;
+  int num_rebalance_changed = 0;
+
+  /* Time spent in rebalancing, including the redistribution of the render buffers. */
+  double rebalance_time = 0.0;
+};
+
 /* Balance work for an initial render integration, before any statistics is known. */
 void work_balance_do_initial(vector<WorkBalanceInfo> &work_balance_infos);
 
@@ -543,45 +543,32 @@ void GeometryManager::device_update_preprocess(Device *device, Scene *scene, Pro
     dscene->prim_visibility.tag_modified();
   }
 
+  /* Modified attributes tag their own range of the attribute arrays when they are packed, so that
+   * only those ranges are copied to the device. */
   if (device_update_flags & ATTR_FLOAT_NEEDS_REALLOC) {
     dscene->attributes_map.tag_realloc();
     dscene->attributes_float.tag_realloc();
   }
-  else if (device_update_flags & ATTR_FLOAT_MODIFIED) {
-    dscene->attributes_float.tag_modified();
-  }
 
   if (device_update_flags & ATTR_FLOAT2_NEEDS_REALLOC) {
     dscene->attributes_map.tag_realloc();
     dscene->attributes_float2.tag_realloc();
   }
-  else if (device_update_flags & ATTR_FLOAT2_MODIFIED) {
-    dscene->attributes_float2.tag_modified();
-  }
 
   if (device_update_flags & ATTR_FLOAT3_NEEDS_REALLOC) {
     dscene->attributes_map.tag_realloc();
     dscene->attributes_float3.tag_realloc();
   }
-  else if (device_update_flags & ATTR_FLOAT3_MODIFIED) {
-    dscene->attributes_float3.tag_modified();
-  }
 
   if (device_update_flags & ATTR_FLOAT4_NEEDS_REALLOC) {
     dscene->attributes_map.tag_realloc();
     dscene->attributes_float4.tag_realloc();
   }
-  else if (device_update_flags & ATTR_FLOAT4_MODIFIED) {
-    dscene->attributes_float4.tag_modified();
-  }
 
   if (device_update_flags & ATTR_UCHAR4_NEEDS_REALLOC) {
     dscene->attributes_map.tag_realloc();
     dscene->attributes_uchar4.tag_realloc();
   }
-  else if (device_update_flags & ATTR_UCHAR4_MODIFIED) {
-    dscene->attributes_uchar4.tag_modified();
-  }
 
   if (device_update_flags & DEVICE_MESH_DATA_MODIFIED) {
     /* if anything else than vertices or shaders are modified, we would need to reallocate, so
@@ -1117,8 +1104,43 @@ bool GeometryManager::need_update() const
 void GeometryManager::collect_statistics(const Scene *scene, RenderStats *stats)
 {
   foreach (Geometry *geometry, scene->geometry) {
-    stats->mesh.geometry.add_entry(
-        NamedSizeEntry(string(geometry->name.c_str()), geometry->get_total_size_in_bytes()));
+    const string name = geometry->name.c_str();
+    const size_t data_size = geometry->get_total_size_in_bytes();
+
+    stats->mesh.geometry.add_entry(NamedSizeEntry(name, data_size));
+
+    GeometryMemoryStats memory(name);
+    memory.data.add_entry(NamedSizeEntry("Geometry data", data_size));
+
+    size_t attributes_size = 0;
+    foreach (const Attribute &attr, geometry->attributes.attributes) {
+      attributes_size += attr.buffer.size();
+    }
+    if (geometry->is_mesh()) {
+      const Mesh *mesh = static_cast<const Mesh *>(geometry);
+      foreach (const Attribute &attr, mesh->subd_attributes.attributes) {
+        attributes_size += attr.buffer.size();
+      }
+    }
+    memory.data.add_entry(NamedSizeEntry("Attributes", attributes_size));
+
+    if (geometry->is_hair()) {
+      /* Curves are packed into separate arrays for the device. */
+      const Hair *hair = static_cast<const Hair *>(geometry);
+      memory.data.add_entry(
+          NamedSizeEntry("Device curve keys", hair->num_keys() * sizeof(float4)));
+      memory.data.add_entry(
+          NamedSizeEntry("Device curves", hair->num_curves() * sizeof(KernelCurve)));
+      memory.data.add_entry(NamedSizeEntry("Device curve segments",
+                                           hair->num_segments() * sizeof(KernelCurveSegment)));
+    }
+
+    if (geometry->bvh && geometry->bvh->params.bvh_layout == BVH_LAYOUT_BVH2) {
+      const BVH2 *bvh2 = static_cast<const BVH2 *>(geometry->bvh);
+      memory.data.add_entry(NamedSizeEntry("BVH", bvh2->pack.size_in_bytes()));
+    }
+
+    stats->mesh.geometry_memory.push_back(memory);
   }
 }
 
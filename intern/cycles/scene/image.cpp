@@ -296,6 +296,11 @@ ustring ImageLoader::osl_filepath() const
   return ustring();
 }
 
+bool ImageLoader::load_reduced_metadata(ImageMetaData & /*metadata*/, const int /*max_size*/)
+{
+  return false;
+}
+
 int ImageLoader::get_tile_number() const
 {
   return 0;
@@ -539,11 +544,21 @@ bool ImageManager::file_load_image(Image *img, int texture_limit)
     return false;
   }
 
-  /* Get metadata. */
-  int width = img->metadata.width;
-  int height = img->metadata.height;
-  int depth = img->metadata.depth;
-  int components = img->metadata.channels;
+  /* Get metadata. When the image is too large and the file contains a lower resolution version
+   * of it, load that directly instead of loading the full resolution to scale it down. */
+  ImageMetaData load_metadata = img->metadata;
+  if (texture_limit > 0 &&
+      max(max(load_metadata.width, load_metadata.height), load_metadata.depth) > texture_limit &&
+      img->loader->load_reduced_metadata(load_metadata, texture_limit))
+  {
+    VLOG_WORK << "Loading image " << img->loader->name() << " at reduced resolution "
+              << load_metadata.width << "x" << load_metadata.height << ".";
+  }
+
+  int width = load_metadata.width;
+  int height = load_metadata.height;
+  int depth = load_metadata.depth;
+  int components = load_metadata.channels;
 
   /* Read pixels. */
   vector<StorageType> pixels_storage;
@@ -571,7 +586,7 @@ bool ImageManager::file_load_image(Image *img, int texture_limit)
 
   const size_t num_pixels = ((size_t)width) * height * depth;
   img->loader->load_pixels(
-      img->metadata, pixels, num_pixels * components, image_associate_alpha(img));
+      load_metadata, pixels, num_pixels * components, image_associate_alpha(img));
 
   /* The kernel can handle 1 and 4 channel images. Anything that is not a single
    * channel image is converted to RGBA format. */
@@ -108,6 +108,11 @@ class ImageLoader {
                            const size_t pixels_size,
                            const bool associate_alpha) = 0;
 
+  /* Optionally change the metadata to a lower resolution version of the image that is stored
+   * in the file, like a MIP level, with width and height no larger than max_size. Returns false
+   * if there is no such version, otherwise the changed metadata is passed to load_pixels. */
+  virtual bool load_reduced_metadata(ImageMetaData &metadata, const int max_size);
+
   /* Name for logs and stats. */
   virtual string name() const = 0;
 
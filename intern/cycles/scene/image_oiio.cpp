@@ -89,9 +89,44 @@ bool OIIOImageLoader::load_metadata(const ImageDeviceFeatures & /*features*/,
   return true;
 }
 
+bool OIIOImageLoader::load_reduced_metadata(ImageMetaData &metadata, const int max_size)
+{
+  if (metadata.depth > 1) {
+    return false;
+  }
+
+  unique_ptr<ImageInput> in(ImageInput::create(filepath.string()));
+  if (!in) {
+    return false;
+  }
+
+  ImageSpec spec;
+  if (!in->open(filepath.string(), spec)) {
+    return false;
+  }
+
+  /* Use the largest MIP level that fits, as stored in tiled texture files. Files without MIP
+   * levels fail to seek to level 1. */
+  bool found = false;
+  for (int miplevel = 1; in->seek_subimage(0, miplevel); miplevel++) {
+    const ImageSpec &mip_spec = in->spec();
+    if (max(mip_spec.width, mip_spec.height) <= max_size) {
+      metadata.width = mip_spec.width;
+      metadata.height = mip_spec.height;
+      found = true;
+      break;
+    }
+  }
+
+  in->close();
+
+  return found;
+}
+
 template<TypeDesc::BASETYPE FileFormat, typename StorageType>
 static void oiio_load_pixels(const ImageMetaData &metadata,
                              const unique_ptr<ImageInput> &in,
+                             const int miplevel,
                              const bool associate_alpha,
                              StorageType *pixels)
 {
@@ -111,7 +146,7 @@ static void oiio_load_pixels(const ImageMetaData &metadata,
   if (depth <= 1) {
     size_t scanlinesize = width * components * sizeof(StorageType);
     in->read_image(0,
-                   0,
+                   miplevel,
                    0,
                    components,
                    FileFormat,
@@ -121,7 +156,7 @@ static void oiio_load_pixels(const ImageMetaData &metadata,
                    AutoStride);
   }
   else {
-    in->read_image(0, 0, 0, components, FileFormat, (uchar *)readpixels);
+    in->read_image(0, miplevel, 0, components, FileFormat, (uchar *)readpixels);
   }
 
   if (components > 4) {
@@ -194,6 +229,15 @@ bool OIIOImageLoader::load_pixels(const ImageMetaData &metadata,
     return false;
   }
 
+  /* Find the MIP level chosen by load_reduced_metadata(). */
+  int miplevel = 0;
+  while (spec.width != metadata.width || spec.height != metadata.height) {
+    if (!in->seek_subimage(0, ++miplevel)) {
+      return false;
+    }
+    spec = in->spec();
+  }
+
   bool do_associate_alpha = false;
   if (associate_alpha) {
     do_associate_alpha = spec.get_int_attribute("oiio:UnassociatedAlpha", 0);
@@ -219,20 +263,23 @@ bool OIIOImageLoader::load_pixels(const ImageMetaData &metadata,
   switch (metadata.type) {
     case IMAGE_DATA_TYPE_BYTE:
     case IMAGE_DATA_TYPE_BYTE4:
-      oiio_load_pixels<TypeDesc::UINT8, uchar>(metadata, in, do_associate_alpha, (uchar *)pixels);
+      oiio_load_pixels<TypeDesc::UINT8, uchar>(
+          metadata, in, miplevel, do_associate_alpha, (uchar *)pixels);
       break;
     case IMAGE_DATA_TYPE_USHORT:
     case IMAGE_DATA_TYPE_USHORT4:
       oiio_load_pixels<TypeDesc::USHORT, uint16_t>(
-          metadata, in, do_associate_alpha, (uint16_t *)pixels);
+          metadata, in, miplevel, do_associate_alpha, (uint16_t *)pixels);
       break;
     case IMAGE_DATA_TYPE_HALF:
     case IMAGE_DATA_TYPE_HALF4:
-      oiio_load_pixels<TypeDesc::HALF, half>(metadata, in, do_associate_alpha, (half *)pixels);
+      oiio_load_pixels<TypeDesc::HALF, half>(
+          metadata, in, miplevel, do_associate_alpha, (half *)pixels);
       break;
     case IMAGE_DATA_TYPE_FLOAT:
     case IMAGE_DATA_TYPE_FLOAT4:
-      oiio_load_pixels<TypeDesc::FLOAT, float>(metadata, in, do_associate_alpha, (float *)pixels);
+      oiio_load_pixels<TypeDesc::FLOAT, float>(
+          metadata, in, miplevel, do_associate_alpha, (float *)pixels);
       break;
     case IMAGE_DATA_TYPE_NANOVDB_FLOAT:
     case IMAGE_DATA_TYPE_NANOVDB_FLOAT3:
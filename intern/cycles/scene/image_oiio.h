@@ -15,6 +15,7 @@ class OIIOImageLoader : public ImageLoader {
   ~OIIOImageLoader();
 
   bool load_metadata(const ImageDeviceFeatures &features, ImageMetaData &metadata) override;
+  bool load_reduced_metadata(ImageMetaData &metadata, const int max_size) override;
 
   bool load_pixels(const ImageMetaData &metadata,
                    void *pixels,
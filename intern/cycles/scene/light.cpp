@@ -152,10 +152,23 @@ Light::Light() : Node(get_node_type())
 void Light::tag_update(Scene *scene)
 {
   if (is_modified()) {
-    scene->light_manager->tag_update(scene, LightManager::LIGHT_MODIFIED);
+    scene->light_manager->tag_update(scene,
+                                     only_strength_is_modified() ?
+                                         LightManager::LIGHT_STRENGTH_MODIFIED :
+                                         LightManager::LIGHT_MODIFIED);
   }
 }
 
+bool Light::only_strength_is_modified() const
+{
+  for (const SocketType &socket : type->inputs) {
+    if (socket_is_modified(socket) && socket.name != "strength") {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool Light::has_contribution(Scene *scene)
 {
   if (strength == zero_float3()) {
@@ -899,6 +912,91 @@ void LightManager::device_update_tree(Device *,
   dscene->object_to_tree.copy_to_device();
   dscene->object_lookup_offset.copy_to_device();
   dscene->triangle_to_tree.copy_to_device();
+
+  last_light_tree_enabled.clear();
+  for (const Light *light : scene->lights) {
+    last_light_tree_enabled.push_back(light->is_enabled);
+  }
+}
+
+bool LightManager::can_update_tree_strength(DeviceScene *dscene, Scene *scene) const
+{
+  if (update_flags != LIGHT_STRENGTH_MODIFIED || !dscene->data.integrator.use_light_tree ||
+      dscene->light_tree_nodes.size() == 0 ||
+      last_light_tree_enabled.size() != scene->lights.size())
+  {
+    return false;
+  }
+
+  /* Lights with zero strength are disabled and not part of the tree. */
+  for (size_t i = 0; i < scene->lights.size(); i++) {
+    if (scene->lights[i]->is_enabled != last_light_tree_enabled[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static float light_tree_node_update_energy(KernelLightTreeNode *knodes,
+                                           const KernelLightTreeEmitter *kemitters,
+                                           vector<bool> &updated,
+                                           const int node_index)
+{
+  KernelLightTreeNode &knode = knodes[node_index];
+
+  /* Nodes may be shared between specialized light linking trees. Instances reference mesh
+   * subtrees, which are not affected by light strengths. */
+  if (updated[node_index] || (knode.type & LIGHT_TREE_INSTANCE)) {
+    return knode.energy;
+  }
+
+  if (knode.num_emitters >= 0) {
+    float energy = 0.0f;
+    for (int i = 0; i < knode.num_emitters; i++) {
+      energy += kemitters[knode.leaf.first_emitter + i].energy;
+    }
+    knode.energy = energy;
+  }
+  else {
+    const int left_child = knode.inner.left_child;
+    const int right_child = knode.inner.right_child;
+    knode.energy = light_tree_node_update_energy(knodes, kemitters, updated, left_child) +
+                   light_tree_node_update_energy(knodes, kemitters, updated, right_child);
+  }
+
+  updated[node_index] = true;
+  return knode.energy;
+}
+
+void LightManager::device_update_tree_strength(DeviceScene *dscene, Scene *scene)
+{
+  KernelLightTreeNode *knodes = dscene->light_tree_nodes.data();
+  KernelLightTreeEmitter *kemitters = dscene->light_tree_emitters.data();
+  const uint *light_to_tree = dscene->light_to_tree.data();
+
+  /* Update energy of light emitters, using the same light indices as the tree build. */
+  int device_light_index = 0;
+  int scene_light_index = 0;
+  for (Light *light : scene->lights) {
+    if (light->is_enabled) {
+      const LightTreeEmitter emitter(scene, ~device_light_index, scene_light_index);
+      kemitters[light_to_tree[device_light_index]].energy = emitter.measure.energy;
+      device_light_index++;
+    }
+    scene_light_index++;
+  }
+
+  /* Propagate energies up the tree, including the specialized light linking trees. */
+  const size_t num_nodes = dscene->light_tree_nodes.size();
+  vector<bool> updated(num_nodes, false);
+  for (size_t i = 0; i < num_nodes; i++) {
+    light_tree_node_update_energy(knodes, kemitters, updated, i);
+  }
+
+  VLOG_INFO << "Updated light tree energies of " << device_light_index << " lights.";
+
+  dscene->light_tree_nodes.copy_to_device();
+  dscene->light_tree_emitters.copy_to_device();
 }
 
 static void background_cdf(
@@ -1426,7 +1524,10 @@ void LightManager::device_update(Device *device,
   /* Detect which lights are enabled, also determines if we need to update the background. */
   test_enabled_lights(scene);
 
-  device_free(device, dscene, need_update_background);
+  /* Changing only light strengths keeps the light tree structure, avoid rebuilding it. */
+  const bool update_tree_strength = can_update_tree_strength(dscene, scene);
+
+  device_free(device, dscene, need_update_background, !update_tree_strength);
 
   device_update_lights(dscene, scene);
   if (progress.get_cancel()) {
@@ -1445,7 +1546,12 @@ void LightManager::device_update(Device *device,
     return;
   }
 
-  device_update_tree(device, dscene, scene, progress);
+  if (update_tree_strength) {
+    device_update_tree_strength(dscene, scene);
+  }
+  else {
+    device_update_tree(device, dscene, scene, progress);
+  }
   if (progress.get_cancel()) {
     return;
   }
@@ -1459,14 +1565,20 @@ void LightManager::device_update(Device *device,
   need_update_background = false;
 }
 
-void LightManager::device_free(Device *, DeviceScene *dscene, const bool free_background)
+void LightManager::device_free(Device *,
+                               DeviceScene *dscene,
+                               const bool free_background,
+                               const bool free_light_tree)
 {
-  dscene->light_tree_nodes.free();
-  dscene->light_tree_emitters.free();
-  dscene->light_to_tree.free();
-  dscene->object_to_tree.free();
-  dscene->object_lookup_offset.free();
-  dscene->triangle_to_tree.free();
+  if (free_light_tree) {
+    dscene->light_tree_nodes.free();
+    dscene->light_tree_emitters.free();
+    dscene->light_to_tree.free();
+    dscene->object_to_tree.free();
+    dscene->object_lookup_offset.free();
+    dscene->triangle_to_tree.free();
+    last_light_tree_enabled.clear();
+  }
 
   dscene->light_distribution.free();
   dscene->lights.free();
@@ -79,6 +79,10 @@ class Light : public Node {
 
   void tag_update(Scene *scene);
 
+  /* Check whether the strength is the only modified socket, which keeps the light tree
+   * structure valid. */
+  bool only_strength_is_modified() const;
+
   /* Check whether the light has contribution the scene. */
   bool has_contribution(Scene *scene);
 
@@ -107,6 +111,7 @@ class LightManager {
     OBJECT_MANAGER = (1 << 5),
     SHADER_COMPILED = (1 << 6),
     SHADER_MODIFIED = (1 << 7),
+    LIGHT_STRENGTH_MODIFIED = (1 << 8),
 
     /* tag everything in the manager for an update */
     UPDATE_ALL = ~0u,
@@ -126,7 +131,10 @@ class LightManager {
   void remove_ies(int slot);
 
   void device_update(Device *device, DeviceScene *dscene, Scene *scene, Progress &progress);
-  void device_free(Device *device, DeviceScene *dscene, const bool free_background = true);
+  void device_free(Device *device,
+                   DeviceScene *dscene,
+                   const bool free_background = true,
+                   const bool free_light_tree = true);
 
   void tag_update(Scene *scene, uint32_t flag);
 
@@ -148,6 +156,9 @@ class LightManager {
                                   Scene *scene,
                                   Progress &progress);
   void device_update_tree(Device *device, DeviceScene *dscene, Scene *scene, Progress &progress);
+  /* Update only emitter and node energies of the existing light tree. */
+  bool can_update_tree_strength(DeviceScene *dscene, Scene *scene) const;
+  void device_update_tree_strength(DeviceScene *dscene, Scene *scene);
   void device_update_background(Device *device,
                                 DeviceScene *dscene,
                                 Scene *scene,
@@ -166,6 +177,9 @@ class LightManager {
   bool last_background_enabled;
   int last_background_resolution;
 
+  /* Enabled state of scene lights when the light tree was last built. */
+  vector<bool> last_light_tree_enabled;
+
   uint32_t update_flags;
 };
 
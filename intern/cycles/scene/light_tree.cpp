@@ -265,12 +265,22 @@ bool LightTree::triangle_usable_as_light(Mesh *mesh, int prim_id)
 
 void LightTree::add_mesh(Scene *scene, Mesh *mesh, int object_id)
 {
+  /* Find emissive triangles first, so the emitters can be created in parallel. Creating them
+   * involves computing bounds and orientation of every triangle, which is slow for meshes with
+   * millions of emissive triangles. */
+  vector<int> prim_ids;
   size_t mesh_num_triangles = mesh->num_triangles();
   for (size_t i = 0; i < mesh_num_triangles; i++) {
     if (triangle_usable_as_light(mesh, i)) {
-      emitters_.emplace_back(scene, i, object_id);
+      prim_ids.push_back(i);
     }
   }
+
+  const size_t start = emitters_.size();
+  emitters_.resize(start + prim_ids.size());
+  parallel_for(size_t(0), prim_ids.size(), [&](const size_t i) {
+    emitters_[start + i] = LightTreeEmitter(scene, prim_ids[i], object_id);
+  });
 }
 
 LightTree::LightTree(Scene *scene,
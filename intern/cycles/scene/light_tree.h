@@ -191,6 +191,7 @@ struct LightTreeEmitter {
 
   LightTreeMeasure measure;
 
+  LightTreeEmitter() = default;
   LightTreeEmitter(Object *object, int object_id); /* Mesh emitter. */
   LightTreeEmitter(Scene *scene, int prim_id, int object_id, bool with_transformation = false);
 
@@ -780,6 +780,45 @@ void ShaderGraph::compute_displacement_hash()
   displacement_hash = md5.get_hex();
 }
 
+void ShaderGraph::compute_compile_hash()
+{
+  /* Compute hash of the whole graph, to detect when a shader is synced again with an identical
+   * graph and its compiled nodes can be reused. Nodes which acquire images or other resources
+   * while compiling need to be compiled again, so leave the hash empty for those. */
+  compile_hash = "";
+
+  MD5Hash md5;
+  foreach (ShaderNode *node, nodes) {
+    if (node->special_type == SHADER_SPECIAL_TYPE_OSL ||
+        node->type == SkyTextureNode::get_node_type() ||
+        node->type == IESLightNode::get_node_type() ||
+        node->type == PointDensityTextureNode::get_node_type())
+    {
+      return;
+    }
+
+    node->hash(md5);
+    md5.append((uint8_t *)&node->id, sizeof(node->id));
+    foreach (ShaderInput *input, node->inputs) {
+      int link_id = (input->link) ? input->link->parent->id : 0;
+      md5.append((uint8_t *)&link_id, sizeof(link_id));
+      md5.append((input->link) ? input->link->name().c_str() : "");
+    }
+
+    if (node->special_type == SHADER_SPECIAL_TYPE_IMAGE_SLOT) {
+      /* Compiled nodes refer to image slots. */
+      ImageSlotTextureNode *image_node = static_cast<ImageSlotTextureNode *>(node);
+      if (image_node->handle.empty()) {
+        return;
+      }
+      const vector<int4> slots = image_node->handle.get_svm_slots();
+      md5.append((const uint8_t *)slots.data(), sizeof(int4) * slots.size());
+    }
+  }
+
+  compile_hash = md5.get_hex();
+}
+
 void ShaderGraph::clean(Scene *scene)
 {
   /* Graph simplification */
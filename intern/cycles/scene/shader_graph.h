@@ -298,6 +298,8 @@ class ShaderGraph : public NodeOwner {
   bool finalized;
   bool simplified;
   string displacement_hash;
+  /* Hash of the unoptimized graph, empty if compiled nodes can not be reused. */
+  string compile_hash;
 
   ShaderGraph();
   ~ShaderGraph();
@@ -314,6 +316,7 @@ class ShaderGraph : public NodeOwner {
 
   void remove_proxy_nodes();
   void compute_displacement_hash();
+  void compute_compile_hash();
   void simplify(Scene *scene);
   void finalize(Scene *scene, bool do_bump = false, bool bump_in_object_space = false);
 
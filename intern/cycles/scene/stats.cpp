@@ -198,6 +198,10 @@ string NamedSampleCountStats::full_report(int indent_level)
   return result;
 }
 
+/* Geometry memory statistics. */
+
+GeometryMemoryStats::GeometryMemoryStats(const string &name) : name(name) {}
+
 /* Mesh statistics. */
 
 MeshStats::MeshStats() {}
@@ -207,6 +211,20 @@ string MeshStats::full_report(int indent_level)
   const string indent(indent_level * kIndentNumSpaces, ' ');
   string result = "";
   result += indent + "Geometry:\n" + geometry.full_report(indent_level + 1);
+
+  if (!geometry_memory.empty()) {
+    const string double_indent = indent + string(kIndentNumSpaces, ' ');
+    sort(geometry_memory.begin(),
+         geometry_memory.end(),
+         [](const GeometryMemoryStats &a, const GeometryMemoryStats &b) {
+           return a.data.total_size > b.data.total_size;
+         });
+    result += indent + "Geometry memory breakdown:\n";
+    foreach (GeometryMemoryStats &memory, geometry_memory) {
+      result += double_indent + memory.name + ":\n" + memory.data.full_report(indent_level + 2);
+    }
+  }
+
   return result;
 }
 
@@ -222,6 +240,90 @@ string ImageStats::full_report(int indent_level)
   return result;
 }
 
+/* Adaptive sampling statistics. */
+
+AdaptiveSamplingStats::AdaptiveSamplingStats() : num_wasted_samples(0), num_samples(0) {}
+
+void AdaptiveSamplingStats::collect(const AdaptiveSamplingStatistics &statistics)
+{
+  filters = statistics.filters;
+  num_wasted_samples = 0;
+  num_samples = 0;
+
+  const AdaptiveSamplingStatistics::Filter *prev = nullptr;
+  foreach (const AdaptiveSamplingStatistics::Filter &filter, filters) {
+    if (prev == nullptr || prev->tile != filter.tile) {
+      /* All pixels are rendered until the first filter round of the tile. */
+      num_samples += filter.num_pixels * filter.num_samples;
+    }
+    else {
+      const uint64_t num_step_samples = filter.num_samples - prev->num_samples;
+      num_samples += prev->num_active_pixels * num_step_samples;
+
+      /* Pixels which converged in between of the filter rounds kept on being rendered until
+       * this round, at most for all samples of the step. Pixels might also become active again
+       * when the threshold is lowered, which is not counted as wasted. */
+      if (prev->num_active_pixels > filter.num_active_pixels) {
+        num_wasted_samples += (prev->num_active_pixels - filter.num_active_pixels) *
+                              num_step_samples;
+      }
+    }
+    prev = &filter;
+  }
+}
+
+string AdaptiveSamplingStats::full_report(int indent_level)
+{
+  const string indent(indent_level * kIndentNumSpaces, ' ');
+  string result = "";
+
+  if (filters.empty()) {
+    result += indent + "Adaptive sampling was not used\n";
+    return result;
+  }
+
+  result += indent + string_printf("%-6s %8s %10s %14s %8s %10s\n",
+                                   "Tile",
+                                   "Samples",
+                                   "Threshold",
+                                   "Active pixels",
+                                   "Active",
+                                   "Time");
+  foreach (const AdaptiveSamplingStatistics::Filter &filter, filters) {
+    const double active = filter.num_pixels ?
+                              100.0 * filter.num_active_pixels / filter.num_pixels :
+                              0.0;
+    result += indent + string_printf("%-6d %8d %10.4f %14llu %7.2f%% %9.2fs\n",
+                                     filter.tile,
+                                     filter.num_samples,
+                                     double(filter.threshold),
+                                     (unsigned long long)filter.num_active_pixels,
+                                     active,
+                                     filter.time);
+  }
+
+  /* Time to fully converge each of the tiles, when it did. */
+  for (size_t i = 0; i < filters.size(); i++) {
+    const AdaptiveSamplingStatistics::Filter &filter = filters[i];
+    const bool is_last_of_tile = (i == filters.size() - 1) || (filters[i + 1].tile != filter.tile);
+    if (is_last_of_tile && filter.num_active_pixels == 0) {
+      result += indent + string_printf("Tile %d converged at sample %d after %.2fs\n",
+                                       filter.tile,
+                                       filter.num_samples,
+                                       filter.time);
+    }
+  }
+
+  const double wasted = num_samples ? 100.0 * num_wasted_samples / num_samples : 0.0;
+  result += indent +
+            string_printf("Pixel samples: %llu\n", (unsigned long long)num_samples);
+  result += indent + string_printf("Samples after convergence: at most %llu (%.2f%%)\n",
+                                   (unsigned long long)num_wasted_samples,
+                                   wasted);
+
+  return result;
+}
+
 /* Overall statistics. */
 
 RenderStats::RenderStats()
@@ -287,6 +389,7 @@ string RenderStats::full_report()
   string result = "";
   result += "Mesh statistics:\n" + mesh.full_report(1);
   result += "Image statistics:\n" + image.full_report(1);
+  result += "Adaptive sampling statistics:\n" + adaptive_sampling.full_report(1);
   if (has_profiling) {
     result += "Kernel statistics:\n" + kernel.full_report(1);
     result += "Shader statistics:\n" + shaders.full_report(1);
@@ -7,6 +7,8 @@
 
 #include "scene/scene.h"
 
+#include "integrator/adaptive_sampling.h"
+
 #include "util/stats.h"
 #include "util/string.h"
 #include "util/vector.h"
@@ -135,6 +137,15 @@ class NamedSampleCountStats {
   entry_map entries;
 };
 
+/* Memory used by a single geometry, split by the kind of data. */
+class GeometryMemoryStats {
+ public:
+  explicit GeometryMemoryStats(const string &name);
+
+  string name;
+  NamedSizeStats data;
+};
+
 /* Statistics about mesh in the render database. */
 class MeshStats {
  public:
@@ -148,6 +159,10 @@ class MeshStats {
    * memory like BVH.
    */
   NamedSizeStats geometry;
+
+  /* Memory used by each geometry, split by the kind of data. Unlike the input geometry
+   * statistics this includes attributes, device copies of curves and BVH2 trees. */
+  vector<GeometryMemoryStats> geometry_memory;
 };
 
 /* Statistics about images held in memory. */
@@ -161,6 +176,27 @@ class ImageStats {
   NamedSizeStats textures;
 };
 
+/* Statistics about the convergence of the adaptive sampling. */
+class AdaptiveSamplingStats {
+ public:
+  AdaptiveSamplingStats();
+
+  void collect(const AdaptiveSamplingStatistics &statistics);
+
+  /* Generate full human-readable report. */
+  string full_report(int indent_level = 0);
+
+  /* History of the filter rounds, in the order they were performed. */
+  vector<AdaptiveSamplingStatistics::Filter> filters;
+
+  /* Upper bound of the number of pixel samples which were rendered for pixels which converged
+   * before the filter round which detected the convergence. */
+  uint64_t num_wasted_samples;
+
+  /* Total number of pixel samples rendered, as far as it is known from the filter rounds. */
+  uint64_t num_samples;
+};
+
 /* Render process statistics. */
 class RenderStats {
  public:
@@ -176,6 +212,7 @@ class RenderStats {
 
   MeshStats mesh;
   ImageStats image;
+  AdaptiveSamplingStats adaptive_sampling;
   NamedNestedSampleStats kernel;
   NamedSampleCountStats shaders;
   NamedSampleCountStats objects;
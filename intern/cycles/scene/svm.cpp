@@ -27,7 +27,39 @@ SVMShaderManager::SVMShaderManager() {}
 
 SVMShaderManager::~SVMShaderManager() {}
 
-void SVMShaderManager::reset(Scene * /*scene*/) {}
+void SVMShaderManager::reset(Scene * /*scene*/)
+{
+  compiled_shaders.clear();
+}
+
+bool SVMShaderManager::reuse_compiled_shader(Scene *scene,
+                                             Shader *shader,
+                                             array<int4> &svm_nodes) const
+{
+  auto it = compiled_shaders.find(shader);
+  if (it == compiled_shaders.end()) {
+    return false;
+  }
+
+  const CompiledShader &compiled = it->second;
+  if (compiled.background != (shader == scene->background->get_shader(scene)) ||
+      compiled.displacement_method != shader->get_displacement_method() ||
+      compiled.emission_sampling_method != shader->get_emission_sampling_method())
+  {
+    return false;
+  }
+
+  /* Shader flags and emission estimate from the previous compilation are still valid when
+   * nothing changed, or when the graph is identical. */
+  if (shader->is_modified() &&
+      (compiled.compile_hash.empty() || compiled.compile_hash != shader->graph->compile_hash))
+  {
+    return false;
+  }
+
+  svm_nodes = compiled.svm_nodes;
+  return true;
+}
 
 void SVMShaderManager::device_update_shader(Scene *scene,
                                             Shader *shader,
@@ -76,7 +108,12 @@ void SVMShaderManager::device_update_specific(Device *device,
   /* Build all shaders. */
   TaskPool task_pool;
   vector<array<int4>> shader_svm_nodes(num_shaders);
+  int num_reused_shaders = 0;
   for (int i = 0; i < num_shaders; i++) {
+    if (reuse_compiled_shader(scene, scene->shaders[i], shader_svm_nodes[i])) {
+      num_reused_shaders++;
+      continue;
+    }
     task_pool.push(function_bind(&SVMShaderManager::device_update_shader,
                                  this,
                                  scene,
@@ -123,14 +160,25 @@ void SVMShaderManager::device_update_specific(Device *device,
     node_offset += shader_svm_nodes[i].size() - 1;
   }
 
-  /* Copy the nodes of each shader into the correct location. */
+  /* Copy the nodes of each shader into the correct location, and keep them for reuse in the
+   * next update. */
   svm_nodes += num_shaders;
+  map<const Shader *, CompiledShader> new_compiled_shaders;
   for (int i = 0; i < num_shaders; i++) {
     int shader_size = shader_svm_nodes[i].size() - 1;
 
     memcpy(svm_nodes, &shader_svm_nodes[i][1], sizeof(int4) * shader_size);
     svm_nodes += shader_size;
+
+    Shader *shader = scene->shaders[i];
+    CompiledShader &compiled = new_compiled_shaders[shader];
+    compiled.compile_hash = shader->graph->compile_hash;
+    compiled.background = (shader == scene->background->get_shader(scene));
+    compiled.displacement_method = shader->get_displacement_method();
+    compiled.emission_sampling_method = shader->get_emission_sampling_method();
+    compiled.svm_nodes.steal_data(shader_svm_nodes[i]);
   }
+  compiled_shaders.swap(new_compiled_shaders);
 
   if (progress.get_cancel()) {
     return;
@@ -143,7 +191,7 @@ void SVMShaderManager::device_update_specific(Device *device,
   update_flags = UPDATE_NONE;
 
   VLOG_INFO << "Shader manager updated " << num_shaders << " shaders in " << time_dt() - start_time
-            << " seconds.";
+            << " seconds, reused " << num_reused_shaders << " compiled shaders.";
 }
 
 void SVMShaderManager::device_free(Device *device, DeviceScene *dscene, Scene *scene)
@@ -10,6 +10,7 @@
 #include "scene/shader_graph.h"
 
 #include "util/array.h"
+#include "util/map.h"
 #include "util/set.h"
 #include "util/string.h"
 #include "util/thread.h"
@@ -45,6 +46,19 @@ class SVMShaderManager : public ShaderManager {
                             Shader *shader,
                             Progress *progress,
                             array<int4> *svm_nodes);
+
+  /* Compiled nodes of shaders from the previous update, to avoid compiling shaders again which
+   * did not change or were synced with an identical graph. */
+  struct CompiledShader {
+    string compile_hash;
+    bool background;
+    DisplacementMethod displacement_method;
+    EmissionSampling emission_sampling_method;
+    array<int4> svm_nodes;
+  };
+  map<const Shader *, CompiledShader> compiled_shaders;
+
+  bool reuse_compiled_shader(Scene *scene, Shader *shader, array<int4> &svm_nodes) const;
 };
 
 /* Graph Compiler */
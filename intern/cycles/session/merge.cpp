@@ -6,6 +6,7 @@
 
 #include "util/array.h"
 #include "util/map.h"
+#include "util/math.h"
 #include "util/system.h"
 #include "util/time.h"
 #include "util/unique_ptr.h"
@@ -382,35 +383,78 @@ static void merge_channels_metadata(vector<MergeImage> &images, ImageSpec &out_s
   }
 }
 
-static void alloc_pixels(const ImageSpec &spec, array<float> &pixels)
+/* Pixels are merged in chunks of rows, so that memory usage stays bounded for large images
+ * with many passes. This is the approximate size of all buffers of a chunk. */
+static const size_t MERGE_CHUNK_SIZE = 256 * 1024 * 1024;
+
+static int merge_chunk_num_rows(const vector<MergeImage> &images, const ImageSpec &out_spec)
 {
-  const size_t width = spec.width;
-  const size_t height = spec.height;
-  const size_t num_channels = spec.nchannels;
+  size_t num_channels = out_spec.nchannels;
+  for (const MergeImage &image : images) {
+    num_channels += image.in->spec().nchannels;
+  }
+
+  const size_t row_size = size_t(out_spec.width) * num_channels * sizeof(float);
+  int num_rows = (row_size > 0) ? max(int(MERGE_CHUNK_SIZE / row_size), 1) : 1;
 
-  const size_t num_pixels = width * height;
-  pixels.resize(num_pixels * num_channels);
+  /* Tiled output is written in whole rows of tiles. */
+  if (out_spec.tile_height > 0) {
+    num_rows = int(divide_up(num_rows, out_spec.tile_height)) * out_spec.tile_height;
+  }
+
+  return min(num_rows, out_spec.height);
 }
 
-static bool merge_pixels(const vector<MergeImage> &images,
-                         const ImageSpec &out_spec,
-                         const unordered_map<string, SampleCount> &layer_samples,
-                         array<float> &out_pixels,
-                         string &error)
+static bool read_pixels(const vector<MergeImage> &images,
+                        const int y_begin,
+                        const int y_end,
+                        vector<array<float>> &images_pixels,
+                        string &error)
 {
-  alloc_pixels(out_spec, out_pixels);
-  memset(out_pixels.data(), 0, out_pixels.size() * sizeof(float));
+  images_pixels.resize(images.size());
+
+  for (size_t i = 0; i < images.size(); i++) {
+    const MergeImage &image = images[i];
+    const ImageSpec &spec = image.in->spec();
+    const int num_channels = spec.nchannels;
 
-  for (const MergeImage &image : images) {
     /* Read all channels into buffer. Reading all channels at once is
      * faster than individually due to interleaved EXR channel storage. */
-    array<float> pixels;
-    alloc_pixels(image.in->spec(), pixels);
-    const int num_channels = image.in->spec().nchannels;
-    if (!image.in->read_image(0, 0, 0, num_channels, TypeDesc::FLOAT, pixels.data())) {
+    array<float> &pixels = images_pixels[i];
+    pixels.resize(size_t(spec.width) * (y_end - y_begin) * num_channels);
+
+    if (!image.in->read_scanlines(0,
+                                  0,
+                                  spec.y + y_begin,
+                                  spec.y + y_end,
+                                  0,
+                                  0,
+                                  num_channels,
+                                  TypeDesc::FLOAT,
+                                  pixels.data()))
+    {
       error = "Failed to read image: " + image.filepath;
       return false;
     }
+  }
+
+  return true;
+}
+
+static void merge_pixels(const vector<MergeImage> &images,
+                         const vector<array<float>> &images_pixels,
+                         const ImageSpec &out_spec,
+                         const unordered_map<string, SampleCount> &layer_samples,
+                         array<float> &out_pixels)
+{
+  const size_t num_rows = images_pixels[0].size() / images[0].in->spec().nchannels /
+                          images[0].in->spec().width;
+  out_pixels.resize(size_t(out_spec.width) * num_rows * out_spec.nchannels);
+  memset(out_pixels.data(), 0, out_pixels.size() * sizeof(float));
+
+  for (size_t image_index = 0; image_index < images.size(); image_index++) {
+    const MergeImage &image = images[image_index];
+    const array<float> &pixels = images_pixels[image_index];
 
     for (const MergeImageLayer &layer : image.layers) {
       const size_t stride = image.in->spec().nchannels;
@@ -470,14 +514,76 @@ static bool merge_pixels(const vector<MergeImage> &images,
       }
     }
   }
+}
 
-  return true;
+static void read_layer_samples(const vector<MergeImage> &images,
+                               const vector<array<float>> &images_pixels,
+                               unordered_map<string, SampleCount> &layer_samples)
+{
+  /* Sample counts are computed for the current chunk of rows only. */
+  for (auto &it : layer_samples) {
+    it.second.total = 0;
+    it.second.per_pixel.clear();
+  }
+
+  for (size_t image_index = 0; image_index < images.size(); image_index++) {
+    const MergeImage &image = images[image_index];
+    const array<float> &pixels = images_pixels[image_index];
+    const size_t stride = image.in->spec().nchannels;
+    const size_t num_pixels = pixels.size() / stride;
+
+    for (auto &layer : image.layers) {
+      auto &current_layer_samples = layer_samples[layer.name];
+
+      if (current_layer_samples.per_pixel.size() != num_pixels) {
+        current_layer_samples.per_pixel.resize(num_pixels);
+        std::fill(
+            current_layer_samples.per_pixel.begin(), current_layer_samples.per_pixel.end(), 0.0f);
+      }
+
+      if (layer.has_sample_pass) {
+        /* Add the samples from the "Debug Sample Count" pass to the layer's sample count. */
+        size_t offset = layer.sample_pass_offset;
+        for (size_t i = 0; i < num_pixels; i++, offset += stride) {
+          current_layer_samples.per_pixel[i] += pixels[offset] * layer.samples;
+        }
+      }
+      else {
+        /* Use sample count from metadata if there's no "Debug Sample Count" pass. */
+        for (size_t i = 0; i < num_pixels; i++) {
+          current_layer_samples.per_pixel[i] += layer.samples;
+        }
+      }
+
+      current_layer_samples.total += layer.samples;
+    }
+  }
 }
 
-static bool save_output(const string &filepath,
-                        const ImageSpec &spec,
-                        const array<float> &pixels,
-                        string &error)
+static bool write_pixels(ImageOutput *out,
+                         const ImageSpec &spec,
+                         const int y_begin,
+                         const int y_end,
+                         const array<float> &pixels)
+{
+  if (spec.tile_width > 0) {
+    return out->write_tiles(spec.x,
+                            spec.x + spec.width,
+                            spec.y + y_begin,
+                            spec.y + y_end,
+                            0,
+                            1,
+                            TypeDesc::FLOAT,
+                            pixels.data());
+  }
+
+  return out->write_scanlines(spec.y + y_begin, spec.y + y_end, 0, TypeDesc::FLOAT, pixels.data());
+}
+
+static bool merge_and_save_output(const string &filepath,
+                                  vector<MergeImage> &images,
+                                  const ImageSpec &spec,
+                                  string &error)
 {
   /* Write to temporary file path, so we merge images in place and don't
    * risk destroying files when something goes wrong in file saving. */
@@ -497,19 +603,47 @@ static bool save_output(const string &filepath,
     return false;
   }
 
+  /* Merge pixels, chunk by chunk. */
+  const int num_rows = merge_chunk_num_rows(images, spec);
+
+  vector<array<float>> images_pixels;
+  unordered_map<string, SampleCount> layer_samples;
+  array<float> out_pixels;
+
   bool ok = true;
-  if (!out->write_image(TypeDesc::FLOAT, pixels.data())) {
-    error = "Failed to write to file " + tmp_filepath + ": " + out->geterror();
-    ok = false;
+  for (int y_begin = 0; y_begin < spec.height; y_begin += num_rows) {
+    const int y_end = min(y_begin + num_rows, spec.height);
+
+    if (!read_pixels(images, y_begin, y_end, images_pixels, error)) {
+      ok = false;
+      break;
+    }
+
+    /* Load and sum sample count for each render layer. */
+    read_layer_samples(images, images_pixels, layer_samples);
+
+    merge_pixels(images, images_pixels, spec, layer_samples, out_pixels);
+
+    if (!write_pixels(out.get(), spec, y_begin, y_end, out_pixels)) {
+      error = "Failed to write to file " + tmp_filepath + ": " + out->geterror();
+      ok = false;
+      break;
+    }
   }
 
   if (!out->close()) {
-    error = "Failed to save to file " + tmp_filepath + ": " + out->geterror();
+    if (ok) {
+      error = "Failed to save to file " + tmp_filepath + ": " + out->geterror();
+    }
     ok = false;
   }
 
   out.reset();
 
+  /* We don't need input anymore at this point, and will possibly
+   * overwrite the same file. */
+  images.clear();
+
   /* Copy temporary file to output filepath. */
   string rename_error;
   if (ok && !OIIO::Filesystem::rename(tmp_filepath, filepath, rename_error)) {
@@ -524,50 +658,6 @@ static bool save_output(const string &filepath,
   return ok;
 }
 
-static void read_layer_samples(vector<MergeImage> &images,
-                               unordered_map<string, SampleCount> &layer_samples)
-{
-  for (auto &image : images) {
-    const ImageSpec &in_spec = image.in->spec();
-
-    for (auto &layer : image.layers) {
-      bool initialize = (layer_samples.count(layer.name) == 0);
-      auto &current_layer_samples = layer_samples[layer.name];
-
-      if (initialize) {
-        current_layer_samples.total = 0;
-        current_layer_samples.per_pixel.resize(in_spec.width * in_spec.height);
-        std::fill(
-            current_layer_samples.per_pixel.begin(), current_layer_samples.per_pixel.end(), 0.0f);
-      }
-
-      if (layer.has_sample_pass) {
-        /* Load the "Debug Sample Count" pass and add the samples to the layer's sample count. */
-        array<float> sample_count_buffer;
-        sample_count_buffer.resize(in_spec.width * in_spec.height);
-
-        image.in->read_image(0,
-                             0,
-                             layer.sample_pass_offset,
-                             layer.sample_pass_offset,
-                             TypeDesc::FLOAT,
-                             (void *)sample_count_buffer.data());
-
-        for (size_t i = 0; i < current_layer_samples.per_pixel.size(); i++) {
-          current_layer_samples.per_pixel[i] += sample_count_buffer[i] * layer.samples;
-        }
-      }
-      else {
-        /* Use sample count from metadata if there's no "Debug Sample Count" pass. */
-        for (size_t i = 0; i < current_layer_samples.per_pixel.size(); i++) {
-          current_layer_samples.per_pixel[i] += layer.samples;
-        }
-      }
-
-      current_layer_samples.total += layer.samples;
-    }
-  }
-}
 /* Image Merger */
 
 ImageMerger::ImageMerger() {}
@@ -589,26 +679,12 @@ bool ImageMerger::run()
     return false;
   }
 
-  /* Load and sum sample count for each render layer. */
-  unordered_map<string, SampleCount> layer_samples;
-  read_layer_samples(images, layer_samples);
-
   /* Merge metadata and setup channels and offsets. */
   ImageSpec out_spec;
   merge_channels_metadata(images, out_spec);
 
-  /* Merge pixels. */
-  array<float> out_pixels;
-  if (!merge_pixels(images, out_spec, layer_samples, out_pixels, error)) {
-    return false;
-  }
-
-  /* We don't need input anymore at this point, and will possibly
-   * overwrite the same file. */
-  images.clear();
-
-  /* Save output file. */
-  return save_output(output, out_spec, out_pixels, error);
+  /* Merge pixels and save output file. */
+  return merge_and_save_output(output, images, out_spec, error);
 }
 
 CCL_NAMESPACE_END
@@ -756,11 +756,17 @@ void Session::device_free()
 void Session::collect_statistics(RenderStats *render_stats)
 {
   scene->collect_statistics(render_stats);
+  render_stats->adaptive_sampling.collect(path_trace_->get_adaptive_sampling_statistics());
   if (params.use_profiling && (params.device.type == DEVICE_CPU)) {
     render_stats->collect_profiling(scene, profiler);
   }
 }
 
+const WorkBalanceStatistics &Session::get_work_balance_statistics() const
+{
+  return path_trace_->get_work_balance_statistics();
+}
+
 /* --------------------------------------------------------------------
  * Full-frame on-disk storage.
  */
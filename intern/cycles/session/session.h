@@ -30,6 +30,7 @@ class Progress;
 class RenderBuffers;
 class Scene;
 class SceneParams;
+struct WorkBalanceStatistics;
 
 /* Session Parameters */
 
@@ -154,6 +155,9 @@ class Session {
 
   void collect_statistics(RenderStats *stats);
 
+  /* Statistics about how the work of the current render is balanced between devices. */
+  const WorkBalanceStatistics &get_work_balance_statistics() const;
+
   /* --------------------------------------------------------------------
    * Full-frame on-disk storage.
    */
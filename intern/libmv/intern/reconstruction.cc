@@ -99,13 +99,18 @@ void libmv_solveRefineIntrinsics(
 
 #undef SET_DISTORTION_FLAG_CHECKED
 
-  progress_update_callback(callback_customdata, 1.0, "Refining solution");
+  ReconstructUpdateCallback update_callback =
+      ReconstructUpdateCallback(progress_update_callback, callback_customdata);
+
+  update_callback.invoke(0, "Refining solution");
 
   EuclideanBundleCommonIntrinsics(tracks,
                                   bundle_intrinsics,
                                   bundle_constraints,
                                   reconstruction,
-                                  intrinsics);
+                                  intrinsics,
+                                  NULL,
+                                  &update_callback);
 }
 
 void finishReconstruction(
@@ -31,6 +31,7 @@
 #include "libmv/multiview/fundamental.h"
 #include "libmv/multiview/projection.h"
 #include "libmv/numeric/numeric.h"
+#include "libmv/simple_pipeline/callbacks.h"
 #include "libmv/simple_pipeline/camera_intrinsics.h"
 #include "libmv/simple_pipeline/distortion_models.h"
 #include "libmv/simple_pipeline/packed_intrinsics.h"
@@ -645,6 +646,27 @@ void EuclideanBundlePointsOnly(const CameraIntrinsics* invariant_intrinsics,
   LG << "Final report:\n" << summary.FullReport();
 }
 
+// Forwards the minimizer iterations to the progress update callback.
+class BundleIterationCallback : public ceres::IterationCallback {
+ public:
+  BundleIterationCallback(ProgressUpdateCallback* update_callback,
+                          int max_num_iterations)
+      : update_callback_(update_callback),
+        max_num_iterations_(max_num_iterations) {}
+
+  ceres::CallbackReturnType operator()(
+      const ceres::IterationSummary& summary) override {
+    update_callback_->invoke(
+        double(summary.iteration) / double(max_num_iterations_),
+        "Bundling...");
+    return ceres::SOLVER_CONTINUE;
+  }
+
+ private:
+  ProgressUpdateCallback* update_callback_;
+  int max_num_iterations_;
+};
+
 }  // namespace
 
 void EuclideanBundle(const Tracks& tracks,
@@ -663,7 +685,8 @@ void EuclideanBundleCommonIntrinsics(const Tracks& tracks,
                                      const int bundle_constraints,
                                      EuclideanReconstruction* reconstruction,
                                      CameraIntrinsics* intrinsics,
-                                     BundleEvaluation* evaluation) {
+                                     BundleEvaluation* evaluation,
+                                     ProgressUpdateCallback* update_callback) {
   LG << "Original intrinsics: " << *intrinsics;
   vector<Marker> markers = tracks.AllMarkers();
 
@@ -804,6 +827,12 @@ void EuclideanBundleCommonIntrinsics(const Tracks& tracks,
   options.max_num_iterations = 100;
   options.num_threads = std::thread::hardware_concurrency();
 
+  BundleIterationCallback iteration_callback(update_callback,
+                                             options.max_num_iterations);
+  if (update_callback) {
+    options.callbacks.push_back(&iteration_callback);
+  }
+
   // Solve!
   ceres::Solver::Summary summary;
   ceres::Solve(options, &problem, &summary);
@@ -27,6 +27,7 @@ namespace libmv {
 
 class CameraIntrinsics;
 class EuclideanReconstruction;
+class ProgressUpdateCallback;
 class ProjectiveReconstruction;
 class Tracks;
 
@@ -92,6 +93,9 @@ void EuclideanBundle(const Tracks& tracks,
     there, plus all the requested additional information (like jacobian) is
     also calculating there. Also see comments for BundleEvaluation.
 
+    If update_callback is not null, it is invoked after every iteration of
+    the minimizer to report the progress of the bundling.
+
     \note This assumes an outlier-free set of markers.
 
     \sa EuclideanResect, EuclideanIntersect, EuclideanReconstructTwoFrames
@@ -122,7 +126,9 @@ void EuclideanBundleCommonIntrinsics(const Tracks& tracks,
                                      const int bundle_constraints,
                                      EuclideanReconstruction* reconstruction,
                                      CameraIntrinsics* intrinsics,
-                                     BundleEvaluation* evaluation = NULL);
+                                     BundleEvaluation* evaluation = NULL,
+                                     ProgressUpdateCallback* update_callback =
+                                         NULL);
 
 /*!
     Refine camera poses and 3D coordinates using bundle adjustment.
@@ -25,6 +25,7 @@ bool manta_ensure_outflow(struct MANTA *fluid, struct FluidModifierData *fmd);
 bool manta_write_config(struct MANTA *fluid, struct FluidModifierData *fmd, int framenr);
 bool manta_write_data(struct MANTA *fluid, struct FluidModifierData *fmd, int framenr);
 bool manta_write_noise(struct MANTA *fluid, struct FluidModifierData *fmd, int framenr);
+void manta_wait_for_cache_writers(void);
 bool manta_read_config(struct MANTA *fluid, struct FluidModifierData *fmd, int framenr);
 bool manta_read_data(struct MANTA *fluid,
                      struct FluidModifierData *fmd,
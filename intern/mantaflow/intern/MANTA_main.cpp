@@ -701,6 +701,18 @@ bool MANTA::runPythonString(vector<string> commands)
   return success;
 }
 
+void MANTA::waitForCacheWriters()
+{
+  /* Nothing can be written before any domain was initialized. */
+  if (manta_main_module == nullptr) {
+    return;
+  }
+  vector<string> pythonCommands;
+  pythonCommands.push_back(
+      "if 'fluid_cache_wait_writers' in globals(): fluid_cache_wait_writers()");
+  runPythonString(pythonCommands);
+}
+
 void MANTA::initializeMantaflow()
 {
   if (with_debug) {
@@ -869,6 +881,7 @@ void MANTA::initializeRNAMap(FluidModifierData *fmd)
   mRNAMap["USING_DISSOLVE"] = getBooleanString(fds->flags & FLUID_DOMAIN_USE_DISSOLVE);
   mRNAMap["DOMAIN_CLOSED"] = getBooleanString(borderCollisions.compare("") == 0);
   mRNAMap["CACHE_RESUMABLE"] = getBooleanString(fds->flags & FLUID_DOMAIN_USE_RESUMABLE_CACHE);
+  mRNAMap["USING_ASYNC_SAVE"] = getBooleanString(fds->flags & FLUID_DOMAIN_USE_ASYNC_CACHE_WRITE);
   mRNAMap["USING_ADAPTIVETIME"] = getBooleanString(fds->flags & FLUID_DOMAIN_USE_ADAPTIVE_TIME);
   mRNAMap["USING_SPEEDVECTORS"] = getBooleanString(fds->flags & FLUID_DOMAIN_USE_SPEED_VECTORS);
   mRNAMap["USING_FRACTIONS"] = getBooleanString(fds->flags & FLUID_DOMAIN_USE_FRACTIONS);
@@ -71,6 +71,9 @@ struct MANTA {
   bool writeNoise(FluidModifierData *fmd, int framenr);
   /* Write calls for mesh and particles were left in bake calls for now. */
 
+  /* Wait until cache files that are written in the background of all domains are complete. */
+  static void waitForCacheWriters();
+
   /* Read cache (via Python). */
   bool readConfiguration(FluidModifierData *fmd, int framenr);
   bool readData(FluidModifierData *fmd, int framenr, bool resumable);
@@ -861,7 +864,7 @@ struct MANTA {
   bool initSmokeNoise(struct FluidModifierData *doRnaRefresh = nullptr);
   void initializeMantaflow();
   void terminateMantaflow();
-  bool runPythonString(vector<string> commands);
+  static bool runPythonString(vector<string> commands);
   string getRealValue(const string &varName);
   string parseLine(const string &line);
   string parseScript(const string &setup_string, FluidModifierData *fmd = nullptr);
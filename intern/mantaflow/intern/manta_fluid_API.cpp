@@ -53,6 +53,11 @@ bool manta_write_noise(MANTA *fluid, FluidModifierData *fmd, int framenr)
   return fluid->writeNoise(fmd, framenr);
 }
 
+void manta_wait_for_cache_writers()
+{
+  MANTA::waitForCacheWriters();
+}
+
 bool manta_read_config(MANTA *fluid, FluidModifierData *fmd, int framenr)
 {
   return fluid->readConfiguration(fmd, framenr);
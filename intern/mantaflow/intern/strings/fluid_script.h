@@ -19,7 +19,6 @@ from math import inf\n\
 import os.path, shutil, math, sys, gc, multiprocessing, platform, time\n\
 \n\
 withMPBake = False # Bake files asynchronously\n\
-withMPSave = False # Save files asynchronously\n\
 isWindows = platform.system() != 'Darwin' and platform.system() != 'Linux'\n\
 # TODO(sebbas): Use this to simulate Windows multiprocessing (has default mode spawn)\n\
 #try:\n\
@@ -147,6 +146,10 @@ mantaMsg('scaleSpeed is ' + str(scaleSpeedFrames_s$ID$))\n\
 \n\
 gravity_s$ID$ *= scaleAcceleration_s$ID$ # scale from world acceleration to cell based acceleration\n\
 \n\
+# Save cache files asynchronously in forked processes (not supported on Windows)\n\
+asyncSave_s$ID$ = $USING_ASYNC_SAVE$ and not isWindows\n\
+maxCacheWriters_s$ID$ = 2\n\
+\n\
 # OpenVDB options\n\
 vdbCompression_s$ID$ = $COMPRESSION_OPENVDB$\n\
 vdbPrecision_s$ID$ = $PRECISION_OPENVDB$\n\
@@ -474,7 +477,15 @@ gc.collect()\n";
 const std::string fluid_cache_helper =
     "\n\
 def fluid_cache_get_framenr_formatted_$ID$(framenr):\n\
-    return str(framenr).zfill(4) if framenr >= 0 else str(framenr).zfill(5)\n";
+    return str(framenr).zfill(4) if framenr >= 0 else str(framenr).zfill(5)\n\
+\n\
+# Processes that are still writing cache files, shared by all domains.\n\
+if 'fluid_cache_writers' not in globals():\n\
+    fluid_cache_writers = []\n\
+\n\
+def fluid_cache_wait_writers(max_pending=0):\n\
+    while len(fluid_cache_writers) > max_pending:\n\
+        fluid_cache_writers.pop(0).join()\n";
 
 const std::string fluid_bake_multiprocessing =
     "\n\
@@ -631,6 +642,7 @@ const std::string fluid_file_import =
     "\n\
 def fluid_file_import_s$ID$(dict, path, framenr, file_format, file_name=None):\n\
     mantaMsg('Fluid file import, frame: ' + str(framenr))\n\
+    fluid_cache_wait_writers()\n\
     try:\n\
         framenr = fluid_cache_get_framenr_formatted_$ID$(framenr)\n\
         # New cache: Try to load the data from a single file\n\
@@ -711,17 +723,25 @@ def fluid_file_export_s$ID$(framenr, file_format, path, dict, file_name=None, mo
     \n\
     except Exception as e:\n\
         mantaMsg('Exception in Python fluid file export: ' + str(e))\n\
-        pass # Just skip file save errors for now\n";
+        pass # Just skip file save errors for now\n\
+\n\
+# The forked process gets a copy-on-write snapshot of the grids, so the simulation can continue\n\
+# while the files are written. Only a few writers are kept alive to bound the memory usage.\n\
+def fluid_cache_save_s$ID$(**kwargs):\n\
+    if not asyncSave_s$ID$:\n\
+        fluid_file_export_s$ID$(**kwargs)\n\
+        return\n\
+    fluid_cache_wait_writers(max_pending=maxCacheWriters_s$ID$ - 1)\n\
+    process = multiprocessing.get_context('fork').Process(target=fluid_file_export_s$ID$, kwargs=kwargs)\n\
+    process.start()\n\
+    fluid_cache_writers.append(process)\n";
 
 const std::string fluid_save_guiding =
     "\n\
 def fluid_save_guiding_$ID$(path, framenr, file_format, resumable):\n\
     mantaMsg('Fluid save guiding, frame ' + str(framenr))\n\
     dict = fluid_guiding_dict_s$ID$\n\
-    if not withMPSave or isWindows:\n\
-        fluid_file_export_s$ID$(dict=dict, framenr=framenr, file_format=file_format, path=path, file_name=file_guiding_s$ID$)\n\
-    else:\n\
-        fluid_cache_multiprocessing_start_$ID$(function=fluid_file_export_s$ID$, file_name=file_guiding_s$ID$, framenr=framenr, format_data=file_format, path_data=path, dict=dict, do_join=False)\n";
+    fluid_cache_save_s$ID$(dict=dict, framenr=framenr, file_format=file_format, path=path, file_name=file_guiding_s$ID$)\n";
 
 //////////////////////////////////////////////////////////////////////
 // STANDALONE MODE
@@ -9,13 +9,23 @@
 
 #include "internal/evaluator/eval_output.h"
 
-#include <opensubdiv/osd/cpuEvaluator.h>
 #include <opensubdiv/osd/cpuPatchTable.h>
 #include <opensubdiv/osd/cpuVertexBuffer.h>
+#ifdef OPENSUBDIV_HAS_TBB
+#  include <opensubdiv/osd/tbbEvaluator.h>
+#else
+#  include <opensubdiv/osd/cpuEvaluator.h>
+#endif
 
 using OpenSubdiv::Far::StencilTable;
-using OpenSubdiv::Osd::CpuEvaluator;
 using OpenSubdiv::Osd::CpuVertexBuffer;
+#ifdef OPENSUBDIV_HAS_TBB
+// Applies the stencils and evaluates the patches multi-threaded. It works on the same CPU buffers
+// and tables as OpenSubdiv::Osd::CpuEvaluator.
+using CpuEvaluator = OpenSubdiv::Osd::TbbEvaluator;
+#else
+using OpenSubdiv::Osd::CpuEvaluator;
+#endif
 
 namespace blender::opensubdiv {
 
@@ -38,8 +38,16 @@ def _initialize_once():
 
     _initialize_extensions_repos_once()
 
-    for addon in _preferences.addons:
-        enable(addon.module)
+    # Report the time taken by each add-on, to find the ones slowing down startup.
+    if _bpy.app.debug_python:
+        import time
+        for addon in _preferences.addons:
+            t_start = time.time()
+            enable(addon.module)
+            print("Add-on {!r} enabled in {:.4f}".format(addon.module, time.time() - t_start))
+    else:
+        for addon in _preferences.addons:
+            enable(addon.module)
 
     _initialize_ensure_extensions_addon()
 
@@ -8,6 +8,7 @@ not associated with blenders internal data.
 """
 
 __all__ = (
+    "batch_update",
     "blend_paths",
     "escape_identifier",
     "flip_name",
@@ -47,6 +48,8 @@ __all__ = (
 )
 
 from _bpy import (
+    _rna_update_batch_begin,
+    _rna_update_batch_end,
     _utils_units as units,
     blend_paths,
     escape_identifier,
@@ -889,6 +892,30 @@ def extension_path_user(package, *, path="", create=False):
     return target_path
 
 
+class batch_update:
+    """
+    Context manager which defers the dependency graph updates and notifiers
+    of data-block properties set within it, sending them once for each data-block
+    when the block ends. This speeds up setting properties on many data-blocks.
+
+    Update functions of properties still run immediately.
+
+    .. code-block:: python
+
+       with bpy.utils.batch_update():
+           for ob in bpy.data.objects:
+               ob.hide_render = True
+    """
+    __slots__ = ()
+
+    def __enter__(self):
+        _rna_update_batch_begin()
+        return self
+
+    def __exit__(self, _type, _value, _traceback):
+        _rna_update_batch_end()
+
+
 def register_classes_factory(classes):
     """
     Utility function to create register and unregister functions
@@ -91,13 +91,14 @@ void AssetCatalogTree::insert_item(const AssetCatalog &catalog)
   const CatalogID nil_id{};
 
   catalog.path.iterate_components([&](StringRef component_name, const bool is_last_component) {
-    /* Insert new tree element - if no matching one is there yet! */
-    auto [key_and_item, was_inserted] = current_item_children->emplace(
+    /* Insert new tree element - if no matching one is there yet! Only construct the item when
+     * it's actually inserted, most components of a path exist already. */
+    auto [key_and_item, was_inserted] = current_item_children->try_emplace(
         component_name,
-        AssetCatalogTreeItem(component_name,
-                             is_last_component ? catalog.catalog_id : nil_id,
-                             is_last_component ? catalog.simple_name : "",
-                             parent));
+        component_name,
+        is_last_component ? catalog.catalog_id : nil_id,
+        is_last_component ? catalog.simple_name : "",
+        parent);
     AssetCatalogTreeItem &item = key_and_item->second;
 
     /* If full path of this catalog already exists as parent path of a previously read catalog,
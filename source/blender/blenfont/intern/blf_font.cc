@@ -228,7 +228,6 @@ void blf_batch_draw_begin(FontBLF *font)
     blf_batch_draw_init();
   }
 
-  const bool font_changed = (g_batch.font != font);
   const bool simple_shader = ((font->flags & (BLF_ROTATION | BLF_ASPECT)) == 0);
   const bool shader_changed = (simple_shader != g_batch.simple_shader);
 
@@ -257,11 +256,12 @@ void blf_batch_draw_begin(FontBLF *font)
       GPU_matrix_set(g_batch.mat);
     }
 
-    /* Flush cache if configuration is not the same. */
-    if (mat_changed || font_changed || shader_changed) {
+    /* Flush cache if configuration is not the same.
+     * Switching fonts alone doesn't need a flush: the offset and color are stored per glyph and
+     * #blf_glyph_draw flushes when the glyph cache (and so the texture) changes. */
+    if (mat_changed || shader_changed) {
       blf_batch_draw();
       g_batch.simple_shader = simple_shader;
-      g_batch.font = font;
     }
     else {
       /* Nothing changed continue batching. */
@@ -277,7 +277,6 @@ void blf_batch_draw_begin(FontBLF *font)
   else {
     /* Flush cache. */
     blf_batch_draw();
-    g_batch.font = font;
     g_batch.simple_shader = simple_shader;
   }
 }
@@ -151,6 +151,11 @@ void blf_glyph_cache_release(FontBLF *font)
 
 GlyphCacheBLF::~GlyphCacheBLF()
 {
+  /* Batching continues across fonts, draw pending glyphs that use this texture. */
+  if (g_batch.glyph_cache == this) {
+    blf_batch_draw();
+    g_batch.glyph_cache = nullptr;
+  }
   this->glyphs.clear_and_shrink();
   if (this->texture) {
     GPU_texture_free(this->texture);
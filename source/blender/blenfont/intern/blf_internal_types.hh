@@ -86,7 +86,7 @@ inline ft_pix ft_pix_from_float(float v)
 
 /** \} */
 
-#define BLF_BATCH_DRAW_LEN_MAX 2048 /* in glyph */
+#define BLF_BATCH_DRAW_LEN_MAX 8192 /* in glyph */
 
 /** Number of characters in #KerningCacheBLF.table. */
 #define KERNING_CACHE_TABLE_SIZE 128
@@ -95,8 +95,6 @@ inline ft_pix ft_pix_from_float(float v)
 #define KERNING_ENTRY_UNSET INT_MAX
 
 struct BatchBLF {
-  /** Can only batch glyph from the same font. */
-  FontBLF *font;
   blender::gpu::Batch *batch;
   blender::gpu::VertBuf *verts;
   GPUVertBufRaw pos_step, col_step, offset_step, glyph_size_step, glyph_flags_step;
@@ -107,6 +105,7 @@ struct BatchBLF {
   /* Previous call `modelmatrix`. */
   float mat[4][4];
   bool enabled, active, simple_shader;
+  /** Can only batch glyphs from the same glyph cache, since they share a texture. */
   GlyphCacheBLF *glyph_cache;
 };
 
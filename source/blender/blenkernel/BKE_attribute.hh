@@ -901,6 +901,41 @@ inline const AnonymousAttributeID &AttributeIDRef::anonymous_id() const
   return *anonymous_id_;
 }
 
+/**
+ * Add the source attribute to the destination geometry by adding a user to its implicitly shared
+ * array instead of copying it. This is only possible when the source is stored as a shared array
+ * of the given type and has as many elements as the destination domain. A domain mapping other
+ * than the identity has to be handled by the caller.
+ *
+ * \return False if the data could not be shared, in which case it has to be copied instead.
+ */
+bool try_share_attribute(const GAttributeReader &src,
+                         const AttributeIDRef &id,
+                         AttrDomain dst_domain,
+                         eCustomDataType data_type,
+                         MutableAttributeAccessor dst_attributes);
+
+/**
+ * Add the selected values of the source attribute to the destination geometry, sharing the data
+ * with #try_share_attribute when the selection contains all source elements.
+ */
+void transfer_attribute(const GAttributeReader &src,
+                        const AttributeIDRef &id,
+                        AttrDomain dst_domain,
+                        eCustomDataType data_type,
+                        const IndexMask &selection,
+                        MutableAttributeAccessor dst_attributes);
+
+/**
+ * Total number of attribute bytes that were shared or copied by the functions above, since the
+ * start of the session. Used to check whether geometry conversions actually avoid copies.
+ */
+struct AttributeTransferStats {
+  int64_t shared_bytes = 0;
+  int64_t copied_bytes = 0;
+};
+AttributeTransferStats attribute_transfer_stats();
+
 void gather_attributes(AttributeAccessor src_attributes,
                        AttrDomain domain,
                        const AnonymousAttributePropagationInfo &propagation_info,
@@ -10,6 +10,8 @@
 
 #include "BKE_bake_items.hh"
 
+struct BLI_mmap_file;
+
 namespace blender::bke::bake {
 
 /**
@@ -151,10 +153,17 @@ class DiskBlobReader : public BlobReader {
  private:
   const std::string blobs_dir_;
   mutable std::mutex mutex_;
+  /**
+   * Blob files are memory mapped when they are first accessed. Reading from a mapping does not
+   * need a lock, so multiple threads can read from the same file at once. Null when the file
+   * could not be mapped, in which case a stream from #open_input_streams_ is used instead.
+   */
+  mutable Map<std::string, BLI_mmap_file *> mapped_files_;
   mutable Map<std::string, std::unique_ptr<fstream>> open_input_streams_;
 
  public:
   DiskBlobReader(std::string blobs_dir);
+  ~DiskBlobReader();
   [[nodiscard]] bool read(const BlobSlice &slice, void *r_data) const override;
 };
 
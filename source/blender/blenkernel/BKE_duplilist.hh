@@ -34,6 +34,10 @@ ListBase *object_duplilist_preview(Depsgraph *depsgraph,
                                    Scene *scene,
                                    Object *ob,
                                    const ViewerPath *viewer_path);
+/**
+ * Free a list created by #object_duplilist or #object_duplilist_preview.
+ * Its elements are owned by the list and must not be freed or removed individually.
+ */
 void free_object_duplilist(ListBase *lb);
 
 struct DupliObject {
@@ -599,6 +599,13 @@ void BKE_lib_id_swap_full(
  * immediately before or after that pointer. It must always be into given \a lb list.
  */
 void id_sort_by_name(ListBase *lb, ID *id, ID *id_sorting_hint);
+/**
+ * Sort all IDs of given list, in the same order as inserting them one by one with
+ * #id_sort_by_name would give.
+ *
+ * Each #id_sort_by_name call walks the list, so prefer this when adding many IDs at once.
+ */
+void id_sort_by_name_all(ListBase *lb);
 /**
  * Expand ID usages of given id as 'extern' (and no more indirect) linked data.
  * Used by ID copy/make_local functions.
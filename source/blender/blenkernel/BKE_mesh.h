@@ -41,6 +41,8 @@ enum eMeshBatchDirtyMode {
   BKE_MESH_BATCH_DIRTY_SHADING,
   BKE_MESH_BATCH_DIRTY_UVEDIT_ALL,
   BKE_MESH_BATCH_DIRTY_UVEDIT_SELECT,
+  /** Only positions changed, buffers that depend on the topology alone can be kept. */
+  BKE_MESH_BATCH_DIRTY_DEFORM,
 };
 
 /* `mesh.cc` */
@@ -158,8 +158,17 @@ struct MeshRuntime {
   /** Cache for triangle to original face index map, accessed with #Mesh::corner_tri_faces(). */
   SharedCache<Array<int>> corner_tri_faces_cache;
 
-  /** Cache for BVH trees generated for the mesh. Defined in 'BKE_bvhutil.c' */
-  BVHCache *bvh_cache = nullptr;
+  /**
+   * Cache for BVH trees generated for the mesh. Defined in 'BKE_bvhutil.c'. The trees in this
+   * cache only depend on positions and topology, so like the #SharedCache members, it is shared
+   * with copies of the mesh until these are changed.
+   */
+  std::shared_ptr<BVHCache> bvh_cache;
+  /**
+   * BVH trees that also depend on other data like hide flags, which can change without tagging
+   * the mesh. Never shared with other meshes.
+   */
+  std::shared_ptr<BVHCache> unshared_bvh_cache;
 
   /** Needed in case we need to lazily initialize the mesh. */
   CustomData_MeshMasks cd_mask_extra = {};
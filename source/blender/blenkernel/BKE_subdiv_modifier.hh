@@ -46,6 +46,16 @@ struct SubsurfRuntimeData {
   bool use_optimal_display;
   bool use_loop_normals;
 
+  /* Result of the last lazy CPU evaluation, reused by CPU consumers of the mesh wrapper as long
+   * as the input data and the settings did not change. The input copy keeps the implicitly shared
+   * arrays alive, so that they can be identified by their sharing info. */
+  Mesh *cpu_cache_input;
+  Mesh *cpu_cache_result;
+  blender::bke::subdiv::Settings cpu_cache_settings;
+  int cpu_cache_resolution;
+  bool cpu_cache_use_optimal_display;
+  bool cpu_cache_use_loop_normals;
+
   /* Cached from the draw code for stats display. */
   int stats_totvert;
   int stats_totedge;
@@ -90,6 +100,18 @@ extern void (*BKE_subsurf_modifier_free_gpu_cache_cb)(blender::bke::subdiv::Subd
 blender::bke::subdiv::Subdiv *BKE_subsurf_modifier_subdiv_descriptor_ensure(
     SubsurfRuntimeData *runtime_data, const Mesh *mesh, bool for_draw_code);
 
+/**
+ * Find the result of a previous CPU evaluation of the same input mesh with the same settings.
+ * Returns a new copy of the cached mesh, sharing its data, or null.
+ */
+Mesh *BKE_subsurf_modifier_cpu_cache_lookup(const SubsurfRuntimeData *runtime_data,
+                                           const Mesh *mesh);
+/** Remember the result of subdividing the mesh on the CPU, replacing the previous one. */
+void BKE_subsurf_modifier_cpu_cache_store(SubsurfRuntimeData *runtime_data,
+                                          const Mesh *mesh,
+                                          const Mesh *result);
+void BKE_subsurf_modifier_cpu_cache_free(SubsurfRuntimeData *runtime_data);
+
 /**
  * Return the #ModifierMode required for the evaluation of the subsurf modifier,
  * which should be used to check if the modifier is enabled.
@@ -28,8 +28,15 @@ struct DenseFloatVolumeGrid {
   float *voxels;
 };
 
+/**
+ * Extract the active voxels of the grid into a dense array of floats.
+ *
+ * \param max_resolution: When larger than zero, the grid is resampled to a lower resolution if
+ * the dense array would be larger than this along any axis (e.g. the maximum 3D texture size).
+ */
 bool BKE_volume_grid_dense_floats(const Volume *volume,
                                   const blender::bke::VolumeGridData *volume_grid,
+                                  int max_resolution,
                                   DenseFloatVolumeGrid *r_dense_grid);
 void BKE_volume_dense_float_grid_clear(DenseFloatVolumeGrid *dense_grid);
 
@@ -15,13 +15,13 @@
 #include <cstdlib>
 #include <cstring>
 
-#include "MEM_guardedalloc.h"
-
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_armature_types.h"
@@ -201,7 +201,20 @@ static float dist_bone_deform(const bPoseChannel *pchan,
   return contrib;
 }
 
-static void pchan_bone_deform(const bPoseChannel *pchan,
+/**
+ * The bone that a vertex group refers to. This is resolved once per evaluation, so that the
+ * per-vertex loop does not have to look at the bone flags again for every weight.
+ */
+struct DeformGroupBone {
+  /** Null if there is no deforming bone with the name of the vertex group. */
+  const bPoseChannel *pchan = nullptr;
+  /** The bone is deformed with its B-Bone segments. */
+  bool use_bbone = false;
+  /** The vertex group weight is multiplied with the envelope of the bone. */
+  bool use_envelope_multiply = false;
+};
+
+static void pchan_bone_deform(const DeformGroupBone &group_bone,
                               const float weight,
                               float vec[3],
                               DualQuat *dq,
@@ -210,13 +223,13 @@ static void pchan_bone_deform(const bPoseChannel *pchan,
                               const bool full_deform,
                               float *contrib)
 {
-  const Bone *bone = pchan->bone;
+  const bPoseChannel *pchan = group_bone.pchan;
 
   if (!weight) {
     return;
   }
 
-  if (bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments) {
+  if (group_bone.use_bbone) {
     b_bone_deform(pchan, co, weight, vec, dq, mat, full_deform);
   }
   else {
@@ -252,7 +265,7 @@ struct ArmatureUserdata {
   const MDeformVert *dverts;
   int dverts_len;
 
-  bPoseChannel **pchan_from_defbase;
+  const DeformGroupBone *bone_from_defbase;
   int defbase_len;
 
   float premat[4][4];
@@ -344,19 +357,24 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     uint j;
     for (j = dvert->totweight; j != 0; j--, dw++) {
       const uint index = dw->def_nr;
-      if (index < data->defbase_len && (pchan = data->pchan_from_defbase[index])) {
-        float weight = dw->weight;
-        const Bone *bone = pchan->bone;
+      if (index >= data->defbase_len) {
+        continue;
+      }
+      const DeformGroupBone &group_bone = data->bone_from_defbase[index];
+      if (group_bone.pchan == nullptr) {
+        continue;
+      }
+      float weight = dw->weight;
 
-        deformed = 1;
+      deformed = 1;
 
-        if (bone && bone->flag & BONE_MULT_VG_ENV) {
-          weight *= distfactor_to_bone(
-              co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
-        }
-
-        pchan_bone_deform(pchan, weight, vec, dq, smat, co, full_deform, &contrib);
+      if (group_bone.use_envelope_multiply) {
+        const Bone *bone = group_bone.pchan->bone;
+        weight *= distfactor_to_bone(
+            co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
       }
+
+      pchan_bone_deform(group_bone, weight, vec, dq, smat, co, full_deform, &contrib);
     }
     /* If there are vertex-groups but not groups with bones (like for soft-body groups). */
     if (deformed == 0 && use_envelope) {
@@ -429,11 +447,8 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
   }
 }
 
-static void armature_vert_task(void *__restrict userdata,
-                               const int i,
-                               const TaskParallelTLS *__restrict /*tls*/)
+static void armature_vert_task(const ArmatureUserdata *data, const int i)
 {
-  const ArmatureUserdata *data = static_cast<const ArmatureUserdata *>(userdata);
   const MDeformVert *dvert;
   if (data->use_dverts || data->armature_def_nr != -1) {
     if (data->me_target) {
@@ -492,8 +507,9 @@ static void armature_deform_coords_impl(const Object *ob_arm,
                                         const BMEditMesh *em_target,
                                         bGPDstroke *gps_target)
 {
+  using namespace blender;
   const bArmature *arm = static_cast<const bArmature *>(ob_arm->data);
-  bPoseChannel **pchan_from_defbase = nullptr;
+  Array<DeformGroupBone> bone_from_defbase;
   const bool use_envelope = (deformflag & ARM_DEF_ENVELOPE) != 0;
   const bool use_quaternion = (deformflag & ARM_DEF_QUATERNION) != 0;
   const bool invert_vgroup = (deformflag & ARM_DEF_INVERT_VGROUP) != 0;
@@ -557,21 +573,23 @@ static void armature_deform_coords_impl(const Object *ob_arm,
       }
 
       if (use_dverts) {
-        pchan_from_defbase = static_cast<bPoseChannel **>(
-            MEM_callocN(sizeof(*pchan_from_defbase) * defbase_len, "defnrToBone"));
-        /* TODO(sergey): Some considerations here:
-         *
-         * - Check whether keeping this consistent across frames gives speedup.
-         */
+        /* Resolving the bones is cheap compared to the deformation. It is not cached across
+         * evaluations, because there is no way to detect that the vertex groups or bones have
+         * been renamed. */
+        bone_from_defbase.reinitialize(defbase_len);
         int i;
         LISTBASE_FOREACH_INDEX (bDeformGroup *, dg, defbase, i) {
-          pchan_from_defbase[i] = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
+          const bPoseChannel *pchan = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
           /* exclude non-deforming bones */
-          if (pchan_from_defbase[i]) {
-            if (pchan_from_defbase[i]->bone->flag & BONE_NO_DEFORM) {
-              pchan_from_defbase[i] = nullptr;
-            }
+          if (pchan == nullptr || (pchan->bone->flag & BONE_NO_DEFORM)) {
+            continue;
           }
+          const Bone *bone = pchan->bone;
+          DeformGroupBone &group_bone = bone_from_defbase[i];
+          group_bone.pchan = pchan;
+          group_bone.use_bbone = bone->segments > 1 &&
+                                 pchan->runtime.bbone_segments == bone->segments;
+          group_bone.use_envelope_multiply = (bone->flag & BONE_MULT_VG_ENV) != 0;
         }
       }
     }
@@ -590,7 +608,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   data.armature_def_nr = armature_def_nr;
   data.dverts = dverts.data();
   data.dverts_len = dverts.size();
-  data.pchan_from_defbase = pchan_from_defbase;
+  data.bone_from_defbase = bone_from_defbase.data();
   data.defbase_len = defbase_len;
   data.bmesh.cd_dvert_offset = cd_dvert_offset;
 
@@ -618,14 +636,14 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     }
   }
   else {
-    TaskParallelSettings settings;
-    BLI_parallel_range_settings_defaults(&settings);
-    settings.min_iter_per_thread = 32;
-    BLI_task_parallel_range(0, vert_coords_len, &data, armature_vert_task, &settings);
-  }
-
-  if (pchan_from_defbase) {
-    MEM_freeN(pchan_from_defbase);
+    /* The cost per vertex depends on the number of weights and on whether envelopes and B-Bones
+     * are used, so the grain size is chosen based on previous evaluations. */
+    static threading::AdaptiveGrainSize grain_size{"armature_deform"};
+    threading::parallel_for(IndexRange(vert_coords_len), grain_size, [&](const IndexRange range) {
+      for (const int i : range) {
+        armature_vert_task(&data, i);
+      }
+    });
   }
 }
 
@@ -2,6 +2,7 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <atomic>
 #include <utility>
 
 #include "BKE_attribute_math.hh"
@@ -20,6 +21,7 @@
 #include "BLI_array_utils.hh"
 #include "BLI_color.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_profile_trace.hh"
 #include "BLI_span.hh"
 
 #include "BLT_translation.hh"
@@ -854,6 +856,74 @@ Vector<AttributeTransferData> retrieve_attributes_for_transfer(
 
 /** \} */
 
+static std::atomic<int64_t> attribute_shared_bytes = 0;
+static std::atomic<int64_t> attribute_copied_bytes = 0;
+
+static void add_attribute_transfer_bytes(std::atomic<int64_t> &counter,
+                                         const char *counter_name,
+                                         const int64_t bytes)
+{
+  const int64_t total = counter.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  profile_trace::counter(counter_name, double(total));
+}
+
+AttributeTransferStats attribute_transfer_stats()
+{
+  AttributeTransferStats stats;
+  stats.shared_bytes = attribute_shared_bytes.load(std::memory_order_relaxed);
+  stats.copied_bytes = attribute_copied_bytes.load(std::memory_order_relaxed);
+  return stats;
+}
+
+bool try_share_attribute(const GAttributeReader &src,
+                         const AttributeIDRef &id,
+                         const AttrDomain dst_domain,
+                         const eCustomDataType data_type,
+                         MutableAttributeAccessor dst_attributes)
+{
+  if (!src.sharing_info || !src.varray.is_span()) {
+    return false;
+  }
+  if (src.varray.size() != dst_attributes.domain_size(dst_domain)) {
+    return false;
+  }
+  if (src.varray.type() != *custom_data_type_to_cpp_type(data_type)) {
+    return false;
+  }
+  const GSpan src_span = src.varray.get_internal_span();
+  if (!dst_attributes.add(
+          id, dst_domain, data_type, AttributeInitShared(src_span.data(), *src.sharing_info)))
+  {
+    return false;
+  }
+  add_attribute_transfer_bytes(
+      attribute_shared_bytes, "Attribute Bytes Shared", src_span.size_in_bytes());
+  return true;
+}
+
+void transfer_attribute(const GAttributeReader &src,
+                        const AttributeIDRef &id,
+                        const AttrDomain dst_domain,
+                        const eCustomDataType data_type,
+                        const IndexMask &selection,
+                        MutableAttributeAccessor dst_attributes)
+{
+  if (selection.size() == src.varray.size()) {
+    if (try_share_attribute(src, id, dst_domain, data_type, dst_attributes)) {
+      return;
+    }
+  }
+  GSpanAttributeWriter dst = dst_attributes.lookup_or_add_for_write_only_span(
+      id, dst_domain, data_type);
+  if (!dst) {
+    return;
+  }
+  array_utils::gather(src.varray, selection, dst.span);
+  dst.finish();
+  add_attribute_transfer_bytes(
+      attribute_copied_bytes, "Attribute Bytes Copied", dst.span.size_in_bytes());
+}
+
 void gather_attributes(const AttributeAccessor src_attributes,
                        const AttrDomain domain,
                        const AnonymousAttributePropagationInfo &propagation_info,
@@ -861,7 +931,6 @@ void gather_attributes(const AttributeAccessor src_attributes,
                        const IndexMask &selection,
                        MutableAttributeAccessor dst_attributes)
 {
-  const int src_size = src_attributes.domain_size(domain);
   src_attributes.for_all([&](const AttributeIDRef &id, const AttributeMetaData meta_data) {
     if (meta_data.domain != domain) {
       return true;
@@ -876,19 +945,7 @@ void gather_attributes(const AttributeAccessor src_attributes,
       return true;
     }
     const GAttributeReader src = src_attributes.lookup(id, domain);
-    if (selection.size() == src_size && src.sharing_info && src.varray.is_span()) {
-      const AttributeInitShared init(src.varray.get_internal_span().data(), *src.sharing_info);
-      if (dst_attributes.add(id, domain, meta_data.data_type, init)) {
-        return true;
-      }
-    }
-    GSpanAttributeWriter dst = dst_attributes.lookup_or_add_for_write_only_span(
-        id, domain, meta_data.data_type);
-    if (!dst) {
-      return true;
-    }
-    array_utils::gather(src.varray, selection, dst.span);
-    dst.finish();
+    transfer_attribute(src, id, domain, meta_data.data_type, selection, dst_attributes);
     return true;
   });
 }
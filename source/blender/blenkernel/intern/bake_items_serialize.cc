@@ -15,7 +15,9 @@
 
 #include "BLI_endian_defines.h"
 #include "BLI_endian_switch.h"
+#include "BLI_fileops.h"
 #include "BLI_math_matrix_types.hh"
+#include "BLI_mmap.h"
 #include "BLI_path_util.h"
 
 #include "DNA_material_types.h"
@@ -24,10 +26,17 @@
 #include "RNA_access.hh"
 #include "RNA_enum_types.hh"
 
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <sstream>
 #include <xxhash.h>
 
+#ifndef WIN32
+#  include <unistd.h> /* For close. */
+#else
+#  include <io.h> /* For close. */
+#endif
+
 #ifdef WITH_OPENVDB
 #  include <openvdb/io/Stream.h>
 #  include <openvdb/openvdb.h>
@@ -87,6 +96,15 @@ bool BlobReader::read_as_stream(const BlobSlice &slice, FunctionRef<bool(std::is
 
 DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blobs_dir)) {}
 
+DiskBlobReader::~DiskBlobReader()
+{
+  for (BLI_mmap_file *mmap_file : mapped_files_.values()) {
+    if (mmap_file) {
+      BLI_mmap_free(mmap_file);
+    }
+  }
+}
+
 [[nodiscard]] bool DiskBlobReader::read(const BlobSlice &slice, void *r_data) const
 {
   if (slice.range.is_empty()) {
@@ -96,6 +114,24 @@ DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blo
   char blob_path[FILE_MAX];
   BLI_path_join(blob_path, sizeof(blob_path), blobs_dir_.c_str(), slice.name.c_str());
 
+  BLI_mmap_file *mmap_file;
+  {
+    std::lock_guard lock{mutex_};
+    mmap_file = mapped_files_.lookup_or_add_cb_as(blob_path, [&]() -> BLI_mmap_file * {
+      const int file = BLI_open(blob_path, O_BINARY | O_RDONLY, 0);
+      if (file == -1) {
+        return nullptr;
+      }
+      /* The mapping stays valid after the file is closed. */
+      BLI_mmap_file *new_mmap_file = BLI_mmap_open(file);
+      close(file);
+      return new_mmap_file;
+    });
+  }
+  if (mmap_file) {
+    return BLI_mmap_read(mmap_file, r_data, slice.range.start(), slice.range.size());
+  }
+
   std::lock_guard lock{mutex_};
   std::unique_ptr<fstream> &blob_file = open_input_streams_.lookup_or_add_cb_as(blob_path, [&]() {
     return std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary);
@@ -203,22 +239,31 @@ std::optional<ImplicitSharingInfoAndData> BlobReadSharing::read_shared(
     const DictionaryValue &io_data,
     FunctionRef<std::optional<ImplicitSharingInfoAndData>()> read_fn) const
 {
-  std::lock_guard lock{mutex_};
-
   io::serialize::JsonFormatter formatter;
   std::stringstream ss;
   formatter.serialize(ss, io_data);
   const std::string key = ss.str();
 
-  if (const ImplicitSharingInfoAndData *shared_data = runtime_by_stored_.lookup_ptr(key)) {
-    shared_data->sharing_info->add_user();
-    return *shared_data;
+  {
+    std::lock_guard lock{mutex_};
+    if (const ImplicitSharingInfoAndData *shared_data = runtime_by_stored_.lookup_ptr(key)) {
+      shared_data->sharing_info->add_user();
+      return *shared_data;
+    }
   }
+  /* Read without holding the lock so that different data can be loaded in parallel. */
   std::optional<ImplicitSharingInfoAndData> data = read_fn();
   if (!data) {
     return std::nullopt;
   }
   if (data->sharing_info != nullptr) {
+    std::lock_guard lock{mutex_};
+    if (const ImplicitSharingInfoAndData *shared_data = runtime_by_stored_.lookup_ptr(key)) {
+      /* Another thread has read the same data in the meantime, use that instead. */
+      data->sharing_info->remove_user_and_delete_if_last();
+      shared_data->sharing_info->add_user();
+      return *shared_data;
+    }
     data->sharing_info->add_user();
     runtime_by_stored_.add_new(key, *data);
   }
@@ -2241,10 +2241,11 @@ bool BKE_blendfile_write_partial(Main *bmain_src,
   a = set_listbasepointers(bmain_dst, lbarray_src);
   while (a--) {
     ListBase *lb_dst = lbarray_dst[a], *lb_src = lbarray_src[a];
-    while (ID *id = static_cast<ID *>(BLI_pophead(lb_src))) {
-      BLI_addtail(lb_dst, id);
-      id_sort_by_name(lb_dst, id, nullptr);
+    if (BLI_listbase_is_empty(lb_src)) {
+      continue;
     }
+    BLI_movelisttolist(lb_dst, lb_src);
+    id_sort_by_name_all(lb_dst);
   }
 
   MEM_freeN(bmain_dst);
@@ -1729,12 +1729,15 @@ void BKE_blendfile_override(BlendfileLinkAppendContext *lapp_context,
 /** \name Library relocating code.
  * \{ */
 
-static void blendfile_library_relocate_remap(Main *bmain,
-                                             ID *old_id,
-                                             ID *new_id,
-                                             ReportList *reports,
-                                             const bool do_reload,
-                                             const int remap_flags)
+/**
+ * Updates needed after \a old_id has been remapped to \a new_id, which is done for all relocated
+ * IDs at once.
+ */
+static void blendfile_library_relocate_remap_postprocess(Main *bmain,
+                                                         ID *old_id,
+                                                         ID *new_id,
+                                                         ReportList *reports,
+                                                         const bool do_reload)
 {
   BLI_assert(old_id);
   if (do_reload) {
@@ -1743,14 +1746,6 @@ static void blendfile_library_relocate_remap(Main *bmain,
     BLI_assert(new_id);
   }
   if (new_id) {
-    CLOG_INFO(&LOG,
-              4,
-              "Before remap of %s, old_id users: %d, new_id users: %d",
-              old_id->name,
-              old_id->us,
-              new_id->us);
-    BKE_libblock_remap_locked(bmain, old_id, new_id, remap_flags);
-
     if (old_id->flag & LIB_FAKEUSER) {
       id_fake_user_clear(old_id);
       id_fake_user_set(new_id);
@@ -1899,14 +1894,25 @@ void BKE_blendfile_library_relocate(BlendfileLinkAppendContext *lapp_context,
   /* Note that in reload case, we also want to replace indirect usages. */
   const int remap_flags = ID_REMAP_SKIP_NEVER_NULL_USAGE |
                           (do_reload ? 0 : ID_REMAP_SKIP_INDIRECT_USAGE);
+
+  /* Remap all relocated IDs at once, each remapping has to check every ID in Main. */
+  blender::bke::id::IDRemapper remapper;
+  /* Pointers to the shape keys of the old IDs, which are unset during remapping. */
+  blender::Vector<std::pair<Key **, Key *>> old_keys;
   for (BlendfileLinkAppendContextItem *item : lapp_context->items) {
     ID *old_id = static_cast<ID *>(item->userdata);
     ID *new_id = item->new_id;
-
-    blendfile_library_relocate_remap(bmain, old_id, new_id, reports, do_reload, remap_flags);
     if (new_id == nullptr) {
       continue;
     }
+    CLOG_INFO(&LOG,
+              4,
+              "Before remap of %s, old_id users: %d, new_id users: %d",
+              old_id->name,
+              old_id->us,
+              new_id->us);
+    remapper.add(old_id, new_id);
+
     /* Usual special code for ShapeKeys snowflakes... */
     Key **old_key_p = BKE_key_from_id_p(old_id);
     if (old_key_p == nullptr) {
@@ -1914,13 +1920,34 @@ void BKE_blendfile_library_relocate(BlendfileLinkAppendContext *lapp_context,
     }
     Key *old_key = *old_key_p;
     Key *new_key = BKE_key_from_id(new_id);
-    if (old_key != nullptr) {
+    if (old_key != nullptr && new_key != nullptr) {
       *old_key_p = nullptr;
       id_us_min(&old_key->id);
-      blendfile_library_relocate_remap(
-          bmain, &old_key->id, &new_key->id, reports, do_reload, remap_flags);
-      *old_key_p = old_key;
-      id_us_plus_no_lib(&old_key->id);
+      remapper.add(&old_key->id, &new_key->id);
+      old_keys.append({old_key_p, old_key});
+    }
+  }
+
+  BKE_libblock_remap_multiple_locked(bmain, remapper, remap_flags);
+
+  for (auto [old_key_p, old_key] : old_keys) {
+    *old_key_p = old_key;
+    id_us_plus_no_lib(&old_key->id);
+  }
+
+  for (BlendfileLinkAppendContextItem *item : lapp_context->items) {
+    ID *old_id = static_cast<ID *>(item->userdata);
+    ID *new_id = item->new_id;
+
+    blendfile_library_relocate_remap_postprocess(bmain, old_id, new_id, reports, do_reload);
+    if (new_id == nullptr) {
+      continue;
+    }
+    Key *old_key = BKE_key_from_id(old_id);
+    Key *new_key = BKE_key_from_id(new_id);
+    if (old_key != nullptr && new_key != nullptr) {
+      blendfile_library_relocate_remap_postprocess(
+          bmain, &old_key->id, &new_key->id, reports, do_reload);
     }
   }
   BKE_layer_collection_resync_allow();
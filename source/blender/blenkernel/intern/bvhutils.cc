@@ -47,7 +47,7 @@ struct BVHCache {
  *
  * When `r_locked` is used the `mesh_eval_mutex` must contain the `MeshRuntime.eval_mutex`.
  */
-static bool bvhcache_find(BVHCache **bvh_cache_p,
+static bool bvhcache_find(std::shared_ptr<BVHCache> &bvh_cache_p,
                           BVHCacheType type,
                           BVHTree **r_tree,
                           bool *r_locked,
@@ -57,18 +57,18 @@ static bool bvhcache_find(BVHCache **bvh_cache_p,
   if (r_locked) {
     *r_locked = false;
   }
-  if (*bvh_cache_p == nullptr) {
+  if (!bvh_cache_p) {
     if (!do_lock) {
       /* Cache does not exist and no lock is requested. */
       return false;
     }
     /* Lazy initialization of the bvh_cache using the `mesh_eval_mutex`. */
     std::lock_guard lock{*mesh_eval_mutex};
-    if (*bvh_cache_p == nullptr) {
-      *bvh_cache_p = bvhcache_init();
+    if (!bvh_cache_p) {
+      bvh_cache_p = std::shared_ptr<BVHCache>(bvhcache_init(), bvhcache_free);
     }
   }
-  BVHCache *bvh_cache = *bvh_cache_p;
+  BVHCache *bvh_cache = bvh_cache_p.get();
 
   if (bvh_cache->items[type].is_filled) {
     *r_tree = bvh_cache->items[type].tree;
@@ -903,7 +903,16 @@ BVHTree *BKE_bvhtree_from_mesh_get(BVHTreeFromMesh *data,
 {
   using namespace blender;
   using namespace blender::bke;
-  BVHCache **bvh_cache_p = (BVHCache **)&mesh->runtime->bvh_cache;
+  /* Hide flags and legacy faces may change without tagging the mesh, so trees that depend on
+   * them can't be shared with copies of the mesh. */
+  const bool use_shared_cache = !ELEM(bvh_cache_type,
+                                      BVHTREE_FROM_LOOSEVERTS_NO_HIDDEN,
+                                      BVHTREE_FROM_LOOSEEDGES_NO_HIDDEN,
+                                      BVHTREE_FROM_CORNER_TRIS_NO_HIDDEN,
+                                      BVHTREE_FROM_FACES);
+  std::shared_ptr<BVHCache> &bvh_cache_p = use_shared_cache ?
+                                               mesh->runtime->bvh_cache :
+                                               mesh->runtime->unshared_bvh_cache;
 
   Span<int3> corner_tris;
   if (ELEM(bvh_cache_type, BVHTREE_FROM_CORNER_TRIS, BVHTREE_FROM_CORNER_TRIS_NO_HIDDEN)) {
@@ -1014,8 +1023,8 @@ BVHTree *BKE_bvhtree_from_mesh_get(BVHTreeFromMesh *data,
   // printf("BVHTree built and saved on cache\n");
   BLI_assert(data->cached == false);
   data->cached = true;
-  bvhcache_insert(*bvh_cache_p, data->tree, bvh_cache_type);
-  bvhcache_unlock(*bvh_cache_p, lock_started);
+  bvhcache_insert(bvh_cache_p.get(), data->tree, bvh_cache_type);
+  bvhcache_unlock(bvh_cache_p.get(), lock_started);
 
 #ifndef NDEBUG
   if (data->tree != nullptr) {
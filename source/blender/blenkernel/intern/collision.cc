@@ -18,6 +18,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -1587,24 +1588,30 @@ int cloth_bvh_collision(
       coll_counts_obj = MEM_cnew_array<uint>(numcollobj, "CollCounts");
       overlap_obj = MEM_cnew_array<BVHTreeOverlap *>(numcollobj, "BVHOverlap");
 
-      for (i = 0; i < numcollobj; i++) {
-        Object *collob = collobjs[i];
-        CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
-            collob, eModifierType_Collision);
-
-        if (!collmd->bvhtree) {
-          continue;
-        }
-
-        /* Move object to position (step) in time. */
-        collision_move_object(collmd, step + dt, step, false);
-
-        overlap_obj[i] = BLI_bvhtree_overlap(cloth_bvh,
-                                             collmd->bvhtree,
-                                             &coll_counts_obj[i],
-                                             is_hair ? nullptr : cloth_bvh_obj_overlap_cb,
-                                             clmd);
-      }
+      /* The overlap test only uses as many threads as the root of the cloth BVH has children, so
+       * also handle the colliders (which are independent of each other) in parallel. */
+      blender::threading::parallel_for(
+          blender::IndexRange(numcollobj), 1, [&](const blender::IndexRange range) {
+            for (const int64_t collob_index : range) {
+              Object *collob = collobjs[collob_index];
+              CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
+                  collob, eModifierType_Collision);
+
+              if (!collmd->bvhtree) {
+                continue;
+              }
+
+              /* Move object to position (step) in time. */
+              collision_move_object(collmd, step + dt, step, false);
+
+              overlap_obj[collob_index] = BLI_bvhtree_overlap(
+                  cloth_bvh,
+                  collmd->bvhtree,
+                  &coll_counts_obj[collob_index],
+                  is_hair ? nullptr : cloth_bvh_obj_overlap_cb,
+                  clmd);
+            }
+          });
     }
   }
 
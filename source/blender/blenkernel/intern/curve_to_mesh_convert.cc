@@ -473,6 +473,69 @@ static void foreach_curve_combination(const CurvesInfo &info,
   });
 }
 
+/**
+ * Whether every combination results in the same topology, apart from the index offsets. That is
+ * the common case of sweeping a single profile along curves that all have the same number of
+ * evaluated points, like hair curves.
+ */
+static bool combinations_share_topology(const CurvesInfo &info)
+{
+  if (info.profile.curves_num() != 1 || info.main.curves_num() < 2) {
+    return false;
+  }
+  const OffsetIndices<int> main_offsets = info.main.evaluated_points_by_curve();
+  const int points_num = main_offsets[0].size();
+  const bool cyclic = info.main_cyclic[0];
+  for (const int i_main : main_offsets.index_range().drop_front(1)) {
+    if (main_offsets[i_main].size() != points_num || info.main_cyclic[i_main] != cyclic) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Fill the topology of all combinations by copying the topology of the first one, which must
+ * already be filled, shifted by the element offsets of each combination.
+ */
+static void copy_topology_from_first_combination(const ResultOffsets &offsets,
+                                                 MutableSpan<int2> edges,
+                                                 MutableSpan<int> corner_verts,
+                                                 MutableSpan<int> corner_edges,
+                                                 MutableSpan<int> face_offsets)
+{
+  const OffsetIndices<int> vert_offsets(offsets.vert);
+  const OffsetIndices<int> edge_offsets(offsets.edge);
+  const OffsetIndices<int> face_offsets_by_combination(offsets.face);
+  const OffsetIndices<int> loop_offsets(offsets.loop);
+  const Span<int2> first_edges = edges.slice(edge_offsets[0]);
+  const Span<int> first_corner_verts = corner_verts.slice(loop_offsets[0]);
+  const Span<int> first_corner_edges = corner_edges.slice(loop_offsets[0]);
+  const Span<int> first_face_offsets = face_offsets.slice(face_offsets_by_combination[0]);
+  const IndexRange other_combinations = IndexRange(offsets.total).drop_front(1);
+  threading::parallel_for(other_combinations, 512, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int vert_offset = vert_offsets[i].start();
+      const int edge_offset = edge_offsets[i].start();
+      const int loop_offset = loop_offsets[i].start();
+      MutableSpan<int2> dst_edges = edges.slice(edge_offsets[i]);
+      for (const int edge : dst_edges.index_range()) {
+        dst_edges[edge] = first_edges[edge] + vert_offset;
+      }
+      MutableSpan<int> dst_corner_verts = corner_verts.slice(loop_offsets[i]);
+      MutableSpan<int> dst_corner_edges = corner_edges.slice(loop_offsets[i]);
+      for (const int corner : dst_corner_verts.index_range()) {
+        dst_corner_verts[corner] = first_corner_verts[corner] + vert_offset;
+        dst_corner_edges[corner] = first_corner_edges[corner] + edge_offset;
+      }
+      MutableSpan<int> dst_face_offsets = face_offsets.slice(face_offsets_by_combination[i]);
+      for (const int face : dst_face_offsets.index_range()) {
+        dst_face_offsets[face] = first_face_offsets[face] + loop_offset;
+      }
+    }
+  });
+}
+
 static void build_mesh_positions(const CurvesInfo &curves_info,
                                  const ResultOffsets &offsets,
                                  Vector<std::byte> &eval_buffer,
@@ -485,11 +548,10 @@ static void build_mesh_positions(const CurvesInfo &curves_info,
   if (ignore_profile_position) {
     if (mesh.verts_num == curves_info.main.points_num()) {
       const GAttributeReader src = curves_info.main.attributes().lookup("position");
-      if (src.sharing_info && src.varray.is_span()) {
-        const AttributeInitShared init(src.varray.get_internal_span().data(), *src.sharing_info);
-        if (mesh.attributes_for_write().add<float3>("position", AttrDomain::Point, init)) {
-          return;
-        }
+      if (try_share_attribute(
+              src, "position", AttrDomain::Point, CD_PROP_FLOAT3, mesh.attributes_for_write()))
+      {
+        return;
       }
     }
   }
@@ -555,24 +617,6 @@ static void copy_main_point_data_to_mesh_faces(const Span<T> src,
   }
 }
 
-static bool try_sharing_point_data(const CurvesGeometry &main,
-                                   const AttributeIDRef &id,
-                                   const GAttributeReader &src,
-                                   MutableAttributeAccessor mesh_attributes)
-{
-  if (mesh_attributes.domain_size(AttrDomain::Point) != main.points_num()) {
-    return false;
-  }
-  if (!src.sharing_info || !src.varray.is_span()) {
-    return false;
-  }
-  return mesh_attributes.add(
-      id,
-      AttrDomain::Point,
-      bke::cpp_type_to_custom_data_type(src.varray.type()),
-      AttributeInitShared(src.varray.get_internal_span().data(), *src.sharing_info));
-}
-
 static bool try_direct_evaluate_point_data(const CurvesGeometry &main,
                                            const GAttributeReader &src,
                                            GMutableSpan dst)
@@ -596,7 +640,12 @@ static void copy_main_point_domain_attribute_to_mesh(const CurvesInfo &curves_in
                                                      MutableAttributeAccessor mesh_attributes)
 {
   if (dst_domain == AttrDomain::Point) {
-    if (try_sharing_point_data(curves_info.main, id, src_attribute, mesh_attributes)) {
+    if (try_share_attribute(src_attribute,
+                            id,
+                            AttrDomain::Point,
+                            bke::cpp_type_to_custom_data_type(src_attribute.varray.type()),
+                            mesh_attributes))
+    {
       return;
     }
   }
@@ -836,21 +885,39 @@ Mesh *curve_to_mesh_sweep(const CurvesGeometry &main,
   MutableSpan<int> corner_edges = mesh->corner_edges_for_write();
   MutableAttributeAccessor mesh_attributes = mesh->attributes_for_write();
 
-  foreach_curve_combination(curves_info, offsets, [&](const CombinationInfo &info) {
-    fill_mesh_topology(info.vert_range.start(),
-                       info.edge_range.start(),
-                       info.face_range.start(),
-                       info.loop_range.start(),
-                       info.main_points.size(),
-                       info.profile_points.size(),
-                       info.main_cyclic,
-                       info.profile_cyclic,
+  if (combinations_share_topology(curves_info)) {
+    fill_mesh_topology(0,
+                       0,
+                       0,
+                       0,
+                       main.evaluated_points_by_curve()[0].size(),
+                       profile.evaluated_points_by_curve()[0].size(),
+                       curves_info.main_cyclic[0],
+                       curves_info.profile_cyclic[0],
                        fill_caps,
                        edges,
                        corner_verts,
                        corner_edges,
                        face_offsets);
-  });
+    copy_topology_from_first_combination(offsets, edges, corner_verts, corner_edges, face_offsets);
+  }
+  else {
+    foreach_curve_combination(curves_info, offsets, [&](const CombinationInfo &info) {
+      fill_mesh_topology(info.vert_range.start(),
+                         info.edge_range.start(),
+                         info.face_range.start(),
+                         info.loop_range.start(),
+                         info.main_points.size(),
+                         info.profile_points.size(),
+                         info.main_cyclic,
+                         info.profile_cyclic,
+                         fill_caps,
+                         edges,
+                         corner_verts,
+                         corner_edges,
+                         face_offsets);
+    });
+  }
 
   if (fill_caps) {
     /* TODO: This is used to keep the tests passing after refactoring mesh shade smooth flags. It
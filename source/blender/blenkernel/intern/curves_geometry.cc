@@ -1094,9 +1094,7 @@ static void translate_positions(MutableSpan<float3> positions, const float3 &tra
 static void transform_positions(MutableSpan<float3> positions, const float4x4 &matrix)
 {
   threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
-    for (float3 &position : positions.slice(range)) {
-      position = math::transform_point(matrix, position);
-    }
+    math::transform_points(matrix, positions.slice(range));
   });
 }
 
@@ -1153,6 +1151,14 @@ void CurvesGeometry::translate(const float3 &translation)
     bounds = this->runtime->bounds_cache.data();
   }
 
+  /* All curve types are evaluated with affine combinations of their control points, so the
+   * evaluated positions only have to be moved as well. Bezier curves missing a handle attribute
+   * are evaluated to zero instead, which does not follow the translation. */
+  const bool translate_evaluated_positions =
+      this->runtime->evaluated_position_cache.is_cached() &&
+      (!this->has_curve_with_type(CURVE_TYPE_BEZIER) ||
+       (!this->handle_positions_left().is_empty() && !this->handle_positions_right().is_empty()));
+
   translate_positions(this->positions_for_write(), translation);
   if (!this->handle_positions_left().is_empty()) {
     translate_positions(this->handle_positions_left_for_write(), translation);
@@ -1160,7 +1166,16 @@ void CurvesGeometry::translate(const float3 &translation)
   if (!this->handle_positions_right().is_empty()) {
     translate_positions(this->handle_positions_right_for_write(), translation);
   }
-  this->tag_positions_changed();
+
+  /* Evaluated tangents, normals and lengths do not depend on the translation and stay valid. */
+  if (translate_evaluated_positions) {
+    this->runtime->evaluated_position_cache.update(
+        [&](Vector<float3> &r_data) { translate_positions(r_data, translation); });
+  }
+  else {
+    this->runtime->evaluated_position_cache.tag_dirty();
+  }
+  this->runtime->bounds_cache.tag_dirty();
 
   if (bounds) {
     bounds->min += translation;
@@ -476,4 +476,46 @@ TEST(curves_geometry, BezierGenericEvaluation)
   }
 }
 
+TEST(curves_geometry, TranslateEvaluatedPositions)
+{
+  CurvesGeometry curves(4, 1);
+  curves.fill_curve_types(CURVE_TYPE_CATMULL_ROM);
+  curves.resolution_for_write().fill(4);
+  curves.offsets_for_write().last() = 4;
+
+  MutableSpan<float3> positions = curves.positions_for_write();
+  positions[0] = {1, 1, 0};
+  positions[1] = {0, 1, 0};
+  positions[2] = {0, 0, 0};
+  positions[3] = {-1, 0, 0};
+
+  const Array<float3> evaluated_positions(curves.evaluated_positions());
+  curves.ensure_evaluated_lengths();
+  const Array<float> evaluated_lengths(curves.evaluated_lengths_for_curve(0, false));
+
+  const float3 translation(1, -2, 3);
+  curves.translate(translation);
+
+  /* The cached evaluated positions are translated instead of being recomputed, they should still
+   * match the result of a new evaluation. */
+  const Span<float3> translated_positions = curves.evaluated_positions();
+  ASSERT_EQ(translated_positions.size(), evaluated_positions.size());
+  for (const int i : evaluated_positions.index_range()) {
+    const float3 expected = evaluated_positions[i] + translation;
+    EXPECT_V3_NEAR(translated_positions[i], expected, 1e-5f);
+  }
+  curves.ensure_evaluated_lengths();
+  const Span<float> translated_lengths = curves.evaluated_lengths_for_curve(0, false);
+  for (const int i : evaluated_lengths.index_range()) {
+    EXPECT_NEAR(translated_lengths[i], evaluated_lengths[i], 1e-5f);
+  }
+
+  curves.tag_positions_changed();
+  const Span<float3> reevaluated_positions = curves.evaluated_positions();
+  for (const int i : evaluated_positions.index_range()) {
+    const float3 expected = evaluated_positions[i] + translation;
+    EXPECT_V3_NEAR(reevaluated_positions[i], expected, 1e-5f);
+  }
+}
+
 }  // namespace blender::bke::tests
@@ -31,6 +31,8 @@
 #include "BLI_string_utils.hh"
 #include "BLI_task.hh"
 
+#include "atomic_ops.h"
+
 #include "BLT_translation.hh"
 
 #include "BKE_anim_data.hh"
@@ -2076,6 +2078,39 @@ static float fcurve_eval_keyframes_extrapolate(const FCurve *fcu,
   return endpoint_bezt->vec[1][1] - (fac * dx);
 }
 
+/**
+ * Same as #BKE_fcurve_bezt_binarysearch_index_ex, but first checks the segment that was found in
+ * the previous evaluation and the one after it. The result is the same, as long as the keyframes
+ * are sorted (which the binary search relies on as well).
+ */
+static int fcurve_eval_segment_index(const FCurve *fcu,
+                                     const BezTriple *bezts,
+                                     const float evaltime,
+                                     const float threshold,
+                                     bool *r_exact)
+{
+  const int totvert = int(fcu->totvert);
+  const int hint = atomic_load_int32(&fcu->runtime_segment_index);
+  for (const int index : {hint, hint + 1}) {
+    if (index < 1 || index >= totvert) {
+      continue;
+    }
+    /* The evaluation time has to be strictly between the keyframes, and not close enough to either
+     * of them to be considered exact. */
+    if (evaltime - bezts[index - 1].vec[1][0] > threshold &&
+        bezts[index].vec[1][0] - evaltime > threshold)
+    {
+      *r_exact = false;
+      return index;
+    }
+  }
+  const int index = BKE_fcurve_bezt_binarysearch_index_ex(
+      bezts, evaltime, totvert, threshold, r_exact);
+  /* Evaluation does not modify the F-Curve otherwise, but the hint does not affect the result. */
+  atomic_store_int32(&const_cast<FCurve *>(fcu)->runtime_segment_index, index);
+  return index;
+}
+
 static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
                                                const BezTriple *bezts,
                                                float evaltime)
@@ -2096,7 +2131,7 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
    *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
    *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
    */
-  a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, 0.0001, &exact);
+  a = fcurve_eval_segment_index(fcu, bezts, evaltime, 0.0001, &exact);
   const BezTriple *bezt = bezts + a;
 
   if (exact) {
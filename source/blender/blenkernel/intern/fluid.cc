@@ -318,12 +318,20 @@ void BKE_fluid_cache_free_all(FluidDomainSettings *fds, Object *ob)
   BKE_fluid_cache_free(fds, ob, cache_map);
 }
 
+void BKE_fluid_cache_wait_writes()
+{
+  manta_wait_for_cache_writers();
+}
+
 void BKE_fluid_cache_free(FluidDomainSettings *fds, Object *ob, int cache_map)
 {
   char temp_dir[FILE_MAX];
   int flags = fds->cache_flag;
   const char *relbase = BKE_modifier_path_relbase_from_global(ob);
 
+  /* Pending writes would recreate files in the deleted directories. */
+  BKE_fluid_cache_wait_writes();
+
   if (cache_map & FLUID_DOMAIN_OUTDATED_DATA) {
     flags &= ~(FLUID_DOMAIN_BAKING_DATA | FLUID_DOMAIN_BAKED_DATA | FLUID_DOMAIN_OUTDATED_DATA);
     BLI_path_join(temp_dir, sizeof(temp_dir), fds->cache_directory, FLUID_DOMAIN_DIR_CONFIG);
@@ -59,19 +59,24 @@ static void shapekey_copy_data(Main * /*bmain*/,
                                std::optional<Library *> /*owner_library*/,
                                ID *id_dst,
                                const ID *id_src,
-                               const int /*flag*/)
+                               const int flag)
 {
   Key *key_dst = (Key *)id_dst;
   const Key *key_src = (const Key *)id_src;
   BLI_duplicatelist(&key_dst->block, &key_src->block);
 
+  /* Evaluated copies only read the shape key data, so they reference the arrays of the original
+   * instead of duplicating them. This avoids copying all of the shape keys when only a setting
+   * like the value of a single shape key is changed. */
+  const bool share_data = (flag & LIB_ID_COPY_SET_COPIED_ON_WRITE) != 0;
+
   KeyBlock *kb_dst, *kb_src;
   for (kb_src = static_cast<KeyBlock *>(key_src->block.first),
       kb_dst = static_cast<KeyBlock *>(key_dst->block.first);
        kb_dst;
        kb_src = kb_src->next, kb_dst = kb_dst->next)
   {
-    if (kb_dst->data) {
+    if (kb_dst->data && !share_data) {
       kb_dst->data = MEM_dupallocN(kb_dst->data);
     }
     if (kb_src == key_src->refkey) {
@@ -83,8 +88,10 @@ static void shapekey_copy_data(Main * /*bmain*/,
 static void shapekey_free_data(ID *id)
 {
   Key *key = (Key *)id;
+  /* The data of evaluated copies is owned by the original, see #shapekey_copy_data. */
+  const bool owns_data = (key->id.tag & LIB_TAG_COPIED_ON_EVAL) == 0;
   while (KeyBlock *kb = static_cast<KeyBlock *>(BLI_pophead(&key->block))) {
-    if (kb->data) {
+    if (kb->data && owns_data) {
       MEM_freeN(kb->data);
     }
     MEM_freeN(kb);
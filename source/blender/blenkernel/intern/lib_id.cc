@@ -9,6 +9,7 @@
  * allocate and free of all library data
  */
 
+#include <algorithm>
 #include <cctype>
 #include <cstddef>
 #include <cstdio>
@@ -35,8 +36,10 @@
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
 #include "BLI_linklist.h"
+#include "BLI_map.hh"
 #include "BLI_memarena.h"
 #include "BLI_string_utils.hh"
+#include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
 
@@ -1821,6 +1824,39 @@ void id_sort_by_name(ListBase *lb, ID *id, ID *id_sorting_hint)
 #undef ID_SORT_STEP_SIZE
 }
 
+void id_sort_by_name_all(ListBase *lb)
+{
+  if (lb->first == lb->last) {
+    return;
+  }
+
+  /* Local IDs come first, then linked ones grouped by library, in the order in which libraries
+   * first appear in the list. This matches what #id_sort_by_name gives when inserting them one
+   * by one. */
+  blender::Map<const Library *, int> library_order;
+  library_order.add(nullptr, 0);
+  blender::Vector<ID *> ids;
+  LISTBASE_FOREACH (ID *, id, lb) {
+    library_order.add(id->lib, library_order.size());
+    ids.append(id);
+  }
+
+  /* Stable, so that IDs with the same name keep their relative order. */
+  std::stable_sort(ids.begin(), ids.end(), [&](const ID *a, const ID *b) {
+    const int order_a = library_order.lookup(a->lib);
+    const int order_b = library_order.lookup(b->lib);
+    if (order_a != order_b) {
+      return order_a < order_b;
+    }
+    return BLI_strcasecmp(a->name, b->name) < 0;
+  });
+
+  BLI_listbase_clear(lb);
+  for (ID *id : ids) {
+    BLI_addtail(lb, id);
+  }
+}
+
 bool BKE_id_new_name_validate(
     Main *bmain, ListBase *lb, ID *id, const char *newname, const bool do_linked_data)
 {
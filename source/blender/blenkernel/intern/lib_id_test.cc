@@ -292,6 +292,33 @@ TEST(lib_id_main_unique_name, ids_sorted_by_default_with_libraries)
   EXPECT_EQ(ctx.bmain->name_map_global, nullptr);
 }
 
+TEST(lib_id_main_sort, sort_all)
+{
+  LibIDMainSortTestContext ctx;
+
+  Library *lib_one = static_cast<Library *>(BKE_id_new(ctx.bmain, ID_LI, "LibOne"));
+  Library *lib_two = static_cast<Library *>(BKE_id_new(ctx.bmain, ID_LI, "LibTwo"));
+
+  ID *id_l2b = add_id_in_library(ctx.bmain, "B", lib_two);
+  ID *id_l1c = add_id_in_library(ctx.bmain, "C", lib_one);
+  ID *id_l1a = add_id_in_library(ctx.bmain, "A", lib_one);
+  ID *id_foo = static_cast<ID *>(BKE_id_new(ctx.bmain, ID_OB, "Foo"));
+  ID *id_bar = static_cast<ID *>(BKE_id_new(ctx.bmain, ID_OB, "Bar"));
+  test_lib_id_main_sort_check_order({id_bar, id_foo, id_l2b, id_l1a, id_l1c});
+
+  /* Scramble the list, as when many IDs are added at once without sorting. */
+  for (ID *id : {id_l1a, id_foo, id_l2b, id_bar, id_l1c}) {
+    BLI_remlink(&ctx.bmain->objects, id);
+    BLI_addtail(&ctx.bmain->objects, id);
+  }
+
+  /* Libraries keep the order in which they first appear, local IDs come first. */
+  id_sort_by_name_all(&ctx.bmain->objects);
+  test_lib_id_main_sort_check_order({id_bar, id_foo, id_l1a, id_l1c, id_l2b});
+
+  EXPECT_TRUE(BKE_main_namemap_validate(ctx.bmain));
+}
+
 TEST(lib_id_main_unique_name, name_too_long_handling)
 {
   LibIDMainSortTestContext ctx;
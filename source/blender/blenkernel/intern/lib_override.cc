@@ -3261,6 +3261,20 @@ static void lib_override_resync_tagging_finalize(Main *bmain,
       false);
 }
 
+/* Whether any liboverride at given library indirect level may need to be resynced. */
+static bool lib_override_library_main_resync_level_has_overrides(
+    Main *bmain, const int library_indirect_level)
+{
+  ID *id;
+  FOREACH_MAIN_ID_BEGIN (bmain, id) {
+    if (!lib_override_library_main_resync_id_skip_check(id, library_indirect_level)) {
+      return true;
+    }
+  }
+  FOREACH_MAIN_ID_END;
+  return false;
+}
+
 /* Ensure resync of all overrides at one level of indirect usage.
  *
  * We need to handle each level independently, since an override at level n may be affected by
@@ -3277,6 +3291,13 @@ static bool lib_override_library_main_resync_on_library_indirect_level(
   const bool do_reports_recursive_resync_timing = (library_indirect_level != 0);
   const double init_time = do_reports_recursive_resync_timing ? BLI_time_now_seconds() : 0.0;
 
+  /* Most library levels in production files do not contain any liboverride at all. Building the
+   * relations and tagging linked hierarchies is a full scan of Main, skip it when there is
+   * nothing that could be resynced on this level. */
+  if (!lib_override_library_main_resync_level_has_overrides(bmain, library_indirect_level)) {
+    return false;
+  }
+
   BKE_main_relations_create(bmain, 0);
   BKE_main_id_tag_all(bmain, LIB_TAG_DOIT, false);
 
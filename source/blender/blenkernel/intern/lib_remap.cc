@@ -12,6 +12,7 @@
 
 #include "BLI_array.hh"
 #include "BLI_linklist.h"
+#include "BLI_set.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_collection_types.h"
@@ -343,6 +344,18 @@ static void libblock_remap_data_preprocess(ID *id_owner,
   }
 }
 
+static void libblock_remap_data_postprocess_metaball_update(Main *bmain, const Object *old_ob)
+{
+  for (Object *ob = static_cast<Object *>(bmain->objects.first); ob != nullptr;
+       ob = static_cast<Object *>(ob->id.next))
+  {
+    if (ob->type == OB_MBALL && BKE_mball_is_basis_for(ob, old_ob)) {
+      DEG_id_tag_update(&ob->id, ID_RECALC_GEOMETRY);
+      break; /* There is only one basis... */
+    }
+  }
+}
+
 /**
  * Can be called with both old_ob and new_ob being nullptr,
  * this means we have to check whole Main database then.
@@ -370,14 +383,7 @@ static void libblock_remap_data_postprocess_object_update(Main *bmain,
     }
   }
   else {
-    for (Object *ob = static_cast<Object *>(bmain->objects.first); ob != nullptr;
-         ob = static_cast<Object *>(ob->id.next))
-    {
-      if (ob->type == OB_MBALL && BKE_mball_is_basis_for(ob, old_ob)) {
-        DEG_id_tag_update(&ob->id, ID_RECALC_GEOMETRY);
-        break; /* There is only one basis... */
-      }
-    }
+    libblock_remap_data_postprocess_metaball_update(bmain, old_ob);
   }
 }
 
@@ -552,7 +558,55 @@ static void libblock_remap_data(
   });
 }
 
-static void libblock_remap_foreach_idpair(ID *old_id, ID *new_id, Main *bmain, int remap_flags)
+/**
+ * Updates of the whole Main database needed after remapping, accumulated over all remapped pairs
+ * so that they are only done once, see #libblock_remap_data_postprocess_main.
+ */
+struct IDRemapPostprocess {
+  bool do_object_update = false;
+  bool do_collection_remove_nulls = false;
+  bool do_collection_relations_rebuild = false;
+  /** New obdata IDs, objects using them need to be updated. */
+  blender::Set<ID *> new_obdata_ids;
+};
+
+static void libblock_remap_data_postprocess_main(Main *bmain,
+                                                 const IDRemapPostprocess &postprocess)
+{
+  if (postprocess.do_object_update) {
+    /* Will only effectively process collections that have been tagged with
+     * #COLLECTION_TAG_COLLECTION_OBJECT_DIRTY. See #collection_foreach_id callback. */
+    BKE_collections_object_remove_invalids(bmain);
+  }
+  if (postprocess.do_collection_remove_nulls) {
+    /* See #libblock_remap_data_postprocess_collection_update. */
+    BKE_collections_child_remove_nulls(bmain, nullptr, nullptr);
+  }
+  if (postprocess.do_collection_relations_rebuild) {
+    BKE_main_collections_parent_relations_rebuild(bmain);
+  }
+  if (postprocess.do_object_update || postprocess.do_collection_remove_nulls ||
+      postprocess.do_collection_relations_rebuild)
+  {
+    BKE_main_collection_sync_remap(bmain);
+  }
+
+  if (!postprocess.new_obdata_ids.is_empty()) {
+    for (Object *ob = static_cast<Object *>(bmain->objects.first); ob;
+         ob = static_cast<Object *>(ob->id.next))
+    {
+      if (ob->data && postprocess.new_obdata_ids.contains(static_cast<ID *>(ob->data))) {
+        libblock_remap_data_postprocess_obdata_relink(bmain, ob, static_cast<ID *>(ob->data));
+      }
+    }
+  }
+}
+
+static void libblock_remap_foreach_idpair(ID *old_id,
+                                          ID *new_id,
+                                          Main *bmain,
+                                          int remap_flags,
+                                          IDRemapPostprocess &postprocess)
 {
   if (old_id == new_id) {
     return;
@@ -600,15 +654,22 @@ static void libblock_remap_foreach_idpair(ID *old_id, ID *new_id, Main *bmain, i
 
   /* Some after-process updates.
    * This is a bit ugly, but cannot see a way to avoid it.
-   * Maybe we should do a per-ID callback for this instead? */
+   * Maybe we should do a per-ID callback for this instead?
+   *
+   * Updates that process the whole Main database are only recorded here, and done once for all
+   * remapped pairs. */
   switch (GS(old_id->name)) {
     case ID_OB:
-      libblock_remap_data_postprocess_object_update(
-          bmain, (Object *)old_id, (Object *)new_id, true);
+      libblock_remap_data_postprocess_metaball_update(bmain, (Object *)old_id);
+      postprocess.do_object_update = true;
       break;
     case ID_GR:
-      libblock_remap_data_postprocess_collection_update(
-          bmain, nullptr, (Collection *)old_id, (Collection *)new_id);
+      if (new_id == nullptr) {
+        postprocess.do_collection_remove_nulls = true;
+      }
+      else {
+        postprocess.do_collection_relations_rebuild = true;
+      }
       break;
     case ID_ME:
     case ID_CU_LEGACY:
@@ -617,11 +678,7 @@ static void libblock_remap_foreach_idpair(ID *old_id, ID *new_id, Main *bmain, i
     case ID_PT:
     case ID_VO:
       if (new_id) { /* Only affects us in case obdata was relinked (changed). */
-        for (Object *ob = static_cast<Object *>(bmain->objects.first); ob;
-             ob = static_cast<Object *>(ob->id.next))
-        {
-          libblock_remap_data_postprocess_obdata_relink(bmain, ob, new_id);
-        }
+        postprocess.new_obdata_ids.add(new_id);
       }
       break;
     default:
@@ -651,9 +708,11 @@ void BKE_libblock_remap_multiple_locked(Main *bmain, IDRemapper &mappings, const
 
   libblock_remap_data(bmain, nullptr, ID_REMAP_TYPE_REMAP, mappings, remap_flags);
 
+  IDRemapPostprocess postprocess;
   mappings.iter([&](ID *old_id, ID *new_id) {
-    libblock_remap_foreach_idpair(old_id, new_id, bmain, remap_flags);
+    libblock_remap_foreach_idpair(old_id, new_id, bmain, remap_flags, postprocess);
   });
+  libblock_remap_data_postprocess_main(bmain, postprocess);
 
   /* We assume editors do not hold references to their IDs... This is false in some cases
    * (Image is especially tricky here),
@@ -26,6 +26,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector_types.hh"
+#include "BLI_profile_trace.hh"
 #include "BLI_span.hh"
 #include "BLI_task.h"
 #include "BLI_task.hh"
@@ -261,7 +262,10 @@ static Mesh *modifier_modify_mesh_and_geometry_set(ModifierData *md,
     geometry_set.replace_mesh(input_mesh, GeometryOwnershipType::Editable);
 
     /* Let the modifier change the geometry set. */
-    mti->modify_geometry_set(md, &mectx, &geometry_set);
+    {
+      PROFILE_TRACE_ZONE_DETAIL("Modifier", md->name);
+      mti->modify_geometry_set(md, &mectx, &geometry_set);
+    }
 
     /* Release the mesh from the geometry set again. */
     if (geometry_set.has<MeshComponent>()) {
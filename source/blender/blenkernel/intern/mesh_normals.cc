@@ -19,6 +19,7 @@
 
 #include "BLI_array_utils.hh"
 #include "BLI_bit_vector.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_linklist.h"
 #include "BLI_math_base.hh"
 #include "BLI_math_vector.hh"
@@ -148,13 +149,52 @@ void normals_calc_faces(const Span<float3> positions,
                         MutableSpan<float3> face_normals)
 {
   BLI_assert(faces.size() == face_normals.size());
-  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+  /* The cost depends on the face sizes, which vary a lot between meshes. */
+  static threading::AdaptiveGrainSize grain_size{"normals_calc_faces"};
+  threading::parallel_for(faces.index_range(), grain_size, [&](const IndexRange range) {
     for (const int i : range) {
       face_normals[i] = normal_calc_ngon(positions, corner_verts.slice(faces[i]));
     }
   });
 }
 
+void normals_calc_faces(const Span<float3> positions,
+                        const OffsetIndices<int> faces,
+                        const Span<int> corner_verts,
+                        const IndexMask &face_mask,
+                        MutableSpan<float3> face_normals)
+{
+  BLI_assert(faces.size() == face_normals.size());
+  face_mask.foreach_index(GrainSize(1024), [&](const int i) {
+    face_normals[i] = normal_calc_ngon(positions, corner_verts.slice(faces[i]));
+  });
+}
+
+static float3 vert_normal_calc(const Span<float3> positions,
+                               const OffsetIndices<int> faces,
+                               const Span<int> corner_verts,
+                               const GroupedSpan<int> vert_to_face_map,
+                               const Span<float3> face_normals,
+                               const int vert)
+{
+  const Span<int> vert_faces = vert_to_face_map[vert];
+  if (vert_faces.is_empty()) {
+    return math::normalize(positions[vert]);
+  }
+
+  float3 vert_normal(0);
+  for (const int face : vert_faces) {
+    const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
+    const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
+    const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
+    const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
+
+    vert_normal += face_normals[face] * factor;
+  }
+
+  return math::normalize(vert_normal);
+}
+
 void normals_calc_verts(const Span<float3> vert_positions,
                         const OffsetIndices<int> faces,
                         const Span<int> corner_verts,
@@ -162,30 +202,28 @@ void normals_calc_verts(const Span<float3> vert_positions,
                         const Span<float3> face_normals,
                         MutableSpan<float3> vert_normals)
 {
-  const Span<float3> positions = vert_positions;
-  threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
+  threading::parallel_for(vert_positions.index_range(), 1024, [&](const IndexRange range) {
     for (const int vert : range) {
-      const Span<int> vert_faces = vert_to_face_map[vert];
-      if (vert_faces.is_empty()) {
-        vert_normals[vert] = math::normalize(positions[vert]);
-        continue;
-      }
-
-      float3 vert_normal(0);
-      for (const int face : vert_faces) {
-        const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
-        const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
-        const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
-        const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
-
-        vert_normal += face_normals[face] * factor;
-      }
-
-      vert_normals[vert] = math::normalize(vert_normal);
+      vert_normals[vert] = vert_normal_calc(
+          vert_positions, faces, corner_verts, vert_to_face_map, face_normals, vert);
     }
   });
 }
 
+void normals_calc_verts(const Span<float3> vert_positions,
+                        const OffsetIndices<int> faces,
+                        const Span<int> corner_verts,
+                        const GroupedSpan<int> vert_to_face_map,
+                        const Span<float3> face_normals,
+                        const IndexMask &vert_mask,
+                        MutableSpan<float3> vert_normals)
+{
+  vert_mask.foreach_index(GrainSize(1024), [&](const int vert) {
+    vert_normals[vert] = vert_normal_calc(
+        vert_positions, faces, corner_verts, vert_to_face_map, face_normals, vert);
+  });
+}
+
 /** \} */
 
 }  // namespace blender::bke::mesh
@@ -1246,7 +1284,9 @@ void normals_calc_corners(const Span<float3> vert_positions,
     }
   });
 
-  threading::parallel_for(fan_corners.index_range(), 1024, [&](const IndexRange range) {
+  /* The cost of a fan depends on the number of faces around the vertex. */
+  static threading::AdaptiveGrainSize fan_grain_size{"normals_calc_corners_fans"};
+  threading::parallel_for(fan_corners.index_range(), fan_grain_size, [&](const IndexRange range) {
     Vector<float3, 16> edge_vectors;
     for (const int i : range) {
       const int corner = fan_corners[i];
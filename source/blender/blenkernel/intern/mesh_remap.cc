@@ -25,6 +25,7 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_bvhutils.hh"
@@ -446,6 +447,83 @@ struct IslandResult {
 /* Will be enough in 99% of cases. */
 #define MREMAP_DEFAULT_BUFSIZE 32
 
+/**
+ * Run the nearest queries of all destination vertices in parallel. A miss is stored with a -1
+ * index. Items are defined by the caller afterwards, since #mesh_remap_item_define allocates
+ * from the map's memory arena, which is not thread-safe.
+ */
+static blender::Array<BVHTreeNearest> mesh_remap_verts_query_nearest(
+    BVHTreeFromMesh *treedata,
+    const SpaceTransform *space_transform,
+    const float (*vert_positions_dst)[3],
+    const int numverts_dst,
+    const float max_dist_sq)
+{
+  blender::Array<BVHTreeNearest> results(numverts_dst);
+  blender::threading::parallel_for(
+      results.index_range(), 1024, [&](const blender::IndexRange range) {
+        /* The local proximity heuristics carry over between consecutive vertices of a range. */
+        BVHTreeNearest nearest = {0};
+        nearest.index = -1;
+        float hit_dist;
+        for (const int64_t i : range) {
+          float tmp_co[3];
+          copy_v3_v3(tmp_co, vert_positions_dst[i]);
+
+          /* Convert the vertex to tree coordinates, if needed. */
+          if (space_transform) {
+            BLI_space_transform_apply(space_transform, tmp_co);
+          }
+
+          if (mesh_remap_bvhtree_query_nearest(treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
+          {
+            results[i] = nearest;
+          }
+          else {
+            results[i].index = -1;
+          }
+        }
+      });
+  return results;
+}
+
+/**
+ * Same as #mesh_remap_verts_query_nearest, for ray-casts along the destination normals.
+ */
+static blender::Array<BVHTreeRayHit> mesh_remap_verts_query_raycast(
+    BVHTreeFromMesh *treedata,
+    const SpaceTransform *space_transform,
+    const float (*vert_positions_dst)[3],
+    const blender::Span<blender::float3> vert_normals_dst,
+    const int numverts_dst,
+    const float ray_radius,
+    const float max_dist)
+{
+  blender::Array<BVHTreeRayHit> results(numverts_dst);
+  blender::threading::parallel_for(
+      results.index_range(), 1024, [&](const blender::IndexRange range) {
+        float hit_dist;
+        for (const int64_t i : range) {
+          float tmp_co[3], tmp_no[3];
+          copy_v3_v3(tmp_co, vert_positions_dst[i]);
+          copy_v3_v3(tmp_no, vert_normals_dst[i]);
+
+          /* Convert the vertex to tree coordinates, if needed. */
+          if (space_transform) {
+            BLI_space_transform_apply(space_transform, tmp_co);
+            BLI_space_transform_apply_normal(space_transform, tmp_no);
+          }
+
+          if (!mesh_remap_bvhtree_query_raycast(
+                  treedata, &results[i], tmp_co, tmp_no, ray_radius, max_dist, &hit_dist))
+          {
+            results[i].index = -1;
+          }
+        }
+      });
+  return results;
+}
+
 void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
                                          const SpaceTransform *space_transform,
                                          const float max_dist,
@@ -472,25 +550,18 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
   }
   else {
     BVHTreeFromMesh treedata = {nullptr};
-    BVHTreeNearest nearest = {0};
-    BVHTreeRayHit rayhit = {0};
     float hit_dist;
-    float tmp_co[3], tmp_no[3];
+    float tmp_co[3];
 
     if (mode == MREMAP_MODE_VERT_NEAREST) {
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_VERTS, 2);
-      nearest.index = -1;
+      const blender::Array<BVHTreeNearest> nearest_dst = mesh_remap_verts_query_nearest(
+          &treedata, space_transform, vert_positions_dst, numverts_dst, max_dist_sq);
 
       for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
-
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
+        const BVHTreeNearest &nearest = nearest_dst[i];
+        if (nearest.index != -1) {
+          hit_dist = sqrtf(nearest.dist_sq);
           mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
         }
         else {
@@ -504,18 +575,20 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       const blender::Span<blender::float3> positions_src = me_src->vert_positions();
 
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_EDGES, 2);
-      nearest.index = -1;
+      const blender::Array<BVHTreeNearest> nearest_dst = mesh_remap_verts_query_nearest(
+          &treedata, space_transform, vert_positions_dst, numverts_dst, max_dist_sq);
 
       for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
+        const BVHTreeNearest &nearest = nearest_dst[i];
+        if (nearest.index != -1) {
+          hit_dist = sqrtf(nearest.dist_sq);
+          copy_v3_v3(tmp_co, vert_positions_dst[i]);
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+          /* Convert the vertex to tree coordinates, if needed. */
+          if (space_transform) {
+            BLI_space_transform_apply(space_transform, tmp_co);
+          }
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
           const blender::int2 &edge = edges_src[nearest.index];
           const float *v1cos = positions_src[edge[0]];
           const float *v2cos = positions_src[edge[1]];
@@ -568,19 +641,19 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_CORNER_TRIS, 2);
 
       if (mode == MREMAP_MODE_VERT_POLYINTERP_VNORPROJ) {
-        for (i = 0; i < numverts_dst; i++) {
-          copy_v3_v3(tmp_co, vert_positions_dst[i]);
-          copy_v3_v3(tmp_no, vert_normals_dst[i]);
-
-          /* Convert the vertex to tree coordinates, if needed. */
-          if (space_transform) {
-            BLI_space_transform_apply(space_transform, tmp_co);
-            BLI_space_transform_apply_normal(space_transform, tmp_no);
-          }
+        const blender::Array<BVHTreeRayHit> rayhit_dst = mesh_remap_verts_query_raycast(
+            &treedata,
+            space_transform,
+            vert_positions_dst,
+            vert_normals_dst,
+            numverts_dst,
+            ray_radius,
+            max_dist);
 
-          if (mesh_remap_bvhtree_query_raycast(
-                  &treedata, &rayhit, tmp_co, tmp_no, ray_radius, max_dist, &hit_dist))
-          {
+        for (i = 0; i < numverts_dst; i++) {
+          const BVHTreeRayHit &rayhit = rayhit_dst[i];
+          if (rayhit.index != -1) {
+            hit_dist = rayhit.dist;
             const int face_index = tri_faces[rayhit.index];
             const int sources_num = mesh_remap_interp_face_data_get(faces_src[face_index],
                                                                     corner_verts_src,
@@ -603,19 +676,13 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
         }
       }
       else {
-        nearest.index = -1;
+        const blender::Array<BVHTreeNearest> nearest_dst = mesh_remap_verts_query_nearest(
+            &treedata, space_transform, vert_positions_dst, numverts_dst, max_dist_sq);
 
         for (i = 0; i < numverts_dst; i++) {
-          copy_v3_v3(tmp_co, vert_positions_dst[i]);
-
-          /* Convert the vertex to tree coordinates, if needed. */
-          if (space_transform) {
-            BLI_space_transform_apply(space_transform, tmp_co);
-          }
-
-          if (mesh_remap_bvhtree_query_nearest(
-                  &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-          {
+          const BVHTreeNearest &nearest = nearest_dst[i];
+          if (nearest.index != -1) {
+            hit_dist = sqrtf(nearest.dist_sq);
             const int face_index = tri_faces[nearest.index];
 
             if (mode == MREMAP_MODE_VERT_FACE_NEAREST) {
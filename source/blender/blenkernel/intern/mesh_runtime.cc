@@ -9,6 +9,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_array_utils.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_math_geom.h"
 #include "BLI_task.hh"
 
@@ -43,10 +44,9 @@ static void free_mesh_eval(MeshRuntime &mesh_runtime)
 
 static void free_bvh_cache(MeshRuntime &mesh_runtime)
 {
-  if (mesh_runtime.bvh_cache) {
-    bvhcache_free(mesh_runtime.bvh_cache);
-    mesh_runtime.bvh_cache = nullptr;
-  }
+  /* The shared cache is only freed when the last mesh that uses it releases it. */
+  mesh_runtime.bvh_cache.reset();
+  mesh_runtime.unshared_bvh_cache.reset();
 }
 
 static void free_batch_cache(MeshRuntime &mesh_runtime)
@@ -390,6 +390,62 @@ void Mesh::tag_positions_changed()
   this->tag_positions_changed_no_normals();
 }
 
+void Mesh::tag_positions_changed(const blender::IndexMask &changed_verts)
+{
+  using namespace blender;
+  /* Updating part of the normals requires the vertex to face map and checking the neighborhood of
+   * every vertex, so when most of the mesh is affected, recomputing everything is faster. */
+  const bool is_small_part = changed_verts.size() < this->verts_num / 4;
+  if (!is_small_part || this->runtime->face_normals_cache.is_dirty()) {
+    this->tag_positions_changed();
+    return;
+  }
+  const Span<float3> positions = this->vert_positions();
+  const OffsetIndices faces = this->faces();
+  const Span<int> corner_verts = this->corner_verts();
+
+  Array<bool> verts_changed(this->verts_num, false);
+  changed_verts.to_bools(verts_changed);
+  IndexMaskMemory memory;
+  const IndexMask changed_faces = IndexMask::from_predicate(
+      faces.index_range(), GrainSize(1024), memory, [&](const int face) {
+        const Span<int> face_verts = corner_verts.slice(faces[face]);
+        return std::any_of(face_verts.begin(), face_verts.end(), [&](const int vert) {
+          return verts_changed[vert];
+        });
+      });
+
+  this->runtime->face_normals_cache.update([&](Vector<float3> &r_data) {
+    bke::mesh::normals_calc_faces(positions, faces, corner_verts, changed_faces, r_data);
+  });
+
+  if (this->runtime->vert_normals_cache.is_cached()) {
+    /* Vertex normals depend on the normals of all faces around them. */
+    Array<bool> faces_changed(faces.size(), false);
+    changed_faces.to_bools(faces_changed);
+    const GroupedSpan<int> vert_to_face = this->vert_to_face_map();
+    const IndexMask affected_verts = IndexMask::from_predicate(
+        IndexRange(this->verts_num), GrainSize(1024), memory, [&](const int vert) {
+          const Span<int> vert_faces = vert_to_face[vert];
+          return verts_changed[vert] ||
+                 std::any_of(vert_faces.begin(), vert_faces.end(), [&](const int face) {
+                   return faces_changed[face];
+                 });
+        });
+    const Span<float3> face_normals = this->runtime->face_normals_cache.data();
+    this->runtime->vert_normals_cache.update([&](Vector<float3> &r_data) {
+      bke::mesh::normals_calc_verts(
+          positions, faces, corner_verts, vert_to_face, face_normals, affected_verts, r_data);
+    });
+  }
+  else {
+    this->runtime->vert_normals_cache.tag_dirty();
+  }
+
+  this->runtime->corner_normals_cache.tag_dirty();
+  this->tag_positions_changed_no_normals();
+}
+
 void Mesh::tag_positions_changed_no_normals()
 {
   free_bvh_cache(*this->runtime);
@@ -335,12 +335,26 @@ static Mesh *mesh_wrapper_ensure_subdivision(Mesh *mesh)
     return mesh;
   }
 
+  /* When the subdivision is evaluated on the GPU for drawing, CPU consumers of the evaluated mesh
+   * (exporters, snapping, other objects' modifiers, ...) would evaluate it again after every
+   * update of the object, even if its input data did not change. */
+  if (Mesh *cached_mesh = BKE_subsurf_modifier_cpu_cache_lookup(runtime_data, mesh)) {
+    if (mesh->runtime->mesh_eval != nullptr) {
+      BKE_id_free(nullptr, mesh->runtime->mesh_eval);
+    }
+    mesh->runtime->mesh_eval = cached_mesh;
+    mesh->runtime->wrapper_type = ME_WRAPPER_TYPE_SUBD;
+    return cached_mesh;
+  }
+
   subdiv::Subdiv *subdiv = BKE_subsurf_modifier_subdiv_descriptor_ensure(
       runtime_data, mesh, false);
   if (subdiv == nullptr) {
     /* Happens on bad topology, but also on empty input mesh. */
     return mesh;
   }
+  /* Take the key before the temporary normals layer is added to the input. */
+  Mesh *cache_input = BKE_mesh_copy_for_eval(*mesh);
   const bool use_clnors = runtime_data->use_loop_normals;
   if (use_clnors) {
     /* If custom normals are present and the option is turned on calculate the split
@@ -363,6 +377,11 @@ static Mesh *mesh_wrapper_ensure_subdivision(Mesh *mesh)
     subdiv::free(subdiv);
   }
 
+  if (subdiv_mesh != mesh) {
+    BKE_subsurf_modifier_cpu_cache_store(runtime_data, cache_input, subdiv_mesh);
+  }
+  BKE_id_free(nullptr, cache_input);
+
   if (subdiv_mesh != mesh) {
     if (mesh->runtime->mesh_eval != nullptr) {
       BKE_id_free(nullptr, mesh->runtime->mesh_eval);
@@ -60,6 +60,10 @@ enum eNodeTreeChangedFlag {
 static void add_tree_tag(bNodeTree *ntree, const eNodeTreeChangedFlag flag)
 {
   ntree->runtime->changed_flag |= flag;
+  if (flag == NTREE_CHANGED_NODE_OUTPUT) {
+    /* Only the output of a node group used by this tree changed, its own topology is the same. */
+    return;
+  }
   ntree->runtime->topology_cache_mutex.tag_dirty();
   ntree->runtime->tree_zones_cache_mutex.tag_dirty();
 }
@@ -486,10 +490,23 @@ class NodeTreeMainUpdater {
     return reachable_trees;
   }
 
+  /**
+   * Whether the only change in the tree is that node groups it uses have a different output.
+   * Changes of a node group that affect inferencing in the trees using it (fields, anonymous
+   * attributes, enums, gizmos) change its interface and are propagated as node property changes.
+   */
+  static bool only_node_group_outputs_changed(const bNodeTree &ntree)
+  {
+    return ntree.runtime->changed_flag == NTREE_CHANGED_NODE_OUTPUT &&
+           !ntree.tree_interface.is_changed();
+  }
+
   TreeUpdateResult update_tree(bNodeTree &ntree)
   {
     TreeUpdateResult result;
 
+    const bool only_group_outputs_changed = only_node_group_outputs_changed(ntree);
+
     ntree.runtime->link_errors_by_target_node.clear();
 
     this->update_socket_link_and_use(ntree);
@@ -500,7 +517,9 @@ class NodeTreeMainUpdater {
     this->make_node_previews_dirty(ntree);
 
     this->propagate_runtime_flags(ntree);
-    if (ntree.type == NTREE_GEOMETRY) {
+    /* Inferencing only depends on the tree itself and the interfaces of the groups it uses. Trees
+     * using a big node group are all updated when its output changes, skip the work there. */
+    if (ntree.type == NTREE_GEOMETRY && !only_group_outputs_changed) {
       if (this->propagate_enum_definitions(ntree)) {
         result.interface_changed = true;
       }
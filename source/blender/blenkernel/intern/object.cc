@@ -2259,6 +2259,7 @@ ParticleSystem *BKE_object_copy_particlesystem(ParticleSystem *psys, const int f
 
   psysn->pathcache = nullptr;
   psysn->childcache = nullptr;
+  psysn->childcache_hash = 0;
   psysn->edit = nullptr;
   psysn->pdd = nullptr;
   psysn->effectors = nullptr;
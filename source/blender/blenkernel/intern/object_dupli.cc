@@ -14,6 +14,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
+#include "BLI_mempool.h"
 #include "BLI_string_utf8.h"
 
 #include "BLI_array.hh"
@@ -90,6 +91,8 @@ struct DupliContext {
   Scene *scene;
   /** Root parent object at the scene level. */
   Object *root_object;
+  /** Hash of the root object name, used for the random number of every instance. */
+  uint root_object_name_hash;
   /** Immediate parent object in the context. */
   Object *object;
   float space_mat[4][4];
@@ -127,6 +130,19 @@ struct DupliContext {
 
   /** Result containers. */
   ListBase *duplilist; /* Legacy doubly-linked list. */
+  /** Allocator of the #DupliObject added to #duplilist. */
+  BLI_mempool *dupli_pool;
+};
+
+/**
+ * Storage of a dupli-list. Only the list is exposed to the callers, allocating every
+ * #DupliObject from a pool avoids one allocation per instance, which adds up when there are
+ * millions of them.
+ */
+struct DupliList {
+  /** Has to be the first member, the list pointer is what is passed around. */
+  ListBase list;
+  BLI_mempool *pool;
 };
 
 struct DupliGenerator {
@@ -153,6 +169,7 @@ static void init_context(DupliContext *r_ctx,
   r_ctx->collection = nullptr;
 
   r_ctx->root_object = ob;
+  r_ctx->root_object_name_hash = BLI_hash_int(BLI_hash_string(ob->id.name + 2));
   r_ctx->object = ob;
   r_ctx->obedit = OBEDIT_FROM_OBACT(ob);
   r_ctx->instance_stack = &instance_stack;
@@ -171,6 +188,7 @@ static void init_context(DupliContext *r_ctx,
   }
 
   r_ctx->duplilist = nullptr;
+  r_ctx->dupli_pool = nullptr;
   r_ctx->preview_instance_index = -1;
   r_ctx->preview_base_geometry = nullptr;
 }
@@ -235,7 +253,7 @@ static DupliObject *make_dupli(const DupliContext *ctx,
 
   /* Add a #DupliObject instance to the result container. */
   if (ctx->duplilist) {
-    dob = MEM_cnew<DupliObject>("dupli object");
+    dob = static_cast<DupliObject *>(BLI_mempool_calloc(ctx->dupli_pool));
     BLI_addtail(ctx->duplilist, dob);
   }
   else {
@@ -301,7 +319,7 @@ static DupliObject *make_dupli(const DupliContext *ctx,
   }
 
   if (ctx->root_object != ob) {
-    dob->random_id ^= BLI_hash_int(BLI_hash_string(ctx->root_object->id.name + 2));
+    dob->random_id ^= ctx->root_object_name_hash;
   }
 
   return dob;
@@ -1761,20 +1779,28 @@ static const DupliGenerator *get_dupli_generator(const DupliContext *ctx)
 /** \name Dupli-Container Implementation
  * \{ */
 
+static DupliList *duplilist_new()
+{
+  DupliList *duplilist = MEM_cnew<DupliList>("duplilist");
+  duplilist->pool = BLI_mempool_create(sizeof(DupliObject), 0, 512, BLI_MEMPOOL_NOP);
+  return duplilist;
+}
+
 ListBase *object_duplilist(Depsgraph *depsgraph, Scene *sce, Object *ob)
 {
-  ListBase *duplilist = MEM_cnew<ListBase>("duplilist");
+  DupliList *duplilist = duplilist_new();
   DupliContext ctx;
   Vector<Object *> instance_stack;
   Vector<short> dupli_gen_type_stack({0});
   instance_stack.append(ob);
   init_context(&ctx, depsgraph, sce, ob, nullptr, instance_stack, dupli_gen_type_stack);
   if (ctx.gen) {
-    ctx.duplilist = duplilist;
+    ctx.duplilist = &duplilist->list;
+    ctx.dupli_pool = duplilist->pool;
     ctx.gen->make_duplis(&ctx);
   }
 
-  return duplilist;
+  return &duplilist->list;
 }
 
 ListBase *object_duplilist_preview(Depsgraph *depsgraph,
@@ -1782,13 +1808,14 @@ ListBase *object_duplilist_preview(Depsgraph *depsgraph,
                                    Object *ob_eval,
                                    const ViewerPath *viewer_path)
 {
-  ListBase *duplilist = MEM_cnew<ListBase>("duplilist");
+  DupliList *duplilist = duplilist_new();
   DupliContext ctx;
   Vector<Object *> instance_stack;
   Vector<short> dupli_gen_type_stack({0});
   instance_stack.append(ob_eval);
   init_context(&ctx, depsgraph, sce, ob_eval, nullptr, instance_stack, dupli_gen_type_stack);
-  ctx.duplilist = duplilist;
+  ctx.duplilist = &duplilist->list;
+  ctx.dupli_pool = duplilist->pool;
 
   Object *ob_orig = DEG_get_original_object(ob_eval);
 
@@ -1811,13 +1838,14 @@ ListBase *object_duplilist_preview(Depsgraph *depsgraph,
                                     ob_eval->type == OB_CURVES);
     }
   }
-  return duplilist;
+  return &duplilist->list;
 }
 
 void free_object_duplilist(ListBase *lb)
 {
-  BLI_freelistN(lb);
-  MEM_freeN(lb);
+  DupliList *duplilist = reinterpret_cast<DupliList *>(lb);
+  BLI_mempool_destroy(duplilist->pool);
+  MEM_freeN(duplilist);
 }
 
 /** \} */
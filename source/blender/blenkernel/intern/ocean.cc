@@ -23,6 +23,7 @@
 #include "BLI_path_util.h"
 #include "BLI_rand.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_image.h"
@@ -363,10 +364,9 @@ void BKE_ocean_eval_xz_catrom(Ocean *oc, OceanResult *ocr, float x, float z)
   BKE_ocean_eval_uv_catrom(oc, ocr, x / oc->_Lx, z / oc->_Lz);
 }
 
-void BKE_ocean_eval_ij(Ocean *oc, OceanResult *ocr, int i, int j)
+/** Same as #BKE_ocean_eval_ij, but the caller has to lock #Ocean.oceanmutex for reading. */
+static void ocean_eval_ij_nolock(const Ocean *oc, OceanResult *ocr, int i, int j)
 {
-  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
-
   i = abs(i) % oc->_M;
   j = abs(j) % oc->_N;
 
@@ -393,7 +393,12 @@ void BKE_ocean_eval_ij(Ocean *oc, OceanResult *ocr, int i, int j)
     compute_eigenstuff(
         ocr, oc->_Jxx[i * oc->_N + j], oc->_Jzz[i * oc->_N + j], oc->_Jxz[i * oc->_N + j]);
   }
+}
 
+void BKE_ocean_eval_ij(Ocean *oc, OceanResult *ocr, int i, int j)
+{
+  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
+  ocean_eval_ij_nolock(oc, ocr, i, j);
   BLI_rw_mutex_unlock(&oc->oceanmutex);
 }
 
@@ -1383,13 +1388,9 @@ void BKE_ocean_bake(Ocean *o,
                     void (*update_cb)(void *, float progress, int *cancel),
                     void *update_cb_data)
 {
-  /* NOTE(@ideasman42): some of these values remain uninitialized unless certain options
-   * are enabled, take care that #BKE_ocean_eval_ij() initializes a member before use. */
-  OceanResult ocr;
-
   ImageFormatData imf = {0};
 
-  int f, i = 0, x, y, cancel = 0;
+  int f, i = 0, cancel = 0;
   float progress;
 
   ImBuf *ibuf_foam, *ibuf_disp, *ibuf_normal, *ibuf_spray, *ibuf_spray_inverse;
@@ -1429,72 +1430,81 @@ void BKE_ocean_bake(Ocean *o,
 
     BKE_ocean_simulate(o, och->time[i], och->wave_scale, och->chop_amount);
 
-    /* add new foam */
-    for (y = 0; y < res_y; y++) {
-      for (x = 0; x < res_x; x++) {
+    /* Every pixel only depends on its own cell, so rows can be filled in parallel. Lock once for
+     * all rows instead of for every single cell. */
+    BLI_rw_mutex_lock(&o->oceanmutex, THREAD_LOCK_READ);
+    using namespace blender;
+    threading::parallel_for(IndexRange(res_y), 8, [&](const IndexRange y_range) {
+      for (const int y : y_range) {
+        for (int x = 0; x < res_x; x++) {
+          /* NOTE(@ideasman42): some of these values remain uninitialized unless certain options
+           * are enabled, take care that #BKE_ocean_eval_ij() initializes a member before use. */
+          OceanResult ocr;
+          ocean_eval_ij_nolock(o, &ocr, x, y);
+          const int pixel = res_x * y + x;
 
-        BKE_ocean_eval_ij(o, &ocr, x, y);
+          /* add to the image */
+          rgb_to_rgba_unit_alpha(&ibuf_disp->float_buffer.data[4 * pixel], ocr.disp);
 
-        /* add to the image */
-        rgb_to_rgba_unit_alpha(&ibuf_disp->float_buffer.data[4 * (res_x * y + x)], ocr.disp);
+          if (o->_do_jacobian) {
+            /* TODO(@ideasman42): cleanup unused code. */
 
-        if (o->_do_jacobian) {
-          /* TODO(@ideasman42): cleanup unused code. */
+            float /* r, */ /* UNUSED */ pr = 0.0f, foam_result;
+            float neg_disp, neg_eplus;
 
-          float /* r, */ /* UNUSED */ pr = 0.0f, foam_result;
-          float neg_disp, neg_eplus;
+            ocr.foam = BKE_ocean_jminus_to_foam(ocr.Jminus, och->foam_coverage);
 
-          ocr.foam = BKE_ocean_jminus_to_foam(ocr.Jminus, och->foam_coverage);
+            /* accumulate previous value for this cell */
+            if (i > 0) {
+              pr = prev_foam[pixel];
+            }
 
-          /* accumulate previous value for this cell */
-          if (i > 0) {
-            pr = prev_foam[res_x * y + x];
-          }
-
-          // r = BLI_rng_get_float(rng); /* UNUSED */ /* randomly reduce foam */
+            // r = BLI_rng_get_float(rng); /* UNUSED */ /* randomly reduce foam */
 
-          // pr = pr * och->foam_fade; /* overall fade */
+            // pr = pr * och->foam_fade; /* overall fade */
 
-          /* Remember ocean coord system is Y up!
-           * break up the foam where height (Y) is low (wave valley),
-           * and X and Z displacement is greatest. */
+            /* Remember ocean coord system is Y up!
+             * break up the foam where height (Y) is low (wave valley),
+             * and X and Z displacement is greatest. */
 
-          neg_disp = ocr.disp[1] < 0.0f ? 1.0f + ocr.disp[1] : 1.0f;
-          neg_disp = neg_disp < 0.0f ? 0.0f : neg_disp;
+            neg_disp = ocr.disp[1] < 0.0f ? 1.0f + ocr.disp[1] : 1.0f;
+            neg_disp = neg_disp < 0.0f ? 0.0f : neg_disp;
 
-          /* foam, 'ocr.Eplus' only initialized with do_jacobian */
-          neg_eplus = ocr.Eplus[2] < 0.0f ? 1.0f + ocr.Eplus[2] : 1.0f;
-          neg_eplus = neg_eplus < 0.0f ? 0.0f : neg_eplus;
+            /* foam, 'ocr.Eplus' only initialized with do_jacobian */
+            neg_eplus = ocr.Eplus[2] < 0.0f ? 1.0f + ocr.Eplus[2] : 1.0f;
+            neg_eplus = neg_eplus < 0.0f ? 0.0f : neg_eplus;
 
-          if (pr < 1.0f) {
-            pr *= pr;
-          }
+            if (pr < 1.0f) {
+              pr *= pr;
+            }
 
-          pr *= och->foam_fade * (0.75f + neg_eplus * 0.25f);
+            pr *= och->foam_fade * (0.75f + neg_eplus * 0.25f);
 
-          /* A full clamping should not be needed! */
-          foam_result = min_ff(pr + ocr.foam, 1.0f);
+            /* A full clamping should not be needed! */
+            foam_result = min_ff(pr + ocr.foam, 1.0f);
 
-          prev_foam[res_x * y + x] = foam_result;
+            prev_foam[pixel] = foam_result;
 
-          // foam_result = min_ff(foam_result, 1.0f);
+            // foam_result = min_ff(foam_result, 1.0f);
 
-          value_to_rgba_unit_alpha(&ibuf_foam->float_buffer.data[4 * (res_x * y + x)],
-                                   foam_result);
+            value_to_rgba_unit_alpha(&ibuf_foam->float_buffer.data[4 * pixel],
+                                     foam_result);
 
-          /* spray map baking */
-          if (o->_do_spray) {
-            rgb_to_rgba_unit_alpha(&ibuf_spray->float_buffer.data[4 * (res_x * y + x)], ocr.Eplus);
-            rgb_to_rgba_unit_alpha(&ibuf_spray_inverse->float_buffer.data[4 * (res_x * y + x)],
-                                   ocr.Eminus);
+            /* spray map baking */
+            if (o->_do_spray) {
+              rgb_to_rgba_unit_alpha(&ibuf_spray->float_buffer.data[4 * pixel], ocr.Eplus);
+              rgb_to_rgba_unit_alpha(&ibuf_spray_inverse->float_buffer.data[4 * pixel],
+                                     ocr.Eminus);
+            }
           }
-        }
 
-        if (o->_do_normals) {
-          rgb_to_rgba_unit_alpha(&ibuf_normal->float_buffer.data[4 * (res_x * y + x)], ocr.normal);
+          if (o->_do_normals) {
+            rgb_to_rgba_unit_alpha(&ibuf_normal->float_buffer.data[4 * pixel], ocr.normal);
+          }
         }
       }
-    }
+    });
+    BLI_rw_mutex_unlock(&o->oceanmutex);
 
     /* write the images */
     cache_filepath(filepath, och->bakepath, och->relbase, f, CACHE_TYPE_DISPLACE);
@@ -15,6 +15,8 @@
 #include <cstring>
 #include <optional>
 
+#include <xxhash.h>
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_defaults.h"
@@ -900,6 +902,7 @@ static void free_child_path_cache(ParticleSystem *psys)
   psys_free_path_cache_buffers(psys->childcache, &psys->childcachebufs);
   psys->childcache = nullptr;
   psys->totchildcache = 0;
+  psys->childcache_hash = 0;
 }
 void psys_free_path_cache(ParticleSystem *psys, PTCacheEdit *edit)
 {
@@ -3145,6 +3148,68 @@ static void exec_child_path_cache(TaskPool *__restrict /*pool*/, void *taskdata)
   }
 }
 
+template<typename T>
+static uint64_t hash_array(const uint64_t hash, const T *data, const int64_t size)
+{
+  return XXH3_64bits_withSeed(data, size_t(size) * sizeof(T), hash);
+}
+
+/**
+ * Hash of everything the child paths depend on, so that they don't have to be computed again when
+ * the particle system is evaluated without changes that affect the hair, e.g. when scrubbing
+ * through the timeline with static hair. Returns zero when the child paths can't be reused.
+ */
+static uint64_t child_paths_cache_hash(const ParticleThreadContext &ctx, const bool editupdate)
+{
+  const ParticleSimulationData &sim = ctx.sim;
+  const ParticleSystem *psys = sim.psys;
+  const ParticleSettings *part = psys->part;
+
+  /* Edit mode updates the paths in place. Effectors, textures and lattices can change over time
+   * without the inputs below changing. */
+  if (editupdate || psys_in_edit_mode(sim.depsgraph, psys) ||
+      (psys->recalc & ID_RECALC_PSYS_ALL) || (part->flag & PART_CHILD_EFFECT) ||
+      psys->lattice_deform_data != nullptr)
+  {
+    return 0;
+  }
+  for (const MTex *mtex : part->mtex) {
+    if (mtex && mtex->tex) {
+      return 0;
+    }
+  }
+  if (psys->pathcache == nullptr || ctx.mesh == nullptr) {
+    return 0;
+  }
+
+  const int settings[4] = {ctx.totchild, ctx.totparent, ctx.segments, ctx.extra_segments};
+  uint64_t hash = hash_array(0, settings, ARRAY_SIZE(settings));
+  hash = hash_array(hash, sim.ob->object_to_world().ptr(), 16);
+  hash = hash_array(hash, psys->child, psys->totchild);
+  for (const int p : blender::IndexRange(psys->totcached)) {
+    const ParticleCacheKey *keys = psys->pathcache[p];
+    hash = hash_array(hash, &keys->segments, 1);
+    if (keys->segments >= 0) {
+      hash = hash_array(hash, keys, keys->segments + 1);
+    }
+  }
+  const blender::Span<blender::float3> positions = ctx.mesh->vert_positions();
+  hash = hash_array(hash, positions.data(), positions.size());
+  for (const float *vgroup : {ctx.vg_length,
+                              ctx.vg_clump,
+                              ctx.vg_kink,
+                              ctx.vg_rough1,
+                              ctx.vg_rough2,
+                              ctx.vg_roughe,
+                              ctx.vg_twist})
+  {
+    if (vgroup) {
+      hash = hash_array(hash, vgroup, ctx.mesh->verts_num);
+    }
+  }
+  return hash;
+}
+
 void psys_cache_child_paths(ParticleSimulationData *sim,
                             float cfra,
                             const bool editupdate,
@@ -3165,6 +3230,15 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
     return;
   }
 
+  const uint64_t cache_hash = child_paths_cache_hash(ctx, editupdate);
+  if (cache_hash != 0 && cache_hash == sim->psys->childcache_hash && sim->psys->childcache &&
+      ctx.totchild == sim->psys->totchildcache)
+  {
+    /* Nothing changed since the child paths were computed. */
+    psys_thread_context_free(&ctx);
+    return;
+  }
+
   task_pool = BLI_task_pool_create(&ctx, TASK_PRIORITY_HIGH);
   totchild = ctx.totchild;
   totparent = ctx.totparent;
@@ -3180,6 +3254,7 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
         &sim->psys->childcachebufs, totchild, ctx.segments + ctx.extra_segments + 1);
     sim->psys->totchildcache = totchild;
   }
+  sim->psys->childcache_hash = cache_hash;
 
   /* cache parent paths */
   ctx.parent_pass = 1;
@@ -5402,6 +5477,7 @@ void BKE_particle_system_blend_read_data(BlendDataReader *reader, ListBase *part
     psys->free_edit = nullptr;
     psys->pathcache = nullptr;
     psys->childcache = nullptr;
+    psys->childcache_hash = 0;
     BLI_listbase_clear(&psys->pathcachebufs);
     BLI_listbase_clear(&psys->childcachebufs);
     psys->pdd = nullptr;
@@ -12,6 +12,7 @@
 
 #include "BLI_array_utils.hh"
 #include "BLI_bit_span_ops.hh"
+#include "BLI_bit_vector.hh"
 #include "BLI_bitmap.h"
 #include "BLI_bounds.hh"
 #include "BLI_enumerable_thread_specific.hh"
@@ -157,15 +158,14 @@ static int partition_indices_material_faces(MutableSpan<int> indices,
 /* Add a vertex to the map, with a positive value for unique vertices and
  * a negative value for additional vertices */
 static int map_insert_vert(Map<int, int> &map,
-                           MutableSpan<bool> vert_bitmap,
+                           const bool is_owned,
                            int *face_verts,
                            int *uniq_verts,
                            int vertex)
 {
   return map.lookup_or_add_cb(vertex, [&]() {
     int value;
-    if (!vert_bitmap[vertex]) {
-      vert_bitmap[vertex] = true;
+    if (is_owned) {
       value = *uniq_verts;
       (*uniq_verts)++;
     }
@@ -177,10 +177,15 @@ static int map_insert_vert(Map<int, int> &map,
   });
 }
 
-/* Find vertices used by the faces in this node and update the draw buffers */
+/**
+ * Find vertices used by the faces in this node and update the draw buffers.
+ *
+ * \param owned_corners: For every triangle corner, whether it is the first use of its vertex in
+ * the node that the vertex is unique to.
+ */
 static void build_mesh_leaf_node(const Span<int> corner_verts,
                                  const Span<int3> corner_tris,
-                                 MutableSpan<bool> vert_bitmap,
+                                 const BitSpan owned_corners,
                                  Node &node)
 {
   node.unique_verts_num_ = 0;
@@ -194,10 +199,14 @@ static void build_mesh_leaf_node(const Span<int> corner_verts,
   node.face_vert_indices_.reinitialize(prim_indices.size());
 
   for (const int i : prim_indices.index_range()) {
-    const int3 &tri = corner_tris[prim_indices[i]];
+    const int prim = prim_indices[i];
+    const int3 &tri = corner_tris[prim];
     for (int j = 0; j < 3; j++) {
-      node.face_vert_indices_[i][j] = map_insert_vert(
-          map, vert_bitmap, &shared_verts, &node.unique_verts_num_, corner_verts[tri[j]]);
+      node.face_vert_indices_[i][j] = map_insert_vert(map,
+                                                      owned_corners[int64_t(prim) * 3 + j],
+                                                      &shared_verts,
+                                                      &node.unique_verts_num_,
+                                                      corner_verts[tri[j]]);
     }
   }
 
@@ -257,7 +266,7 @@ static void build_nodes_recursive_mesh(Tree &pbvh,
                                        const Span<int> material_indices,
                                        const Span<bool> sharp_faces,
                                        const int leaf_limit,
-                                       MutableSpan<bool> vert_bitmap,
+                                       Vector<int> &r_leaves,
                                        const int node_index,
                                        const Bounds<float3> *cb,
                                        const Span<Bounds<float3>> prim_bounds,
@@ -277,8 +286,7 @@ static void build_nodes_recursive_mesh(Tree &pbvh,
       Node &node = pbvh.nodes_[node_index];
       node.flag_ |= PBVH_Leaf;
       node.prim_indices_ = pbvh.prim_indices_.as_span().slice(prim_offset, prims_num);
-      build_mesh_leaf_node(corner_verts, corner_tris, vert_bitmap, node);
-
+      r_leaves.append(node_index);
       return;
     }
   }
@@ -329,7 +337,7 @@ static void build_nodes_recursive_mesh(Tree &pbvh,
                              material_indices,
                              sharp_faces,
                              leaf_limit,
-                             vert_bitmap,
+                             r_leaves,
                              pbvh.nodes_[node_index].children_offset_,
                              nullptr,
                              prim_bounds,
@@ -344,7 +352,7 @@ static void build_nodes_recursive_mesh(Tree &pbvh,
                              material_indices,
                              sharp_faces,
                              leaf_limit,
-                             vert_bitmap,
+                             r_leaves,
                              pbvh.nodes_[node_index].children_offset_ + 1,
                              nullptr,
                              prim_bounds,
@@ -379,8 +387,6 @@ std::unique_ptr<Tree> build_mesh(Mesh *mesh)
   update_mesh_pointers(*pbvh, mesh);
   const Span<int> tri_faces = mesh->corner_tri_faces();
 
-  Array<bool> vert_bitmap(mesh->verts_num, false);
-
   const int leaf_limit = LEAF_LIMIT;
 
   /* For each face, store the AABB and the AABB centroid */
@@ -414,6 +420,7 @@ std::unique_ptr<Tree> build_mesh(Mesh *mesh)
     array_utils::fill_index_range<int>(pbvh->prim_indices_);
 
     pbvh->nodes_.resize(1);
+    Vector<int> leaves;
     build_nodes_recursive_mesh(*pbvh,
                                corner_verts,
                                corner_tris,
@@ -421,7 +428,7 @@ std::unique_ptr<Tree> build_mesh(Mesh *mesh)
                                material_index,
                                sharp_face,
                                leaf_limit,
-                               vert_bitmap,
+                               leaves,
                                0,
                                &cb,
                                prim_bounds,
@@ -430,6 +437,31 @@ std::unique_ptr<Tree> build_mesh(Mesh *mesh)
                                Array<int>(pbvh->prim_indices_.size()),
                                0);
 
+    /* Every vertex is unique to the first leaf that uses it, in the order the leaves were
+     * created. Deciding that is cheap and has to be done serially, but afterwards the much more
+     * expensive gathering of each leaf's vertices can happen in parallel. */
+    BitVector<> owned_corners(corner_tris.size() * 3, false);
+    {
+      BitVector<> vert_used(mesh->verts_num, false);
+      for (const int leaf : leaves) {
+        for (const int prim : pbvh->nodes_[leaf].prim_indices_) {
+          const int3 &tri = corner_tris[prim];
+          for (int j = 0; j < 3; j++) {
+            const int vert = corner_verts[tri[j]];
+            if (!vert_used[vert]) {
+              vert_used[vert].set();
+              owned_corners[int64_t(prim) * 3 + j].set();
+            }
+          }
+        }
+      }
+    }
+    threading::parallel_for(leaves.index_range(), 8, [&](const IndexRange range) {
+      for (const int leaf : leaves.as_span().slice(range)) {
+        build_mesh_leaf_node(corner_verts, corner_tris, owned_corners, pbvh->nodes_[leaf]);
+      }
+    });
+
     update_bounds(*pbvh);
     store_bounds_orig(*pbvh);
 
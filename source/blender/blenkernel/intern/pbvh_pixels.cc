@@ -445,10 +445,15 @@ struct UVPrimitiveLookup {
   }
 };
 
+/** An image tile with its buffer, which stays acquired while the pixels are extracted. */
+struct TileBuffer {
+  image::ImageTileWrapper image_tile;
+  ImBuf *image_buffer;
+};
+
 struct EncodePixelsUserData {
   const uv_islands::MeshData *mesh_data;
-  Image *image;
-  ImageUser *image_user;
+  Span<TileBuffer> tile_buffers;
   Tree *pbvh;
   Vector<Node *> *nodes;
   const uv_islands::UVIslandsMask *uv_masks;
@@ -459,19 +464,13 @@ struct EncodePixelsUserData {
 static void do_encode_pixels(EncodePixelsUserData *data, const int n)
 {
   const uv_islands::MeshData &mesh_data = *data->mesh_data;
-  Image *image = data->image;
-  ImageUser image_user = *data->image_user;
   Node *node = (*data->nodes)[n];
   NodeData *node_data = static_cast<NodeData *>(node->pixels_);
   const uv_islands::UVIslandsMask &uv_masks = *data->uv_masks;
 
-  LISTBASE_FOREACH (ImageTile *, tile, &data->image->tiles) {
-    image::ImageTileWrapper image_tile(tile);
-    image_user.tile = image_tile.get_tile_number();
-    ImBuf *image_buffer = BKE_image_acquire_ibuf(image, &image_user, nullptr);
-    if (image_buffer == nullptr) {
-      continue;
-    }
+  for (const TileBuffer &tile_buffer : data->tile_buffers) {
+    const image::ImageTileWrapper &image_tile = tile_buffer.image_tile;
+    const ImBuf *image_buffer = tile_buffer.image_buffer;
 
     UDIMTilePixels tile_data;
     tile_data.tile_number = image_tile.get_tile_number();
@@ -519,7 +518,6 @@ static void do_encode_pixels(EncodePixelsUserData *data, const int n)
                                    maxy);
       }
     }
-    BKE_image_release_ibuf(image, image_buffer, nullptr);
 
     if (tile_data.pixel_rows.is_empty()) {
       continue;
@@ -667,6 +665,9 @@ static bool update_pixels(Tree &pbvh, Mesh *mesh, Image *image, ImageUser *image
       mesh->corner_tris(), mesh->corner_verts(), uv_map, pbvh.vert_positions_);
   uv_islands::UVIslands islands(mesh_data);
 
+  /* Acquire the tile buffers once, instead of in every node which would make the threads
+   * contend on the image lock. */
+  Vector<TileBuffer> tile_buffers;
   uv_islands::UVIslandsMask uv_masks;
   ImageUser tile_user = *image_user;
   LISTBASE_FOREACH (ImageTile *, tile_data, &image->tiles) {
@@ -678,7 +679,7 @@ static bool update_pixels(Tree &pbvh, Mesh *mesh, Image *image, ImageUser *image
     }
     uv_masks.add_tile(float2(image_tile.get_tile_x_offset(), image_tile.get_tile_y_offset()),
                       ushort2(tile_buffer->x, tile_buffer->y));
-    BKE_image_release_ibuf(image, tile_buffer, nullptr);
+    tile_buffers.append({image_tile, tile_buffer});
   }
   uv_masks.add(mesh_data, islands);
   uv_masks.dilate(image->seam_margin);
@@ -692,8 +693,7 @@ static bool update_pixels(Tree &pbvh, Mesh *mesh, Image *image, ImageUser *image
   EncodePixelsUserData user_data;
   user_data.mesh_data = &mesh_data;
   user_data.pbvh = &pbvh;
-  user_data.image = image;
-  user_data.image_user = image_user;
+  user_data.tile_buffers = tile_buffers;
   user_data.nodes = &nodes_to_update;
   user_data.uv_primitive_lookup = &uv_primitive_lookup;
   user_data.uv_masks = &uv_masks;
@@ -703,6 +703,9 @@ static bool update_pixels(Tree &pbvh, Mesh *mesh, Image *image, ImageUser *image
       do_encode_pixels(&user_data, i);
     }
   });
+  for (const TileBuffer &tile_buffer : tile_buffers) {
+    BKE_image_release_ibuf(image, tile_buffer.image_buffer, nullptr);
+  }
   if (USE_WATERTIGHT_CHECK) {
     apply_watertight_check(pbvh, image, image_user);
   }
@@ -711,10 +714,12 @@ static bool update_pixels(Tree &pbvh, Mesh *mesh, Image *image, ImageUser *image
   copy_update(pbvh, *image, *image_user, mesh_data);
 
   /* Rebuild the undo regions. */
-  for (Node *node : nodes_to_update) {
-    NodeData *node_data = static_cast<NodeData *>(node->pixels_);
-    node_data->rebuild_undo_regions();
-  }
+  threading::parallel_for(nodes_to_update.index_range(), 8, [&](const IndexRange range) {
+    for (Node *node : nodes_to_update.as_span().slice(range)) {
+      NodeData *node_data = static_cast<NodeData *>(node->pixels_);
+      node_data->rebuild_undo_regions();
+    }
+  });
 
   /* Clear the UpdatePixels flag. */
   for (Node *node : nodes_to_update) {
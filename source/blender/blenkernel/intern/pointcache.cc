@@ -40,6 +40,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
 
@@ -1549,16 +1550,29 @@ static int ptcache_file_compressed_read(PTCacheFile *pf, uchar *result, uint len
 
   return r;
 }
-static int ptcache_file_compressed_write(
-    PTCacheFile *pf, uchar *in, uint in_len, uchar *out, int mode)
+/** Result of compressing a block of cache data, before it is written to a file. */
+struct PTCacheCompressed {
+  int r;
+  uchar compressed;
+  size_t out_len;
+  uchar props[16];
+  size_t props_len;
+};
+
+/**
+ * Compress `in` into `out`. This doesn't touch the file, so multiple blocks can be compressed in
+ * parallel before they are written in order with #ptcache_file_compressed_write_result.
+ */
+static void ptcache_compress(
+    const uchar *in, uint in_len, uchar *out, int mode, PTCacheCompressed *r_result)
 {
   int r = 0;
   uchar compressed = 0;
   size_t out_len = 0;
-  uchar *props = static_cast<uchar *>(MEM_callocN(sizeof(char[16]), "tmp"));
   size_t sizeOfIt = 5;
 
-  (void)mode; /* unused when building w/o compression */
+  /* Unused when building w/o compression. */
+  UNUSED_VARS(in, in_len, out, mode);
 
 #ifdef WITH_LZO
   out_len = LZO_OUT_LEN(in_len);
@@ -1581,7 +1595,7 @@ static int ptcache_file_compressed_write(
                      &out_len,
                      in,
                      in_len, /* Assume `sizeof(char) == 1`. */
-                     props,
+                     r_result->props,
                      &sizeOfIt,
                      5,
                      1 << 24,
@@ -1600,25 +1614,41 @@ static int ptcache_file_compressed_write(
   }
 #endif
 
-  ptcache_file_write(pf, &compressed, 1, sizeof(uchar));
-  if (compressed) {
-    uint size = out_len;
+  r_result->r = r;
+  r_result->compressed = compressed;
+  r_result->out_len = out_len;
+  r_result->props_len = sizeOfIt;
+}
+static int ptcache_file_compressed_write_result(PTCacheFile *pf,
+                                                const uchar *in,
+                                                uint in_len,
+                                                const uchar *out,
+                                                const PTCacheCompressed &result)
+{
+  ptcache_file_write(pf, &result.compressed, 1, sizeof(uchar));
+  if (result.compressed) {
+    uint size = result.out_len;
     ptcache_file_write(pf, &size, 1, sizeof(uint));
-    ptcache_file_write(pf, out, out_len, sizeof(uchar));
+    ptcache_file_write(pf, out, result.out_len, sizeof(uchar));
   }
   else {
     ptcache_file_write(pf, in, in_len, sizeof(uchar));
   }
 
-  if (compressed == 2) {
-    uint size = sizeOfIt;
-    ptcache_file_write(pf, &sizeOfIt, 1, sizeof(uint));
-    ptcache_file_write(pf, props, size, sizeof(uchar));
+  if (result.compressed == 2) {
+    uint size = result.props_len;
+    ptcache_file_write(pf, &result.props_len, 1, sizeof(uint));
+    ptcache_file_write(pf, result.props, size, sizeof(uchar));
   }
 
-  MEM_freeN(props);
-
-  return r;
+  return result.r;
+}
+static int ptcache_file_compressed_write(
+    PTCacheFile *pf, uchar *in, uint in_len, uchar *out, int mode)
+{
+  PTCacheCompressed result = {};
+  ptcache_compress(in, in_len, out, mode, &result);
+  return ptcache_file_compressed_write_result(pf, in, in_len, out, result);
 }
 static int ptcache_file_read(PTCacheFile *pf, void *f, uint tot, uint size)
 {
@@ -1628,33 +1658,6 @@ static int ptcache_file_write(PTCacheFile *pf, const void *f, uint tot, uint siz
 {
   return (fwrite(f, size, tot, pf->fp) == tot);
 }
-static int ptcache_file_data_read(PTCacheFile *pf)
-{
-  int i;
-
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    if ((pf->data_types & (1 << i)) && !ptcache_file_read(pf, pf->cur[i], 1, ptcache_data_size[i]))
-    {
-      return 0;
-    }
-  }
-
-  return 1;
-}
-static int ptcache_file_data_write(PTCacheFile *pf)
-{
-  int i;
-
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    if ((pf->data_types & (1 << i)) &&
-        !ptcache_file_write(pf, pf->cur[i], 1, ptcache_data_size[i]))
-    {
-      return 0;
-    }
-  }
-
-  return 1;
-}
 static int ptcache_file_header_begin_read(PTCacheFile *pf)
 {
   uint typeflag = 0;
@@ -1825,16 +1828,45 @@ static void ptcache_data_free(PTCacheMem *pm)
     }
   }
 }
-static void ptcache_data_copy(void *from[], void *to[])
+/** Size of one point in uncompressed files, which store all data of a point together. */
+static uint ptcache_file_point_size(const uint data_types)
 {
-  int i;
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    /* NOTE: durian file 03.4b_comp crashes if to[i] is not tested
-     * its nullptr, not sure if this should be fixed elsewhere but for now its needed */
-    if (from[i] && to[i]) {
-      memcpy(to[i], from[i], ptcache_data_size[i]);
+  uint size = 0;
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if (data_types & (1 << i)) {
+      size += ptcache_data_size[i];
     }
   }
+  return size;
+}
+
+/**
+ * Convert between the per-point layout of uncompressed files and the per-type arrays of
+ * #PTCacheMem, so that a frame is read or written with a single call instead of one call per
+ * point and data type.
+ */
+static void ptcache_data_interleave(const PTCacheMem *pm, uchar *r_buffer, const bool to_buffer)
+{
+  const uint point_size = ptcache_file_point_size(pm->data_types);
+  blender::threading::parallel_for(
+      blender::IndexRange(pm->totpoint), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t point : range) {
+          uchar *point_data = r_buffer + point * point_size;
+          for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+            if (pm->data[i] == nullptr) {
+              continue;
+            }
+            uchar *mem_data = static_cast<uchar *>(pm->data[i]) + point * ptcache_data_size[i];
+            if (to_buffer) {
+              memcpy(point_data, mem_data, ptcache_data_size[i]);
+            }
+            else {
+              memcpy(mem_data, point_data, ptcache_data_size[i]);
+            }
+            point_data += ptcache_data_size[i];
+          }
+        }
+      });
 }
 
 static void ptcache_extra_free(PTCacheMem *pm)
@@ -1967,18 +1999,15 @@ static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
       }
     }
     else {
-      void *cur[BPHYS_TOT_DATA];
-      BKE_ptcache_mem_pointers_init(pm, cur);
-      ptcache_file_pointers_init(pf);
-
-      for (i = 0; i < pm->totpoint; i++) {
-        if (!ptcache_file_data_read(pf)) {
-          error = 1;
-          break;
-        }
-        ptcache_data_copy(pf->cur, cur);
-        BKE_ptcache_mem_pointers_incr(cur);
+      const size_t buffer_size = size_t(pm->totpoint) * ptcache_file_point_size(pm->data_types);
+      uchar *buffer = static_cast<uchar *>(MEM_mallocN(buffer_size, "pointcache_read_buffer"));
+      if (fread(buffer, 1, buffer_size, pf->fp) == buffer_size) {
+        ptcache_data_interleave(pm, buffer, false);
+      }
+      else {
+        error = 1;
       }
+      MEM_freeN(buffer);
     }
   }
 
@@ -2057,29 +2086,42 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
 
   if (!error) {
     if (pid->cache->compression) {
+      /* Compress the data types in parallel (LZMA in particular is slow), then write them to the
+       * file in their usual order. */
+      uchar *outs[BPHYS_TOT_DATA] = {nullptr};
+      PTCacheCompressed results[BPHYS_TOT_DATA] = {};
+      blender::threading::parallel_for(
+          blender::IndexRange(BPHYS_TOT_DATA), 1, [&](const blender::IndexRange range) {
+            for (const int64_t type : range) {
+              if (pm->data[type]) {
+                uint in_len = pm->totpoint * ptcache_data_size[type];
+                outs[type] = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4,
+                                                  "pointcache_lzo_buffer");
+                ptcache_compress((const uchar *)(pm->data[type]),
+                                 in_len,
+                                 outs[type],
+                                 pid->cache->compression,
+                                 &results[type]);
+              }
+            }
+          });
       for (i = 0; i < BPHYS_TOT_DATA; i++) {
         if (pm->data[i]) {
           uint in_len = pm->totpoint * ptcache_data_size[i];
-          uchar *out = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4, "pointcache_lzo_buffer");
-          ptcache_file_compressed_write(
-              pf, (uchar *)(pm->data[i]), in_len, out, pid->cache->compression);
-          MEM_freeN(out);
+          ptcache_file_compressed_write_result(
+              pf, (const uchar *)(pm->data[i]), in_len, outs[i], results[i]);
+          MEM_freeN(outs[i]);
         }
       }
     }
     else {
-      void *cur[BPHYS_TOT_DATA];
-      BKE_ptcache_mem_pointers_init(pm, cur);
-      ptcache_file_pointers_init(pf);
-
-      for (i = 0; i < pm->totpoint; i++) {
-        ptcache_data_copy(cur, pf->cur);
-        if (!ptcache_file_data_write(pf)) {
-          error = 1;
-          break;
-        }
-        BKE_ptcache_mem_pointers_incr(cur);
+      const size_t buffer_size = size_t(pm->totpoint) * ptcache_file_point_size(pm->data_types);
+      uchar *buffer = static_cast<uchar *>(MEM_mallocN(buffer_size, "pointcache_write_buffer"));
+      ptcache_data_interleave(pm, buffer, true);
+      if (fwrite(buffer, 1, buffer_size, pf->fp) != buffer_size) {
+        error = 1;
       }
+      MEM_freeN(buffer);
     }
   }
 
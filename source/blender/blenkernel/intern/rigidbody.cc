@@ -1748,19 +1748,23 @@ static void rigidbody_update_sim_world(Scene *scene, RigidBodyWorld *rbw)
   rigidbody_update_ob_array(rbw);
 }
 
-static void rigidbody_update_sim_ob(Depsgraph *depsgraph, Object *ob, RigidBodyOb *rbo)
+static bool is_selected_base(ViewLayer *view_layer, Object *ob)
+{
+  const Base *base = BKE_view_layer_base_find(view_layer, ob);
+  return base ? (base->flag & BASE_SELECTED) != 0 : false;
+}
+
+/**
+ * \param view_layer: Only needed while objects are being transformed, null otherwise. This avoids
+ * a base lookup for every object in large simulations.
+ */
+static void rigidbody_update_sim_ob(ViewLayer *view_layer, Object *ob, RigidBodyOb *rbo)
 {
   /* only update if rigid body exists */
   if (rbo->shared->physics_object == nullptr) {
     return;
   }
 
-  const Scene *scene = DEG_get_input_scene(depsgraph);
-  ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
-  BKE_view_layer_synced_ensure(scene, view_layer);
-  Base *base = BKE_view_layer_base_find(view_layer, ob);
-  const bool is_selected = base ? (base->flag & BASE_SELECTED) != 0 : false;
-
   if (rbo->shape == RB_SHAPE_TRIMESH && rbo->flag & RBO_FLAG_USE_DEFORM) {
     const Mesh *mesh = BKE_object_get_mesh_deform_eval(ob);
     if (mesh) {
@@ -1798,7 +1802,7 @@ static void rigidbody_update_sim_ob(Depsgraph *depsgraph, Object *ob, RigidBodyO
 
   /* Make transformed objects temporarily kinematic
    * so that they can be moved by the user during simulation. */
-  if (is_selected && (G.moving & G_TRANSFORM_OBJ)) {
+  if (view_layer != nullptr && is_selected_base(view_layer, ob)) {
     RB_body_set_kinematic_state(static_cast<rbRigidBody *>(rbo->shared->physics_object), true);
     RB_body_set_mass(static_cast<rbRigidBody *>(rbo->shared->physics_object), 0.0f);
   }
@@ -1848,6 +1852,13 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
     FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
   }
 
+  /* Selection only matters while objects are being transformed. */
+  ViewLayer *view_layer = nullptr;
+  if (G.moving & G_TRANSFORM_OBJ) {
+    view_layer = DEG_get_input_view_layer(depsgraph);
+    BKE_view_layer_synced_ensure(DEG_get_input_scene(depsgraph), view_layer);
+  }
+
   /* update objects */
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     if (ob->type == OB_MESH) {
@@ -1900,7 +1911,7 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
       rbo->flag &= ~(RBO_FLAG_NEEDS_VALIDATE | RBO_FLAG_NEEDS_RESHAPE);
 
       /* update simulation object... */
-      rigidbody_update_sim_ob(depsgraph, ob, rbo);
+      rigidbody_update_sim_ob(view_layer, ob, rbo);
     }
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
@@ -2111,6 +2122,11 @@ static void rigidbody_free_substep_data(ListBase *substep_targets)
 }
 static void rigidbody_update_simulation_post_step(Depsgraph *depsgraph, RigidBodyWorld *rbw)
 {
+  /* Only objects that are being transformed have been made kinematic temporarily. */
+  if ((G.moving & G_TRANSFORM_OBJ) == 0) {
+    return;
+  }
+
   const Scene *scene = DEG_get_input_scene(depsgraph);
   ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
   BKE_view_layer_synced_ensure(scene, view_layer);
@@ -2119,9 +2135,7 @@ static void rigidbody_update_simulation_post_step(Depsgraph *depsgraph, RigidBod
     Base *base = BKE_view_layer_base_find(view_layer, ob);
     RigidBodyOb *rbo = ob->rigidbody_object;
     /* Reset kinematic state for transformed objects. */
-    if (rbo && base && (base->flag & BASE_SELECTED) && (G.moving & G_TRANSFORM_OBJ) &&
-        rbo->shared->physics_object)
-    {
+    if (rbo && base && (base->flag & BASE_SELECTED) && rbo->shared->physics_object) {
       RB_body_set_kinematic_state(static_cast<rbRigidBody *>(rbo->shared->physics_object),
                                   rbo->flag & RBO_FLAG_KINEMATIC || rbo->flag & RBO_FLAG_DISABLED);
       RB_body_set_mass(static_cast<rbRigidBody *>(rbo->shared->physics_object), RBO_GET_MASS(rbo));
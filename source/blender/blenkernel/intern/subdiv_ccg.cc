@@ -929,49 +929,60 @@ void BKE_subdiv_ccg_average_grids(SubdivCCG &subdiv_ccg)
 
 #ifdef WITH_OPENSUBDIV
 
-static void subdiv_ccg_affected_face_adjacency(SubdivCCG &subdiv_ccg,
+/**
+ * Find the vertices and edges of the base mesh that are adjacent to the given faces. They are
+ * tagged in arrays covering all adjacent elements rather than gathered in sets, so that the faces
+ * can be processed in parallel and the result is sorted, which gives a cache friendly order for
+ * the averaging.
+ */
+static void subdiv_ccg_affected_face_adjacency(const SubdivCCG &subdiv_ccg,
                                                const IndexMask &face_mask,
-                                               blender::Set<int> &adjacent_verts,
-                                               blender::Set<int> &adjacent_edges)
+                                               IndexMaskMemory &memory,
+                                               IndexMask &r_adjacent_verts,
+                                               IndexMask &r_adjacent_edges)
 {
-  Subdiv *subdiv = subdiv_ccg.subdiv;
+  using namespace blender;
+  const Subdiv *subdiv = subdiv_ccg.subdiv;
   const OpenSubdiv_TopologyRefiner *topology_refiner = subdiv->topology_refiner;
 
-  Vector<int, 64> face_vertices;
-  Vector<int, 64> face_edges;
+  Array<bool> adjacent_verts(subdiv_ccg.adjacent_verts.size(), false);
+  Array<bool> adjacent_edges(subdiv_ccg.adjacent_edges.size(), false);
 
-  face_mask.foreach_index([&](const int face_index) {
-    const int num_face_grids = subdiv_ccg.faces[face_index].size();
-    face_vertices.reinitialize(num_face_grids);
-    topology_refiner->getFaceVertices(face_index, face_vertices.data());
-    adjacent_verts.add_multiple(face_vertices);
+  face_mask.foreach_segment(GrainSize(512), [&](const IndexMaskSegment segment) {
+    Vector<int, 64> face_vertices;
+    Vector<int, 64> face_edges;
+    for (const int face_index : segment) {
+      const int num_face_grids = subdiv_ccg.faces[face_index].size();
+      face_vertices.reinitialize(num_face_grids);
+      topology_refiner->getFaceVertices(face_index, face_vertices.data());
+      for (const int vert : face_vertices) {
+        adjacent_verts[vert] = true;
+      }
 
-    face_edges.reinitialize(num_face_grids);
-    topology_refiner->getFaceEdges(face_index, face_edges.data());
-    adjacent_edges.add_multiple(face_edges);
+      face_edges.reinitialize(num_face_grids);
+      topology_refiner->getFaceEdges(face_index, face_edges.data());
+      for (const int edge : face_edges) {
+        adjacent_edges[edge] = true;
+      }
+    }
   });
+
+  r_adjacent_verts = IndexMask::from_bools(adjacent_verts, memory);
+  r_adjacent_edges = IndexMask::from_bools(adjacent_edges, memory);
 }
 
 void subdiv_ccg_average_faces_boundaries_and_corners(SubdivCCG &subdiv_ccg,
                                                      const CCGKey &key,
                                                      const IndexMask &face_mask)
 {
-  blender::Set<int> adjacent_vert_set;
-  blender::Set<int> adjacent_edge_set;
-  subdiv_ccg_affected_face_adjacency(subdiv_ccg, face_mask, adjacent_vert_set, adjacent_edge_set);
-
-  Vector<int> adjacent_verts(adjacent_vert_set.begin(), adjacent_vert_set.end());
-  Vector<int> adjacent_edges(adjacent_edge_set.begin(), adjacent_edge_set.end());
-
-  std::sort(adjacent_verts.begin(), adjacent_verts.end());
-  std::sort(adjacent_edges.begin(), adjacent_edges.end());
-
   IndexMaskMemory memory;
-  subdiv_ccg_average_boundaries(
-      subdiv_ccg, key, IndexMask::from_indices(adjacent_edges.as_span(), memory));
+  IndexMask adjacent_verts;
+  IndexMask adjacent_edges;
+  subdiv_ccg_affected_face_adjacency(
+      subdiv_ccg, face_mask, memory, adjacent_verts, adjacent_edges);
 
-  subdiv_ccg_average_corners(
-      subdiv_ccg, key, IndexMask::from_indices(adjacent_verts.as_span(), memory));
+  subdiv_ccg_average_boundaries(subdiv_ccg, key, adjacent_edges);
+  subdiv_ccg_average_corners(subdiv_ccg, key, adjacent_verts);
 }
 
 #endif
@@ -984,10 +995,14 @@ void BKE_subdiv_ccg_average_stitch_faces(SubdivCCG &subdiv_ccg, const IndexMask
   face_mask.foreach_index(GrainSize(512), [&](const int face_index) {
     subdiv_ccg_average_inner_face_grids(subdiv_ccg, key, subdiv_ccg.faces[face_index]);
   });
-  /* TODO(sergey): Only average elements which are adjacent to modified
-   * faces. */
-  subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
-  subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
+  if (face_mask.size() == subdiv_ccg.faces.size()) {
+    subdiv_ccg_average_boundaries(subdiv_ccg, key, subdiv_ccg.adjacent_edges.index_range());
+    subdiv_ccg_average_corners(subdiv_ccg, key, subdiv_ccg.adjacent_verts.index_range());
+  }
+  else {
+    /* Only average elements which are adjacent to modified faces. */
+    subdiv_ccg_average_faces_boundaries_and_corners(subdiv_ccg, key, face_mask);
+  }
 #else
   UNUSED_VARS(subdiv_ccg, face_mask);
 #endif
@@ -4,15 +4,21 @@
 
 #include "BKE_subdiv_modifier.hh"
 
+#include <algorithm>
+
 #include "MEM_guardedalloc.h"
 
+#include "BLI_listbase.h"
+
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 #include "DNA_object_types.h"
 #include "DNA_userdef_types.h"
 
 #include "BKE_customdata.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_mesh.hh"
+#include "BKE_mesh_types.hh"
 #include "BKE_modifier.hh"
 #include "BKE_subdiv.hh"
 
@@ -171,6 +177,110 @@ subdiv::Subdiv *BKE_subsurf_modifier_subdiv_descriptor_ensure(SubsurfRuntimeData
              runtime_data->subdiv_cpu, &runtime_data->settings, mesh);
 }
 
+static bool custom_data_shares_all_layers(const CustomData &a, const CustomData &b)
+{
+  if (a.totlayer != b.totlayer) {
+    return false;
+  }
+  for (const int i : blender::IndexRange(a.totlayer)) {
+    const CustomDataLayer &layer_a = a.layers[i];
+    const CustomDataLayer &layer_b = b.layers[i];
+    if (layer_a.sharing_info == nullptr || layer_a.sharing_info != layer_b.sharing_info ||
+        layer_a.data != layer_b.data || layer_a.type != layer_b.type ||
+        !STREQ(layer_a.name, layer_b.name))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Check whether both meshes reference exactly the same data. The arrays are compared by the
+ * identity of their implicit sharing info, so this is only reliable while \a a keeps its data
+ * alive: a shared array is never modified in place.
+ */
+static bool mesh_shares_all_data(const Mesh &a, const Mesh &b)
+{
+  if (a.verts_num != b.verts_num || a.edges_num != b.edges_num || a.faces_num != b.faces_num ||
+      a.corners_num != b.corners_num)
+  {
+    return false;
+  }
+  if (a.faces_num > 0 && (a.runtime->face_offsets_sharing_info == nullptr ||
+                          a.runtime->face_offsets_sharing_info !=
+                              b.runtime->face_offsets_sharing_info))
+  {
+    return false;
+  }
+  if (!custom_data_shares_all_layers(a.vert_data, b.vert_data) ||
+      !custom_data_shares_all_layers(a.edge_data, b.edge_data) ||
+      !custom_data_shares_all_layers(a.face_data, b.face_data) ||
+      !custom_data_shares_all_layers(a.corner_data, b.corner_data))
+  {
+    return false;
+  }
+  if (a.totcol != b.totcol || !std::equal(a.mat, a.mat + a.totcol, b.mat)) {
+    return false;
+  }
+  if (BLI_listbase_count(&a.vertex_group_names) != BLI_listbase_count(&b.vertex_group_names)) {
+    return false;
+  }
+  const bDeformGroup *group_b = static_cast<const bDeformGroup *>(b.vertex_group_names.first);
+  LISTBASE_FOREACH (const bDeformGroup *, group_a, &a.vertex_group_names) {
+    if (!STREQ(group_a->name, group_b->name)) {
+      return false;
+    }
+    group_b = group_b->next;
+  }
+  return true;
+}
+
+Mesh *BKE_subsurf_modifier_cpu_cache_lookup(const SubsurfRuntimeData *runtime_data,
+                                           const Mesh *mesh)
+{
+  if (runtime_data->cpu_cache_result == nullptr) {
+    return nullptr;
+  }
+  if (!subdiv::settings_equal(&runtime_data->cpu_cache_settings, &runtime_data->settings) ||
+      runtime_data->cpu_cache_resolution != runtime_data->resolution ||
+      runtime_data->cpu_cache_use_optimal_display != runtime_data->use_optimal_display ||
+      runtime_data->cpu_cache_use_loop_normals != runtime_data->use_loop_normals)
+  {
+    return nullptr;
+  }
+  if (!mesh_shares_all_data(*runtime_data->cpu_cache_input, *mesh)) {
+    return nullptr;
+  }
+  return BKE_mesh_copy_for_eval(*runtime_data->cpu_cache_result);
+}
+
+void BKE_subsurf_modifier_cpu_cache_store(SubsurfRuntimeData *runtime_data,
+                                          const Mesh *mesh,
+                                          const Mesh *result)
+{
+  BKE_subsurf_modifier_cpu_cache_free(runtime_data);
+  /* Copying only adds users to the implicitly shared arrays of both meshes. */
+  runtime_data->cpu_cache_input = BKE_mesh_copy_for_eval(*mesh);
+  runtime_data->cpu_cache_result = BKE_mesh_copy_for_eval(*result);
+  runtime_data->cpu_cache_settings = runtime_data->settings;
+  runtime_data->cpu_cache_resolution = runtime_data->resolution;
+  runtime_data->cpu_cache_use_optimal_display = runtime_data->use_optimal_display;
+  runtime_data->cpu_cache_use_loop_normals = runtime_data->use_loop_normals;
+}
+
+void BKE_subsurf_modifier_cpu_cache_free(SubsurfRuntimeData *runtime_data)
+{
+  if (runtime_data->cpu_cache_input != nullptr) {
+    BKE_id_free(nullptr, runtime_data->cpu_cache_input);
+    runtime_data->cpu_cache_input = nullptr;
+  }
+  if (runtime_data->cpu_cache_result != nullptr) {
+    BKE_id_free(nullptr, runtime_data->cpu_cache_result);
+    runtime_data->cpu_cache_result = nullptr;
+  }
+}
+
 int BKE_subsurf_modifier_eval_required_mode(bool is_final_render, bool is_edit_mode)
 {
   if (is_final_render) {
@@ -15,6 +15,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
+#include "BLI_path_util.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
@@ -703,12 +704,93 @@ static void autotrack_context_reduce(const void *__restrict /*userdata*/,
   BLI_movelisttolist(&autotrack_tls_join->results, &autotrack_tls->results);
 }
 
+/* Frame of a clip which is to be read into the movie cache ahead of the tracking step which needs
+ * it. */
+struct AutoTrackPrefetchFrame {
+  MovieClip *clip;
+  int scene_frame;
+};
+
+static void autotrack_prefetch_frame_cb(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  const AutoTrackPrefetchFrame *prefetch_frame = static_cast<AutoTrackPrefetchFrame *>(taskdata);
+  MovieClip *clip = prefetch_frame->clip;
+
+  /* Same settings as used by the image accessor of the tracker. */
+  MovieClipUser user;
+  BKE_movieclip_user_set_frame(&user, prefetch_frame->scene_frame);
+  user.render_size = MCLIP_PROXY_RENDER_SIZE_FULL;
+  user.render_flag = 0;
+
+  if (BKE_movieclip_has_cached_frame(clip, &user)) {
+    return;
+  }
+
+  /* Read and decode the file without holding the movie clip lock, so that the trackers can keep
+   * on accessing the cached frames in the meantime. */
+  char filepath[FILE_MAX];
+  BKE_movieclip_filepath_for_frame(clip, &user, filepath);
+  ImBuf *ibuf = IMB_loadiffname(filepath,
+                                IB_rect | IB_multilayer | IB_alphamode_detect | IB_metadata,
+                                clip->colorspace_settings.name);
+  if (ibuf == nullptr) {
+    return;
+  }
+  BKE_movieclip_convert_multilayer_ibuf(ibuf);
+
+  /* Does not free other frames from the cache when it is full, the frames used by the current
+   * tracking step are more important than the prefetched one. */
+  BKE_movieclip_put_frame_if_possible(clip, &user, ibuf);
+  IMB_freeImBuf(ibuf);
+}
+
+/* Start reading the frames which will be tracked by the step after the current one.
+ *
+ * Only image sequences are prefetched: reading movie files goes through the animation decoder of
+ * the clip, which is not thread safe and is only accessed with the movie clip lock held. */
+static TaskPool *autotrack_context_prefetch_next_frames(AutoTrackContext *context)
+{
+  const int frame_delta = context->is_backwards ? -1 : 1;
+
+  TaskPool *task_pool = nullptr;
+  bool clip_handled[MAX_ACCESSOR_CLIP] = {false};
+  for (int i = 0; i < context->num_autotrack_markers; ++i) {
+    const libmv_Marker &libmv_marker = context->autotrack_markers[i].libmv_marker;
+    const int clip_index = libmv_marker.clip;
+    if (clip_handled[clip_index]) {
+      continue;
+    }
+    clip_handled[clip_index] = true;
+
+    MovieClip *clip = context->autotrack_clips[clip_index].clip;
+    if (clip->source != MCLIP_SRC_SEQUENCE) {
+      continue;
+    }
+
+    if (task_pool == nullptr) {
+      task_pool = BLI_task_pool_create(nullptr, TASK_PRIORITY_LOW);
+    }
+
+    AutoTrackPrefetchFrame *prefetch_frame = MEM_cnew<AutoTrackPrefetchFrame>(__func__);
+    prefetch_frame->clip = clip;
+    prefetch_frame->scene_frame = BKE_movieclip_remap_clip_to_scene_frame(
+        clip, libmv_marker.frame + 2 * frame_delta);
+    BLI_task_pool_push(task_pool, autotrack_prefetch_frame_cb, prefetch_frame, true, nullptr);
+  }
+
+  return task_pool;
+}
+
 bool BKE_autotrack_context_step(AutoTrackContext *context)
 {
   if (context->num_autotrack_markers == 0) {
     return false;
   }
 
+  /* Overlap reading of the next frame with tracking on the current one, so that the markers of
+   * the next step do not wait for the frame to be read from disk. */
+  TaskPool *prefetch_pool = autotrack_context_prefetch_next_frames(context);
+
   AutoTrackTLS tls;
   BLI_listbase_clear(&tls.results);
 
@@ -722,6 +804,11 @@ bool BKE_autotrack_context_step(AutoTrackContext *context)
   BLI_task_parallel_range(
       0, context->num_autotrack_markers, context, autotrack_context_step_cb, &settings);
 
+  if (prefetch_pool != nullptr) {
+    BLI_task_pool_work_and_wait(prefetch_pool);
+    BLI_task_pool_free(prefetch_pool);
+  }
+
   /* Prepare next tracking step by updating the AutoTrack context with new markers and moving
    * tracked markers as an input for the next iteration. */
   context->num_autotrack_markers = 0;
@@ -160,11 +160,22 @@ static GVolumeGrid get_cached_grid(const StringRef file_path,
     }
     /* Build the simplified grid from the main grid. */
     const GVolumeGrid main_grid = get_grid_from_file(file_path, grid_name, 0);
+    const bool main_tree_was_loaded = main_grid->is_loaded();
     const VolumeGridType grid_type = main_grid->grid_type();
     const float resolution_factor = 1.0f / (1 << simplify_level);
-    VolumeTreeAccessToken tree_token;
-    return BKE_volume_grid_create_with_changed_resolution(
-        grid_type, main_grid->grid(tree_token), resolution_factor);
+    openvdb::GridBase::Ptr simplified_grid;
+    {
+      VolumeTreeAccessToken tree_token;
+      simplified_grid = BKE_volume_grid_create_with_changed_resolution(
+          grid_type, main_grid->grid(tree_token), resolution_factor);
+    }
+    if (!main_tree_was_loaded) {
+      /* The full resolution tree was only loaded to build the simplified grid. Free it again, so
+       * that only the much smaller simplified tree stays in memory when e.g. the viewport displays
+       * large volumes with simplification. It's loaded again when it's accessed later on. */
+      main_grid->unload_tree_if_possible();
+    }
+    return simplified_grid;
   };
   /* This allows the returned grid to already contain meta-data and transforms, even if the tree is
    * not loaded yet. */
@@ -93,14 +93,15 @@ static void create_texture_to_object_matrix(const openvdb::Mat4d &grid_transform
 
 bool BKE_volume_grid_dense_floats(const Volume *volume,
                                   const blender::bke::VolumeGridData *volume_grid,
+                                  const int max_resolution,
                                   DenseFloatVolumeGrid *r_dense_grid)
 {
 #ifdef WITH_OPENVDB
   const VolumeGridType grid_type = volume_grid->grid_type();
   blender::bke::VolumeTreeAccessToken tree_token;
-  const openvdb::GridBase &grid = volume_grid->grid(tree_token);
+  const openvdb::GridBase *grid_ptr = &volume_grid->grid(tree_token);
 
-  const openvdb::CoordBBox bbox = grid.evalActiveVoxelBoundingBox();
+  openvdb::CoordBBox bbox = grid_ptr->evalActiveVoxelBoundingBox();
   if (bbox.empty()) {
     return false;
   }
@@ -113,6 +114,26 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
     return false;
   }
 
+  openvdb::GridBase::Ptr resampled_grid;
+  if (max_resolution > 0) {
+    const openvdb::Coord dim = bbox.dim();
+    const int max_dim = std::max({dim.x(), dim.y(), dim.z()});
+    if (max_dim > max_resolution) {
+      /* Use a lower resolution instead of failing, also avoids allocating the large dense array.
+       * Leave some margin because resampling may round up the size of the bounding box. */
+      const float resolution_factor = float(max_resolution - 2) / float(max_dim);
+      resampled_grid = BKE_volume_grid_create_with_changed_resolution(
+          grid_type, *grid_ptr, resolution_factor);
+      grid_ptr = resampled_grid.get();
+      bbox = grid_ptr->evalActiveVoxelBoundingBox();
+      const openvdb::Coord new_dim = bbox.dim();
+      if (bbox.empty() || std::max({new_dim.x(), new_dim.y(), new_dim.z()}) > max_resolution) {
+        return false;
+      }
+    }
+  }
+  const openvdb::GridBase &grid = *grid_ptr;
+
   const openvdb::Vec3i resolution = bbox.dim().asVec3i();
   const int64_t num_voxels = int64_t(resolution[0]) * int64_t(resolution[1]) *
                              int64_t(resolution[2]);
@@ -133,7 +154,7 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
   copy_v3_v3_int(r_dense_grid->resolution, resolution.asV());
   return true;
 #endif
-  UNUSED_VARS(volume, volume_grid, r_dense_grid);
+  UNUSED_VARS(volume, volume_grid, max_resolution, r_dense_grid);
   return false;
 }
 
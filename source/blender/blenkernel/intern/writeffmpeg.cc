@@ -8,8 +8,11 @@
  */
 
 #ifdef WITH_FFMPEG
+#  include <condition_variable>
 #  include <cstdio>
 #  include <cstring>
+#  include <mutex>
+#  include <thread>
 
 #  include <cstdlib>
 
@@ -77,6 +80,8 @@ static ThreadMutex swscale_cache_lock = PTHREAD_MUTEX_INITIALIZER;
 static int64_t swscale_cache_timestamp = 0;
 static blender::Vector<SwscaleContext> *swscale_cache = nullptr;
 
+struct FFMpegEncoder;
+
 struct FFMpegContext {
   int ffmpeg_type;
   AVCodecID ffmpeg_codec;
@@ -114,11 +119,39 @@ struct FFMpegContext {
 
   StampData *stamp_data;
 
+  /* Encodes the frames in the background, null when frames are encoded directly. */
+  FFMpegEncoder *encoder;
+
 #  ifdef WITH_AUDASPACE
   AUD_Device *audio_mixdown_device;
 #  endif
 };
 
+/**
+ * Encodes and writes video frames on a separate thread, so that the next frame can be rendered
+ * in the meantime. Audio is written on the same thread, because all packets are interleaved into
+ * the same output file.
+ */
+struct FFMpegEncoder {
+  /** Limits the memory used by frames that are waiting to be encoded. */
+  static constexpr int max_frames_num = 2;
+
+  struct QueuedFrame {
+    AVFrame *frame;
+    /** Audio is written up to this time, after the frame is encoded. */
+    double audio_time;
+  };
+
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable cond;
+  blender::Vector<QueuedFrame> queue;
+  blender::Vector<AVFrame *> free_frames;
+  int frames_num = 0;
+  bool stop = false;
+  bool failed = false;
+};
+
 #  define FFMPEG_AUTOSPLIT_SIZE 2000000000
 
 #  define PRINT \
@@ -396,7 +429,9 @@ static bool write_video_frame(FFMpegContext *context, AVFrame *frame, ReportList
 }
 
 /* read and encode a frame of video from the buffer */
-static AVFrame *generate_video_frame(FFMpegContext *context, const ImBuf *image)
+static AVFrame *generate_video_frame(FFMpegContext *context,
+                                     const ImBuf *image,
+                                     AVFrame *output_frame)
 {
   /* For now only 8-bit/channel images are supported. */
   const uint8_t *pixels = image->byte_buffer.data;
@@ -414,7 +449,7 @@ static AVFrame *generate_video_frame(FFMpegContext *context, const ImBuf *image)
   }
   else {
     /* The output pixel format is Blender's internal pixel format. */
-    rgb_frame = context->current_frame;
+    rgb_frame = output_frame;
   }
 
   /* Copy the Blender pixels into the FFMPEG data-structure, taking care of endianness and flipping
@@ -447,10 +482,10 @@ static AVFrame *generate_video_frame(FFMpegContext *context, const ImBuf *image)
   /* Convert to the output pixel format, if it's different that Blender's internal one. */
   if (context->img_convert_frame != nullptr) {
     BLI_assert(context->img_convert_ctx != NULL);
-    BKE_ffmpeg_sws_scale_frame(context->img_convert_ctx, context->current_frame, rgb_frame);
+    BKE_ffmpeg_sws_scale_frame(context->img_convert_ctx, output_frame, rgb_frame);
   }
 
-  return context->current_frame;
+  return output_frame;
 }
 
 static AVRational calc_time_base(uint den, double num, int codec_id)
@@ -1706,6 +1741,98 @@ static void write_audio_frames(FFMpegContext *context, double to_pts)
 }
 #  endif
 
+static void ffmpeg_encoder_run(FFMpegContext *context)
+{
+  FFMpegEncoder &encoder = *context->encoder;
+  while (true) {
+    FFMpegEncoder::QueuedFrame queued;
+    {
+      std::unique_lock lock{encoder.mutex};
+      encoder.cond.wait(lock, [&]() { return !encoder.queue.is_empty() || encoder.stop; });
+      if (encoder.queue.is_empty()) {
+        return;
+      }
+      queued = encoder.queue.first();
+      encoder.queue.remove(0);
+    }
+
+    const bool success = write_video_frame(context, queued.frame, nullptr);
+#  ifdef WITH_AUDASPACE
+    write_audio_frames(context, queued.audio_time);
+#  endif
+
+    {
+      std::lock_guard lock{encoder.mutex};
+      encoder.failed |= !success;
+      encoder.free_frames.append(queued.frame);
+    }
+    encoder.cond.notify_all();
+  }
+}
+
+static void ffmpeg_encoder_start(FFMpegContext *context)
+{
+  context->encoder = MEM_new<FFMpegEncoder>(__func__);
+  context->encoder->thread = std::thread(ffmpeg_encoder_run, context);
+}
+
+/** Wait until all queued frames are written, then stop the encoder thread. */
+static void ffmpeg_encoder_end(FFMpegContext *context)
+{
+  FFMpegEncoder *encoder = context->encoder;
+  if (encoder == nullptr) {
+    return;
+  }
+  {
+    std::lock_guard lock{encoder->mutex};
+    encoder->stop = true;
+  }
+  encoder->cond.notify_all();
+  encoder->thread.join();
+  if (encoder->failed) {
+    fprintf(stderr, "Error writing frame\n");
+  }
+
+  for (AVFrame *frame : encoder->free_frames) {
+    delete_picture(frame);
+  }
+  MEM_delete(encoder);
+  context->encoder = nullptr;
+}
+
+/** Get a frame that is not used by the encoder, waits when all frames are still queued. */
+static AVFrame *ffmpeg_encoder_frame_acquire(FFMpegContext *context)
+{
+  FFMpegEncoder &encoder = *context->encoder;
+  std::unique_lock lock{encoder.mutex};
+  if (encoder.free_frames.is_empty() && encoder.frames_num < FFMpegEncoder::max_frames_num) {
+    encoder.frames_num++;
+    const AVCodecContext *c = context->video_codec;
+    return alloc_picture(c->pix_fmt, c->width, c->height);
+  }
+  encoder.cond.wait(lock, [&]() { return !encoder.free_frames.is_empty(); });
+  return encoder.free_frames.pop_last();
+}
+
+/** Queue a frame for encoding, returns false if writing one of the previous frames failed. */
+static bool ffmpeg_encoder_frame_push(FFMpegContext *context,
+                                      AVFrame *frame,
+                                      const double audio_time)
+{
+  FFMpegEncoder &encoder = *context->encoder;
+  bool success;
+  {
+    std::lock_guard lock{encoder.mutex};
+    if (frame != nullptr) {
+      encoder.queue.append({frame, audio_time});
+    }
+    success = !encoder.failed;
+    encoder.failed = false;
+  }
+  encoder.cond.notify_all();
+  return success;
+}
+
 bool BKE_ffmpeg_append(void *context_v,
                        RenderData *rd,
                        int start_frame,
@@ -1721,15 +1848,37 @@ bool BKE_ffmpeg_append(void *context_v,
   PRINT("Writing frame %i, render width=%d, render height=%d\n", frame, image->x, image->y);
 
   if (context->video_stream) {
-    avframe = generate_video_frame(context, image);
-    success = (avframe && write_video_frame(context, avframe, reports));
-#  ifdef WITH_AUDASPACE
     /* Add +1 frame because we want to encode audio up until the next video frame. */
-    write_audio_frames(
-        context, (frame - start_frame + 1) / (double(rd->frs_sec) / double(rd->frs_sec_base)));
-#  else
-    UNUSED_VARS(start_frame);
+    const double audio_time = (frame - start_frame + 1) /
+                              (double(rd->frs_sec) / double(rd->frs_sec_base));
+
+    /* Splitting the output file has to happen in sync with writing the frames. */
+    if (context->encoder == nullptr && !context->ffmpeg_autosplit) {
+      ffmpeg_encoder_start(context);
+    }
+
+    if (context->encoder) {
+      AVFrame *output_frame = ffmpeg_encoder_frame_acquire(context);
+      /* The encoder may still reference the buffer of a previous frame. */
+      av_frame_make_writable(output_frame);
+      avframe = generate_video_frame(context, image, output_frame);
+      if (avframe == nullptr) {
+        std::lock_guard lock{context->encoder->mutex};
+        context->encoder->free_frames.append(output_frame);
+      }
+      if (!ffmpeg_encoder_frame_push(context, avframe, audio_time)) {
+        BKE_report(reports, RPT_ERROR, "Error writing frame");
+        success = false;
+      }
+      success &= avframe != nullptr;
+    }
+    else {
+      avframe = generate_video_frame(context, image, context->current_frame);
+      success = (avframe && write_video_frame(context, avframe, reports));
+#  ifdef WITH_AUDASPACE
+      write_audio_frames(context, audio_time);
 #  endif
+    }
 
     if (context->ffmpeg_autosplit) {
       if (avio_tell(context->outfile->pb) > FFMPEG_AUTOSPLIT_SIZE) {
@@ -1748,6 +1897,8 @@ static void end_ffmpeg_impl(FFMpegContext *context, int is_autosplit)
 {
   PRINT("Closing FFMPEG...\n");
 
+  ffmpeg_encoder_end(context);
+
 #  ifdef WITH_AUDASPACE
   if (is_autosplit == false) {
     if (context->audio_mixdown_device) {
@@ -54,6 +54,12 @@ typedef struct FileReader {
 FileReader *BLI_filereader_new_file(int filedes) ATTR_WARN_UNUSED_RESULT;
 /** Create #FileReader from raw file descriptor using memory-mapped IO. */
 FileReader *BLI_filereader_new_mmap(int filedes) ATTR_WARN_UNUSED_RESULT;
+/**
+ * Same as #BLI_filereader_new_mmap, for files of which only small parts are expected to be read.
+ * When `random_access` is set, the OS is told not to read ahead of the accessed pages,
+ * and larger reads prefetch their whole range up-front instead of faulting in page by page.
+ */
+FileReader *BLI_filereader_new_mmap_ex(int filedes, bool random_access) ATTR_WARN_UNUSED_RESULT;
 /** Create #FileReader from a region of memory. */
 FileReader *BLI_filereader_new_memory(const void *data, size_t len) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL();
@@ -307,6 +307,9 @@ extern const float bvhtree_kdop_axes[13][3];
 
 #ifdef __cplusplus
 
+#  include <cmath>
+#  include <limits>
+
 #  include "BLI_function_ref.hh"
 #  include "BLI_math_vector.hh"
 
@@ -353,6 +356,35 @@ inline void BLI_bvhtree_range_query_cpp(const BVHTree &tree,
       &fn);
 }
 
+/**
+ * Same as #BLI_bvhtree_find_nearest, but the distance to a hint element (e.g. the element that
+ * was found for the previous nearby query) is used as an initial bound for the traversal, so that
+ * most of the tree can be skipped. The bound is slightly larger than the distance to the hint, so
+ * the result is exactly the same as without the hint, including which element is found when
+ * multiple elements have the same distance.
+ *
+ * \param hint_index: Index of an element in the tree or -1 to search without a hint.
+ */
+inline int BLI_bvhtree_find_nearest_with_hint(const BVHTree &tree,
+                                              const float3 co,
+                                              BVHTreeNearest &nearest,
+                                              BVHTree_NearestPointCallback callback,
+                                              void *userdata,
+                                              const int hint_index)
+{
+  if (hint_index != -1 && callback != nullptr) {
+    BVHTreeNearest hint;
+    hint.index = -1;
+    hint.dist_sq = std::numeric_limits<float>::max();
+    callback(userdata, hint_index, co, &hint);
+    if (hint.index != -1) {
+      const float bound = std::nextafter(hint.dist_sq, std::numeric_limits<float>::infinity());
+      nearest.dist_sq = std::min(nearest.dist_sq, bound);
+    }
+  }
+  return BLI_bvhtree_find_nearest(&tree, co, &nearest, callback, userdata);
+}
+
 }  // namespace blender
 
 #endif
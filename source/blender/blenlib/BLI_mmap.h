@@ -32,9 +32,29 @@ BLI_mmap_file *BLI_mmap_open(int fd) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
 bool BLI_mmap_read(BLI_mmap_file *file, void *dest, size_t offset, size_t length)
     ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1);
 
+/* Access pattern hints, see #BLI_mmap_advise. */
+typedef enum eBLI_mmap_advice {
+  /* Default behavior of the OS, which usually reads ahead of accessed pages. */
+  BLI_MMAP_ADVICE_NORMAL = 0,
+  /* Pages are accessed in random order, only read the pages that are actually accessed. */
+  BLI_MMAP_ADVICE_RANDOM = 1,
+  /* The given range is going to be accessed soon, start reading it in. */
+  BLI_MMAP_ADVICE_WILLNEED = 2,
+} eBLI_mmap_advice;
+
+/* Hints the expected access pattern of the given range to the OS.
+ * This never affects the data that is read, only how and when the OS performs the IO.
+ * Returns false when the hint is not supported on this platform. */
+bool BLI_mmap_advise(BLI_mmap_file *file, size_t offset, size_t length, eBLI_mmap_advice advice)
+    ATTR_NONNULL(1);
+
 void *BLI_mmap_get_pointer(BLI_mmap_file *file) ATTR_WARN_UNUSED_RESULT;
 size_t BLI_mmap_get_length(const BLI_mmap_file *file) ATTR_WARN_UNUSED_RESULT;
 
+/* Returns whether an IO error occurred while accessing the memory returned by
+ * #BLI_mmap_get_pointer directly, in which case the affected pages read as zeros. */
+bool BLI_mmap_any_io_error(const BLI_mmap_file *file) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1);
+
 void BLI_mmap_free(BLI_mmap_file *file) ATTR_NONNULL(1);
 
 #ifdef __cplusplus
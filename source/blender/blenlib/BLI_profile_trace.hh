@@ -0,0 +1,98 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Low overhead tracing of named zones and counters across all of Blender. Recording is compiled
+ * in but disabled by default, in which case a zone only costs a relaxed atomic load. When enabled
+ * (e.g. with `--profile-trace file.json`), every thread records into its own ring buffer without
+ * any synchronization, and all buffers are written to a file in the Chrome trace event format
+ * when recording stops. The file can be opened in Perfetto or `chrome://tracing`.
+ *
+ * Zone names have to be string literals, because only the pointer is stored. Dynamic information
+ * like the name of a modifier can be passed in as detail string, which is copied (and possibly
+ * truncated) only when recording is enabled.
+ */
+
+#include <atomic>
+#include <chrono>
+
+#include "BLI_string_ref.hh"
+#include "BLI_utility_mixins.hh"
+
+namespace blender::profile_trace {
+
+namespace detail {
+extern std::atomic<bool> is_enabled;
+
+using Clock = std::chrono::steady_clock;
+
+void add_zone(const char *name, StringRef detail, Clock::time_point start, Clock::time_point end);
+}  // namespace detail
+
+inline bool is_enabled()
+{
+  return detail::is_enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * Start recording. The trace is written to the given file when #stop is called.
+ */
+void start(StringRefNull filepath);
+/**
+ * Stop recording and write all recorded events to the file passed to #start. Should be called
+ * when no other threads are recording anymore. Does nothing if recording was not started.
+ */
+void stop();
+
+/** Record the current value of a counter, which is displayed as graph over time. */
+void counter(const char *name, double value);
+
+/**
+ * Records the time between construction and destruction as zone on the current thread.
+ */
+class ScopedZone : NonCopyable, NonMovable {
+ private:
+  const char *name_ = nullptr;
+  StringRef detail_;
+  detail::Clock::time_point start_;
+
+ public:
+  ScopedZone(const char *name, const StringRef detail = {})
+  {
+    if (is_enabled()) {
+      name_ = name;
+      detail_ = detail;
+      start_ = detail::Clock::now();
+    }
+  }
+
+  ~ScopedZone()
+  {
+    if (name_ != nullptr) {
+      detail::add_zone(name_, detail_, start_, detail::Clock::now());
+    }
+  }
+};
+
+}  // namespace blender::profile_trace
+
+#define BLI_PROFILE_TRACE_CONCAT_(a, b) a##b
+#define BLI_PROFILE_TRACE_CONCAT(a, b) BLI_PROFILE_TRACE_CONCAT_(a, b)
+
+/** Record the current scope as zone with the given string literal as name. */
+#define PROFILE_TRACE_ZONE(name) \
+  blender::profile_trace::ScopedZone BLI_PROFILE_TRACE_CONCAT(profile_trace_zone_, __LINE__)(name)
+
+/**
+ * Same as #PROFILE_TRACE_ZONE but with an additional detail string. The detail expression is only
+ * evaluated when recording is enabled and has to stay valid until the end of the scope.
+ */
+#define PROFILE_TRACE_ZONE_DETAIL(name, detail) \
+  blender::profile_trace::ScopedZone BLI_PROFILE_TRACE_CONCAT(profile_trace_zone_, __LINE__)( \
+      name, \
+      blender::profile_trace::is_enabled() ? blender::StringRef(detail) : blender::StringRef())
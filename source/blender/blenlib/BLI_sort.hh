@@ -8,12 +8,17 @@
  * \ingroup bli
  */
 
+#include <cstdint>
+#include <cstring>
+
 #ifdef WITH_TBB
 #  include <tbb/parallel_sort.h>
 #else
 #  include <algorithm>
 #endif
 
+#include "BLI_span.hh"
+
 namespace blender {
 
 #ifdef WITH_TBB
@@ -31,4 +36,36 @@ void parallel_sort(RandomAccessIterator begin, RandomAccessIterator end, const C
 }
 #endif
 
+/**
+ * Reorder the values by their keys with a parallel LSD radix sort. The sort is stable, values with
+ * equal keys keep their relative order. Both spans are reordered. For large arrays this is much
+ * faster than a comparison based sort, so it's meant for sorting millions of indices by a key.
+ * Use #radix_sort_key to get keys that preserve the order of signed integers and floats.
+ */
+void parallel_radix_sort(MutableSpan<uint32_t> keys, MutableSpan<int> values);
+
+inline uint32_t radix_sort_key(const uint32_t value)
+{
+  return value;
+}
+
+inline uint32_t radix_sort_key(const int32_t value)
+{
+  return uint32_t(value) ^ 0x80000000u;
+}
+
+/**
+ * Negative zero is treated as being equal to positive zero. NaN values with the sign bit set are
+ * sorted before all other values, other NaN values after them.
+ */
+inline uint32_t radix_sort_key(float value)
+{
+  if (value == 0.0f) {
+    value = 0.0f;
+  }
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+}
+
 }  // namespace blender
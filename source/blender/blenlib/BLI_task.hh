@@ -32,12 +32,17 @@
 #  endif
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
 #include "BLI_function_ref.hh"
 #include "BLI_index_range.hh"
 #include "BLI_lazy_threading.hh"
 #include "BLI_span.hh"
 #include "BLI_task_size_hints.hh"
 #include "BLI_utildefines.h"
+#include "BLI_utility_mixins.hh"
 
 namespace blender {
 
@@ -108,6 +113,96 @@ inline void parallel_for(const IndexRange range,
   detail::parallel_for_impl(range, grain_size, function, size_hints);
 }
 
+/**
+ * Chooses the grain size for a #parallel_for call site based on how long the elements took to
+ * process in previous calls. This is useful when the cost per element depends a lot on the input
+ * data, so that no fixed grain size works well for all inputs.
+ *
+ * It should be a static variable at the call site, so that the measurements are shared by all
+ * calls:
+ * \code{.cc}
+ * static threading::AdaptiveGrainSize grain_size{"normals_calc_faces"};
+ * threading::parallel_for(faces.index_range(), grain_size, [&](const IndexRange range) { ... });
+ * \endcode
+ *
+ * The grain size does not affect the result of the computation, only how the work is split up.
+ */
+class AdaptiveGrainSize : NonCopyable, NonMovable {
+ public:
+  /** Each task should take about this long, which is much more than the scheduling overhead. */
+  static constexpr double target_task_ns = 50'000.0;
+  /** Used before the first measurement. */
+  static constexpr int64_t initial_grain_size = 256;
+
+ private:
+  const char *name_;
+  /** Exponential moving average of the measured cost per element. Zero when not measured yet. */
+  std::atomic<double> ns_per_element_ = 0.0;
+  std::atomic<int64_t> calls_num_ = 0;
+  std::atomic<int64_t> single_thread_calls_num_ = 0;
+  /** Intrusive list of all call sites, used to print statistics. */
+  AdaptiveGrainSize *next_ = nullptr;
+
+ public:
+  explicit AdaptiveGrainSize(const char *name);
+
+  int64_t grain_size() const
+  {
+    const double ns_per_element = ns_per_element_.load(std::memory_order_relaxed);
+    if (ns_per_element <= 0.0) {
+      return initial_grain_size;
+    }
+    return std::clamp<int64_t>(int64_t(target_task_ns / ns_per_element), 1, 1 << 20);
+  }
+
+  void add_measurement(int64_t elements_num, std::chrono::nanoseconds duration);
+
+  /** Print the measured cost and the chosen grain size of all call sites, for profiling. */
+  static void print_stats();
+
+  template<typename Function>
+  friend void parallel_for(IndexRange range,
+                           AdaptiveGrainSize &grain_size,
+                           const Function &function);
+};
+
+/**
+ * Same as #parallel_for but the grain size is derived from previous calls at the same call site.
+ * A small part at the beginning of the range is processed on the calling thread first to measure
+ * the current cost per element. If the remaining work is too small to amortize the threading
+ * overhead, it is done on the calling thread as well.
+ */
+template<typename Function>
+inline void parallel_for(const IndexRange range,
+                         AdaptiveGrainSize &grain_size,
+                         const Function &function)
+{
+  if (range.is_empty()) {
+    return;
+  }
+  grain_size.calls_num_.fetch_add(1, std::memory_order_relaxed);
+  const int64_t sample_size = std::min(range.size(),
+                                       std::max<int64_t>(1, grain_size.grain_size() / 8));
+  const IndexRange sample_range = range.take_front(sample_size);
+  const auto start = std::chrono::steady_clock::now();
+  function(sample_range);
+  grain_size.add_measurement(sample_size, std::chrono::steady_clock::now() - start);
+
+  const IndexRange remaining_range = range.drop_front(sample_size);
+  if (remaining_range.is_empty()) {
+    grain_size.single_thread_calls_num_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  const int64_t final_grain_size = grain_size.grain_size();
+  if (remaining_range.size() <= final_grain_size) {
+    grain_size.single_thread_calls_num_.fetch_add(1, std::memory_order_relaxed);
+    function(remaining_range);
+    return;
+  }
+  detail::parallel_for_impl(
+      remaining_range, final_grain_size, function, detail::TaskSizeHints_Static(1));
+}
+
 /**
  * Move the sub-range boundaries down to the next aligned index. The "global" begin and end
  * remain fixed though.
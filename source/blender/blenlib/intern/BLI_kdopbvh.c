@@ -1574,7 +1574,35 @@ static void dfs_find_nearest_dfs(BVHNearestData *data, BVHNode *node)
     int i;
     float nearest[3];
 
-    if (data->proj[node->main_axis] <= node->children[0]->bv[node->main_axis * 2 + 1]) {
+    if (node->node_num > 2) {
+      /* With wide trees, visit the children ordered by their distance, so that the nearest
+       * distance shrinks as fast as possible and more of the remaining children can be skipped. */
+      float children_dist_sq[MAX_TREETYPE];
+      int order[MAX_TREETYPE];
+      int order_len = 0;
+      for (i = 0; i != node->node_num; i++) {
+        const float dist_sq = calc_nearest_point_squared(data->proj, node->children[i], nearest);
+        if (dist_sq >= data->nearest.dist_sq) {
+          continue;
+        }
+        /* Insertion sort, there are only a few children. */
+        int j = order_len++;
+        while (j > 0 && children_dist_sq[order[j - 1]] > dist_sq) {
+          order[j] = order[j - 1];
+          j--;
+        }
+        order[j] = i;
+        children_dist_sq[i] = dist_sq;
+      }
+      for (i = 0; i != order_len; i++) {
+        if (children_dist_sq[order[i]] >= data->nearest.dist_sq) {
+          /* All remaining children are even farther away. */
+          break;
+        }
+        dfs_find_nearest_dfs(data, node->children[order[i]]);
+      }
+    }
+    else if (data->proj[node->main_axis] <= node->children[0]->bv[node->main_axis * 2 + 1]) {
 
       for (i = 0; i != node->node_num; i++) {
         if (calc_nearest_point_squared(data->proj, node->children[i], nearest) >=
@@ -208,6 +208,39 @@ bool BLI_mmap_read(BLI_mmap_file *file, void *dest, size_t offset, size_t length
   return !file->io_error;
 }
 
+bool BLI_mmap_advise(BLI_mmap_file *file, size_t offset, size_t length, eBLI_mmap_advice advice)
+{
+  if (file->io_error || offset >= file->length) {
+    return false;
+  }
+  length = MIN2(length, file->length - offset);
+
+#ifndef WIN32
+  int posix_advice;
+  switch (advice) {
+    case BLI_MMAP_ADVICE_RANDOM:
+      posix_advice = MADV_RANDOM;
+      break;
+    case BLI_MMAP_ADVICE_WILLNEED:
+      posix_advice = MADV_WILLNEED;
+      break;
+    default:
+      posix_advice = MADV_NORMAL;
+      break;
+  }
+
+  /* `madvise` requires a page aligned start address. */
+  const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+  const size_t offset_aligned = offset - (offset % page_size);
+  return madvise(file->memory + offset_aligned, length + (offset - offset_aligned), posix_advice) ==
+         0;
+#else
+  /* Windows has no equivalent for the access pattern hints of a mapped view. */
+  UNUSED_VARS(length, advice);
+  return false;
+#endif
+}
+
 void *BLI_mmap_get_pointer(BLI_mmap_file *file)
 {
   return file->memory;
@@ -218,6 +251,11 @@ size_t BLI_mmap_get_length(const BLI_mmap_file *file)
   return file->length;
 }
 
+bool BLI_mmap_any_io_error(const BLI_mmap_file *file)
+{
+  return file->io_error;
+}
+
 void BLI_mmap_free(BLI_mmap_file *file)
 {
 #ifndef WIN32
@@ -21,6 +21,8 @@ typedef struct {
   const char *data;
   BLI_mmap_file *mmap;
   size_t length;
+  /** Only used for memory-mapped files, see #BLI_filereader_new_mmap_ex. */
+  bool random_access;
 } MemoryReader;
 
 static int64_t memory_read_raw(FileReader *reader, void *buffer, size_t size)
@@ -87,6 +89,10 @@ FileReader *BLI_filereader_new_memory(const void *data, size_t len)
  * This avoids system call overhead and can significantly speed up file loading.
  */
 
+/* Reads of at least this size prefetch their range when the file is accessed randomly,
+ * smaller reads typically only touch one or two pages. */
+#define MMAP_RANDOM_ACCESS_PREFETCH_SIZE (64 * 1024)
+
 static int64_t memory_read_mmap(FileReader *reader, void *buffer, size_t size)
 {
   MemoryReader *mem = (MemoryReader *)reader;
@@ -94,6 +100,10 @@ static int64_t memory_read_mmap(FileReader *reader, void *buffer, size_t size)
   /* Don't read more bytes than there are available in the buffer. */
   size_t readsize = MIN2(size, (size_t)(mem->length - mem->reader.offset));
 
+  if (mem->random_access && readsize >= MMAP_RANDOM_ACCESS_PREFETCH_SIZE) {
+    BLI_mmap_advise(mem->mmap, mem->reader.offset, readsize, BLI_MMAP_ADVICE_WILLNEED);
+  }
+
   if (!BLI_mmap_read(mem->mmap, buffer, mem->reader.offset, readsize)) {
     return 0;
   }
@@ -110,7 +120,7 @@ static void memory_close_mmap(FileReader *reader)
   MEM_freeN(mem);
 }
 
-FileReader *BLI_filereader_new_mmap(int filedes)
+FileReader *BLI_filereader_new_mmap_ex(int filedes, bool random_access)
 {
   BLI_mmap_file *mmap = BLI_mmap_open(filedes);
   if (mmap == NULL) {
@@ -121,6 +131,11 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   mem->mmap = mmap;
   mem->length = BLI_mmap_get_length(mmap);
+  mem->random_access = random_access;
+
+  if (random_access) {
+    BLI_mmap_advise(mmap, 0, mem->length, BLI_MMAP_ADVICE_RANDOM);
+  }
 
   mem->reader.read = memory_read_mmap;
   mem->reader.seek = memory_seek;
@@ -128,3 +143,8 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   return (FileReader *)mem;
 }
+
+FileReader *BLI_filereader_new_mmap(int filedes)
+{
+  return BLI_filereader_new_mmap_ex(filedes, false);
+}
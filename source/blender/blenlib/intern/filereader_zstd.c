@@ -11,6 +11,7 @@
 
 #include "BLI_filereader.h"
 #include "BLI_math_base.h"
+#include "BLI_task.h"
 
 #ifdef __BIG_ENDIAN__
 #  include "BLI_endian_switch.h"
@@ -195,6 +196,109 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
   return uncompressed_data;
 }
 
+typedef struct ZstdFramesDecompressData {
+  ZstdReader *zstd;
+  int first_frame;
+  const char *compressed_data;
+  char *uncompressed_data;
+  /** Per frame, whether decompression failed. */
+  bool *frame_failed;
+} ZstdFramesDecompressData;
+
+typedef struct ZstdFramesDecompressTLS {
+  ZSTD_DCtx *ctx;
+} ZstdFramesDecompressTLS;
+
+static void zstd_decompress_frames_init(const void *__restrict UNUSED(userdata),
+                                        void *__restrict chunk)
+{
+  ZstdFramesDecompressTLS *tls = (ZstdFramesDecompressTLS *)chunk;
+  tls->ctx = NULL;
+}
+
+static void zstd_decompress_frames_free(const void *__restrict UNUSED(userdata),
+                                        void *__restrict chunk)
+{
+  ZstdFramesDecompressTLS *tls = (ZstdFramesDecompressTLS *)chunk;
+  if (tls->ctx) {
+    ZSTD_freeDCtx(tls->ctx);
+  }
+}
+
+static void zstd_decompress_frames_fn(void *__restrict userdata,
+                                      const int iter,
+                                      const TaskParallelTLS *__restrict tls)
+{
+  ZstdFramesDecompressData *data = (ZstdFramesDecompressData *)userdata;
+  ZstdFramesDecompressTLS *tls_data = (ZstdFramesDecompressTLS *)tls->userdata_chunk;
+  const ZstdReader *zstd = data->zstd;
+  const int frame = data->first_frame + iter;
+
+  if (tls_data->ctx == NULL) {
+    tls_data->ctx = ZSTD_createDCtx();
+  }
+
+  const size_t *compressed_ofs = zstd->seek.compressed_ofs;
+  const size_t *uncompressed_ofs = zstd->seek.uncompressed_ofs;
+  const size_t compressed_size = compressed_ofs[frame + 1] - compressed_ofs[frame];
+  const size_t uncompressed_size = uncompressed_ofs[frame + 1] - uncompressed_ofs[frame];
+
+  size_t res = ZSTD_decompressDCtx(
+      tls_data->ctx,
+      data->uncompressed_data + (uncompressed_ofs[frame] - uncompressed_ofs[data->first_frame]),
+      uncompressed_size,
+      data->compressed_data + (compressed_ofs[frame] - compressed_ofs[data->first_frame]),
+      compressed_size);
+  data->frame_failed[iter] = ZSTD_isError(res) || res < uncompressed_size;
+}
+
+/* Decompress the frames in [first_frame, last_frame) directly into the given buffer.
+ * The compressed data is read in one go, then the frames are decompressed in parallel. */
+static bool zstd_decompress_frames(ZstdReader *zstd,
+                                   const int first_frame,
+                                   const int last_frame,
+                                   char *buffer)
+{
+  const size_t compressed_start = zstd->seek.compressed_ofs[first_frame];
+  const size_t compressed_size = zstd->seek.compressed_ofs[last_frame] - compressed_start;
+  const int frames_num = last_frame - first_frame;
+
+  char *compressed_data = MEM_mallocN(compressed_size, __func__);
+  if (zstd->base->seek(zstd->base, compressed_start, SEEK_SET) < 0 ||
+      zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
+  {
+    MEM_freeN(compressed_data);
+    return false;
+  }
+
+  ZstdFramesDecompressData data = {
+      .zstd = zstd,
+      .first_frame = first_frame,
+      .compressed_data = compressed_data,
+      .uncompressed_data = buffer,
+      .frame_failed = MEM_malloc_arrayN(frames_num, sizeof(bool), __func__),
+  };
+  ZstdFramesDecompressTLS tls_data = {NULL};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = frames_num > 1;
+  settings.userdata_chunk = &tls_data;
+  settings.userdata_chunk_size = sizeof(tls_data);
+  settings.func_init = zstd_decompress_frames_init;
+  settings.func_free = zstd_decompress_frames_free;
+  BLI_task_parallel_range(0, frames_num, &data, zstd_decompress_frames_fn, &settings);
+
+  bool success = true;
+  for (int i = 0; i < frames_num; i++) {
+    success &= !data.frame_failed[i];
+  }
+
+  MEM_freeN(data.frame_failed);
+  MEM_freeN(compressed_data);
+  return success;
+}
+
 static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
 {
   ZstdReader *zstd = (ZstdReader *)reader;
@@ -207,6 +311,30 @@ static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
       break;
     }
 
+    /* Frames that are entirely covered by the read don't need to go through the cache,
+     * decompress them straight into the output buffer (in parallel when there are several). */
+    if (zstd->reader.offset == zstd->seek.uncompressed_ofs[frame] &&
+        zstd->seek.uncompressed_ofs[frame + 1] <= end_offset && frame != zstd->seek.cached_frame)
+    {
+      int last_frame = frame + 1;
+      while (last_frame < zstd->seek.frames_num &&
+             zstd->seek.uncompressed_ofs[last_frame + 1] <= end_offset)
+      {
+        last_frame++;
+      }
+
+      if (!zstd_decompress_frames(zstd, frame, last_frame, (char *)buffer + read_len)) {
+        /* Error while reading the frames, so return as much as we can. */
+        break;
+      }
+
+      const size_t frames_read_len = zstd->seek.uncompressed_ofs[last_frame] -
+                                     zstd->reader.offset;
+      read_len += frames_read_len;
+      zstd->reader.offset += frames_read_len;
+      continue;
+    }
+
     const char *framedata = zstd_ensure_cache(zstd, frame);
     if (framedata == NULL) {
       /* Error while reading the frame, so return as much as we can. */
@@ -461,20 +461,85 @@ IndexMask IndexMask::from_bools(const VArray<bool> &bools, IndexMaskMemory &memo
   return IndexMask::from_bools(bools.index_range(), bools, memory);
 }
 
+/**
+ * Filter function for #from_predicate_impl that finds the indices where #bools is true (or false
+ * when #Invert is set). When the segment is a range, eight booleans are tested at once, so that
+ * long runs of unselected or selected elements, which are common in selections, are cheap.
+ */
+template<bool Invert>
+static int64_t filter_bools_segment(const IndexMaskSegment indices,
+                                    const bool *bools,
+                                    int16_t *__restrict r_true_indices)
+{
+  const Span<int16_t> local_indices = indices.base_span();
+  const int64_t offset = indices.offset();
+  int16_t *r_current = r_true_indices;
+  if (!unique_sorted_indices::non_empty_is_range(local_indices)) {
+    for (const int16_t local_index : local_indices) {
+      *r_current = local_index;
+      r_current += bools[offset + local_index] != Invert;
+    }
+    return r_current - r_true_indices;
+  }
+
+  const int64_t first = local_indices.first();
+  const int64_t size = local_indices.size();
+  const bool *segment_bools = bools + offset + first;
+  /* Booleans are expected to be 0 or 1, so eight of them read as one word have these values. */
+  constexpr uint64_t all_false = 0;
+  constexpr uint64_t all_true = 0x0101010101010101;
+  constexpr uint64_t all_skipped = Invert ? all_true : all_false;
+  constexpr uint64_t all_kept = Invert ? all_false : all_true;
+
+  int64_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    uint64_t word;
+    memcpy(&word, segment_bools + i, sizeof(word));
+    if (word == all_skipped) {
+      continue;
+    }
+    if (word == all_kept) {
+      for (int64_t j = 0; j < 8; j++) {
+        *r_current++ = int16_t(first + i + j);
+      }
+      continue;
+    }
+    for (int64_t j = 0; j < 8; j++) {
+      *r_current = int16_t(first + i + j);
+      r_current += segment_bools[i + j] != Invert;
+    }
+  }
+  for (; i < size; i++) {
+    *r_current = int16_t(first + i);
+    r_current += segment_bools[i] != Invert;
+  }
+  return r_current - r_true_indices;
+}
+
 IndexMask IndexMask::from_bools(const IndexMask &universe,
                                 Span<bool> bools,
                                 IndexMaskMemory &memory)
 {
-  return IndexMask::from_predicate(
-      universe, GrainSize(1024), memory, [bools](const int64_t index) { return bools[index]; });
+  return detail::from_predicate_impl(
+      universe,
+      GrainSize(1024),
+      memory,
+      [bools](const IndexMaskSegment indices, int16_t *__restrict r_true_indices) {
+        return filter_bools_segment<false>(indices, bools.data(), r_true_indices);
+      });
 }
 
 IndexMask IndexMask::from_bools_inverse(const IndexMask &universe,
                                         Span<bool> bools,
                                         IndexMaskMemory &memory)
 {
-  return IndexMask::from_predicate(
-      universe, GrainSize(1024), memory, [bools](const int64_t index) { return !bools[index]; });
+  return detail::from_predicate_impl(
+      universe,
+      GrainSize(1024),
+      memory,
+      [bools](const IndexMaskSegment indices, int16_t *__restrict r_true_indices) {
+        return filter_bools_segment<true>(indices, bools.data(), r_true_indices);
+      });
 }
 
 IndexMask IndexMask::from_bools(const IndexMask &universe,
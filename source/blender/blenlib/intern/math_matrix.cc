@@ -492,6 +492,45 @@ template MatBase<float, 4, 4> from_rotation(const AxisAngleCartesian &rotation);
 
 template float3 transform_point(const float3x3 &mat, const float3 &point);
 template float3 transform_point(const float4x4 &mat, const float3 &point);
+
+#if BLI_HAVE_SSE2
+BLI_INLINE __m128 transform_point_sse(const __m128 col[4], const float3 &point)
+{
+  /* Same order of operations as #transform_point. */
+  __m128 result = _mm_add_ps(_mm_setzero_ps(), _mm_mul_ps(_mm_set1_ps(point.x), col[0]));
+  result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(point.y), col[1]));
+  result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(point.z), col[2]));
+  return _mm_add_ps(result, col[3]);
+}
+
+BLI_INLINE void store_float3_sse(const __m128 value, float3 &dst)
+{
+  /* Only write three components, the next point directly follows in memory. */
+  _mm_storel_pi(reinterpret_cast<__m64 *>(&dst.x), value);
+  _mm_store_ss(&dst.z, _mm_movehl_ps(value, value));
+}
+#endif
+
+void transform_points(const Span<float3> src, const float4x4 &mat, MutableSpan<float3> dst)
+{
+  BLI_assert(src.size() == dst.size());
+#if BLI_HAVE_SSE2
+  const __m128 col[4] = {
+      _mm_loadu_ps(mat[0]), _mm_loadu_ps(mat[1]), _mm_loadu_ps(mat[2]), _mm_loadu_ps(mat[3])};
+  for (const int64_t i : src.index_range()) {
+    store_float3_sse(transform_point_sse(col, src[i]), dst[i]);
+  }
+#else
+  for (const int64_t i : src.index_range()) {
+    dst[i] = transform_point(mat, src[i]);
+  }
+#endif
+}
+
+void transform_points(const float4x4 &mat, MutableSpan<float3> points)
+{
+  transform_points(points.as_span(), mat, points);
+}
 template float3 transform_direction(const float3x3 &mat, const float3 &direction);
 template float3 transform_direction(const float4x4 &mat, const float3 &direction);
 template float3 project_point(const float4x4 &mat, const float3 &point);
@@ -0,0 +1,230 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "BLI_array.hh"
+#include "BLI_fileops.h"
+#include "BLI_profile_trace.hh"
+#include "BLI_string.h"
+#include "BLI_vector.hh"
+
+namespace blender::profile_trace {
+
+namespace detail {
+std::atomic<bool> is_enabled = false;
+}  // namespace detail
+
+using detail::Clock;
+
+struct Event {
+  /** String literal passed to the zone or counter. */
+  const char *name;
+  /** Zero for counters. */
+  int64_t duration_ns;
+  int64_t start_ns;
+  double counter_value;
+  char detail[48];
+};
+
+/**
+ * Only written by the thread it belongs to. When the buffer is full, the oldest events are
+ * overwritten.
+ */
+struct ThreadBuffer {
+  static constexpr int64_t capacity = 1 << 15;
+
+  int thread_index;
+  Array<Event> events{capacity, NoInitialization()};
+  /** Total number of events added since recording started. */
+  std::atomic<int64_t> events_num = 0;
+
+  void add(const Event &event)
+  {
+    const int64_t index = events_num.load(std::memory_order_relaxed);
+    events[index % capacity] = event;
+    events_num.store(index + 1, std::memory_order_release);
+  }
+};
+
+struct TraceState {
+  std::mutex mutex;
+  Vector<std::unique_ptr<ThreadBuffer>> buffers;
+  std::string filepath;
+  /** Time when recording started, all events are relative to it. */
+  std::atomic<int64_t> start_time_ns = 0;
+};
+
+static TraceState &get_state()
+{
+  static TraceState state;
+  return state;
+}
+
+static ThreadBuffer &get_thread_buffer()
+{
+  static thread_local ThreadBuffer *thread_buffer = nullptr;
+  if (thread_buffer == nullptr) {
+    TraceState &state = get_state();
+    std::lock_guard lock{state.mutex};
+    std::unique_ptr<ThreadBuffer> buffer = std::make_unique<ThreadBuffer>();
+    buffer->thread_index = int(state.buffers.size());
+    thread_buffer = buffer.get();
+    state.buffers.append(std::move(buffer));
+  }
+  return *thread_buffer;
+}
+
+static int64_t to_ns(const Clock::time_point time)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+void detail::add_zone(const char *name,
+                      const StringRef detail,
+                      const Clock::time_point start,
+                      const Clock::time_point end)
+{
+  Event event;
+  event.name = name;
+  event.start_ns = to_ns(start) - get_state().start_time_ns.load(std::memory_order_relaxed);
+  /* Make sure that zones are never mistaken for counters. */
+  event.duration_ns = std::max<int64_t>(to_ns(end) - to_ns(start), 1);
+  event.counter_value = 0.0;
+  int64_t detail_len = std::min<int64_t>(detail.size(), sizeof(event.detail) - 1);
+  /* Don't cut a multi-byte UTF8 character in half. */
+  while (detail_len > 0 && detail_len < detail.size() &&
+         (uchar(detail[detail_len]) & 0xC0) == 0x80)
+  {
+    detail_len--;
+  }
+  memcpy(event.detail, detail.data(), size_t(detail_len));
+  event.detail[detail_len] = '\0';
+  get_thread_buffer().add(event);
+}
+
+void counter(const char *name, const double value)
+{
+  if (!is_enabled()) {
+    return;
+  }
+  Event event;
+  event.name = name;
+  event.start_ns = to_ns(Clock::now()) -
+                   get_state().start_time_ns.load(std::memory_order_relaxed);
+  event.duration_ns = 0;
+  event.counter_value = value;
+  event.detail[0] = '\0';
+  get_thread_buffer().add(event);
+}
+
+void start(const StringRefNull filepath)
+{
+  TraceState &state = get_state();
+  std::lock_guard lock{state.mutex};
+  if (detail::is_enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  for (std::unique_ptr<ThreadBuffer> &buffer : state.buffers) {
+    buffer->events_num.store(0, std::memory_order_relaxed);
+  }
+  state.filepath = filepath;
+  state.start_time_ns.store(to_ns(Clock::now()), std::memory_order_relaxed);
+  detail::is_enabled.store(true, std::memory_order_release);
+}
+
+static void write_json_string(FILE *file, const char *str)
+{
+  fputc('"', file);
+  for (const char *c = str; *c; c++) {
+    if (ELEM(*c, '"', '\\')) {
+      fputc('\\', file);
+      fputc(*c, file);
+    }
+    else if (uchar(*c) < 0x20) {
+      fputc(' ', file);
+    }
+    else {
+      fputc(*c, file);
+    }
+  }
+  fputc('"', file);
+}
+
+static void write_event(FILE *file, const int thread_index, const Event &event)
+{
+  /* Times in the trace event format are in microseconds. */
+  fprintf(file, "{\"name\": ");
+  write_json_string(file, event.name);
+  if (event.duration_ns == 0) {
+    fprintf(file,
+            ", \"ph\": \"C\", \"pid\": 0, \"tid\": %d, \"ts\": %.3f, \"args\": {\"value\": %g}}",
+            thread_index,
+            double(event.start_ns) / 1000.0,
+            event.counter_value);
+    return;
+  }
+  fprintf(file,
+          ", \"ph\": \"X\", \"pid\": 0, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f",
+          thread_index,
+          double(event.start_ns) / 1000.0,
+          double(event.duration_ns) / 1000.0);
+  if (event.detail[0] != '\0') {
+    fprintf(file, ", \"args\": {\"detail\": ");
+    write_json_string(file, event.detail);
+    fprintf(file, "}");
+  }
+  fprintf(file, "}");
+}
+
+void stop()
+{
+  TraceState &state = get_state();
+  std::lock_guard lock{state.mutex};
+  if (!detail::is_enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  detail::is_enabled.store(false, std::memory_order_relaxed);
+
+  FILE *file = BLI_fopen(state.filepath.c_str(), "w");
+  if (file == nullptr) {
+    fprintf(stderr, "Could not write profile trace to \"%s\"\n", state.filepath.c_str());
+    return;
+  }
+  fprintf(file, "{\"traceEvents\": [\n");
+  bool is_first = true;
+  for (const std::unique_ptr<ThreadBuffer> &buffer : state.buffers) {
+    const int64_t events_num = buffer->events_num.load(std::memory_order_acquire);
+    if (events_num == 0) {
+      continue;
+    }
+    fprintf(file,
+            "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": %d, "
+            "\"args\": {\"name\": \"Thread %d\"}}",
+            is_first ? "" : ",\n",
+            buffer->thread_index,
+            buffer->thread_index);
+    is_first = false;
+    /* Only the most recent events are still available when the buffer overflowed. */
+    const int64_t first_event = std::max<int64_t>(events_num - ThreadBuffer::capacity, 0);
+    for (int64_t i = first_event; i < events_num; i++) {
+      fprintf(file, ",\n");
+      write_event(file, buffer->thread_index, buffer->events[i % ThreadBuffer::capacity]);
+    }
+  }
+  fprintf(file, "\n]}\n");
+  fclose(file);
+  printf("Profile trace written to %s\n", state.filepath.c_str());
+}
+
+}  // namespace blender::profile_trace
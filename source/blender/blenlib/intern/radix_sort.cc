@@ -0,0 +1,105 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+
+#include "BLI_array.hh"
+#include "BLI_math_base.h"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
+
+namespace blender {
+
+static constexpr int radix_bits = 8;
+static constexpr int radix_size = 1 << radix_bits;
+static constexpr int radix_mask = radix_size - 1;
+
+void parallel_radix_sort(MutableSpan<uint32_t> keys, MutableSpan<int> values)
+{
+  BLI_assert(keys.size() == values.size());
+  const int64_t size = keys.size();
+  if (size < 2) {
+    return;
+  }
+
+  /* Every chunk is counted and scattered by a single task. Scattering the chunks in order into
+   * consecutive ranges of each digit keeps the sort stable. */
+  const int64_t chunk_size = std::max<int64_t>(16384,
+                                               int64_t(divide_ceil_ul(uint64_t(size), 256)));
+  const int64_t chunks_num = int64_t(divide_ceil_ul(uint64_t(size), uint64_t(chunk_size)));
+  const auto chunk_range = [&](const int64_t chunk) {
+    return IndexRange::from_begin_end(chunk * chunk_size,
+                                      std::min(size, (chunk + 1) * chunk_size));
+  };
+
+  Array<uint32_t> keys_buffer(size, NoInitialization());
+  Array<int> values_buffer(size, NoInitialization());
+  MutableSpan<uint32_t> src_keys = keys;
+  MutableSpan<int> src_values = values;
+  MutableSpan<uint32_t> dst_keys = keys_buffer;
+  MutableSpan<int> dst_values = values_buffer;
+
+  /* Per chunk counts of every digit, turned into the chunk's destination offsets. */
+  Array<int64_t> offsets(chunks_num * radix_size);
+
+  for (int shift = 0; shift < 32; shift += radix_bits) {
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+      for (const int64_t chunk : range) {
+        MutableSpan<int64_t> chunk_counts = offsets.as_mutable_span().slice(
+            chunk * radix_size, radix_size);
+        chunk_counts.fill(0);
+        for (const uint32_t key : src_keys.slice(chunk_range(chunk))) {
+          chunk_counts[(key >> shift) & radix_mask]++;
+        }
+      }
+    });
+
+    int64_t offset = 0;
+    bool all_keys_have_same_digit = false;
+    for (const int digit : IndexRange(radix_size)) {
+      const int64_t digit_begin = offset;
+      for (const int64_t chunk : IndexRange(chunks_num)) {
+        int64_t &chunk_offset = offsets[chunk * radix_size + digit];
+        const int64_t count = chunk_offset;
+        chunk_offset = offset;
+        offset += count;
+      }
+      if (offset - digit_begin == size) {
+        all_keys_have_same_digit = true;
+        break;
+      }
+    }
+    if (all_keys_have_same_digit) {
+      /* This pass would not change the order. */
+      continue;
+    }
+
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+      for (const int64_t chunk : range) {
+        int64_t *chunk_offsets = &offsets[chunk * radix_size];
+        for (const int64_t i : chunk_range(chunk)) {
+          const uint32_t key = src_keys[i];
+          const int64_t dst_index = chunk_offsets[(key >> shift) & radix_mask]++;
+          dst_keys[dst_index] = key;
+          dst_values[dst_index] = src_values[i];
+        }
+      }
+    });
+    std::swap(src_keys, dst_keys);
+    std::swap(src_values, dst_values);
+  }
+
+  if (src_keys.data() != keys.data()) {
+    threading::parallel_for(IndexRange(size), 16384, [&](const IndexRange range) {
+      keys.slice(range).copy_from(src_keys.slice(range));
+      values.slice(range).copy_from(src_values.slice(range));
+    });
+  }
+}
+
+}  // namespace blender
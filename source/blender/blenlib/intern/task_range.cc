@@ -9,6 +9,8 @@
  */
 
 #include <cstdlib>
+#include <iostream>
+#include <mutex>
 
 #include "MEM_guardedalloc.h"
 
@@ -315,3 +317,59 @@ void memory_bandwidth_bound_task_impl(const FunctionRef<void()> function)
 }
 
 }  // namespace blender::threading::detail
+
+namespace blender::threading {
+
+static std::mutex &adaptive_grain_sizes_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+static AdaptiveGrainSize *&adaptive_grain_sizes_head()
+{
+  static AdaptiveGrainSize *head = nullptr;
+  return head;
+}
+
+AdaptiveGrainSize::AdaptiveGrainSize(const char *name) : name_(name)
+{
+  std::lock_guard lock{adaptive_grain_sizes_mutex()};
+  AdaptiveGrainSize *&head = adaptive_grain_sizes_head();
+  next_ = head;
+  head = this;
+}
+
+void AdaptiveGrainSize::add_measurement(const int64_t elements_num,
+                                        const std::chrono::nanoseconds duration)
+{
+  BLI_assert(elements_num > 0);
+  /* Avoid a cost of zero when the clock resolution is too low for the sample. */
+  const double sample = std::max(double(duration.count()), 1.0) / double(elements_num);
+  double old_value = ns_per_element_.load(std::memory_order_relaxed);
+  double new_value;
+  do {
+    /* Smooth out noise from preemption and cache effects, but still adapt quickly to inputs that
+     * are much more or less expensive than before. */
+    new_value = old_value <= 0.0 ? sample : old_value * 0.75 + sample * 0.25;
+  } while (
+      !ns_per_element_.compare_exchange_weak(old_value, new_value, std::memory_order_relaxed));
+}
+
+void AdaptiveGrainSize::print_stats()
+{
+  std::lock_guard lock{adaptive_grain_sizes_mutex()};
+  for (const AdaptiveGrainSize *item = adaptive_grain_sizes_head(); item; item = item->next_) {
+    const int64_t calls_num = item->calls_num_.load(std::memory_order_relaxed);
+    if (calls_num == 0) {
+      continue;
+    }
+    std::cout << item->name_ << ": " << calls_num << " calls, "
+              << item->single_thread_calls_num_.load(std::memory_order_relaxed)
+              << " single threaded, "
+              << item->ns_per_element_.load(std::memory_order_relaxed) << " ns per element, "
+              << "grain size " << item->grain_size() << "\n";
+  }
+}
+
+}  // namespace blender::threading
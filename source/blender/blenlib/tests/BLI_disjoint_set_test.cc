@@ -4,6 +4,7 @@
 
 #include "testing/testing.h"
 
+#include "BLI_atomic_disjoint_set.hh"
 #include "BLI_disjoint_set.hh"
 
 #include "BLI_strict_flags.h" /* Keep last. */
@@ -36,4 +37,18 @@ TEST(disjoint_set, Test)
   EXPECT_FALSE(disjoint_set.in_same_set(0, 4));
 }
 
+TEST(atomic_disjoint_set, ReducedIds)
+{
+  AtomicDisjointSet disjoint_set(8);
+  disjoint_set.join(6, 1);
+  disjoint_set.join(7, 3);
+  disjoint_set.join(3, 5);
+  disjoint_set.join(0, 4);
+  EXPECT_EQ(disjoint_set.count_sets(), 4);
+
+  Array<int> ids(8);
+  disjoint_set.calc_reduced_ids(ids);
+  EXPECT_EQ(ids.as_span(), Span<int>({0, 1, 2, 3, 0, 3, 1, 3}));
+}
+
 }  // namespace blender::tests
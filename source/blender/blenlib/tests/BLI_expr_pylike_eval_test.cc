@@ -114,6 +114,8 @@ TEST_PARSE_FAIL(Truncated7, "1 and")
 TEST_PARSE_FAIL(Truncated8, "1 or")
 TEST_PARSE_FAIL(Truncated9, "sqrt(1")
 TEST_PARSE_FAIL(Truncated10, "fmod(1,")
+TEST_PARSE_FAIL(Truncated11, "2 **")
+TEST_PARSE_FAIL(Truncated12, "2 //")
 
 /* Constant expression with working constant folding */
 #define TEST_CONST(name, str, value) \
@@ -148,6 +150,8 @@ TEST_CONST(Half, ".5", 0.5)
 TEST_CONST(Pi, "pi", M_PI)
 TEST_CONST(True, "True", TRUE_VAL)
 TEST_CONST(False, "False", FALSE_VAL)
+TEST_CONST(E, "e", M_E)
+TEST_CONST(Tau, "tau", 2.0 * M_PI)
 
 TEST_CONST(Sqrt, "sqrt(4)", 2.0)
 TEST_EVAL(Sqrt, "sqrt(x)", 4.0, 2.0)
@@ -159,6 +163,18 @@ TEST_CONST(Pow, "pow(4, 0.5)", 2.0)
 TEST_EVAL(Pow, "pow(4, x)", 0.5, 2.0)
 
 TEST_CONST(Log2_1, "log(4, 2)", 2.0)
+TEST_CONST(Log2_2, "log2(8)", 3.0)
+TEST_CONST(Log10, "log10(100)", 2.0)
+
+TEST_CONST(Hypot, "hypot(3, 4)", 5.0)
+TEST_EVAL(Hypot, "hypot(x, 4)", 3.0, 5.0)
+
+TEST_CONST(CopySign, "copysign(2, -1)", -2.0)
+TEST_CONST(Tanh, "tanh(0)", 0.0)
+
+TEST_CONST(Float, "float(2)", 2.0)
+TEST_CONST(Bool1, "bool(2)", TRUE_VAL)
+TEST_CONST(Bool2, "bool(0)", FALSE_VAL)
 
 TEST_CONST(Round1, "round(-0.5)", -1.0)
 TEST_CONST(Round2, "round(-0.4)", 0.0)
@@ -171,6 +187,16 @@ TEST_CONST(Clamp3, "clamp(1.5)", 1.0)
 TEST_CONST(Clamp4, "clamp(0.5, 0.2, 0.3)", 0.3)
 TEST_CONST(Clamp5, "clamp(0.0, 0.2, 0.3)", 0.2)
 
+TEST_CONST(Min1, "min(1, 2)", 1.0)
+TEST_CONST(Min2, "min(3, -2, 1)", -2.0)
+TEST_EVAL(Min1, "min(x, 0.5)", 0.25, 0.25)
+TEST_EVAL(Min2, "min(x, 0.5)", 0.75, 0.5)
+
+TEST_CONST(Max1, "max(1, 2)", 2.0)
+TEST_CONST(Max2, "max(3, -2, 1)", 3.0)
+TEST_EVAL(Max1, "max(x, 0.5)", 0.25, 0.5)
+TEST_EVAL(Max2, "max(x, 0.5)", 0.75, 0.75)
+
 TEST_CONST(Lerp1, "lerp(-10,10,-1)", -30.0)
 TEST_CONST(Lerp2, "lerp(-10,10,0.25)", -5.0)
 TEST_CONST(Lerp3, "lerp(-10,10,1)", 10.0)
@@ -208,6 +234,24 @@ TEST_EVAL(BinaryMul, "x*3", 2, 6.0)
 TEST_CONST(BinaryDiv, "3/2", 1.5)
 TEST_EVAL(BinaryDiv, "3/x", 2, 1.5)
 
+TEST_CONST(BinaryPow, "2**3", 8.0)
+TEST_EVAL(BinaryPow, "x**2", 3, 9.0)
+
+TEST_CONST(BinaryFloorDiv1, "7//2", 3.0)
+TEST_CONST(BinaryFloorDiv2, "-7//2", -4.0)
+TEST_EVAL(BinaryFloorDiv, "x//2", 7, 3.0)
+
+TEST_CONST(BinaryMod1, "7%3", 1.0)
+TEST_CONST(BinaryMod2, "-7%3", 2.0)
+TEST_CONST(BinaryMod3, "7%-3", -2.0)
+TEST_CONST(BinaryMod4, "7.5%2", 1.5)
+TEST_EVAL(BinaryMod, "x%3", -7, 2.0)
+
+TEST_CONST(Pow1, "-2**2", -4.0)
+TEST_CONST(Pow2, "2**3**2", 512.0)
+TEST_CONST(Pow3, "2**-1", 0.5)
+TEST_CONST(Pow4, "2*3**2", 18.0)
+
 TEST_CONST(Arith1, "1 + -2 * 3", -5.0)
 TEST_CONST(Arith2, "(1 + -2) * 3", -3.0)
 TEST_CONST(Arith3, "-1 + 2 * 3", 5.0)
@@ -340,6 +384,10 @@ TEST_ERROR(SqrtDomain3, "sqrt(x)", 0.0, EXPR_PYLIKE_SUCCESS)
 TEST_ERROR(PowDomain1, "pow(-1, 0.5)", 0.0, EXPR_PYLIKE_MATH_ERROR)
 TEST_ERROR(PowDomain2, "pow(-1, x)", 0.5, EXPR_PYLIKE_MATH_ERROR)
 TEST_ERROR(PowDomain3, "pow(-1, x)", 2.0, EXPR_PYLIKE_SUCCESS)
+TEST_ERROR(PowDomain4, "(-1) ** x", 0.5, EXPR_PYLIKE_MATH_ERROR)
+
+TEST_ERROR(ModZero, "1 % x", 0.0, EXPR_PYLIKE_MATH_ERROR)
+TEST_ERROR(FloorDivZero, "1 // x", 0.0, EXPR_PYLIKE_DIV_BY_ZERO)
 
 TEST_ERROR(Mixed1, "sqrt(x) + 1 / max(0, x)", -1.0, EXPR_PYLIKE_MATH_ERROR)
 TEST_ERROR(Mixed2, "sqrt(x) + 1 / max(0, x)", 0.0, EXPR_PYLIKE_DIV_BY_ZERO)
@@ -322,6 +322,38 @@ TEST(index_mask, FromPredicateFuzzy)
   });
 }
 
+TEST(index_mask, FromBoolsFuzzy)
+{
+  RandomNumberGenerator rng;
+  /* Mix long runs of the same value with random values, so that both the fast path for runs and
+   * the per-element path are used. */
+  Array<bool> bools(100'000);
+  int64_t run_start = 0;
+  while (run_start < bools.size()) {
+    const int64_t run_size = std::min<int64_t>(rng.get_int32(100), bools.size() - run_start);
+    const int mode = rng.get_int32(3);
+    for (const int64_t i : IndexRange(run_start, run_size)) {
+      bools[i] = mode == 2 ? rng.get_int32(2) == 1 : mode == 1;
+    }
+    run_start += run_size;
+  }
+
+  IndexMaskMemory memory;
+  const IndexMask universes[] = {IndexMask(bools.size()),
+                                 IndexMask::from_every_nth(3, bools.size() / 3, 0, memory)};
+  for (const IndexMask &universe : universes) {
+    const IndexMask mask = IndexMask::from_bools(universe, bools, memory);
+    const IndexMask expected = IndexMask::from_predicate(
+        universe, GrainSize(1024), memory, [&](const int64_t i) { return bools[i]; });
+    EXPECT_EQ(mask, expected);
+
+    const IndexMask mask_inverse = IndexMask::from_bools_inverse(universe, bools, memory);
+    const IndexMask expected_inverse = IndexMask::from_predicate(
+        universe, GrainSize(1024), memory, [&](const int64_t i) { return !bools[i]; });
+    EXPECT_EQ(mask_inverse, expected_inverse);
+  }
+}
+
 TEST(index_mask, Complement)
 {
   IndexMaskMemory memory;
@@ -4,6 +4,7 @@
 
 #include "testing/testing.h"
 
+#include "BLI_array.hh"
 #include "BLI_math_matrix.h"
 #include "BLI_math_matrix.hh"
 #include "BLI_math_rotation.h"
@@ -569,6 +570,26 @@ TEST(math_matrix, MatrixTransform)
   EXPECT_V2_NEAR(result2, expect2, 1e-5);
 }
 
+TEST(math_matrix, MatrixTransformPoints)
+{
+  const float4x4 m4 = from_loc_rot_scale<float4x4>(
+      {10, -2, 0.5f}, EulerXYZ(0.3f, -1.2f, 2.0f), float3(1.5f, 0.25f, -3.0f));
+  const Array<float3> src = {{1, 2, 3}, {-0.0f, 0, 0}, {-4.5f, 1e6f, 0.1f}, {7, 8, 9}};
+  Array<float3> dst(src.size());
+  transform_points(src, m4, dst);
+  for (const int i : src.index_range()) {
+    EXPECT_EQ(dst[i], transform_point(m4, src[i]));
+  }
+
+  /* The last point must not affect memory after the span. */
+  Array<float3> points = src;
+  transform_points(m4, points.as_mutable_span().drop_back(1));
+  EXPECT_EQ(points.last(), src.last());
+  for (const int i : src.index_range().drop_back(1)) {
+    EXPECT_EQ(points[i], dst[i]);
+  }
+}
+
 TEST(math_matrix, MatrixProjection)
 {
   using namespace math::projection;
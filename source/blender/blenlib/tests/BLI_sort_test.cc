@@ -0,0 +1,103 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "BLI_array.hh"
+#include "BLI_array_utils.hh"
+#include "BLI_rand.hh"
+#include "BLI_sort.hh"
+#include "BLI_timeit.hh"
+
+namespace blender::tests {
+
+static Array<int> radix_sorted_indices(const Span<float> weights)
+{
+  Array<uint32_t> keys(weights.size());
+  Array<int> indices(weights.size());
+  for (const int i : weights.index_range()) {
+    keys[i] = radix_sort_key(weights[i]);
+  }
+  array_utils::fill_index_range<int>(indices);
+  parallel_radix_sort(keys, indices);
+  return indices;
+}
+
+static Array<int> stable_sorted_indices(const Span<float> weights)
+{
+  Array<int> indices(weights.size());
+  array_utils::fill_index_range<int>(indices);
+  std::stable_sort(indices.begin(), indices.end(), [&](const int a, const int b) {
+    return weights[a] < weights[b];
+  });
+  return indices;
+}
+
+TEST(sort, RadixSortKeys)
+{
+  EXPECT_LT(radix_sort_key(-5), radix_sort_key(-1));
+  EXPECT_LT(radix_sort_key(-1), radix_sort_key(0));
+  EXPECT_LT(radix_sort_key(0), radix_sort_key(std::numeric_limits<int32_t>::max()));
+  EXPECT_LT(radix_sort_key(std::numeric_limits<int32_t>::min()), radix_sort_key(-5));
+
+  EXPECT_LT(radix_sort_key(-std::numeric_limits<float>::infinity()), radix_sort_key(-2.5f));
+  EXPECT_LT(radix_sort_key(-2.5f), radix_sort_key(-1e-20f));
+  EXPECT_LT(radix_sort_key(-1e-20f), radix_sort_key(0.0f));
+  EXPECT_EQ(radix_sort_key(-0.0f), radix_sort_key(0.0f));
+  EXPECT_LT(radix_sort_key(0.0f), radix_sort_key(1e-20f));
+  EXPECT_LT(radix_sort_key(1e-20f), radix_sort_key(3.0f));
+  EXPECT_LT(radix_sort_key(3.0f), radix_sort_key(std::numeric_limits<float>::infinity()));
+}
+
+TEST(sort, RadixSortSmall)
+{
+  const Array<float> weights = {3.0f, -1.0f, 3.0f, 0.0f, -0.0f, 2.5f, -1.0f};
+  const Array<int> indices = radix_sorted_indices(weights);
+  EXPECT_EQ(indices.as_span(), Span<int>({1, 6, 3, 4, 5, 0, 2}));
+}
+
+TEST(sort, RadixSortStable)
+{
+  RandomNumberGenerator rng(42);
+  /* Large enough to be split into multiple chunks, with many duplicate keys. */
+  Array<float> weights(100'000);
+  for (float &weight : weights) {
+    weight = float(rng.get_int32(1000) - 500) * 0.25f;
+  }
+  EXPECT_EQ(radix_sorted_indices(weights).as_span(), stable_sorted_indices(weights).as_span());
+}
+
+/**
+ * Set this to 1 to activate the benchmark. It is disabled by default, because it prints a lot.
+ */
+#if 0
+TEST(sort, RadixSortBenchmark)
+{
+  RandomNumberGenerator rng(0);
+  Array<float> weights(20'000'000);
+  for (float &weight : weights) {
+    weight = rng.get_float() * 1000.0f - 500.0f;
+  }
+  Array<int> indices(weights.size());
+  {
+    SCOPED_TIMER("parallel_sort");
+    array_utils::fill_index_range<int>(indices);
+    parallel_sort(indices.begin(), indices.end(), [&](const int a, const int b) {
+      if (weights[a] == weights[b]) {
+        return a < b;
+      }
+      return weights[a] < weights[b];
+    });
+  }
+  {
+    SCOPED_TIMER("parallel_radix_sort");
+    radix_sorted_indices(weights);
+  }
+}
+#endif
+
+}  // namespace blender::tests
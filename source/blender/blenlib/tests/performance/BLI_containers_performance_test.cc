@@ -0,0 +1,154 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_map.hh"
+#include "BLI_rand.hh"
+#include "BLI_set.hh"
+#include "BLI_task.hh"
+#include "BLI_timeit.hh"
+#include "BLI_vector_set.hh"
+
+namespace blender::tests {
+
+/* Run the longest tests! */
+// #define USE_BIG_TESTS
+
+#ifdef USE_BIG_TESTS
+static constexpr int64_t ELEMENTS_NUM = 100'000'000;
+#else
+static constexpr int64_t ELEMENTS_NUM = 1'000'000;
+#endif
+
+static Array<int> random_ints(const int64_t size, const uint32_t seed)
+{
+  RandomNumberGenerator rng(seed);
+  Array<int> values(size);
+  for (int &value : values) {
+    value = rng.get_int32();
+  }
+  return values;
+}
+
+static Array<bool> random_bools(const int64_t size, const float probability, const uint32_t seed)
+{
+  RandomNumberGenerator rng(seed);
+  Array<bool> values(size);
+  for (bool &value : values) {
+    value = rng.get_float() < probability;
+  }
+  return values;
+}
+
+TEST(containers_performance, Set)
+{
+  const Array<int> values = random_ints(ELEMENTS_NUM, 0);
+  Set<int> set;
+  {
+    SCOPED_TIMER("set_insert");
+    for (const int value : values) {
+      set.add(value);
+    }
+  }
+  int64_t found = 0;
+  {
+    SCOPED_TIMER("set_lookup");
+    for (const int value : values) {
+      found += set.contains(value);
+    }
+  }
+  EXPECT_EQ(found, ELEMENTS_NUM);
+}
+
+TEST(containers_performance, VectorSet)
+{
+  const Array<int> values = random_ints(ELEMENTS_NUM, 0);
+  VectorSet<int> set;
+  {
+    SCOPED_TIMER("vector_set_insert");
+    for (const int value : values) {
+      set.add(value);
+    }
+  }
+  int64_t found = 0;
+  {
+    SCOPED_TIMER("vector_set_index_of");
+    for (const int value : values) {
+      found += set.index_of(value) >= 0;
+    }
+  }
+  EXPECT_EQ(found, ELEMENTS_NUM);
+}
+
+TEST(containers_performance, Map)
+{
+  const Array<int> values = random_ints(ELEMENTS_NUM, 0);
+  Map<int, int> map;
+  {
+    SCOPED_TIMER("map_insert");
+    for (const int i : values.index_range()) {
+      map.add(values[i], i);
+    }
+  }
+  int64_t found = 0;
+  {
+    SCOPED_TIMER("map_lookup");
+    for (const int value : values) {
+      found += map.lookup_ptr(value) != nullptr;
+    }
+  }
+  EXPECT_EQ(found, ELEMENTS_NUM);
+}
+
+TEST(containers_performance, IndexMaskFromBools)
+{
+  for (const float probability : {0.01f, 0.5f, 0.99f}) {
+    const Array<bool> bools = random_bools(ELEMENTS_NUM, probability, 0);
+    IndexMaskMemory memory;
+    SCOPED_TIMER("index_mask_from_bools");
+    const IndexMask mask = IndexMask::from_bools(bools, memory);
+    EXPECT_LE(mask.size(), ELEMENTS_NUM);
+  }
+}
+
+TEST(containers_performance, IndexMaskSetOperations)
+{
+  IndexMaskMemory memory;
+  const IndexMask mask_a = IndexMask::from_bools(random_bools(ELEMENTS_NUM, 0.5f, 0), memory);
+  const IndexMask mask_b = IndexMask::from_bools(random_bools(ELEMENTS_NUM, 0.5f, 1), memory);
+  {
+    SCOPED_TIMER("index_mask_union");
+    const IndexMask mask = IndexMask::from_union(mask_a, mask_b, memory);
+    EXPECT_GE(mask.size(), mask_a.size());
+  }
+  {
+    SCOPED_TIMER("index_mask_intersection");
+    const IndexMask mask = IndexMask::from_intersection(mask_a, mask_b, memory);
+    EXPECT_LE(mask.size(), mask_a.size());
+  }
+  {
+    SCOPED_TIMER("index_mask_difference");
+    const IndexMask mask = IndexMask::from_difference(mask_a, mask_b, memory);
+    EXPECT_LE(mask.size(), mask_a.size());
+  }
+}
+
+TEST(containers_performance, ParallelForOverhead)
+{
+  Array<int> values(ELEMENTS_NUM, 0);
+  for (const int64_t grain_size : {1, 64, 4096}) {
+    SCOPED_TIMER("parallel_for_grain_" + std::to_string(grain_size));
+    threading::parallel_for(values.index_range(), grain_size, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        values[i]++;
+      }
+    });
+  }
+  EXPECT_EQ(values.first(), 3);
+}
+
+}  // namespace blender::tests
@@ -0,0 +1,89 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_kdopbvh.h"
+#include "BLI_kdtree.h"
+#include "BLI_math_vector_types.hh"
+#include "BLI_rand.hh"
+#include "BLI_timeit.hh"
+
+namespace blender::tests {
+
+/* Run the longest tests! */
+// #define USE_BIG_TESTS
+
+#ifdef USE_BIG_TESTS
+static constexpr int POINTS_NUM = 10'000'000;
+#else
+static constexpr int POINTS_NUM = 1'000'000;
+#endif
+static constexpr int QUERIES_NUM = 100'000;
+
+static Array<float3> random_points(const int size, const uint32_t seed)
+{
+  RandomNumberGenerator rng(seed);
+  Array<float3> points(size);
+  for (float3 &point : points) {
+    point = float3(rng.get_float(), rng.get_float(), rng.get_float());
+  }
+  return points;
+}
+
+TEST(spatial_performance, KDTree)
+{
+  const Array<float3> points = random_points(POINTS_NUM, 0);
+  const Array<float3> queries = random_points(QUERIES_NUM, 1);
+
+  KDTree_3d *tree;
+  {
+    SCOPED_TIMER("kdtree_build");
+    tree = BLI_kdtree_3d_new(POINTS_NUM);
+    for (const int i : points.index_range()) {
+      BLI_kdtree_3d_insert(tree, i, points[i]);
+    }
+    BLI_kdtree_3d_balance(tree);
+  }
+  int found = 0;
+  {
+    SCOPED_TIMER("kdtree_find_nearest");
+    for (const float3 &query : queries) {
+      found += BLI_kdtree_3d_find_nearest(tree, query, nullptr) != -1;
+    }
+  }
+  EXPECT_EQ(found, QUERIES_NUM);
+  BLI_kdtree_3d_free(tree);
+}
+
+TEST(spatial_performance, BVHTree)
+{
+  const Array<float3> points = random_points(POINTS_NUM, 0);
+  const Array<float3> queries = random_points(QUERIES_NUM, 1);
+
+  BVHTree *tree;
+  {
+    SCOPED_TIMER("bvhtree_build");
+    tree = BLI_bvhtree_new(POINTS_NUM, 0.0f, 2, 6);
+    for (const int i : points.index_range()) {
+      BLI_bvhtree_insert(tree, i, points[i], 1);
+    }
+    BLI_bvhtree_balance(tree);
+  }
+  int found = 0;
+  {
+    SCOPED_TIMER("bvhtree_find_nearest");
+    for (const float3 &query : queries) {
+      BVHTreeNearest nearest;
+      nearest.index = -1;
+      nearest.dist_sq = FLT_MAX;
+      found += BLI_bvhtree_find_nearest(tree, query, &nearest, nullptr, nullptr) != -1;
+    }
+  }
+  EXPECT_EQ(found, QUERIES_NUM);
+  BLI_bvhtree_free(tree);
+}
+
+}  // namespace blender::tests
@@ -12,6 +12,7 @@
 #include "BLI_filereader.h"
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
+#include "BLI_vector.hh"
 
 namespace blender {
 class ImplicitSharingInfo;
@@ -34,8 +35,16 @@ struct MemFileChunk {
   const char *buf;
   /** Size in bytes. */
   size_t size;
-  /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
+  /** Hash of the content, used to find identical chunks anywhere in the previous step. */
+  uint64_t hash;
+  /** When true, this chunk is identical to the chunk at the same position in the previous step. */
   bool is_identical;
+  /**
+   * When true, this chunk doesn't own the memory, it's shared with a #MemFileChunk of a previous
+   * step. Always set for identical chunks, but also for chunks that have the same content as any
+   * other chunk of the previous step (e.g. because data moved in the file).
+   */
+  bool is_buf_shared;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
    * detect unchanged IDs).
    * Defined when writing the next step (i.e. last undo step has those always false). */
@@ -55,6 +64,13 @@ struct MemFile {
   MemFileSharedStorage *shared_storage;
 };
 
+/** A newly written chunk and the chunk of the reference memfile it should be compared with. */
+struct MemFileChunkCompare {
+  MemFileChunk *chunk;
+  /** Chunk at the same position in the reference memfile, may be null. */
+  MemFileChunk *reference_chunk;
+};
+
 struct MemFileWriteData {
   MemFile *written_memfile;
   MemFile *reference_memfile;
@@ -64,6 +80,13 @@ struct MemFileWriteData {
 
   /** Maps an ID session uid to its first reference MemFileChunk, if existing. */
   blender::Map<uint, MemFileChunk *> id_session_uid_mapping;
+  /** Maps the size and hash of all reference MemFileChunk to the first chunk with that content. */
+  blender::Map<std::pair<size_t, uint64_t>, MemFileChunk *> content_mapping;
+  /**
+   * Chunks written so far, they own a copy of the written data until they are compared to the
+   * reference memfile in a background task started by #BLO_memfile_write_finalize.
+   */
+  blender::Vector<MemFileChunkCompare> pending_chunks;
 };
 
 struct MemFileUndoData {
@@ -90,6 +113,12 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
 void BLO_memfile_write_finalize(MemFileWriteData *mem_data);
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size);
+/**
+ * Wait until the background comparison of the last written memfile with its reference is done.
+ * Until then, chunks may still be replaced by shared buffers and the #MemFile.size is an upper
+ * bound, so this must be called before reading or modifying any written memfile.
+ */
+void BLO_memfile_write_wait();
 
 /* exports */
 
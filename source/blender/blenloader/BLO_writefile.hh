@@ -34,14 +34,34 @@ enum eBLO_WritePathRemap {
   BLO_WRITE_PATH_REMAP_ABSOLUTE = 3,
 };
 
+/**
+ * Trade-off between writing speed and file size, only used for compressed files
+ * (see #G_FILE_COMPRESS).
+ */
+enum eBLO_WriteCompressionMode {
+  /** Balanced compression level and frame size. */
+  BLO_WRITE_COMPRESSION_DEFAULT = 0,
+  /** Fastest compression with bigger frames, e.g. for saving huge scenes often. */
+  BLO_WRITE_COMPRESSION_FAST = 1,
+  /** Smallest files at the cost of slower writing, e.g. for archival. */
+  BLO_WRITE_COMPRESSION_DENSE = 2,
+};
+
 /** Similar to #BlendFileReadParams. */
 struct BlendFileWriteParams {
   eBLO_WritePathRemap remap_mode;
+  eBLO_WriteCompressionMode compression_mode;
   /** Save `.blend1`, `.blend2`... etc. */
   uint use_save_versions : 1;
   /** On write, restore paths after editing them (see #BLO_WRITE_PATH_REMAP_RELATIVE). */
   uint use_save_as_copy : 1;
   uint use_userdef : 1;
+  /**
+   * Write a manifest of the file content, with the data in a store file next to it that is kept
+   * between writes, so only data that is not in the store yet has to be written.
+   * Intended for auto-save, compression is not supported. See #ChunkStoreHeader.
+   */
+  uint use_chunk_store : 1;
   const BlendThumbnail *thumb;
 };
 
@@ -54,6 +74,12 @@ extern bool BLO_write_file(Main *mainvar,
                            const BlendFileWriteParams *params,
                            ReportList *reports);
 
+/**
+ * Remove the store of the file at \a filepath if it was written with
+ * #BlendFileWriteParams.use_chunk_store, the file itself is kept.
+ */
+void BLO_chunk_store_remove(const char *filepath);
+
 /**
  * \return Success.
  */
@@ -17,7 +17,8 @@
 
 #include "BLI_ghash.h"
 #include "BLI_linklist.h"
-#include "BLI_path_util.h" /* Only for assertions. */
+#include "BLI_path_util.h"
+#include "BLI_profile_trace.hh"
 #include "BLI_string.h"
 #include "BLI_utildefines.h"
 
@@ -63,7 +64,7 @@ BlendHandle *BLO_blendhandle_from_file(const char *filepath, BlendFileReadReport
 {
   BlendHandle *bh;
 
-  bh = (BlendHandle *)blo_filedata_from_file(filepath, reports);
+  bh = (BlendHandle *)blo_filedata_from_file_for_partial_read(filepath, reports);
 
   return bh;
 }
@@ -305,6 +306,7 @@ BlendFileData *BLO_read_from_file(const char *filepath,
 {
   BLI_assert(!BLI_path_is_rel(filepath));
   BLI_assert(BLI_path_is_abs_from_cwd(filepath));
+  PROFILE_TRACE_ZONE_DETAIL("Read File", BLI_path_basename(filepath));
 
   BlendFileData *bfd = nullptr;
   FileData *fd;
@@ -28,6 +28,8 @@
 
 #include "fmt/format.h"
 
+#include <xxhash.h>
+
 /* allow readfile to use deprecated functionality */
 #define DNA_DEPRECATED_ALLOW
 
@@ -58,8 +60,11 @@
 #include "BLI_map.hh"
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
+#include "BLI_system.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include BLI_SYSTEM_PID_H
 
 #include "BLT_translation.hh"
 
@@ -1184,9 +1189,346 @@ static FileData *blo_decode_and_check(FileData *fd, ReportList *reports)
   return fd;
 }
 
+/* Reads the content of a chunk store manifest, see #ChunkStoreHeader. */
+static bool chunk_store_manifest_read_from_reader(FileReader *file,
+                                                  ChunkStoreHeader *r_header,
+                                                  ChunkStoreEntry **r_entries)
+{
+  if (file->read(file, r_header, sizeof(*r_header)) != sizeof(*r_header) ||
+      memcmp(r_header->magic, BLO_CHUNK_STORE_MAGIC, BLO_CHUNK_STORE_MAGIC_LEN) != 0)
+  {
+    return false;
+  }
+  r_header->store_filename[sizeof(r_header->store_filename) - 1] = '\0';
+
+  const size_t entries_size = sizeof(ChunkStoreEntry) * size_t(r_header->chunks_num);
+  /* Allocate at least one entry, so that empty manifests still have a valid pointer. */
+  ChunkStoreEntry *entries = static_cast<ChunkStoreEntry *>(MEM_malloc_arrayN(
+      std::max<size_t>(r_header->chunks_num, 1), sizeof(ChunkStoreEntry), __func__));
+  if (file->read(file, entries, entries_size) != int64_t(entries_size)) {
+    MEM_freeN(entries);
+    return false;
+  }
+  for (const uint32_t i : blender::IndexRange(r_header->chunks_num)) {
+    if (entries[i].store_offset + entries[i].size > r_header->store_size) {
+      MEM_freeN(entries);
+      return false;
+    }
+  }
+  *r_entries = entries;
+  return true;
+}
+
+bool blo_chunk_store_manifest_read(const char *filepath,
+                                   ChunkStoreHeader *r_header,
+                                   ChunkStoreEntry **r_entries)
+{
+  const int filedes = BLI_open(filepath, O_BINARY | O_RDONLY, 0);
+  if (filedes == -1) {
+    return false;
+  }
+  FileReader *file = BLI_filereader_new_file(filedes);
+  if (file == nullptr) {
+    close(filedes);
+    return false;
+  }
+  const bool success = chunk_store_manifest_read_from_reader(file, r_header, r_entries);
+  file->close(file);
+  return success;
+}
+
+void blo_chunk_store_filepath_get(const char *manifest_filepath,
+                                  const ChunkStoreHeader *header,
+                                  char *r_filepath,
+                                  const size_t filepath_maxncpy)
+{
+  char dirpath[FILE_MAX];
+  BLI_path_split_dir_part(manifest_filepath, dirpath, sizeof(dirpath));
+  BLI_path_join(r_filepath, filepath_maxncpy, dirpath, header->store_filename);
+}
+
+/** #FileReader that reads the content described by a chunk store manifest from its store. */
+struct ChunkStoreReader {
+  FileReader reader;
+
+  FileReader *store;
+  ChunkStoreEntry *entries;
+  int chunks_num;
+  /** Start of each chunk in the content, with the total size at the end. */
+  uint64_t *chunk_offsets;
+  /** Chunk of the previous read, sequential reads don't have to search for their chunk. */
+  int current_chunk;
+};
+
+static int chunk_store_chunk_from_offset(ChunkStoreReader *chunk_store, const uint64_t offset)
+{
+  const uint64_t *offsets = chunk_store->chunk_offsets;
+  const int current = chunk_store->current_chunk;
+  if (current < chunk_store->chunks_num && offsets[current] <= offset &&
+      offset < offsets[current + 1])
+  {
+    return current;
+  }
+  if (current + 1 < chunk_store->chunks_num && offsets[current + 1] <= offset &&
+      offset < offsets[current + 2])
+  {
+    return current + 1;
+  }
+  const uint64_t *end = offsets + chunk_store->chunks_num + 1;
+  const uint64_t *next = std::upper_bound(offsets, end, offset);
+  if (next == end) {
+    return -1;
+  }
+  return int(next - offsets) - 1;
+}
+
+static int64_t chunk_store_read(FileReader *reader, void *buffer, size_t size)
+{
+  ChunkStoreReader *chunk_store = (ChunkStoreReader *)reader;
+
+  size_t read_len = 0;
+  while (read_len < size) {
+    const uint64_t offset = uint64_t(chunk_store->reader.offset);
+    const int chunk = chunk_store_chunk_from_offset(chunk_store, offset);
+    if (chunk < 0) {
+      /* EOF is reached, so return as much as we can. */
+      break;
+    }
+    chunk_store->current_chunk = chunk;
+
+    const ChunkStoreEntry &entry = chunk_store->entries[chunk];
+    const uint64_t offset_in_chunk = offset - chunk_store->chunk_offsets[chunk];
+    const size_t chunk_read_len = size_t(
+        std::min<uint64_t>(entry.size - offset_in_chunk, size - read_len));
+
+    FileReader *store = chunk_store->store;
+    if (store->seek(store, off64_t(entry.store_offset + offset_in_chunk), SEEK_SET) < 0 ||
+        store->read(store, static_cast<char *>(buffer) + read_len, chunk_read_len) !=
+            int64_t(chunk_read_len))
+    {
+      break;
+    }
+    read_len += chunk_read_len;
+    chunk_store->reader.offset += off64_t(chunk_read_len);
+  }
+
+  return int64_t(read_len);
+}
+
+static off64_t chunk_store_seek(FileReader *reader, off64_t offset, int whence)
+{
+  ChunkStoreReader *chunk_store = (ChunkStoreReader *)reader;
+  const off64_t content_size = off64_t(chunk_store->chunk_offsets[chunk_store->chunks_num]);
+
+  off64_t new_pos;
+  if (whence == SEEK_SET) {
+    new_pos = offset;
+  }
+  else if (whence == SEEK_END) {
+    new_pos = content_size + offset;
+  }
+  else {
+    new_pos = chunk_store->reader.offset + offset;
+  }
+
+  if (new_pos < 0 || new_pos > content_size) {
+    return -1;
+  }
+  chunk_store->reader.offset = new_pos;
+  return chunk_store->reader.offset;
+}
+
+static void chunk_store_close(FileReader *reader)
+{
+  ChunkStoreReader *chunk_store = (ChunkStoreReader *)reader;
+  chunk_store->store->close(chunk_store->store);
+  MEM_freeN(chunk_store->entries);
+  MEM_freeN(chunk_store->chunk_offsets);
+  MEM_freeN(chunk_store);
+}
+
+/**
+ * Create a #FileReader for the content described by the chunk store manifest read from
+ * \a manifest. Takes ownership of \a manifest, like the compressed file readers.
+ */
+static FileReader *blo_filereader_new_chunk_store(FileReader *manifest, const char *filepath)
+{
+  ChunkStoreHeader header;
+  ChunkStoreEntry *entries = nullptr;
+  const bool manifest_valid = chunk_store_manifest_read_from_reader(manifest, &header, &entries);
+  manifest->close(manifest);
+  if (!manifest_valid) {
+    return nullptr;
+  }
+
+  char store_filepath[FILE_MAX];
+  blo_chunk_store_filepath_get(filepath, &header, store_filepath, sizeof(store_filepath));
+  const int store_filedes = BLI_open(store_filepath, O_BINARY | O_RDONLY, 0);
+  if (store_filedes == -1) {
+    MEM_freeN(entries);
+    return nullptr;
+  }
+  FileReader *store = BLI_filereader_new_mmap(store_filedes);
+  if (store == nullptr) {
+    store = BLI_filereader_new_file(store_filedes);
+  }
+  if (store == nullptr) {
+    close(store_filedes);
+    MEM_freeN(entries);
+    return nullptr;
+  }
+
+  ChunkStoreReader *chunk_store = static_cast<ChunkStoreReader *>(
+      MEM_callocN(sizeof(ChunkStoreReader), __func__));
+  chunk_store->store = store;
+  chunk_store->entries = entries;
+  chunk_store->chunks_num = int(header.chunks_num);
+  chunk_store->chunk_offsets = static_cast<uint64_t *>(
+      MEM_malloc_arrayN(size_t(header.chunks_num) + 1, sizeof(uint64_t), __func__));
+  uint64_t offset = 0;
+  for (const int i : blender::IndexRange(chunk_store->chunks_num)) {
+    chunk_store->chunk_offsets[i] = offset;
+    offset += entries[i].size;
+  }
+  chunk_store->chunk_offsets[chunk_store->chunks_num] = offset;
+
+  chunk_store->reader.read = chunk_store_read;
+  chunk_store->reader.seek = chunk_store_seek;
+  chunk_store->reader.close = chunk_store_close;
+
+  return (FileReader *)chunk_store;
+}
+
+/* -------------------------------------------------------------------- */
+/** \name Library Cache
+ *
+ * Compressed library files are decompressed into the private memory of every process that links
+ * from them. When `$BLENDER_LIBRARY_CACHE_DIR` is set, the decompressed content is written once
+ * to a file in that directory instead, and read through a read-only memory mapping. All Blender
+ * processes on a host linking from the same library then share the same pages of the page cache.
+ *
+ * Cache files are keyed by the library path, modification time and size, so a modified library
+ * gets a new cache file. Stale cache files are never removed, that is left to the user.
+ * \{ */
+
+static const char *library_cache_dirpath_get()
+{
+  const char *dirpath = BLI_getenv("BLENDER_LIBRARY_CACHE_DIR");
+  return (dirpath && dirpath[0]) ? dirpath : nullptr;
+}
+
+static bool library_cache_filepath_get(const char *filepath,
+                                       char *r_cache_filepath,
+                                       const size_t cache_filepath_maxncpy)
+{
+  const char *cache_dirpath = library_cache_dirpath_get();
+  BLI_stat_t st;
+  if (cache_dirpath == nullptr || BLI_stat(filepath, &st) != 0) {
+    return false;
+  }
+  const uint64_t path_hash = XXH3_64bits(filepath, strlen(filepath));
+  const std::string cache_filename = fmt::format(
+      "{:016x}_{:x}_{:x}.blend", path_hash, uint64_t(st.st_mtime), uint64_t(st.st_size));
+  BLI_path_join(r_cache_filepath, cache_filepath_maxncpy, cache_dirpath, cache_filename.c_str());
+  return true;
+}
+
+/** Decompress \a filepath into \a cache_filepath, which appears atomically once complete. */
+static bool library_cache_write(const char *filepath, const char *cache_filepath)
+{
+  const int filedes = BLI_open(filepath, O_BINARY | O_RDONLY, 0);
+  if (filedes == -1) {
+    return false;
+  }
+  FileReader *rawfile = BLI_filereader_new_file(filedes);
+  if (rawfile == nullptr) {
+    close(filedes);
+    return false;
+  }
+  char header[7];
+  const bool has_header = rawfile->read(rawfile, header, sizeof(header)) == sizeof(header);
+  rawfile->seek(rawfile, 0, SEEK_SET);
+  FileReader *file = nullptr;
+  if (has_header && BLI_file_magic_is_zstd(header)) {
+    file = BLI_filereader_new_zstd(rawfile);
+  }
+  else if (has_header && BLI_file_magic_is_gzip(header)) {
+    file = BLI_filereader_new_gzip(rawfile);
+  }
+  if (file == nullptr) {
+    rawfile->close(rawfile);
+    return false;
+  }
+
+  /* Each process writes its own temporary file, so concurrent misses don't interfere. */
+  char cache_filepath_tmp[FILE_MAX + 16];
+  SNPRINTF(cache_filepath_tmp, "%s.%d@", cache_filepath, abs(getpid()));
+  BLI_file_ensure_parent_dir_exists(cache_filepath_tmp);
+  const int cache_filedes = BLI_open(
+      cache_filepath_tmp, O_BINARY | O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (cache_filedes == -1) {
+    file->close(file);
+    return false;
+  }
+
+  const size_t buffer_size = 1 << 20;
+  char *buffer = static_cast<char *>(MEM_mallocN(buffer_size, __func__));
+  bool success = true;
+  int64_t readsize;
+  while ((readsize = file->read(file, buffer, buffer_size)) > 0) {
+    if (write(cache_filedes, buffer, size_t(readsize)) != readsize) {
+      success = false;
+      break;
+    }
+  }
+  success &= readsize >= 0;
+  MEM_freeN(buffer);
+  file->close(file);
+  success &= close(cache_filedes) == 0;
+
+  /* Another process may have written the same cache file meanwhile, its content is identical. */
+  if (success && BLI_rename_overwrite(cache_filepath_tmp, cache_filepath) == 0) {
+    return true;
+  }
+  BLI_delete(cache_filepath_tmp, false, false);
+  return false;
+}
+
+/**
+ * Create a memory mapped #FileReader for the cached decompressed content of the compressed
+ * library \a filepath, writing the cache file first if needed.
+ * Returns null when the library cache is not used or could not be written.
+ */
+static FileReader *blo_filereader_new_library_cache(const char *filepath)
+{
+  char cache_filepath[FILE_MAX];
+  if (!library_cache_filepath_get(filepath, cache_filepath, sizeof(cache_filepath))) {
+    return nullptr;
+  }
+  int cache_filedes = BLI_open(cache_filepath, O_BINARY | O_RDONLY, 0);
+  if (cache_filedes == -1) {
+    if (!library_cache_write(filepath, cache_filepath)) {
+      CLOG_WARN(&LOG, "Unable to write library cache file '%s'", cache_filepath);
+      return nullptr;
+    }
+    cache_filedes = BLI_open(cache_filepath, O_BINARY | O_RDONLY, 0);
+    if (cache_filedes == -1) {
+      return nullptr;
+    }
+  }
+  FileReader *file = BLI_filereader_new_mmap_ex(cache_filedes, true);
+  if (file == nullptr) {
+    close(cache_filedes);
+  }
+  return file;
+}
+
+/** \} */
+
 static FileData *blo_filedata_from_file_descriptor(const char *filepath,
                                                    BlendFileReadReport *reports,
-                                                   int filedes)
+                                                   int filedes,
+                                                   const bool is_partial_read)
 {
   char header[7];
   FileReader *rawfile = BLI_filereader_new_file(filedes);
@@ -1215,7 +1557,7 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
   /* Check if we have a regular file. */
   if (memcmp(header, "BLENDER", sizeof(header)) == 0) {
     /* Try opening the file with memory-mapped IO. */
-    file = BLI_filereader_new_mmap(filedes);
+    file = BLI_filereader_new_mmap_ex(filedes, is_partial_read);
     if (file == nullptr) {
       /* `mmap` failed, so just keep using `rawfile`. */
       file = rawfile;
@@ -1234,11 +1576,25 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
       rawfile = nullptr; /* The `Zstd` #FileReader takes ownership of `rawfile`. */
     }
   }
+  else if (memcmp(header, BLO_CHUNK_STORE_MAGIC, BLO_CHUNK_STORE_MAGIC_LEN) == 0) {
+    file = blo_filereader_new_chunk_store(rawfile, filepath);
+    rawfile = nullptr; /* The chunk store #FileReader takes ownership of `rawfile`. */
+  }
 
   /* Clean up `rawfile` if it wasn't taken over. */
   if (rawfile != nullptr) {
     rawfile->close(rawfile);
   }
+
+  /* Linked libraries are read through the shared library cache when enabled. */
+  if (is_partial_read && file != nullptr &&
+      (BLI_file_magic_is_zstd(header) || BLI_file_magic_is_gzip(header)))
+  {
+    if (FileReader *cache_file = blo_filereader_new_library_cache(filepath)) {
+      file->close(file);
+      file = cache_file;
+    }
+  }
   if (file == nullptr) {
     BKE_reportf(reports->reports, RPT_WARNING, "Unrecognized file format '%s'", filepath);
     return nullptr;
@@ -1250,7 +1606,9 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
   return fd;
 }
 
-static FileData *blo_filedata_from_file_open(const char *filepath, BlendFileReadReport *reports)
+static FileData *blo_filedata_from_file_open(const char *filepath,
+                                             BlendFileReadReport *reports,
+                                             const bool is_partial_read = false)
 {
   errno = 0;
   const int file = BLI_open(filepath, O_BINARY | O_RDONLY, 0);
@@ -1262,12 +1620,14 @@ static FileData *blo_filedata_from_file_open(const char *filepath, BlendFileRead
                 errno ? strerror(errno) : RPT_("unknown error reading file"));
     return nullptr;
   }
-  return blo_filedata_from_file_descriptor(filepath, reports, file);
+  return blo_filedata_from_file_descriptor(filepath, reports, file, is_partial_read);
 }
 
-FileData *blo_filedata_from_file(const char *filepath, BlendFileReadReport *reports)
+static FileData *blo_filedata_from_file_ex(const char *filepath,
+                                           BlendFileReadReport *reports,
+                                           const bool is_partial_read)
 {
-  FileData *fd = blo_filedata_from_file_open(filepath, reports);
+  FileData *fd = blo_filedata_from_file_open(filepath, reports, is_partial_read);
   if (fd != nullptr) {
     /* needed for library_append and read_libraries */
     STRNCPY(fd->relabase, filepath);
@@ -1277,6 +1637,17 @@ FileData *blo_filedata_from_file(const char *filepath, BlendFileReadReport *repo
   return nullptr;
 }
 
+FileData *blo_filedata_from_file(const char *filepath, BlendFileReadReport *reports)
+{
+  return blo_filedata_from_file_ex(filepath, reports, false);
+}
+
+FileData *blo_filedata_from_file_for_partial_read(const char *filepath,
+                                                  BlendFileReadReport *reports)
+{
+  return blo_filedata_from_file_ex(filepath, reports, true);
+}
+
 /**
  * Same as blo_filedata_from_file(), but does not reads DNA data, only header.
  * Use it for light access (e.g. thumbnail reading).
@@ -1693,19 +2064,16 @@ void blo_cache_storage_end(FileData *fd)
 
 static void switch_endian_structs(const SDNA *filesdna, BHead *bhead)
 {
-  int blocksize, nblocks;
-  char *data;
+  char *data = (char *)(bhead + 1);
+  const int blocksize = DNA_struct_size(filesdna, bhead->SDNAnr);
 
-  data = (char *)(bhead + 1);
-
-  blocksize = DNA_struct_size(filesdna, bhead->SDNAnr);
-
-  nblocks = bhead->nr;
-  while (nblocks--) {
-    DNA_struct_switch_endian(filesdna, bhead->SDNAnr, data);
-
-    data += blocksize;
-  }
+  /* Blocks are independent, large arrays (e.g. geometry) are converted in parallel. */
+  blender::threading::parallel_for(
+      blender::IndexRange(bhead->nr), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          DNA_struct_switch_endian(filesdna, bhead->SDNAnr, data + i * blocksize);
+        }
+      });
 }
 
 /**
@@ -4647,7 +5015,8 @@ static FileData *read_library_file_data(FileData *basefd,
                      mainptr->curlib->runtime.filepath_abs,
                      mainptr->curlib->filepath,
                      library_parent_filepath(mainptr->curlib));
-    fd = blo_filedata_from_file(mainptr->curlib->runtime.filepath_abs, basefd->reports);
+    fd = blo_filedata_from_file_for_partial_read(mainptr->curlib->runtime.filepath_abs,
+                                                 basefd->reports);
   }
 
   if (fd) {
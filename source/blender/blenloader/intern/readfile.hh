@@ -161,6 +161,16 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath) ATTR_N
  * cannot be called with relative paths anymore!
  */
 FileData *blo_filedata_from_file(const char *filepath, BlendFileReadReport *reports);
+/**
+ * Same as #blo_filedata_from_file, for files of which typically only a few IDs are read,
+ * like libraries that are linked from.
+ *
+ * Since data blocks are already read on demand, uncompressed files that are memory-mapped
+ * then only fault in the pages that are actually accessed, instead of letting the OS read
+ * ahead through the whole file (which is expensive for big libraries on network storage).
+ */
+FileData *blo_filedata_from_file_for_partial_read(const char *filepath,
+                                                  BlendFileReadReport *reports);
 FileData *blo_filedata_from_memory(const void *mem, int memsize, BlendFileReadReport *reports);
 FileData *blo_filedata_from_memfile(MemFile *memfile,
                                     const BlendFileReadParams *params,
@@ -260,3 +270,53 @@ void *blo_read_get_new_globaldata_address(FileData *fd, const void *adr) ATTR_NO
 /* Mark the Main data as invalid (.blend file reading should be aborted ASAP, and the already read
  * data should be discarded). Also add an error report to `fd` including given `message`. */
 void blo_readfile_invalidate(FileData *fd, Main *bmain, const char *message) ATTR_NONNULL(1, 2, 3);
+
+/* -------------------------------------------------------------------- */
+/** \name Chunk Store
+ *
+ * Instead of the regular file content, a file written with
+ * #BlendFileWriteParams.use_chunk_store contains a manifest: a #ChunkStoreHeader followed by a
+ * #ChunkStoreEntry for each chunk of the content, in order. The chunk data itself is stored in a
+ * separate store file next to the manifest. Later writes of the same file only append the chunks
+ * that are not in the store yet, so the cost of writing scales with the changes since the
+ * previous write rather than with the size of the file.
+ *
+ * Both files are only meant to be read on the system that wrote them (they are not portable).
+ * \{ */
+
+#define BLO_CHUNK_STORE_MAGIC "BLENDCS"
+#define BLO_CHUNK_STORE_MAGIC_LEN 7
+
+struct ChunkStoreHeader {
+  /** #BLO_CHUNK_STORE_MAGIC, padded with zeros. */
+  char magic[8];
+  /** Incremented when the store is compacted, to write it to a new file. */
+  uint32_t generation;
+  uint32_t chunks_num;
+  /** Number of valid bytes in the store file, anything after that is garbage. */
+  uint64_t store_size;
+  /** File name of the store, in the same directory as the manifest. */
+  char store_filename[256];
+};
+
+struct ChunkStoreEntry {
+  /** Hash of the chunk content, used to find existing chunks when writing. */
+  uint64_t hash;
+  uint64_t store_offset;
+  uint64_t size;
+};
+
+/**
+ * Read the header and entries of the chunk store manifest at \a filepath.
+ * \return False if the file does not exist or is not a valid manifest.
+ */
+bool blo_chunk_store_manifest_read(const char *filepath,
+                                   ChunkStoreHeader *r_header,
+                                   ChunkStoreEntry **r_entries);
+/** Get the path of the store file used by the manifest at \a manifest_filepath. */
+void blo_chunk_store_filepath_get(const char *manifest_filepath,
+                                  const ChunkStoreHeader *header,
+                                  char *r_filepath,
+                                  size_t filepath_maxncpy);
+
+/** \} */
@@ -26,6 +26,9 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_implicit_sharing.hh"
+#include "BLI_task.h"
+
+#include <xxhash.h>
 
 #include "BLO_readfile.hh"
 #include "BLO_undofile.hh"
@@ -40,8 +43,10 @@
 
 void BLO_memfile_free(MemFile *memfile)
 {
+  BLO_memfile_write_wait();
+
   while (MemFileChunk *chunk = static_cast<MemFileChunk *>(BLI_pophead(&memfile->chunks))) {
-    if (chunk->is_identical == false) {
+    if (chunk->is_buf_shared == false) {
       MEM_freeN((void *)chunk->buf);
     }
     MEM_freeN(chunk);
@@ -61,13 +66,15 @@ MemFileSharedStorage::~MemFileSharedStorage()
 
 void BLO_memfile_merge(MemFile *first, MemFile *second)
 {
+  BLO_memfile_write_wait();
+
   /* We use this mapping to store the memory buffers from second memfile chunks which are not owned
    * by it (i.e. shared with some previous memory steps). */
   blender::Map<const char *, MemFileChunk *> buffer_to_second_memchunk;
 
   /* First, detect all memchunks in second memfile that are not owned by it. */
   LISTBASE_FOREACH (MemFileChunk *, sc, &second->chunks) {
-    if (sc->is_identical) {
+    if (sc->is_buf_shared) {
       buffer_to_second_memchunk.add(sc->buf, sc);
     }
   }
@@ -75,11 +82,11 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
   /* Now, check all chunks from first memfile (the one we are removing), and if a memchunk owned by
    * it is also used by the second memfile, transfer the ownership. */
   LISTBASE_FOREACH (MemFileChunk *, fc, &first->chunks) {
-    if (!fc->is_identical) {
+    if (!fc->is_buf_shared) {
       if (MemFileChunk *sc = buffer_to_second_memchunk.lookup_default(fc->buf, nullptr)) {
-        BLI_assert(sc->is_identical);
-        sc->is_identical = false;
-        fc->is_identical = true;
+        BLI_assert(sc->is_buf_shared);
+        sc->is_buf_shared = false;
+        fc->is_buf_shared = true;
       }
       /* Note that if the second memfile does not use that chunk, we assume that the first one
        * fully owns it without sharing it with any other memfile, and hence it should be freed with
@@ -92,15 +99,104 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
 
 void BLO_memfile_clear_future(MemFile *memfile)
 {
+  BLO_memfile_write_wait();
+
   LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
     chunk->is_identical_future = false;
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Background Chunk Comparison
+ *
+ * Writing an undo step only copies the written data into new chunks on the main thread. Comparing
+ * them with the reference memfile, which replaces unchanged chunks by the buffers of the previous
+ * step and frees the copies, is done in a background task. Only one such task runs at a time,
+ * the next undo push or any access to the memfiles waits for it.
+ * \{ */
+
+struct MemFileCompareTaskData {
+  MemFile *memfile;
+  blender::Map<std::pair<size_t, uint64_t>, MemFileChunk *> content_mapping;
+  blender::Vector<MemFileChunkCompare> chunks;
+  /** Size of the copies freed because their chunk could share the buffer of a previous step. */
+  size_t size_shared;
+};
+
+static TaskPool *memfile_compare_task_pool = nullptr;
+static MemFileCompareTaskData *memfile_compare_task_data = nullptr;
+
+static void memfile_chunk_compare(MemFileCompareTaskData *task_data,
+                                  MemFileChunk *curchunk,
+                                  MemFileChunk *compchunk)
+{
+  const char *buf = curchunk->buf;
+  const size_t size = curchunk->size;
+  curchunk->hash = XXH3_64bits(buf, size);
+
+  /* we compare compchunk with buf */
+  if (compchunk != nullptr) {
+    if (compchunk->size == curchunk->size && compchunk->hash == curchunk->hash) {
+      if (memcmp(compchunk->buf, buf, size) == 0) {
+        curchunk->buf = compchunk->buf;
+        curchunk->is_identical = true;
+        curchunk->is_buf_shared = true;
+        compchunk->is_identical_future = true;
+      }
+    }
+  }
+
+  /* Otherwise, share the memory of any chunk of the previous step with the same content. This
+   * does not make the chunk identical, as it is used to detect unchanged IDs. */
+  if (!curchunk->is_buf_shared) {
+    if (const MemFileChunk *samechunk = task_data->content_mapping.lookup_default(
+            {size, curchunk->hash}, nullptr))
+    {
+      if (memcmp(samechunk->buf, buf, size) == 0) {
+        curchunk->buf = samechunk->buf;
+        curchunk->is_buf_shared = true;
+      }
+    }
+  }
+
+  if (curchunk->is_buf_shared) {
+    MEM_freeN((void *)buf);
+    task_data->size_shared += size;
+  }
+}
+
+static void memfile_compare_task_run(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  MemFileCompareTaskData *task_data = static_cast<MemFileCompareTaskData *>(taskdata);
+  for (const MemFileChunkCompare &compare : task_data->chunks) {
+    memfile_chunk_compare(task_data, compare.chunk, compare.reference_chunk);
+  }
+}
+
+void BLO_memfile_write_wait()
+{
+  if (memfile_compare_task_pool == nullptr) {
+    return;
+  }
+  BLI_task_pool_work_and_wait(memfile_compare_task_pool);
+  BLI_task_pool_free(memfile_compare_task_pool);
+  memfile_compare_task_pool = nullptr;
+
+  MemFileCompareTaskData *task_data = memfile_compare_task_data;
+  task_data->memfile->size -= task_data->size_shared;
+  MEM_delete(task_data);
+  memfile_compare_task_data = nullptr;
+}
+
+/** \} */
+
 void BLO_memfile_write_init(MemFileWriteData *mem_data,
                             MemFile *written_memfile,
                             MemFile *reference_memfile)
 {
+  /* The reference chunks must be final. */
+  BLO_memfile_write_wait();
+
   mem_data->written_memfile = written_memfile;
   mem_data->reference_memfile = reference_memfile;
   mem_data->reference_current_chunk = reference_memfile ? static_cast<MemFileChunk *>(
@@ -119,6 +215,7 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
         current_session_uid = mem_chunk->id_session_uid;
         mem_data->id_session_uid_mapping.add_new(current_session_uid, mem_chunk);
       }
+      mem_data->content_mapping.add({mem_chunk->size, mem_chunk->hash}, mem_chunk);
     }
   }
 }
@@ -126,6 +223,20 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
 void BLO_memfile_write_finalize(MemFileWriteData *mem_data)
 {
   mem_data->id_session_uid_mapping.clear_and_shrink();
+
+  BLI_assert(memfile_compare_task_pool == nullptr);
+  MemFileCompareTaskData *task_data = MEM_new<MemFileCompareTaskData>(__func__);
+  task_data->memfile = mem_data->written_memfile;
+  task_data->content_mapping = std::move(mem_data->content_mapping);
+  task_data->chunks = std::move(mem_data->pending_chunks);
+  task_data->size_shared = 0;
+  mem_data->content_mapping.clear_and_shrink();
+  mem_data->pending_chunks.clear_and_shrink();
+
+  memfile_compare_task_data = task_data;
+  memfile_compare_task_pool = BLI_task_pool_create_background_serial(nullptr, TASK_PRIORITY_LOW);
+  BLI_task_pool_push(
+      memfile_compare_task_pool, memfile_compare_task_run, task_data, false, nullptr);
 }
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size)
@@ -136,8 +247,9 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   MemFileChunk *curchunk = static_cast<MemFileChunk *>(
       MEM_mallocN(sizeof(MemFileChunk), "MemFileChunk"));
   curchunk->size = size;
-  curchunk->buf = nullptr;
+  curchunk->hash = 0;
   curchunk->is_identical = false;
+  curchunk->is_buf_shared = false;
   /* This is unsafe in the sense that an app handler or other code that does not
    * perform an undo push may make changes after the last undo push that
    * will then not be undo. Though it's not entirely clear that is wrong behavior. */
@@ -145,25 +257,16 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   curchunk->id_session_uid = mem_data->current_id_session_uid;
   BLI_addtail(&memfile->chunks, curchunk);
 
-  /* we compare compchunk with buf */
-  if (*compchunk_step != nullptr) {
-    MemFileChunk *compchunk = *compchunk_step;
-    if (compchunk->size == curchunk->size) {
-      if (memcmp(compchunk->buf, buf, size) == 0) {
-        curchunk->buf = compchunk->buf;
-        curchunk->is_identical = true;
-        compchunk->is_identical_future = true;
-      }
-    }
-    *compchunk_step = static_cast<MemFileChunk *>(compchunk->next);
-  }
+  /* The write buffer is re-used, so always copy it. The comparison with the reference chunks is
+   * deferred to #memfile_chunk_compare, which frees the copy again when it is not needed. */
+  char *buf_new = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
+  memcpy(buf_new, buf, size);
+  curchunk->buf = buf_new;
+  memfile->size += size;
 
-  /* not equal... */
-  if (curchunk->buf == nullptr) {
-    char *buf_new = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
-    memcpy(buf_new, buf, size);
-    curchunk->buf = buf_new;
-    memfile->size += size;
+  mem_data->pending_chunks.append({curchunk, *compchunk_step});
+  if (*compchunk_step != nullptr) {
+    *compchunk_step = static_cast<MemFileChunk *>((*compchunk_step)->next);
   }
 }
 
@@ -268,6 +371,8 @@ static void undo_close(FileReader *reader)
 
 FileReader *BLO_memfile_new_filereader(MemFile *memfile, int undo_direction)
 {
+  BLO_memfile_write_wait();
+
   UndoReader *undo = static_cast<UndoReader *>(MEM_callocN(sizeof(UndoReader), __func__));
 
   undo->memfile = memfile;
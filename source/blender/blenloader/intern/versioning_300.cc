@@ -372,9 +372,9 @@ static void sort_linked_ids(Main *bmain)
       if (ID_IS_LINKED(id)) {
         BLI_remlink(lb, id);
         BLI_addtail(&temp_list, id);
-        id_sort_by_name(&temp_list, id, nullptr);
       }
     }
+    id_sort_by_name_all(&temp_list);
     BLI_movelisttolist(lb, &temp_list);
   }
   FOREACH_MAIN_LISTBASE_END;
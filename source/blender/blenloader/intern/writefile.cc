@@ -94,8 +94,10 @@
 #include "BLI_implicit_sharing.hh"
 #include "BLI_link_utils.h"
 #include "BLI_linklist.h"
+#include "BLI_map.hh"
 #include "BLI_math_base.h"
 #include "BLI_mempool.h"
+#include "BLI_profile_trace.hh"
 #include "BLI_set.hh"
 #include "BLI_threads.h"
 
@@ -130,6 +132,7 @@
 
 #include "readfile.hh"
 
+#include <xxhash.h>
 #include <zstd.h>
 
 /* Make preferences read-only. */
@@ -146,6 +149,13 @@
 
 #define ZSTD_COMPRESSION_LEVEL 3
 
+/* Settings for #BLO_WRITE_COMPRESSION_FAST and #BLO_WRITE_COMPRESSION_DENSE.
+ * Bigger frames compress better and have less per-frame overhead,
+ * but always have to be decompressed as a whole when reading parts of them. */
+#define ZSTD_CHUNK_SIZE_LARGE (1 << 22) /* 4mb */
+#define ZSTD_COMPRESSION_LEVEL_FAST 1
+#define ZSTD_COMPRESSION_LEVEL_DENSE 12
+
 static CLG_LogRef LOG = {"blo.writefile"};
 
 /** Use if we want to store how many bytes have been written to the file. */
@@ -170,6 +180,13 @@ class WriteWrap {
 
   /** Buffer output (we only want when output isn't already buffered). */
   bool use_buf = true;
+  /** Size of the chunks passed to #write when buffering (each becomes one compressed frame). */
+  size_t buf_chunk_size = ZSTD_CHUNK_SIZE;
+  /**
+   * Flush the buffer at the end of every ID, so that the chunks passed to #write are the same
+   * for IDs that did not change between writes (as done for undo).
+   */
+  bool use_flush_per_id = false;
 };
 
 class RawWriteWrap : public WriteWrap {
@@ -218,8 +235,25 @@ class ZstdWriteWrap : public WriteWrap {
 
   bool write_error = false;
 
+  int compression_level = ZSTD_COMPRESSION_LEVEL;
+
  public:
-  ZstdWriteWrap(WriteWrap &base_wrap) : base_wrap(base_wrap) {}
+  ZstdWriteWrap(WriteWrap &base_wrap, const eBLO_WriteCompressionMode compression_mode)
+      : base_wrap(base_wrap)
+  {
+    switch (compression_mode) {
+      case BLO_WRITE_COMPRESSION_DEFAULT:
+        break;
+      case BLO_WRITE_COMPRESSION_FAST:
+        compression_level = ZSTD_COMPRESSION_LEVEL_FAST;
+        buf_chunk_size = ZSTD_CHUNK_SIZE_LARGE;
+        break;
+      case BLO_WRITE_COMPRESSION_DENSE:
+        compression_level = ZSTD_COMPRESSION_LEVEL_DENSE;
+        buf_chunk_size = ZSTD_CHUNK_SIZE_LARGE;
+        break;
+    }
+  }
 
   bool open(const char *filepath) override;
   bool close() override;
@@ -251,8 +285,7 @@ void ZstdWriteWrap::write_task(ZstdWriteBlockTask *task)
 {
   size_t out_buf_len = ZSTD_compressBound(task->size);
   void *out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
-  size_t out_size = ZSTD_compress(
-      out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
+  size_t out_size = ZSTD_compress(out_buf, out_buf_len, task->data, task->size, compression_level);
 
   MEM_freeN(task->data);
 
@@ -395,6 +428,176 @@ bool ZstdWriteWrap::write(const void *buf, size_t buf_len)
 
 /** \} */
 
+/**
+ * Writes the file as a chunk store manifest, see #ChunkStoreHeader.
+ *
+ * The entries of the previously written manifest are used to find chunks that are already in the
+ * store, only new chunks are appended to it. When most of the store is not used anymore, a new
+ * store is started instead (the previous one is removed by #finish once the new manifest is in
+ * place, so that a failed write keeps the previous file valid).
+ */
+class ChunkStoreWriteWrap : public WriteWrap {
+  /** The final path of the manifest (#open is given a temporary path). */
+  char manifest_filepath[FILE_MAX];
+  RawWriteWrap manifest_wrap;
+
+  int store_handle = -1;
+  ChunkStoreHeader header = {};
+  blender::Vector<ChunkStoreEntry> entries;
+  /** Chunks in the store, identified by size and hash. */
+  blender::Map<std::pair<uint64_t, uint64_t>, ChunkStoreEntry> stored_chunks;
+
+  /** Set when a new store is started, this store is removed after a successful write. */
+  char store_filepath_prev[FILE_MAX] = "";
+
+  bool write_error = false;
+
+ public:
+  ChunkStoreWriteWrap(const char *filepath)
+  {
+    STRNCPY(manifest_filepath, filepath);
+    use_flush_per_id = true;
+  }
+
+  bool open(const char *filepath) override;
+  bool close() override;
+  bool write(const void *buf, size_t buf_len) override;
+
+  /** Call once the written manifest replaced the previous file. */
+  void finish(bool success);
+};
+
+bool ChunkStoreWriteWrap::open(const char *filepath)
+{
+  ChunkStoreHeader header_prev;
+  ChunkStoreEntry *entries_prev = nullptr;
+  const bool has_prev = blo_chunk_store_manifest_read(
+      manifest_filepath, &header_prev, &entries_prev);
+
+  char store_filepath[FILE_MAX];
+  if (has_prev) {
+    blo_chunk_store_filepath_get(
+        manifest_filepath, &header_prev, store_filepath, sizeof(store_filepath));
+
+    for (const uint32_t i : blender::IndexRange(header_prev.chunks_num)) {
+      const ChunkStoreEntry &entry = entries_prev[i];
+      stored_chunks.add({entry.size, entry.hash}, entry);
+    }
+    MEM_freeN(entries_prev);
+
+    uint64_t used_size = 0;
+    for (const ChunkStoreEntry &entry : stored_chunks.values()) {
+      used_size += entry.size;
+    }
+
+    /* Start a new store when more than half of it isn't used anymore. */
+    if (header_prev.store_size > used_size * 2 || !BLI_exists(store_filepath)) {
+      STRNCPY(store_filepath_prev, store_filepath);
+      stored_chunks.clear();
+      header.generation = header_prev.generation + 1;
+    }
+    else {
+      header.generation = header_prev.generation;
+      header.store_size = header_prev.store_size;
+    }
+  }
+
+  memcpy(header.magic, BLO_CHUNK_STORE_MAGIC, BLO_CHUNK_STORE_MAGIC_LEN);
+  SNPRINTF(header.store_filename,
+           "%s.%u.chunks",
+           BLI_path_basename(manifest_filepath),
+           header.generation);
+  blo_chunk_store_filepath_get(manifest_filepath, &header, store_filepath, sizeof(store_filepath));
+
+  /* Existing data is kept, anything after the size recorded in the manifest (e.g. from a failed
+   * write) is overwritten. */
+  const int open_flags = O_BINARY | O_WRONLY | O_CREAT | (header.store_size == 0 ? O_TRUNC : 0);
+  store_handle = BLI_open(store_filepath, open_flags, 0666);
+  if (store_handle == -1) {
+    return false;
+  }
+  if (BLI_lseek(store_handle, off64_t(header.store_size), SEEK_SET) == -1) {
+    ::close(store_handle);
+    store_handle = -1;
+    return false;
+  }
+
+  if (!manifest_wrap.open(filepath)) {
+    ::close(store_handle);
+    store_handle = -1;
+    return false;
+  }
+  return true;
+}
+
+bool ChunkStoreWriteWrap::write(const void *buf, size_t buf_len)
+{
+  if (write_error) {
+    return false;
+  }
+
+  ChunkStoreEntry entry;
+  entry.hash = XXH3_64bits(buf, buf_len);
+  entry.size = buf_len;
+
+  const std::pair<uint64_t, uint64_t> key = {entry.size, entry.hash};
+  if (const ChunkStoreEntry *stored_entry = stored_chunks.lookup_ptr(key)) {
+    entries.append(*stored_entry);
+    return true;
+  }
+
+  if (::write(store_handle, buf, buf_len) != buf_len) {
+    write_error = true;
+    return false;
+  }
+  entry.store_offset = header.store_size;
+  header.store_size += buf_len;
+
+  stored_chunks.add_new(key, entry);
+  entries.append(entry);
+  return true;
+}
+
+bool ChunkStoreWriteWrap::close()
+{
+  bool success = !write_error;
+  if (::close(store_handle) == -1) {
+    success = false;
+  }
+  store_handle = -1;
+
+  header.chunks_num = uint32_t(entries.size());
+  if (!manifest_wrap.write(&header, sizeof(header)) ||
+      !manifest_wrap.write(entries.data(), sizeof(ChunkStoreEntry) * size_t(entries.size())))
+  {
+    success = false;
+  }
+  return manifest_wrap.close() && success;
+}
+
+void ChunkStoreWriteWrap::finish(const bool success)
+{
+  if (success && store_filepath_prev[0] != '\0') {
+    BLI_delete(store_filepath_prev, false, false);
+  }
+}
+
+void BLO_chunk_store_remove(const char *filepath)
+{
+  ChunkStoreHeader header;
+  ChunkStoreEntry *entries = nullptr;
+  if (!blo_chunk_store_manifest_read(filepath, &header, &entries)) {
+    return;
+  }
+  MEM_freeN(entries);
+
+  char store_filepath[FILE_MAX];
+  blo_chunk_store_filepath_get(filepath, &header, store_filepath, sizeof(store_filepath));
+  BLI_delete(store_filepath, false, false);
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Write Data Type & Functions
  * \{ */
@@ -473,8 +676,9 @@ static WriteData *writedata_new(WriteWrap *ww)
       wd->buffer.chunk_size = MEM_CHUNK_SIZE;
     }
     else {
-      wd->buffer.max_size = ZSTD_BUFFER_SIZE;
-      wd->buffer.chunk_size = ZSTD_CHUNK_SIZE;
+      /* Keep the same ratio as #ZSTD_BUFFER_SIZE to #ZSTD_CHUNK_SIZE. */
+      wd->buffer.max_size = ww->buf_chunk_size * (ZSTD_BUFFER_SIZE / ZSTD_CHUNK_SIZE);
+      wd->buffer.chunk_size = ww->buf_chunk_size;
     }
     wd->buffer.buf = static_cast<uchar *>(MEM_mallocN(wd->buffer.max_size, "wd->buffer.buf"));
   }
@@ -680,6 +884,9 @@ static void mywrite_id_end(WriteData *wd, ID * /*id*/)
     mywrite_flush(wd);
     wd->mem.current_id_session_uid = MAIN_ID_SESSION_UID_UNSET;
   }
+  else if (wd->ww->use_flush_per_id) {
+    mywrite_flush(wd);
+  }
 
   wd->validation_data.per_id_addresses_set.clear();
   wd->per_id_written_shared_addresses.clear();
@@ -1761,10 +1968,19 @@ bool BLO_write_file(Main *mainvar,
                     const BlendFileWriteParams *params,
                     ReportList *reports)
 {
+  PROFILE_TRACE_ZONE_DETAIL("Write File", BLI_path_basename(filepath));
+  if (params->use_chunk_store) {
+    ChunkStoreWriteWrap chunk_store_wrap(filepath);
+    const bool success = BLO_write_file_impl(
+        mainvar, filepath, write_flags, params, reports, chunk_store_wrap);
+    chunk_store_wrap.finish(success);
+    return success;
+  }
+
   RawWriteWrap raw_wrap;
 
   if (write_flags & G_FILE_COMPRESS) {
-    ZstdWriteWrap zstd_wrap(raw_wrap);
+    ZstdWriteWrap zstd_wrap(raw_wrap, params->compression_mode);
     return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, zstd_wrap);
   }
 
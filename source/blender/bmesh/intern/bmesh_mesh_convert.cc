@@ -71,6 +71,8 @@
  *   These indices are also used to maintain correct indices for hook modifiers and vertex parents.
  */
 
+#include <atomic>
+
 #include "DNA_key_types.h"
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
@@ -193,12 +195,14 @@ static Vector<MeshToBMeshLayerInfo> mesh_to_bm_copy_info_calc(const CustomData &
   return infos;
 }
 
-static void mesh_attributes_copy_to_bmesh_block(CustomData &data,
-                                                const Span<MeshToBMeshLayerInfo> copy_info,
+/**
+ * Copy the attribute values of a mesh element into a BMesh element's custom data block. The block
+ * has to be allocated already, which isn't thread-safe, while the copying can run in parallel.
+ */
+static void mesh_attributes_copy_to_bmesh_block(const Span<MeshToBMeshLayerInfo> copy_info,
                                                 const int mesh_index,
                                                 BMHeader &header)
 {
-  CustomData_bmesh_alloc_block(&data, &header.data);
   for (const MeshToBMeshLayerInfo &info : copy_info) {
     if (info.mesh_data) {
       CustomData_data_copy_value(info.type,
@@ -428,6 +432,8 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *mesh, const BMeshFromMeshParams *
   const VArraySpan sharp_edges = *attributes.lookup<bool>("sharp_edge", AttrDomain::Edge);
   const VArraySpan uv_seams = *attributes.lookup<bool>(".uv_seam", AttrDomain::Edge);
 
+  /* Elements and their custom data blocks are allocated from memory pools, which has to happen
+   * on a single thread. Copying the attribute values into the blocks is done in parallel after. */
   const Span<float3> positions = mesh->vert_positions();
   Array<BMVert *> vtable(mesh->verts_num);
   for (const int i : positions.index_range()) {
@@ -442,28 +448,35 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *mesh, const BMeshFromMeshParams *
       BM_vert_select_set(bm, v, true);
     }
 
-    if (!vert_normals.is_empty()) {
-      copy_v3_v3(v->no, vert_normals[i]);
-    }
+    CustomData_bmesh_alloc_block(&bm->vdata, &v->head.data);
+  }
+  if (is_new) {
+    bm->elem_index_dirty &= ~BM_VERT; /* Added in order, clear dirty flag. */
+  }
 
-    mesh_attributes_copy_to_bmesh_block(bm->vdata, vert_info, i, v->head);
+  threading::parallel_for(vtable.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      BMVert *v = vtable[i];
+      if (!vert_normals.is_empty()) {
+        copy_v3_v3(v->no, vert_normals[i]);
+      }
 
-    /* Set shape key original index. */
-    if (cd_shape_keyindex_offset != -1) {
-      BM_ELEM_CD_SET_INT(v, cd_shape_keyindex_offset, i);
-    }
+      mesh_attributes_copy_to_bmesh_block(vert_info, i, v->head);
 
-    /* Set shape-key data. */
-    if (tot_shape_keys) {
-      float(*co_dst)[3] = (float(*)[3])BM_ELEM_CD_GET_VOID_P(v, cd_shape_key_offset);
-      for (int j = 0; j < tot_shape_keys; j++, co_dst++) {
-        copy_v3_v3(*co_dst, shape_key_table[j][i]);
+      /* Set shape key original index. */
+      if (cd_shape_keyindex_offset != -1) {
+        BM_ELEM_CD_SET_INT(v, cd_shape_keyindex_offset, i);
+      }
+
+      /* Set shape-key data. */
+      if (tot_shape_keys) {
+        float(*co_dst)[3] = (float(*)[3])BM_ELEM_CD_GET_VOID_P(v, cd_shape_key_offset);
+        for (int j = 0; j < tot_shape_keys; j++, co_dst++) {
+          copy_v3_v3(*co_dst, shape_key_table[j][i]);
+        }
       }
     }
-  }
-  if (is_new) {
-    bm->elem_index_dirty &= ~BM_VERT; /* Added in order, clear dirty flag. */
-  }
+  });
 
   const Span<blender::int2> edges = mesh->edges();
   Array<BMEdge *> etable(mesh->edges_num);
@@ -486,31 +499,30 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *mesh, const BMeshFromMeshParams *
       BM_elem_flag_enable(e, BM_ELEM_SMOOTH);
     }
 
-    mesh_attributes_copy_to_bmesh_block(bm->edata, edge_info, i, e->head);
+    CustomData_bmesh_alloc_block(&bm->edata, &e->head.data);
   }
   if (is_new) {
     bm->elem_index_dirty &= ~BM_EDGE; /* Added in order, clear dirty flag. */
   }
 
+  threading::parallel_for(etable.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      mesh_attributes_copy_to_bmesh_block(edge_info, i, etable[i]->head);
+    }
+  });
+
   const blender::OffsetIndices faces = mesh->faces();
   const Span<int> corner_verts = mesh->corner_verts();
   const Span<int> corner_edges = mesh->corner_edges();
 
-  /* Only needed for selection. */
-
-  Array<BMFace *> ftable;
-  if (mesh->mselect && mesh->totselect != 0) {
-    ftable.reinitialize(mesh->faces_num);
-  }
+  /* Null for faces that couldn't be created. Also used for the selection history. */
+  Array<BMFace *> ftable(mesh->faces_num);
 
   int totloops = 0;
   for (const int i : faces.index_range()) {
     const IndexRange face = faces[i];
-    BMFace *f = bm_face_create_from_mpoly(
+    BMFace *f = ftable[i] = bm_face_create_from_mpoly(
         *bm, corner_verts.slice(face), corner_edges.slice(face), vtable, etable);
-    if (!ftable.is_empty()) {
-      ftable[i] = f;
-    }
 
     if (UNLIKELY(f == nullptr)) {
       printf(
@@ -541,27 +553,43 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *mesh, const BMeshFromMeshParams *
       bm->act_face = f;
     }
 
-    int j = face.start();
     BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
     BMLoop *l_iter = l_first;
     do {
-      /* Don't use 'j' since we may have skipped some faces, hence some loops. */
+      /* Don't use the mesh corner index since we may have skipped some faces, hence some loops. */
       BM_elem_index_set(l_iter, totloops++); /* set_ok */
-
-      mesh_attributes_copy_to_bmesh_block(bm->ldata, loop_info, j, l_iter->head);
-      j++;
+      CustomData_bmesh_alloc_block(&bm->ldata, &l_iter->head.data);
     } while ((l_iter = l_iter->next) != l_first);
 
-    mesh_attributes_copy_to_bmesh_block(bm->pdata, poly_info, i, f->head);
-
-    if (params->calc_face_normal) {
-      BM_face_normal_update(f);
-    }
+    CustomData_bmesh_alloc_block(&bm->pdata, &f->head.data);
   }
   if (is_new) {
     bm->elem_index_dirty &= ~(BM_FACE | BM_LOOP); /* Added in order, clear dirty flag. */
   }
 
+  threading::parallel_for(ftable.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      BMFace *f = ftable[i];
+      if (f == nullptr) {
+        continue;
+      }
+
+      int j = faces[i].start();
+      BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
+      BMLoop *l_iter = l_first;
+      do {
+        mesh_attributes_copy_to_bmesh_block(loop_info, j, l_iter->head);
+        j++;
+      } while ((l_iter = l_iter->next) != l_first);
+
+      mesh_attributes_copy_to_bmesh_block(poly_info, i, f->head);
+
+      if (params->calc_face_normal) {
+        BM_face_normal_update(f);
+      }
+    }
+  });
+
   /* -------------------------------------------------------------------- */
   /* MSelect clears the array elements (to avoid adding multiple times).
    *
@@ -745,6 +773,7 @@ static int bm_to_mesh_shape_layer_index_from_kb(BMesh *bm, KeyBlock *currkey)
  * Update `key` with shape key data stored in `bm`.
  *
  * \param bm: The source BMesh.
+ * \param vert_table: All vertices of `bm`, in index order.
  * \param key: The destination key.
  * \param positions: The destination vertex array (in some situations its coordinates are updated).
  * \param active_shapekey_to_mvert: When editing a non-basis shape key, the coordinates for the
@@ -754,6 +783,7 @@ static int bm_to_mesh_shape_layer_index_from_kb(BMesh *bm, KeyBlock *currkey)
  * See #BMeshToMeshParams.active_shapekey_to_mvert doc-string.
  */
 static void bm_to_mesh_shape(BMesh *bm,
+                             const Span<const BMVert *> vert_table,
                              Key *key,
                              MutableSpan<float3> positions,
                              const bool active_shapekey_to_mvert)
@@ -813,25 +843,29 @@ static void bm_to_mesh_shape(BMesh *bm,
     const int cd_shape_offset = CustomData_get_n_offset(&bm->vdata, CD_SHAPEKEY, actkey_uuid);
 
     ofs = static_cast<float(*)[3]>(MEM_mallocN(sizeof(float[3]) * bm->totvert, __func__));
-    int i;
-    BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
-      const int keyi = BM_ELEM_CD_GET_INT(eve, cd_shape_keyindex_offset);
-      /* Check the vertex existed when entering edit-mode (otherwise don't apply an offset). */
-      if (keyi != ORIGINDEX_NONE) {
-        float *co_orig = (float *)BM_ELEM_CD_GET_VOID_P(eve, cd_shape_offset);
-        /* Could use 'eve->co' or the destination position, they're the same at this point. */
-        sub_v3_v3v3(ofs[i], eve->co, co_orig);
-      }
-      else {
-        /* If there are new vertices in the mesh, we can't propagate the offset
-         * because it will only work for the existing vertices and not the new
-         * ones, creating a mess when doing e.g. subdivide + translate. */
-        MEM_freeN(ofs);
-        ofs = nullptr;
-        MEM_freeN(dependent);
-        dependent = nullptr;
-        break;
+    std::atomic<bool> has_new_verts = false;
+    blender::threading::parallel_for(vert_table.index_range(), 2048, [&](const IndexRange range) {
+      for (const int i : range) {
+        const BMVert *vert = vert_table[i];
+        const int keyi = BM_ELEM_CD_GET_INT(vert, cd_shape_keyindex_offset);
+        /* Check the vertex existed when entering edit-mode (otherwise don't apply an offset). */
+        if (keyi == ORIGINDEX_NONE) {
+          has_new_verts.store(true, std::memory_order_relaxed);
+          return;
+        }
+        const float *co_orig = (const float *)BM_ELEM_CD_GET_VOID_P(vert, cd_shape_offset);
+        /* Could use 'vert->co' or the destination position, they're the same at this point. */
+        sub_v3_v3v3(ofs[i], vert->co, co_orig);
       }
+    });
+    if (has_new_verts) {
+      /* If there are new vertices in the mesh, we can't propagate the offset
+       * because it will only work for the existing vertices and not the new
+       * ones, creating a mess when doing e.g. subdivide + translate. */
+      MEM_freeN(ofs);
+      ofs = nullptr;
+      MEM_freeN(dependent);
+      dependent = nullptr;
     }
   }
 
@@ -879,37 +913,40 @@ static void bm_to_mesh_shape(BMesh *bm,
       }
       currkey_data = (float(*)[3])currkey->data;
 
-      int i;
-      BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
-        float *co_orig = (float *)BM_ELEM_CD_GET_VOID_P(eve, cd_shape_offset);
-
-        if (currkey == actkey) {
-          copy_v3_v3(currkey_data[i], eve->co);
-
-          if (update_vertex_coords_from_refkey) {
-            BLI_assert(actkey != key->refkey);
-            keyi = BM_ELEM_CD_GET_INT(eve, cd_shape_keyindex_offset);
-            if (keyi != ORIGINDEX_NONE) {
-              float *co_refkey = (float *)BM_ELEM_CD_GET_VOID_P(eve, cd_shape_offset_refkey);
-              copy_v3_v3(positions[i], co_refkey);
+      blender::threading::parallel_for(vert_table.index_range(), 2048, [&](const IndexRange range) {
+        for (const int i : range) {
+          const BMVert *vert = vert_table[i];
+          float *co_orig = (float *)BM_ELEM_CD_GET_VOID_P(vert, cd_shape_offset);
+
+          if (currkey == actkey) {
+            copy_v3_v3(currkey_data[i], vert->co);
+
+            if (update_vertex_coords_from_refkey) {
+              BLI_assert(actkey != key->refkey);
+              const int keyi = BM_ELEM_CD_GET_INT(vert, cd_shape_keyindex_offset);
+              if (keyi != ORIGINDEX_NONE) {
+                const float *co_refkey = (const float *)BM_ELEM_CD_GET_VOID_P(
+                    vert, cd_shape_offset_refkey);
+                copy_v3_v3(positions[i], co_refkey);
+              }
             }
           }
-        }
-        else {
-          copy_v3_v3(currkey_data[i], co_orig);
-        }
+          else {
+            copy_v3_v3(currkey_data[i], co_orig);
+          }
 
-        /* Propagate edited basis offsets to other shapes. */
-        if (apply_offset) {
-          add_v3_v3(currkey_data[i], ofs[i]);
-        }
+          /* Propagate edited basis offsets to other shapes. */
+          if (apply_offset) {
+            add_v3_v3(currkey_data[i], ofs[i]);
+          }
 
-        /* Apply back new coordinates shape-keys that have offset into #BMesh.
-         * Otherwise, in case we call again #BM_mesh_bm_to_me on same #BMesh,
-         * we'll apply diff from previous call to #BM_mesh_bm_to_me,
-         * to shape-key values from original creation of the #BMesh. See #50524. */
-        copy_v3_v3(co_orig, currkey_data[i]);
-      }
+          /* Apply back new coordinates shape-keys that have offset into #BMesh.
+           * Otherwise, in case we call again #BM_mesh_bm_to_me on same #BMesh,
+           * we'll apply diff from previous call to #BM_mesh_bm_to_me,
+           * to shape-key values from original creation of the #BMesh. See #50524. */
+          copy_v3_v3(co_orig, currkey_data[i]);
+        }
+      });
     }
     else {
       /* No original layer data, use fallback information. */
@@ -1529,8 +1566,11 @@ void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *mesh, const BMeshToMeshParam
       [&]() {
         bm_to_mesh_verts(*bm, vert_table, *mesh, select_vert.span, hide_vert.span);
         if (mesh->key) {
-          bm_to_mesh_shape(
-              bm, mesh->key, mesh->vert_positions_for_write(), params->active_shapekey_to_mvert);
+          bm_to_mesh_shape(bm,
+                           vert_table,
+                           mesh->key,
+                           mesh->vert_positions_for_write(),
+                           params->active_shapekey_to_mvert);
         }
       },
       [&]() {
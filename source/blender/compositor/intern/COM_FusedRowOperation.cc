@@ -0,0 +1,120 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "BLI_array.hh"
+
+#include "COM_FusedRowOperation.h"
+
+namespace blender::compositor {
+
+FusedRowOperation::FusedRowOperation(Span<MultiThreadedRowOperation *> operations)
+    : operations_(operations)
+{
+  BLI_assert(operations.size() > 1);
+  for (const int op_index : operations.index_range()) {
+    MultiThreadedRowOperation *op = operations[op_index];
+    input_sources_.append_as();
+    Vector<int> &sources = input_sources_.last();
+    for (const int i : IndexRange(op->get_number_of_input_sockets())) {
+      if (op_index > 0 && op->get_input_operation(i) == operations[op_index - 1]) {
+        sources.append(-1);
+        continue;
+      }
+      sources.append(this->get_number_of_input_sockets());
+      this->add_input_socket(op->get_input_socket(i)->get_data_type(), ResizeMode::None);
+    }
+  }
+  MultiThreadedRowOperation *last_op = operations.last();
+  this->add_output_socket(last_op->get_output_socket()->get_data_type());
+  this->set_canvas(last_op->get_canvas());
+  this->set_name(last_op->get_name());
+  this->set_node_instance_key(last_op->get_node_instance_key());
+}
+
+FusedRowOperation::~FusedRowOperation()
+{
+  for (MultiThreadedRowOperation *op : operations_) {
+    delete op;
+  }
+}
+
+NodeOperationInput *FusedRowOperation::get_fused_input_socket(const int input_index)
+{
+  for (const int op_index : operations_.index_range()) {
+    const Vector<int> &sources = input_sources_[op_index];
+    const int i = sources.first_index_of_try(input_index);
+    if (i != -1) {
+      return operations_[op_index]->get_input_socket(i);
+    }
+  }
+  BLI_assert_unreachable();
+  return nullptr;
+}
+
+void FusedRowOperation::init_data()
+{
+  for (MultiThreadedRowOperation *op : operations_) {
+    op->init_data();
+  }
+}
+
+void FusedRowOperation::init_execution()
+{
+  for (MultiThreadedRowOperation *op : operations_) {
+    op->init_execution();
+  }
+}
+
+void FusedRowOperation::deinit_execution()
+{
+  for (MultiThreadedRowOperation *op : operations_) {
+    op->deinit_execution();
+  }
+}
+
+void FusedRowOperation::update_memory_buffer_partial(MemoryBuffer *output,
+                                                     const rcti &area,
+                                                     Span<MemoryBuffer *> inputs)
+{
+  BLI_assert(output != nullptr);
+  const int width = BLI_rcti_size_x(&area);
+  const int last_index = operations_.size() - 1;
+
+  /* Rows of the intermediate results, the last operation writes into the output directly. */
+  Array<Array<float>> rows(last_index);
+  Vector<MultiThreadedRowOperation::PixelCursor> cursors;
+  for (const int op_index : operations_.index_range()) {
+    MultiThreadedRowOperation *op = operations_[op_index];
+    const Vector<int> &sources = input_sources_[op_index];
+    cursors.append_as(sources.size());
+    MultiThreadedRowOperation::PixelCursor &p = cursors.last();
+    if (op_index == last_index) {
+      p.out_stride = output->elem_stride;
+    }
+    else {
+      p.out_stride = COM_data_type_num_channels(op->get_output_socket()->get_data_type());
+      rows[op_index].reinitialize(width * p.out_stride);
+    }
+    for (const int i : sources.index_range()) {
+      p.in_strides[i] = sources[i] == -1 ? cursors[op_index - 1].out_stride :
+                                           inputs[sources[i]]->elem_stride;
+    }
+  }
+
+  for (int y = area.ymin; y < area.ymax; y++) {
+    for (const int op_index : operations_.index_range()) {
+      MultiThreadedRowOperation::PixelCursor &p = cursors[op_index];
+      const Vector<int> &sources = input_sources_[op_index];
+      p.out = op_index == last_index ? output->get_elem(area.xmin, y) : rows[op_index].data();
+      p.row_end = p.out + width * p.out_stride;
+      for (const int i : sources.index_range()) {
+        p.ins[i] = sources[i] == -1 ? rows[op_index - 1].data() :
+                                      inputs[sources[i]]->get_elem(area.xmin, y);
+      }
+      operations_[op_index]->update_memory_buffer_row(p);
+    }
+  }
+}
+
+}  // namespace blender::compositor
@@ -0,0 +1,58 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+#include "COM_MultiThreadedRowOperation.h"
+
+namespace blender::compositor {
+
+/**
+ * Executes a chain of row operations, where each operation reads the result of the previous one,
+ * as a single operation. The intermediate results are only computed for one row at a time, so
+ * they stay in the CPU cache instead of being written to full frame buffers.
+ *
+ * Inputs of the chained operations that are not linked to the previous operation in the chain
+ * become inputs of the fused operation.
+ */
+class FusedRowOperation : public MultiThreadedOperation {
+ private:
+  /** Operations in execution order, owned by the fused operation. */
+  Vector<MultiThreadedRowOperation *> operations_;
+  /**
+   * For every input of every operation, the fused operation input it reads from. Inputs that read
+   * the result of the previous operation are -1.
+   */
+  Vector<Vector<int>> input_sources_;
+
+ public:
+  /**
+   * The operations have to be in execution order and each operation has to read the result of
+   * the previous one. Links of the operations are not changed.
+   */
+  FusedRowOperation(Span<MultiThreadedRowOperation *> operations);
+  ~FusedRowOperation();
+
+  Span<MultiThreadedRowOperation *> get_operations() const
+  {
+    return operations_;
+  }
+
+  /**
+   * Get the input socket of the chained operations that the given input of the fused operation
+   * replaces.
+   */
+  NodeOperationInput *get_fused_input_socket(int input_index);
+
+  void init_data() override;
+  void init_execution() override;
+  void deinit_execution() override;
+
+ protected:
+  void update_memory_buffer_partial(MemoryBuffer *output,
+                                    const rcti &area,
+                                    Span<MemoryBuffer *> inputs) override;
+};
+
+}  // namespace blender::compositor
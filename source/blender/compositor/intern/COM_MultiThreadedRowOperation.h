@@ -13,6 +13,8 @@ namespace blender::compositor {
  * between inputs and output.
  */
 class MultiThreadedRowOperation : public MultiThreadedOperation {
+  friend class FusedRowOperation;
+
  protected:
   struct PixelCursor {
     float *out;
@@ -34,6 +36,9 @@ class MultiThreadedRowOperation : public MultiThreadedOperation {
     }
   };
 
+ public:
+  MultiThreadedRowOperation();
+
  protected:
   virtual void update_memory_buffer_row(PixelCursor &p) = 0;
 
@@ -206,6 +206,12 @@ struct NodeOperationFlags {
    */
   bool can_be_constant : 1;
 
+  /**
+   * Whether operation is a #MultiThreadedRowOperation, which allows fusing it with other row
+   * operations.
+   */
+  bool is_row_operation : 1;
+
   NodeOperationFlags()
   {
     use_render_border = false;
@@ -217,6 +223,7 @@ struct NodeOperationFlags {
     use_datatype_conversion = true;
     is_constant_operation = false;
     can_be_constant = false;
+    is_row_operation = false;
   }
 };
 
@@ -5,11 +5,13 @@
 #include <set>
 
 #include "BLI_multi_value_map.hh"
+#include "BLI_set.hh"
 
 #include "BKE_node_runtime.hh"
 
 #include "COM_Converter.h"
 #include "COM_Debug.h"
+#include "COM_FusedRowOperation.h"
 
 #include "COM_PreviewOperation.h"
 #include "COM_SetColorOperation.h"
@@ -90,6 +92,8 @@ void NodeOperationBuilder::convert_to_operations(ExecutionSystem *system)
   save_graphviz("compositor_prior_merging");
   merge_equal_operations();
 
+  fuse_row_operations();
+
   /* links not available from here on */
   /* XXX make links_ a local variable to avoid confusion! */
   links_.clear();
@@ -493,6 +497,73 @@ void NodeOperationBuilder::merge_equal_operations(NodeOperation *from, NodeOpera
   delete from;
 }
 
+void NodeOperationBuilder::fuse_row_operations()
+{
+  Map<NodeOperationOutput *, int> output_users;
+  for (const Link &link : links_) {
+    output_users.lookup_or_add(link.from(), 0)++;
+  }
+
+  /* Find the row operation each row operation can be fused with as the next one in a chain. An
+   * operation can only be fused with the operation reading its result when no other operation
+   * reads it and both operations have the same canvas, so that their pixels line up. */
+  Map<NodeOperation *, MultiThreadedRowOperation *> prev_ops;
+  Set<NodeOperation *> has_next_op;
+  for (NodeOperation *op : operations_) {
+    if (!op->get_flags().is_row_operation) {
+      continue;
+    }
+    for (int i = 0; i < op->get_number_of_input_sockets(); i++) {
+      NodeOperation *input_op = op->get_input_operation(i);
+      if (input_op == nullptr || !input_op->get_flags().is_row_operation ||
+          output_users.lookup_default(input_op->get_output_socket(), 0) != 1 ||
+          !BLI_rcti_compare(&input_op->get_canvas(), &op->get_canvas()))
+      {
+        continue;
+      }
+      prev_ops.add_new(op, static_cast<MultiThreadedRowOperation *>(input_op));
+      has_next_op.add_new(input_op);
+      break;
+    }
+  }
+
+  Vector<MultiThreadedRowOperation *> chain;
+  for (const auto item : prev_ops.items()) {
+    if (has_next_op.contains(item.key)) {
+      /* Not the last operation of a chain. */
+      continue;
+    }
+    chain.clear();
+    chain.append(static_cast<MultiThreadedRowOperation *>(item.key));
+    for (MultiThreadedRowOperation *op = item.value; op != nullptr;
+         op = prev_ops.lookup_default(op, nullptr))
+    {
+      chain.append(op);
+    }
+    std::reverse(chain.begin(), chain.end());
+
+    FusedRowOperation *fused_op = new FusedRowOperation(chain);
+    for (int i = 0; i < fused_op->get_number_of_input_sockets(); i++) {
+      NodeOperationInput *input = fused_op->get_fused_input_socket(i);
+      if (NodeOperationOutput *link = input->get_link()) {
+        remove_input_link(input);
+        add_link(link, fused_op->get_input_socket(i));
+      }
+    }
+    /* Remove the links between the chained operations. */
+    for (MultiThreadedRowOperation *op : chain) {
+      for (int i = 0; i < op->get_number_of_input_sockets(); i++) {
+        remove_input_link(op->get_input_socket(i));
+      }
+    }
+    unlink_inputs_and_relink_outputs(chain.last(), fused_op);
+    for (MultiThreadedRowOperation *op : chain) {
+      operations_.remove_first_occurrence_and_reorder(op);
+    }
+    add_operation(fused_op);
+  }
+}
+
 Vector<NodeOperationInput *> NodeOperationBuilder::cache_output_links(
     NodeOperationOutput *output) const
 {
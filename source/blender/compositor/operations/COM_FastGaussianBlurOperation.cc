@@ -4,6 +4,9 @@
 
 #include <climits>
 
+#include "BLI_array.hh"
+#include "BLI_task.hh"
+
 #include "COM_FastGaussianBlurOperation.h"
 
 namespace blender::compositor {
@@ -50,12 +53,9 @@ void FastGaussianBlurOperation::set_size(int size_x, int size_y)
 void FastGaussianBlurOperation::IIR_gauss(MemoryBuffer *src, float sigma, uint chan, uint xy)
 {
   BLI_assert(!src->is_a_single_elem());
-  double q, q2, sc, cf[4], tsM[9], tsu[3], tsv[3];
-  double *X, *Y, *W;
+  double q, q2, sc, cf[4], tsM[9];
   const uint src_width = src->get_width();
   const uint src_height = src->get_height();
-  uint x, y, src_dim_max;
-  uint i;
   float *buffer = src->get_buffer();
   const uint8_t num_channels = src->get_num_channels();
 
@@ -143,50 +143,41 @@ void FastGaussianBlurOperation::IIR_gauss(MemoryBuffer *src, float sigma, uint c
   } \
   (void)0
 
-  /* Intermediate buffers. */
-  src_dim_max = std::max(src_width, src_height);
-  X = (double *)MEM_callocN(src_dim_max * sizeof(double), "IIR_gauss X buf");
-  Y = (double *)MEM_callocN(src_dim_max * sizeof(double), "IIR_gauss Y buf");
-  W = (double *)MEM_callocN(src_dim_max * sizeof(double), "IIR_gauss W buf");
-  if (xy & 1) { /* H. */
-    int offset;
-    for (y = 0; y < src_height; y++) {
-      const int yx = y * src_width;
-      offset = yx * num_channels + chan;
-      for (x = 0; x < src_width; x++) {
-        X[x] = buffer[offset];
-        offset += num_channels;
-      }
-      YVV(src_width);
-      offset = yx * num_channels + chan;
-      for (x = 0; x < src_width; x++) {
-        buffer[offset] = Y[x];
-        offset += num_channels;
+  /* Lines are filtered independently of each other, so they are processed in parallel, with
+   * separate intermediate buffers for every task. */
+  auto filter_lines = [&](const uint lines_num,
+                          const uint line_size,
+                          const int64_t line_stride,
+                          const int64_t elem_stride) {
+    threading::parallel_for(IndexRange(lines_num), 8, [&](const IndexRange range) {
+      Array<double> X_buffer(line_size), Y_buffer(line_size), W_buffer(line_size);
+      double *X = X_buffer.data();
+      double *Y = Y_buffer.data();
+      double *W = W_buffer.data();
+      double tsu[3], tsv[3];
+      uint i;
+      for (const int64_t line : range) {
+        int64_t offset = line * line_stride + chan;
+        for (const uint j : IndexRange(line_size)) {
+          X[j] = buffer[offset];
+          offset += elem_stride;
+        }
+        YVV(line_size);
+        offset = line * line_stride + chan;
+        for (const uint j : IndexRange(line_size)) {
+          buffer[offset] = Y[j];
+          offset += elem_stride;
+        }
       }
-    }
+    });
+  };
+
+  if (xy & 1) { /* H. */
+    filter_lines(src_height, src_width, int64_t(src_width) * num_channels, num_channels);
   }
   if (xy & 2) { /* V. */
-    int offset;
-    const int add = src_width * num_channels;
-
-    for (x = 0; x < src_width; x++) {
-      offset = x * num_channels + chan;
-      for (y = 0; y < src_height; y++) {
-        X[y] = buffer[offset];
-        offset += add;
-      }
-      YVV(src_height);
-      offset = x * num_channels + chan;
-      for (y = 0; y < src_height; y++) {
-        buffer[offset] = Y[y];
-        offset += add;
-      }
-    }
+    filter_lines(src_width, src_height, num_channels, int64_t(src_width) * num_channels);
   }
-
-  MEM_freeN(X);
-  MEM_freeN(W);
-  MEM_freeN(Y);
 #undef YVV
 }
 
@@ -208,8 +199,7 @@ void FastGaussianBlurOperation::update_memory_buffer_started(MemoryBuffer *outpu
                                                              const rcti &area,
                                                              Span<MemoryBuffer *> inputs)
 {
-  /* TODO(manzanilla): Add a render test and make #IIR_gauss multi-threaded with support for
-   * an output buffer. */
+  /* TODO(manzanilla): Add a render test and make #IIR_gauss support an output buffer. */
   const MemoryBuffer *input = inputs[IMAGE_INPUT_INDEX];
   MemoryBuffer *image = nullptr;
   const bool is_full_output = BLI_rcti_compare(&output->get_rect(), &area);
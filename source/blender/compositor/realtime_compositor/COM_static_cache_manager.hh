@@ -45,7 +45,9 @@ namespace blender::realtime_compositor {
  * evaluation will be deleted before the next evaluation. This mechanism is implemented in the
  * reset() method of the class, which should be called before every evaluation. The reset for the
  * next evaluation can be skipped by calling the skip_next_reset() method, see its description for
- * more information. */
+ * more information. Only a limited number of consecutive resets can be skipped, because resources
+ * are never deleted while resets are skipped, so the cache could otherwise grow without bounds
+ * when evaluations keep getting canceled, for instance, during continuous interaction. */
 class StaticCacheManager {
  public:
   SymmetricBlurWeightsContainer symmetric_blur_weights;
@@ -68,6 +70,11 @@ class StaticCacheManager {
   /* The cache manager should skip the next reset. See the skip_next_reset() method for more
    * information. */
   bool should_skip_next_reset_ = false;
+  /* The number of resets that were skipped since the last reset that actually deleted resources.
+   */
+  int skipped_resets_num_ = 0;
+  /* The maximum number of consecutive resets that can be skipped. */
+  static constexpr int max_skipped_resets_num_ = 4;
 
  public:
   /* Reset the cache manager by deleting the cached resources that are no longer needed because
@@ -80,7 +87,8 @@ class StaticCacheManager {
    * the evaluation gets canceled before it was fully done, in that case, we wouldn't want to
    * invalidate the cache because not all operations that use cached resources got the chance to
    * mark their used resources as still in use. So we wait until a full evaluation happen before we
-   * decide that some resources are no longer needed. */
+   * decide that some resources are no longer needed. The reset is not skipped if too many
+   * consecutive resets were skipped already, see the class description for more information. */
   void skip_next_reset();
 };
 
@@ -10,8 +10,12 @@ void StaticCacheManager::reset()
 {
   if (should_skip_next_reset_) {
     should_skip_next_reset_ = false;
-    return;
+    if (skipped_resets_num_ < max_skipped_resets_num_) {
+      skipped_resets_num_++;
+      return;
+    }
   }
+  skipped_resets_num_ = 0;
 
   symmetric_blur_weights.reset();
   symmetric_separable_blur_weights.reset();
@@ -30,6 +30,11 @@ bool BuilderMap::checkIsBuiltAndTag(ID *id, int tag)
   return result;
 }
 
+void BuilderMap::reserve(const int64_t num_ids)
+{
+  id_tags_.reserve(num_ids);
+}
+
 int BuilderMap::getIDTag(ID *id) const
 {
   return id_tags_.lookup_default(id, 0);
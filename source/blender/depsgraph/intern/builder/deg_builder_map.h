@@ -41,6 +41,9 @@ class BuilderMap {
    * handled otherwise and return false. */
   bool checkIsBuiltAndTag(ID *id, int tag = TAG_COMPLETE);
 
+  /* Pre-allocate storage for the given number of IDs. */
+  void reserve(int64_t num_ids);
+
   template<typename T> bool checkIsBuilt(T *datablock, int tag = TAG_COMPLETE) const
   {
     return checkIsBuilt(&datablock->id, tag);
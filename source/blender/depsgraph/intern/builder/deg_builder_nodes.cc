@@ -377,6 +377,13 @@ ID *DepsgraphNodeBuilder::ensure_cow_id(ID *id_orig)
 
 void DepsgraphNodeBuilder::begin_build()
 {
+  /* The graph is rebuilt from scratch, but typically ends up with roughly the same number of IDs
+   * as before. Size the lookup tables for that up-front to avoid them being grown many times
+   * while building graphs of big scenes. */
+  const int64_t num_previous_id_nodes = graph_->id_nodes.size();
+  id_info_hash_.reserve(num_previous_id_nodes);
+  built_map_.reserve(num_previous_id_nodes);
+
   /* Store existing evaluated versions of datablock, so we can re-use
    * them for new ID nodes. */
   for (IDNode *id_node : graph_->id_nodes) {
@@ -416,6 +423,8 @@ void DepsgraphNodeBuilder::begin_build()
   graph_->clear_all_nodes();
   graph_->operations.clear();
   graph_->entry_tags.clear();
+
+  graph_->id_hash.reserve(num_previous_id_nodes);
 }
 
 /* Util callbacks for `BKE_library_foreach_ID_link`, used to detect when an evaluated ID is using
@@ -515,7 +515,11 @@ Depsgraph *DepsgraphRelationBuilder::getGraph()
 
 /* **** Functions to build relations between entities  **** */
 
-void DepsgraphRelationBuilder::begin_build() {}
+void DepsgraphRelationBuilder::begin_build()
+{
+  /* The nodes are built already, so the number of IDs the relations are built for is known. */
+  built_map_.reserve(graph_->id_nodes.size());
+}
 
 void DepsgraphRelationBuilder::build_id(ID *id)
 {
@@ -10,13 +10,26 @@
 
 #include "intern/eval/deg_eval.h"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include "MEM_guardedalloc.h"
+
 #include "BLI_compiler_attrs.h"
 #include "BLI_function_ref.hh"
 #include "BLI_gsqueue.h"
+#include "BLI_path_util.h"
+#include "BLI_profile_trace.hh"
+#include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
+#include "BKE_appdir.hh"
 #include "BKE_global.hh"
 
 #include "DNA_node_types.h"
@@ -52,6 +65,7 @@ namespace {
 struct DepsgraphEvalState;
 
 void deg_task_run_func(TaskPool *pool, void *taskdata);
+void deg_task_run_prioritized_func(TaskPool *pool, void *taskdata);
 
 void schedule_children(DepsgraphEvalState *state,
                        OperationNode *node,
@@ -77,12 +91,32 @@ enum class EvaluationStage {
   SINGLE_THREADED_WORKAROUND,
 };
 
+/* Cost in seconds assumed for operations which were not evaluated yet or which are too cheap to be
+ * measured, so that long chains of such operations are still considered expensive. */
+constexpr float MIN_OPERATION_COST = 1e-6f;
+
+struct CriticalPathCostLess {
+  bool operator()(const OperationNode *a, const OperationNode *b) const
+  {
+    return a->critical_path_cost < b->critical_path_cost;
+  }
+};
+
 struct DepsgraphEvalState {
   Depsgraph *graph;
   bool do_stats;
   EvaluationStage stage;
   bool need_update_pending_parents = true;
   bool need_single_thread_pass = false;
+
+  /* Timeline of the evaluated operations, recorded when statistics are gathered. */
+  EvaluationTimeline *timeline = nullptr;
+
+  /* Operations which are ready to be evaluated in the threaded evaluation stage, the ones on the
+   * critical path first. */
+  std::priority_queue<OperationNode *, std::vector<OperationNode *>, CriticalPathCostLess>
+      ready_operations;
+  std::mutex ready_operations_mutex;
 };
 
 void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_node)
@@ -92,15 +126,26 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
   /* Perform operation. */
-  if (state->do_stats) {
-    const double start_time = BLI_time_now_seconds();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
+  std::string trace_detail;
+  if (profile_trace::is_enabled()) {
+    trace_detail = operation_node->full_identifier();
   }
-  else {
-    operation_node->evaluate(depsgraph);
+  PROFILE_TRACE_ZONE_DETAIL("Depsgraph Operation", trace_detail);
+  const double start_time = BLI_time_now_seconds();
+  operation_node->evaluate(depsgraph);
+  const double end_time = BLI_time_now_seconds();
+  const float eval_time = float(end_time - start_time);
+  if (state->do_stats) {
+    operation_node->stats.current_time += eval_time;
+    state->timeline->add_operation(operation_node, start_time, end_time);
   }
 
+  /* Average with the previous evaluations, so that the cost estimate follows changes in the
+   * operation while smoothing out the noise of individual timings. */
+  operation_node->eval_cost = (operation_node->eval_cost == 0.0f) ?
+                                  eval_time :
+                                  0.5f * (operation_node->eval_cost + eval_time);
+
   /* Clear the flag early on, allowing partial updates without re-evaluating the same node multiple
    * times.
    * This is a thread-safe modification as the node's flags are only read for a non-scheduled nodes
@@ -113,14 +158,73 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  while (operation_node != nullptr) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    /* Schedule children. The first child which becomes ready is evaluated by this task directly,
+     * so that chains of operations don't pay the task scheduling overhead for every operation. */
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      if (next_node == nullptr) {
+        next_node = node;
+        return;
+      }
+      BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+    });
+    operation_node = next_node;
+  }
+}
+
+void schedule_node_prioritized(DepsgraphEvalState *state, TaskPool *pool, OperationNode *node)
+{
+  {
+    std::lock_guard lock(state->ready_operations_mutex);
+    state->ready_operations.push(node);
+  }
+  BLI_task_pool_push(pool, deg_task_run_prioritized_func, nullptr, false, nullptr);
+}
+
+void deg_task_run_prioritized_func(TaskPool *pool, void * /*taskdata*/)
+{
+  void *userdata_v = BLI_task_pool_user_data(pool);
+  DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
+
+  /* Every task evaluates one operation, but not necessarily the one which became ready when the
+   * task was pushed: the ready operation with the highest critical path cost is taken instead. */
+  OperationNode *operation_node;
+  {
+    std::lock_guard lock(state->ready_operations_mutex);
+    BLI_assert(!state->ready_operations.empty());
+    operation_node = state->ready_operations.top();
+    state->ready_operations.pop();
+  }
+
+  while (operation_node != nullptr) {
+    evaluate_node(state, operation_node);
+
+    /* Keep one of the children which became ready for this task instead of pushing a new task for
+     * it. Chains of cheap operations, like the many operations of every bone in a rig, would
+     * otherwise spend more time in the task scheduler than in the evaluation. */
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+      if (next_node == nullptr) {
+        next_node = node;
+        return;
+      }
+      schedule_node_prioritized(state, pool, node);
+    });
+    if (next_node == nullptr) {
+      break;
+    }
+    /* Still take the operation with the highest priority, which is not necessarily the child.
+     * The number of queued operations stays the same, so it matches the number of pushed tasks. */
+    std::lock_guard lock(state->ready_operations_mutex);
+    state->ready_operations.push(next_node);
+    operation_node = state->ready_operations.top();
+    state->ready_operations.pop();
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -138,7 +242,7 @@ bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode
     return op_node->flag & OperationFlag::DEPSOP_FLAG_AFFECTS_VISIBILITY;
   }
 
-  return comp_node->affects_visible_id;
+  return comp_node->affects_visible_id && (op_node->flag & DEPSOP_FLAG_AFFECTS_VISIBLE_ID);
 }
 
 void calculate_pending_parents_for_node(const DepsgraphEvalState *state, OperationNode *node)
@@ -186,6 +290,68 @@ void calculate_pending_parents_if_needed(DepsgraphEvalState *state)
   state->need_update_pending_parents = false;
 }
 
+bool is_operation_to_be_evaluated(const DepsgraphEvalState *state, OperationNode *node)
+{
+  return check_operation_node_visible(state, node) && (node->flag & DEPSOP_FLAG_NEEDS_UPDATE);
+}
+
+/* Calculate the critical path cost of all operations which are to be evaluated: the cost of the
+ * operation itself plus the cost of the most expensive chain of operations which depend on it.
+ *
+ * The operations are visited from the leaves towards the roots. The number of children which are
+ * not visited yet is stored in the custom flags of the operation. */
+void calculate_critical_path_costs(DepsgraphEvalState *state)
+{
+  Vector<OperationNode *> queue;
+
+  for (OperationNode *node : state->graph->operations) {
+    node->critical_path_cost = 0.0f;
+    node->custom_flags = 0;
+    if (!is_operation_to_be_evaluated(state, node)) {
+      continue;
+    }
+    for (Relation *rel : node->outlinks) {
+      OperationNode *child = (OperationNode *)rel->to;
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0 && is_operation_to_be_evaluated(state, child))
+      {
+        ++node->custom_flags;
+      }
+    }
+    if (node->custom_flags == 0) {
+      queue.append(node);
+    }
+  }
+
+  while (!queue.is_empty()) {
+    OperationNode *node = queue.pop_last();
+
+    float children_cost = 0.0f;
+    for (Relation *rel : node->outlinks) {
+      OperationNode *child = (OperationNode *)rel->to;
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0 && is_operation_to_be_evaluated(state, child))
+      {
+        children_cost = std::max(children_cost, child->critical_path_cost);
+      }
+    }
+    const float node_cost = node->is_noop() ? 0.0f : std::max(node->eval_cost, MIN_OPERATION_COST);
+    node->critical_path_cost = node_cost + children_cost;
+
+    for (Relation *rel : node->inlinks) {
+      if (rel->from->type != NodeType::OPERATION || (rel->flag & RELATION_FLAG_CYCLIC)) {
+        continue;
+      }
+      OperationNode *parent = (OperationNode *)rel->from;
+      if (!is_operation_to_be_evaluated(state, parent)) {
+        continue;
+      }
+      BLI_assert(parent->custom_flags > 0);
+      if (--parent->custom_flags == 0) {
+        queue.append(parent);
+      }
+    }
+  }
+}
+
 void initialize_execution(DepsgraphEvalState *state, Depsgraph *graph)
 {
   /* Clear tags and other things which needs to be clear. */
@@ -317,9 +483,19 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 
   calculate_pending_parents_if_needed(state);
 
-  schedule_graph(state, [&](OperationNode *node) {
-    BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
-  });
+  if (stage == EvaluationStage::THREADED_EVALUATION) {
+    /* The bulk of the evaluation: start with the operations on the critical path, so that long
+     * chains of dependent operations do not start late. */
+    calculate_critical_path_costs(state);
+    schedule_graph(state, [&](OperationNode *node) {
+      schedule_node_prioritized(state, task_pool, node);
+    });
+  }
+  else {
+    schedule_graph(state, [&](OperationNode *node) {
+      BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
+    });
+  }
   BLI_task_pool_work_and_wait(task_pool);
 }
 
@@ -351,6 +527,23 @@ void evaluate_graph_single_threaded_if_needed(DepsgraphEvalState *state)
   BLI_gsqueue_free(evaluation_queue);
 }
 
+void report_evaluation_timeline(const Depsgraph *graph, const EvaluationTimeline &timeline)
+{
+  timeline.print_summary(graph, BLI_time_now_seconds());
+
+  char filename[FILE_MAX];
+  SNPRINTF(filename,
+           "depsgraph_trace%s%s.json",
+           graph->debug.name.empty() ? "" : "_",
+           graph->debug.name.c_str());
+  BLI_path_make_safe_filename(filename);
+  char filepath[FILE_MAX];
+  BLI_path_join(filepath, sizeof(filepath), BKE_tempdir_session(), filename);
+  if (timeline.write_chrome_trace(filepath)) {
+    printf("  Timeline written to %s\n", filepath);
+  }
+}
+
 void depsgraph_ensure_view_layer(Depsgraph *graph)
 {
   /* We update evaluated scene in the following cases:
@@ -387,6 +580,7 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   }
 
   graph->update_count++;
+  PROFILE_TRACE_ZONE_DETAIL("Depsgraph Evaluation", graph->debug.name);
 
   graph->debug.begin_graph_evaluation();
 
@@ -403,6 +597,12 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   state.graph = graph;
   state.do_stats = graph->debug.do_time_debug();
 
+  std::unique_ptr<EvaluationTimeline> timeline;
+  if (state.do_stats) {
+    timeline = std::make_unique<EvaluationTimeline>(BLI_time_now_seconds());
+    state.timeline = timeline.get();
+  }
+
   /* Prepare all nodes for evaluation. */
   initialize_execution(&state, graph);
 
@@ -455,6 +655,7 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
    * synchronization. */
   if (state.do_stats) {
     deg_eval_stats_aggregate(graph);
+    report_evaluation_timeline(graph, *timeline);
   }
 
   /* Clear any uncleared tags. */
@@ -466,6 +667,8 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
 #endif
 
   graph->debug.end_graph_evaluation();
+
+  profile_trace::counter("Memory in Use (MB)", double(MEM_get_memory_in_use()) / (1024 * 1024));
 }
 
 }  // namespace blender::deg
@@ -8,9 +8,17 @@
 
 #include "intern/eval/deg_eval_stats.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+
+#include "BLI_fileops.h"
+#include "BLI_map.hh"
+#include "BLI_set.hh"
 #include "BLI_utildefines.h"
 
 #include "intern/depsgraph.hh"
+#include "intern/depsgraph_relation.hh"
 
 #include "intern/node/deg_node.hh"
 #include "intern/node/deg_node_component.hh"
@@ -39,4 +47,182 @@ void deg_eval_stats_aggregate(Depsgraph *graph)
   }
 }
 
+/* Evaluation timeline. */
+
+namespace {
+
+/* Index of the thread which is currently running, stable for the lifetime of the thread. */
+int current_thread_index()
+{
+  static std::atomic<int> num_threads = 0;
+  static thread_local const int thread_index = num_threads++;
+  return thread_index;
+}
+
+string json_escape(const string &str)
+{
+  string result;
+  result.reserve(str.size());
+  for (const char c : str) {
+    if (ELEM(c, '"', '\\')) {
+      result += '\\';
+      result += c;
+    }
+    else if (uchar(c) < 0x20) {
+      result += ' ';
+    }
+    else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+EvaluationTimeline::EvaluationTimeline(const double start_time) : start_time_(start_time) {}
+
+void EvaluationTimeline::add_operation(const OperationNode *node,
+                                       const double start_time,
+                                       const double end_time)
+{
+  const int thread_index = current_thread_index();
+  std::lock_guard lock(mutex_);
+  operations_.append({node, start_time, end_time, thread_index});
+}
+
+Vector<const EvaluationTimeline::OperationTiming *> EvaluationTimeline::critical_path() const
+{
+  Map<const OperationNode *, const OperationTiming *> timing_by_node;
+  const OperationTiming *last_timing = nullptr;
+  for (const OperationTiming &timing : operations_) {
+    timing_by_node.add_overwrite(timing.node, &timing);
+    if (last_timing == nullptr || timing.end_time > last_timing->end_time) {
+      last_timing = &timing;
+    }
+  }
+
+  /* Find the evaluated parent which finished last before the given operation started. NOOP
+   * operations are never evaluated, so the search continues through them. */
+  auto find_latest_parent = [&](const OperationTiming &child) -> const OperationTiming * {
+    const OperationTiming *latest_timing = nullptr;
+    Set<const OperationNode *> visited;
+    Vector<const OperationNode *> stack = {child.node};
+    while (!stack.is_empty()) {
+      const OperationNode *node = stack.pop_last();
+      for (const Relation *rel : node->inlinks) {
+        if (rel->from->type != NodeType::OPERATION || (rel->flag & RELATION_FLAG_CYCLIC)) {
+          continue;
+        }
+        const OperationNode *parent = static_cast<const OperationNode *>(rel->from);
+        if (!visited.add(parent)) {
+          continue;
+        }
+        const OperationTiming *timing = timing_by_node.lookup_default(parent, nullptr);
+        if (timing == nullptr) {
+          if (parent->is_noop()) {
+            stack.append(parent);
+          }
+          continue;
+        }
+        if (timing->end_time <= child.start_time &&
+            (latest_timing == nullptr || timing->end_time > latest_timing->end_time))
+        {
+          latest_timing = timing;
+        }
+      }
+    }
+    return latest_timing;
+  };
+
+  Vector<const OperationTiming *> path;
+  for (const OperationTiming *timing = last_timing; timing != nullptr;
+       timing = find_latest_parent(*timing))
+  {
+    path.append(timing);
+  }
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+void EvaluationTimeline::print_summary(const Depsgraph *graph, const double end_time) const
+{
+  const double total_time = end_time - start_time_;
+
+  Map<int, double> busy_time_by_thread;
+  for (const OperationTiming &timing : operations_) {
+    busy_time_by_thread.lookup_or_add(timing.thread_index, 0.0) += timing.end_time -
+                                                                   timing.start_time;
+  }
+  Vector<int> thread_indices;
+  for (const int thread_index : busy_time_by_thread.keys()) {
+    thread_indices.append(thread_index);
+  }
+  std::sort(thread_indices.begin(), thread_indices.end());
+
+  if (graph->debug.name.empty()) {
+    printf("Depsgraph evaluation timeline:\n");
+  }
+  else {
+    printf("Depsgraph [%s] evaluation timeline:\n", graph->debug.name.c_str());
+  }
+
+  for (const int thread_index : thread_indices) {
+    const double busy_time = busy_time_by_thread.lookup(thread_index);
+    printf("  Thread %d: busy %f seconds, idle %f seconds\n",
+           thread_index,
+           busy_time,
+           std::max(total_time - busy_time, 0.0));
+  }
+
+  const Vector<const OperationTiming *> path = critical_path();
+  double path_time = 0.0;
+  for (const OperationTiming *timing : path) {
+    path_time += timing->end_time - timing->start_time;
+  }
+  printf("  Critical path: %d operations, %f seconds\n", int(path.size()), path_time);
+  for (const OperationTiming *timing : path) {
+    printf("    %f seconds: %s\n",
+           timing->end_time - timing->start_time,
+           timing->node->full_identifier().c_str());
+  }
+}
+
+bool EvaluationTimeline::write_chrome_trace(const char *filepath) const
+{
+  FILE *file = BLI_fopen(filepath, "w");
+  if (file == nullptr) {
+    return false;
+  }
+
+  Set<const OperationTiming *> critical_timings;
+  for (const OperationTiming *timing : critical_path()) {
+    critical_timings.add(timing);
+  }
+
+  /* Times in the trace event format are in microseconds. */
+  fprintf(file, "{\"traceEvents\": [\n");
+  bool is_first = true;
+  for (const OperationTiming &timing : operations_) {
+    const ComponentNode *comp_node = timing.node->owner;
+    const IDNode *id_node = comp_node->owner;
+    fprintf(file,
+            "%s  {\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 0, "
+            "\"tid\": %d, \"ts\": %.3f, \"dur\": %.3f, "
+            "\"args\": {\"id\": \"%s\", \"critical_path\": %s}}",
+            is_first ? "" : ",\n",
+            json_escape(timing.node->identifier()).c_str(),
+            json_escape(comp_node->identifier()).c_str(),
+            timing.thread_index,
+            (timing.start_time - start_time_) * 1e6,
+            (timing.end_time - timing.start_time) * 1e6,
+            json_escape(id_node->name).c_str(),
+            critical_timings.contains(&timing) ? "true" : "false");
+    is_first = false;
+  }
+  fprintf(file, "\n]}\n");
+  fclose(file);
+  return true;
+}
+
 }  // namespace blender::deg
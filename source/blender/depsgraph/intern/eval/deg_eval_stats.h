@@ -8,11 +8,50 @@
 
 #pragma once
 
+#include <mutex>
+
+#include "BLI_vector.hh"
+
 namespace blender::deg {
 
 struct Depsgraph;
+struct OperationNode;
 
 /* Aggregate operation timings to overall component and ID nodes timing. */
 void deg_eval_stats_aggregate(Depsgraph *graph);
 
+/* Timeline of the operations evaluated during a single update of the graph: when and on which
+ * thread every operation was evaluated. Is only recorded when time debug is enabled. */
+class EvaluationTimeline {
+ public:
+  explicit EvaluationTimeline(double start_time);
+
+  /* Thread-safe. */
+  void add_operation(const OperationNode *node, double start_time, double end_time);
+
+  /* Print how busy every thread was, and the chain of operations which defined how long the
+   * evaluation took. */
+  void print_summary(const Depsgraph *graph, double end_time) const;
+
+  /* Write the timeline in the Chrome trace event format, which can be viewed with
+   * `chrome://tracing` or Perfetto. */
+  bool write_chrome_trace(const char *filepath) const;
+
+ protected:
+  struct OperationTiming {
+    const OperationNode *node;
+    double start_time;
+    double end_time;
+    int thread_index;
+  };
+
+  /* Chain of operations which ended last, each operation preceded by the parent which finished
+   * last before it started. */
+  Vector<const OperationTiming *> critical_path() const;
+
+  double start_time_;
+  Vector<OperationTiming> operations_;
+  std::mutex mutex_;
+};
+
 }  // namespace blender::deg
@@ -14,6 +14,7 @@
 
 #include "BLI_assert.h"
 #include "BLI_listbase.h"
+#include "BLI_set.hh"
 #include "BLI_stack.h"
 
 #include "DEG_depsgraph.hh"
@@ -88,11 +89,113 @@ void deg_evaluate_object_modifiers_mode_node_visibility(::Depsgraph *depsgraph,
   }
 }
 
+namespace {
+
+enum {
+  DEG_NODE_VISITED = (1 << 0),
+};
+
+/* Push operations which do not have any children to the stack, and initialize the number of
+ * children which are to be visited before the operation itself. */
+void push_operations_without_children(Depsgraph *graph, BLI_Stack *stack)
+{
+  for (OperationNode *op_node : graph->operations) {
+    op_node->custom_flags = 0;
+    op_node->num_links_pending = 0;
+    for (Relation *rel : op_node->outlinks) {
+      if ((rel->to->type == NodeType::OPERATION) && (rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+        ++op_node->num_links_pending;
+      }
+    }
+    if (op_node->num_links_pending == 0) {
+      BLI_stack_push(stack, &op_node);
+      op_node->custom_flags |= DEG_NODE_VISITED;
+    }
+  }
+}
+
+/* Push parents of the given operation to the stack once all their children are visited. */
+void push_parents_when_children_visited(OperationNode *op_node, BLI_Stack *stack)
+{
+  for (Relation *rel : op_node->inlinks) {
+    if (rel->from->type == NodeType::OPERATION) {
+      OperationNode *op_from = (OperationNode *)rel->from;
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0) {
+        BLI_assert(op_from->num_links_pending > 0);
+        --op_from->num_links_pending;
+      }
+      if ((op_from->num_links_pending == 0) && (op_from->custom_flags & DEG_NODE_VISITED) == 0) {
+        BLI_stack_push(stack, &op_from);
+        op_from->custom_flags |= DEG_NODE_VISITED;
+      }
+    }
+  }
+}
+
+/* Tag operations whose result is used by directly visible IDs.
+ *
+ * The visibility of components only tells that some of their operations are needed: for example
+ * a driver which reads a single bone of a hidden rig makes the pose component of the rig affect
+ * visible IDs, which would otherwise cause all IK solvers of the rig to be evaluated, together
+ * with all their bones. Here the need is propagated per operation, starting from the operations
+ * of IDs which are visible themselves.
+ *
+ * Must happen after the components visibility is known. */
+void flush_operations_affect_visible_id(Depsgraph *graph,
+                                        const Set<const IDNode *> &visibility_forced_ids)
+{
+  for (OperationNode *op_node : graph->operations) {
+    const ComponentNode *comp_node = op_node->owner;
+    const IDNode *id_node = comp_node->owner;
+    op_node->flag &= ~DEPSOP_FLAG_AFFECTS_VISIBLE_ID;
+    if ((id_node->is_visible_on_build && id_node->is_enabled_on_eval) ||
+        ELEM(comp_node->type, NodeType::VISIBILITY, NodeType::SYNCHRONIZATION) ||
+        visibility_forced_ids.contains(id_node))
+    {
+      op_node->flag |= DEPSOP_FLAG_AFFECTS_VISIBLE_ID;
+    }
+  }
+
+  BLI_Stack *stack = BLI_stack_new(sizeof(OperationNode *), "DEG flush visible operations stack");
+
+  push_operations_without_children(graph, stack);
+
+  while (!BLI_stack_is_empty(stack)) {
+    OperationNode *op_node;
+    BLI_stack_pop(stack, &op_node);
+
+    /* Same rules as for the components in #deg_graph_flush_visibility_flags. */
+    const ComponentNode *comp_to = op_node->owner;
+    if (comp_to->type != NodeType::SYNCHRONIZATION) {
+      for (Relation *rel : op_node->inlinks) {
+        if (rel->from->type != NodeType::OPERATION || (rel->flag & RELATION_NO_VISIBILITY_CHANGE))
+        {
+          continue;
+        }
+        OperationNode *op_from = reinterpret_cast<OperationNode *>(rel->from);
+        if (op_from->owner != comp_to && (op_node->flag & DEPSOP_FLAG_MUTE)) {
+          continue;
+        }
+        /* The child of a cyclic relation might not be visited yet, so consider the parent to be
+         * needed. */
+        if ((op_node->flag & DEPSOP_FLAG_AFFECTS_VISIBLE_ID) || (rel->flag & RELATION_FLAG_CYCLIC))
+        {
+          op_from->flag |= DEPSOP_FLAG_AFFECTS_VISIBLE_ID;
+        }
+      }
+    }
+
+    push_parents_when_children_visited(op_node, stack);
+  }
+  BLI_stack_free(stack);
+}
+
+}  // namespace
+
 void deg_graph_flush_visibility_flags(Depsgraph *graph)
 {
-  enum {
-    DEG_NODE_VISITED = (1 << 0),
-  };
+  /* IDs which are considered visible because their visibility affects visible IDs. */
+  Set<const IDNode *> visibility_forced_ids;
 
   for (IDNode *id_node : graph->id_nodes) {
     for (ComponentNode *comp_node : id_node->components.values()) {
@@ -124,19 +227,7 @@ void deg_graph_flush_visibility_flags(Depsgraph *graph)
 
   BLI_Stack *stack = BLI_stack_new(sizeof(OperationNode *), "DEG flush layers stack");
 
-  for (OperationNode *op_node : graph->operations) {
-    op_node->custom_flags = 0;
-    op_node->num_links_pending = 0;
-    for (Relation *rel : op_node->outlinks) {
-      if ((rel->to->type == NodeType::OPERATION) && (rel->flag & RELATION_FLAG_CYCLIC) == 0) {
-        ++op_node->num_links_pending;
-      }
-    }
-    if (op_node->num_links_pending == 0) {
-      BLI_stack_push(stack, &op_node);
-      op_node->custom_flags |= DEG_NODE_VISITED;
-    }
-  }
+  push_operations_without_children(graph, stack);
 
   while (!BLI_stack_is_empty(stack)) {
     OperationNode *op_node;
@@ -195,6 +286,7 @@ void deg_graph_flush_visibility_flags(Depsgraph *graph)
             for (ComponentNode *comp_node : id_node_from->components.values()) {
               comp_node->affects_visible_id |= target_affects_visible_id;
             }
+            visibility_forced_ids.add(id_node_from);
           }
         }
         else {
@@ -205,22 +297,12 @@ void deg_graph_flush_visibility_flags(Depsgraph *graph)
     }
 
     /* Schedule parent nodes. */
-    for (Relation *rel : op_node->inlinks) {
-      if (rel->from->type == NodeType::OPERATION) {
-        OperationNode *op_from = (OperationNode *)rel->from;
-        if ((rel->flag & RELATION_FLAG_CYCLIC) == 0) {
-          BLI_assert(op_from->num_links_pending > 0);
-          --op_from->num_links_pending;
-        }
-        if ((op_from->num_links_pending == 0) && (op_from->custom_flags & DEG_NODE_VISITED) == 0) {
-          BLI_stack_push(stack, &op_from);
-          op_from->custom_flags |= DEG_NODE_VISITED;
-        }
-      }
-    }
+    push_parents_when_children_visited(op_node, stack);
   }
   BLI_stack_free(stack);
 
+  flush_operations_affect_visible_id(graph, visibility_forced_ids);
+
   graph->need_update_nodes_visibility = false;
 }
 
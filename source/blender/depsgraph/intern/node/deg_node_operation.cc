@@ -209,7 +209,10 @@ const char *operationCodeAsString(OperationCode opcode)
   return "UNKNOWN";
 }
 
-OperationNode::OperationNode() : name_tag(-1), flag(0) {}
+OperationNode::OperationNode()
+    : name_tag(-1), flag(0), eval_cost(0.0f), critical_path_cost(0.0f)
+{
+}
 
 string OperationNode::identifier() const
 {
@@ -232,6 +232,11 @@ enum OperationFlag {
   /* Evaluation of the node is temporarily disabled. */
   DEPSOP_FLAG_MUTE = (1 << 5),
 
+  /* The result of the operation is used by a directly visible ID, either by the ID itself or via
+   * a chain of relations. Operations of components which affect visible IDs are only evaluated
+   * when they have this flag. */
+  DEPSOP_FLAG_AFFECTS_VISIBLE_ID = (1 << 6),
+
   /* Set of flags which gets flushed along the relations. */
   DEPSOP_FLAG_FLUSH = (DEPSOP_FLAG_USER_MODIFIED),
 
@@ -288,6 +293,14 @@ struct OperationNode : public Node {
   /* (OperationFlag) extra settings affecting evaluation. */
   int flag;
 
+  /* Evaluation time in seconds, averaged over the previous evaluations of this operation. */
+  float eval_cost;
+
+  /* Estimated time needed to evaluate this operation and the most expensive chain of operations
+   * which depend on it. Operations with the highest cost are on the critical path of the graph
+   * and are evaluated first. Only valid during the threaded evaluation. */
+  float critical_path_cost;
+
   DEG_DEPSNODE_DECLARE;
 };
 
@@ -13,6 +13,7 @@
 #include "BKE_global.hh"
 #include "BKE_object.hh"
 #include "BLI_rect.h"
+#include "BLI_time.h"
 #include "DEG_depsgraph_query.hh"
 #include "DNA_ID.h"
 #include "DNA_lightprobe_types.h"
@@ -730,15 +731,19 @@ void Instance::light_bake_irradiance(
     return;
   }
 
+  /* Batch ray casts to avoid too much overhead of the update function & context switch. The size
+   * of each batch depends on the time it took to compute the previous one (including the result
+   * read-back which waits for the GPU), so that the progress is still updated regularly. */
+  const double target_batch_duration = 0.5;
+  int batch_size = 16;
+
   sampling.init(probe);
   while (!sampling.finished()) {
+    const double batch_start = BLI_time_now_seconds();
     context_wrapper([&]() {
       DebugScope debug_scope(debug_scope_irradiance_sample, "EEVEE.irradiance_sample");
 
-      /* Batch ray cast by pack of 16. Avoids too much overhead of the update function & context
-       * switch. */
-      /* TODO(fclem): Could make the number of iteration depend on the computation time. */
-      for (int i = 0; i < 16 && !sampling.finished(); i++) {
+      for (int i = 0; i < batch_size && !sampling.finished(); i++) {
         sampling.step();
 
         volume_probes.bake.raylists_build();
@@ -759,6 +764,14 @@ void Instance::light_bake_irradiance(
       result_update(cache_frame, progress);
     });
 
+    const double batch_duration = BLI_time_now_seconds() - batch_start;
+    if (batch_duration < target_batch_duration * 0.5) {
+      batch_size = math::min(batch_size * 2, 256);
+    }
+    else if (batch_duration > target_batch_duration * 2.0) {
+      batch_size = math::max(batch_size / 2, 1);
+    }
+
     if (stop()) {
       return;
     }
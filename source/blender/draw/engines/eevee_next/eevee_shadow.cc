@@ -639,6 +639,17 @@ void ShadowModule::init()
       ss << "Error: Too many shadow updates, some shadow might be incorrect.\n";
       inst_.info += ss.str();
     }
+    if (!inst_.is_image_render()) {
+      /* Lower the update budget as long as views are dropped, and raise it again slowly when
+       * there is enough headroom to avoid oscillating between both states. */
+      if (stats.view_needed_count > SHADOW_VIEW_MAX) {
+        viewport_view_per_tilemap_limit_ = math::max(1, viewport_view_per_tilemap_limit_ - 1);
+      }
+      else if (stats.view_needed_count <= SHADOW_VIEW_MAX / 2) {
+        viewport_view_per_tilemap_limit_ = math::min(SHADOW_TILEMAP_LOD,
+                                                     viewport_view_per_tilemap_limit_ + 1);
+      }
+    }
   }
 
   atlas_tx_.filter_mode(false);
@@ -1193,6 +1204,7 @@ int ShadowModule::max_view_per_tilemap()
     }
   }
   int max_view_count = divide_ceil_u(SHADOW_VIEW_MAX, math::max(potential_view_count, 1));
+  max_view_count = math::min(viewport_view_per_tilemap_limit_, max_view_count);
   /* For viewport interactivity, have a hard maximum. This allows smoother experience. */
   if (inst_.is_transforming() || inst_.is_navigating()) {
     max_view_count = math::min(2, max_view_count);
@@ -244,6 +244,12 @@ class ShadowModule {
   int2 usage_tag_fb_resolution_;
   int usage_tag_fb_lod_ = 5;
   int max_view_per_tilemap_ = 1;
+  /**
+   * Viewport limit of views per tile-map, adapted to the statistics of previous updates.
+   * Views that don't fit inside #SHADOW_VIEW_MAX are dropped without any priority, so it is
+   * better to update fewer levels of all tile-maps and refine them over the next redraws.
+   */
+  int viewport_view_per_tilemap_limit_ = SHADOW_TILEMAP_LOD;
   int2 input_depth_extent_;
 
   /* Statistics that are read back to CPU after a few frame (to avoid stall). */
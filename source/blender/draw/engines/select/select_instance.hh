@@ -9,6 +9,7 @@
 #pragma once
 
 #include "BKE_object_types.hh"
+#include "BLI_math_bits.h"
 
 #include "DRW_gpu_wrapper.hh"
 
@@ -197,7 +198,12 @@ struct SelectMap {
       return;
     }
 
-    select_output_buf.resize(ceil_to_multiple_u(select_id_map.size(), 4));
+    /* The #SELECT_ALL mode only stores one bit per select id, which also keeps the read-back
+     * small. */
+    const uint result_len = (info_buf.mode == SelectType::SELECT_ALL) ?
+                                divide_ceil_u(select_id_map.size(), 32) :
+                                select_id_map.size();
+    select_output_buf.resize(ceil_to_multiple_u(result_len, 4));
     select_output_buf.push_update();
     if (info_buf.mode == SelectType::SELECT_ALL) {
       /* This mode uses atomicOr and store result as a bitmap. Clear to 0 (no selection). */
@@ -223,8 +229,12 @@ struct SelectMap {
     /* Convert raw data from GPU to #GPUSelectResult. */
     switch (info_buf.mode) {
       case SelectType::SELECT_ALL:
-        for (auto i : IndexRange(select_id_map.size())) {
-          if (((select_output_buf[i / 32] >> (i % 32)) & 1) != 0) {
+        for (auto word : IndexRange(divide_ceil_u(select_id_map.size(), 32))) {
+          uint bits = select_output_buf[word];
+          /* Only visit the set bits, most ids are usually not selected. */
+          while (bits != 0) {
+            const int i = word * 32 + bitscan_forward_uint(bits);
+            bits &= bits - 1;
             GPUSelectResult hit_result{};
             hit_result.id = select_id_map[i];
             hit_result.depth = 0xFFFF;
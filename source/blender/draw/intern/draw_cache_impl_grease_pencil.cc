@@ -1075,6 +1075,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
   int v_offset = 0;
   Vector<Array<int>> verts_start_offsets_per_visible_drawing;
   Vector<Array<int>> tris_start_offsets_per_visible_drawing;
+  Vector<Array<int>> ibo_start_offsets_per_visible_drawing;
   for (const ed::greasepencil::DrawingInfo &info : drawings) {
     const bke::CurvesGeometry &curves = info.drawing.strokes();
     const OffsetIndices<int> points_by_curve = curves.evaluated_points_by_curve();
@@ -1088,6 +1089,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
     const int tris_start_offsets_size = num_curves;
     Array<int> verts_start_offsets(verts_start_offsets_size);
     Array<int> tris_start_offsets(tris_start_offsets_size);
+    Array<int> ibo_start_offsets(num_curves);
 
     /* Calculate the triangle offsets for all the visible curves. */
     int t_offset = 0;
@@ -1103,7 +1105,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       }
     }
 
-    /* Calculate the vertex offsets for all the visible curves. */
+    /* Calculate the vertex and index buffer offsets for all the visible curves. Every stroke owns
+     * a separate range in both buffers, so strokes can be written in parallel below. */
     int num_cyclic = 0;
     int num_points = 0;
     visible_strokes.foreach_index([&](const int curve_i, const int pos) {
@@ -1117,15 +1120,21 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       verts_start_offsets[pos] = v_offset;
       v_offset += 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
       num_points += points.size();
+
+      /* Fill triangles, then one quad (two triangles) per stroke point. */
+      ibo_start_offsets[pos] = total_triangles_num;
+      if (points.size() >= 3) {
+        total_triangles_num += points.size() - 2;
+      }
+      total_triangles_num += (points.size() + (is_cyclic ? 1 : 0)) * 2;
     });
 
     /* One vertex is stored before and after as padding. Cyclic strokes have one extra vertex. */
     total_verts_num += num_points + num_cyclic + num_curves * 2;
-    total_triangles_num += (num_points + num_cyclic) * 2;
-    total_triangles_num += info.drawing.triangles().size();
 
     verts_start_offsets_per_visible_drawing.append(std::move(verts_start_offsets));
     tris_start_offsets_per_visible_drawing.append(std::move(tris_start_offsets));
+    ibo_start_offsets_per_visible_drawing.append(std::move(ibo_start_offsets));
   }
 
   GPUUsageType vbo_flag = GPU_USAGE_STATIC | GPU_USAGE_FLAG_BUFFER_TEXTURE_ONLY;
@@ -1143,6 +1152,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
   MutableSpan<GreasePencilColorVert> cols = cache->vbo_col->data<GreasePencilColorVert>();
   /* Create IBO. */
   GPU_indexbuf_init(&ibo, GPU_PRIM_TRIS, total_triangles_num, 0xFFFFFFFFu);
+  MutableSpan<uint3> ibo_tris = GPU_indexbuf_get_data(&ibo).cast<uint3>();
 
   /* Fill buffers with data. */
   for (const int drawing_i : drawings.index_range()) {
@@ -1196,6 +1206,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
     const Span<float4x2> texture_matrices = info.drawing.texture_matrices();
     const Span<int> verts_start_offsets = verts_start_offsets_per_visible_drawing[drawing_i];
     const Span<int> tris_start_offsets = tris_start_offsets_per_visible_drawing[drawing_i];
+    const Span<int> ibo_start_offsets = ibo_start_offsets_per_visible_drawing[drawing_i];
     IndexMaskMemory memory;
     const IndexMask visible_strokes = ed::greasepencil::retrieve_visible_strokes(
         object, info.drawing, memory);
@@ -1211,7 +1222,8 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                               float u_stroke,
                               const float4x2 &texture_matrix,
                               GreasePencilStrokeVert &s_vert,
-                              GreasePencilColorVert &c_vert) {
+                              GreasePencilColorVert &c_vert,
+                              MutableSpan<uint3> quad_tris) {
       const float3 pos = math::transform_point(layer_space_to_object_space, positions[point_i]);
       copy_v3_v3(s_vert.pos, pos);
       /* GP data itself does not constrain radii to be positive, but drawing code expects it, and
@@ -1236,12 +1248,12 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       copy_v4_v4(c_vert.fcol, stroke_fill_colors[curve_i]);
       c_vert.fcol[3] = (int(c_vert.fcol[3] * 10000.0f) * 10.0f) + fill_opacities[curve_i];
 
-      int v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
-      GPU_indexbuf_add_tri_verts(&ibo, v_mat + 0, v_mat + 1, v_mat + 2);
-      GPU_indexbuf_add_tri_verts(&ibo, v_mat + 2, v_mat + 1, v_mat + 3);
+      const uint v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
+      quad_tris[0] = uint3(v_mat + 0, v_mat + 1, v_mat + 2);
+      quad_tris[1] = uint3(v_mat + 2, v_mat + 1, v_mat + 3);
     };
 
-    visible_strokes.foreach_index([&](const int curve_i, const int pos) {
+    visible_strokes.foreach_index(GrainSize(512), [&](const int curve_i, const int pos) {
       const IndexRange points = points_by_curve[curve_i];
       const bool is_cyclic = cyclic[curve_i] && (points.size() > 2);
       const int verts_start_offset = verts_start_offsets[pos];
@@ -1251,6 +1263,7 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       MutableSpan<GreasePencilStrokeVert> verts_slice = verts.slice(verts_range);
       MutableSpan<GreasePencilColorVert> cols_slice = cols.slice(verts_range);
       const float4x2 texture_matrix = texture_matrices[curve_i] * object_space_to_layer_space;
+      int ibo_offset = ibo_start_offsets[pos];
 
       const Span<float> lengths = curves.evaluated_lengths_for_curve(curve_i, cyclic[curve_i]);
 
@@ -1261,10 +1274,9 @@ static void grease_pencil_geom_batch_ensure(Object &object,
       if (points.size() >= 3) {
         const Span<uint3> tris_slice = triangles.slice(tris_start_offset, points.size() - 2);
         for (const uint3 tri : tris_slice) {
-          GPU_indexbuf_add_tri_verts(&ibo,
-                                     (verts_range[1] + tri.x) << GP_VERTEX_ID_SHIFT,
-                                     (verts_range[1] + tri.y) << GP_VERTEX_ID_SHIFT,
-                                     (verts_range[1] + tri.z) << GP_VERTEX_ID_SHIFT);
+          ibo_tris[ibo_offset++] = uint3((verts_range[1] + tri.x) << GP_VERTEX_ID_SHIFT,
+                                         (verts_range[1] + tri.y) << GP_VERTEX_ID_SHIFT,
+                                         (verts_range[1] + tri.z) << GP_VERTEX_ID_SHIFT);
         }
       }
 
@@ -1283,7 +1295,9 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                        u_stroke,
                        texture_matrix,
                        verts_slice[idx],
-                       cols_slice[idx]);
+                       cols_slice[idx],
+                       ibo_tris.slice(ibo_offset, 2));
+        ibo_offset += 2;
       }
 
       if (is_cyclic) {
@@ -1299,7 +1313,9 @@ static void grease_pencil_geom_batch_ensure(Object &object,
                        u_stroke,
                        texture_matrix,
                        verts_slice[idx],
-                       cols_slice[idx]);
+                       cols_slice[idx],
+                       ibo_tris.slice(ibo_offset, 2));
+        ibo_offset += 2;
       }
 
       /* Last vertex is not drawn. */
@@ -1313,8 +1329,17 @@ static void grease_pencil_geom_batch_ensure(Object &object,
   /* Also mark first vert as invalid. */
   verts[0].mat = -1;
 
-  /* Finish the IBO. */
-  cache->ibo = GPU_indexbuf_build(&ibo);
+  /* Finish the IBO. The builder does not track the index range when indices are written directly,
+   * so pass an upper bound. Keep the builder's empty range when there is nothing to draw. */
+  cache->ibo = GPU_indexbuf_calloc();
+  if (total_triangles_num > 0) {
+    const uint index_max = (uint(total_verts_num + 2) << GP_VERTEX_ID_SHIFT) |
+                           GP_IS_STROKE_VERTEX_BIT;
+    GPU_indexbuf_build_in_place_ex(&ibo, 0, index_max, false, cache->ibo);
+  }
+  else {
+    GPU_indexbuf_build_in_place(&ibo, cache->ibo);
+  }
   /* Create the batches */
   cache->geom_batch = GPU_batch_create(GPU_PRIM_TRIS, cache->vbo, cache->ibo);
   /* Allow creation of buffer texture. */
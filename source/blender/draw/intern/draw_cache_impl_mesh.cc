@@ -754,6 +754,43 @@ void DRW_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode)
     case BKE_MESH_BATCH_DIRTY_ALL:
       cache.is_dirty = true;
       break;
+    case BKE_MESH_BATCH_DIRTY_DEFORM:
+      if (cache.subdiv_cache) {
+        /* The GPU subdivision cache is built from the positions as well. */
+        cache.is_dirty = true;
+        break;
+      }
+      /* Keep the buffers that only depend on topology (indices of edges and points, UVs,
+       * attributes, selection data...). The triangulation of n-gons depends on positions. */
+      FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.pos);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.nor);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.vnor);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edge_fac);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.tan);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_area);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_angle);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.mesh_analysis);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_pos);
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_nor);
+        GPU_INDEXBUF_DISCARD_SAFE(mbc->buff.ibo.tris);
+      }
+      for (int i = 0; i < cache.mat_len; i++) {
+        GPU_INDEXBUF_DISCARD_SAFE(cache.tris_per_mat[i]);
+      }
+      batch_map = BATCH_MAP(vbo.pos,
+                            vbo.nor,
+                            vbo.vnor,
+                            vbo.edge_fac,
+                            vbo.tan,
+                            vbo.edituv_stretch_area,
+                            vbo.edituv_stretch_angle,
+                            vbo.mesh_analysis,
+                            vbo.fdots_pos,
+                            vbo.fdots_nor) |
+                  BATCH_MAP(ibo.tris);
+      mesh_batch_cache_discard_batch(cache, batch_map);
+      break;
     case BKE_MESH_BATCH_DIRTY_SHADING:
       mesh_batch_cache_discard_shaded_tri(cache);
       mesh_batch_cache_discard_uvedit(cache);
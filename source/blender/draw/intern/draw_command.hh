@@ -606,6 +606,12 @@ class DrawMultiBuf {
   uint prototype_count_ = 0;
   /** Used items in the resource_id_buf_. Not it's allocated length. */
   uint resource_id_count_ = 0;
+  /**
+   * Group of the previous draw. Consecutive draws of the same batch (e.g. many instances of the
+   * same geometry) are very common, this avoids a lookup in #group_ids_ for each of them.
+   */
+  DrawGroupKey last_group_key_ = {uint(-1), nullptr};
+  uint last_group_id_ = uint(-1);
 
  public:
   void clear()
@@ -619,6 +625,8 @@ class DrawMultiBuf {
     group_count_ = 0;
     prototype_count_ = 0;
     group_ids_.clear();
+    last_group_key_ = {uint(-1), nullptr};
+    last_group_id_ = uint(-1);
   }
 
   void append_draw(Vector<Header, 0> &headers,
@@ -649,7 +657,12 @@ class DrawMultiBuf {
 
     DrawMulti &cmd = commands.last().draw_multi;
 
-    uint &group_id = group_ids_.lookup_or_add(DrawGroupKey(cmd.uuid, batch), uint(-1));
+    const DrawGroupKey group_key(cmd.uuid, batch);
+    if (group_key != last_group_key_) {
+      last_group_key_ = group_key;
+      last_group_id_ = group_ids_.lookup_default(group_key, uint(-1));
+    }
+    uint &group_id = last_group_id_;
 
     bool inverted = handle.has_inverted_handedness();
 
@@ -680,6 +693,7 @@ class DrawMultiBuf {
       /* Custom group are not to be registered in the group_ids_. */
       if (!custom_group) {
         group_id = new_group_id;
+        group_ids_.add_new(group_key, new_group_id);
       }
       /* For serialization only. */
       (inverted ? group.back_proto_len : group.front_proto_len)++;
@@ -13,6 +13,7 @@
 #include "BLI_alloca.h"
 #include "BLI_listbase.h"
 #include "BLI_memblock.h"
+#include "BLI_profile_trace.hh"
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_task.h"
@@ -716,21 +717,20 @@ static void drw_duplidata_load(Object *ob)
     DST.dupli_ghash = BLI_ghash_new(dupli_key_hash, dupli_key_cmp, __func__);
   }
 
-  DupliKey *key = static_cast<DupliKey *>(MEM_callocN(sizeof(DupliKey), __func__));
-  key->ob = dupli->ob;
-  key->ob_data = dupli->ob_data;
-
-  void **value;
-  if (!BLI_ghash_ensure_p(DST.dupli_ghash, key, &value)) {
+  /* Only allocate the key when it is added, instances of different objects are often
+   * interleaved, which would otherwise allocate and free a key for every instance. */
+  DupliKey lookup_key = {dupli->ob, dupli->ob_data};
+  void **value = BLI_ghash_lookup_p(DST.dupli_ghash, &lookup_key);
+  if (value == nullptr) {
+    DupliKey *key = static_cast<DupliKey *>(MEM_mallocN(sizeof(DupliKey), __func__));
+    *key = lookup_key;
+    BLI_ghash_ensure_p(DST.dupli_ghash, key, &value);
     *value = MEM_callocN(sizeof(void *) * g_registered_engines.len, __func__);
 
     /* TODO: Meh a bit out of place but this is nice as it is
      * only done once per instance type. */
     drw_batch_cache_validate(ob);
   }
-  else {
-    MEM_freeN(key);
-  }
   DST.dupli_datas = *(void ***)value;
 }
 
@@ -1123,6 +1123,7 @@ static void drw_engines_draw_scene()
   DRW_ENABLED_ENGINE_ITER (DST.view_data_active, engine, data) {
     PROFILE_START(stime);
     if (engine->draw_scene) {
+      PROFILE_TRACE_ZONE_DETAIL("Draw Engine", engine->idname);
       DRW_stats_group_start(engine->idname);
       engine->draw_scene(data);
       /* Restore for next engine */
@@ -1662,6 +1663,7 @@ void DRW_draw_render_loop_ex(Depsgraph *depsgraph,
                              const bContext *evil_C)
 {
   using namespace blender::draw;
+  PROFILE_TRACE_ZONE("Draw Viewport");
   Scene *scene = DEG_get_evaluated_scene(depsgraph);
   ViewLayer *view_layer = DEG_get_evaluated_view_layer(depsgraph);
   RegionView3D *rv3d = static_cast<RegionView3D *>(region->regiondata);
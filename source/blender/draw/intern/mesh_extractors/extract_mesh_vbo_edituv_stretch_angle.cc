@@ -85,56 +85,56 @@ static void extract_uv_stretch_angle_bm(const MeshRenderData &mr,
   const BMesh &bm = *mr.bm;
   const int uv_offset = CustomData_get_offset(&bm.ldata, CD_PROP_FLOAT2);
 
-  float auv[2][2], last_auv[2];
-  float av[2][3], last_av[3];
-
-  const BMFace *face;
-  BMIter f_iter;
-  BM_ITER_MESH (face, &f_iter, &const_cast<BMesh &>(bm), BM_FACES_OF_MESH) {
-    BMLoop *l_iter, *l_first;
-    l_iter = l_first = BM_FACE_FIRST_LOOP(face);
-    do {
-      const int l_index = BM_elem_index_get(l_iter);
-
-      const float(*luv)[2], (*luv_next)[2];
-      BMLoop *l_next = l_iter->next;
-      if (l_iter == BM_FACE_FIRST_LOOP(face)) {
-        /* First loop in face. */
-        BMLoop *l_tmp = l_iter->prev;
-        BMLoop *l_next_tmp = l_iter;
-        luv = BM_ELEM_CD_GET_FLOAT2_P(l_tmp, uv_offset);
-        luv_next = BM_ELEM_CD_GET_FLOAT2_P(l_next_tmp, uv_offset);
-        compute_normalize_edge_vectors(auv,
-                                       av,
-                                       *luv,
-                                       *luv_next,
-                                       bm_vert_co_get(mr, l_tmp->v),
-                                       bm_vert_co_get(mr, l_next_tmp->v));
-        /* Save last edge. */
-        copy_v2_v2(last_auv, auv[1]);
-        copy_v3_v3(last_av, av[1]);
-      }
-      if (l_next == BM_FACE_FIRST_LOOP(face)) {
-        /* Move previous edge. */
-        copy_v2_v2(auv[0], auv[1]);
-        copy_v3_v3(av[0], av[1]);
-        /* Copy already calculated last edge. */
-        copy_v2_v2(auv[1], last_auv);
-        copy_v3_v3(av[1], last_av);
-      }
-      else {
-        luv = BM_ELEM_CD_GET_FLOAT2_P(l_iter, uv_offset);
-        luv_next = BM_ELEM_CD_GET_FLOAT2_P(l_next, uv_offset);
-        compute_normalize_edge_vectors(auv,
-                                       av,
-                                       *luv,
-                                       *luv_next,
-                                       bm_vert_co_get(mr, l_iter->v),
-                                       bm_vert_co_get(mr, l_next->v));
-      }
-      edituv_get_edituv_stretch_angle(auv, av, &vbo_data[l_index]);
-    } while ((l_iter = l_iter->next) != l_first);
-  }
+  threading::parallel_for(IndexRange(bm.totface), 2048, [&](const IndexRange range) {
+    float auv[2][2], last_auv[2];
+    float av[2][3], last_av[3];
+    for (const int face_index : range) {
+      const BMFace *face = BM_face_at_index(&const_cast<BMesh &>(bm), face_index);
+      BMLoop *l_iter, *l_first;
+      l_iter = l_first = BM_FACE_FIRST_LOOP(face);
+      do {
+        const int l_index = BM_elem_index_get(l_iter);
+
+        const float(*luv)[2], (*luv_next)[2];
+        BMLoop *l_next = l_iter->next;
+        if (l_iter == BM_FACE_FIRST_LOOP(face)) {
+          /* First loop in face. */
+          BMLoop *l_tmp = l_iter->prev;
+          BMLoop *l_next_tmp = l_iter;
+          luv = BM_ELEM_CD_GET_FLOAT2_P(l_tmp, uv_offset);
+          luv_next = BM_ELEM_CD_GET_FLOAT2_P(l_next_tmp, uv_offset);
+          compute_normalize_edge_vectors(auv,
+                                         av,
+                                         *luv,
+                                         *luv_next,
+                                         bm_vert_co_get(mr, l_tmp->v),
+                                         bm_vert_co_get(mr, l_next_tmp->v));
+          /* Save last edge. */
+          copy_v2_v2(last_auv, auv[1]);
+          copy_v3_v3(last_av, av[1]);
+        }
+        if (l_next == BM_FACE_FIRST_LOOP(face)) {
+          /* Move previous edge. */
+          copy_v2_v2(auv[0], auv[1]);
+          copy_v3_v3(av[0], av[1]);
+          /* Copy already calculated last edge. */
+          copy_v2_v2(auv[1], last_auv);
+          copy_v3_v3(av[1], last_av);
+        }
+        else {
+          luv = BM_ELEM_CD_GET_FLOAT2_P(l_iter, uv_offset);
+          luv_next = BM_ELEM_CD_GET_FLOAT2_P(l_next, uv_offset);
+          compute_normalize_edge_vectors(auv,
+                                         av,
+                                         *luv,
+                                         *luv_next,
+                                         bm_vert_co_get(mr, l_iter->v),
+                                         bm_vert_co_get(mr, l_next->v));
+        }
+        edituv_get_edituv_stretch_angle(auv, av, &vbo_data[l_index]);
+      } while ((l_iter = l_iter->next) != l_first);
+    }
+  });
 }
 
 static void extract_uv_stretch_angle_mesh(const MeshRenderData &mr,
@@ -148,48 +148,49 @@ static void extract_uv_stretch_angle_mesh(const MeshRenderData &mr,
   const StringRef name = CustomData_get_active_layer_name(&mesh.corner_data, CD_PROP_FLOAT2);
   const VArraySpan uv_map = *attributes.lookup<float2>(name, bke::AttrDomain::Corner);
 
-  float auv[2][2], last_auv[2];
-  float av[2][3], last_av[3];
-
-  for (const int face_index : faces.index_range()) {
-    const IndexRange face = faces[face_index];
-    const int corner_end = face.start() + face.size();
-    for (int corner = face.start(); corner < corner_end; corner += 1) {
-      int l_next = corner + 1;
-      if (corner == face.start()) {
-        /* First loop in face. */
-        const int corner_last = corner_end - 1;
-        const int l_next_tmp = face.start();
-        compute_normalize_edge_vectors(auv,
-                                       av,
-                                       uv_map[corner_last],
-                                       uv_map[l_next_tmp],
-                                       positions[corner_verts[corner_last]],
-                                       positions[corner_verts[l_next_tmp]]);
-        /* Save last edge. */
-        copy_v2_v2(last_auv, auv[1]);
-        copy_v3_v3(last_av, av[1]);
+  threading::parallel_for(faces.index_range(), 2048, [&](const IndexRange range) {
+    float auv[2][2], last_auv[2];
+    float av[2][3], last_av[3];
+    for (const int face_index : range) {
+      const IndexRange face = faces[face_index];
+      const int corner_end = face.start() + face.size();
+      for (int corner = face.start(); corner < corner_end; corner += 1) {
+        int l_next = corner + 1;
+        if (corner == face.start()) {
+          /* First loop in face. */
+          const int corner_last = corner_end - 1;
+          const int l_next_tmp = face.start();
+          compute_normalize_edge_vectors(auv,
+                                         av,
+                                         uv_map[corner_last],
+                                         uv_map[l_next_tmp],
+                                         positions[corner_verts[corner_last]],
+                                         positions[corner_verts[l_next_tmp]]);
+          /* Save last edge. */
+          copy_v2_v2(last_auv, auv[1]);
+          copy_v3_v3(last_av, av[1]);
+        }
+        if (l_next == corner_end) {
+          l_next = face.start();
+          /* Move previous edge. */
+          copy_v2_v2(auv[0], auv[1]);
+          copy_v3_v3(av[0], av[1]);
+          /* Copy already calculated last edge. */
+          copy_v2_v2(auv[1], last_auv);
+          copy_v3_v3(av[1], last_av);
+        }
+        else {
+          compute_normalize_edge_vectors(auv,
+                                         av,
+                                         uv_map[corner],
+                                         uv_map[l_next],
+                                         positions[corner_verts[corner]],
+                                         positions[corner_verts[l_next]]);
+        }
+        edituv_get_edituv_stretch_angle(auv, av, &vbo_data[corner]);
       }
-      if (l_next == corner_end) {
-        l_next = face.start();
-        /* Move previous edge. */
-        copy_v2_v2(auv[0], auv[1]);
-        copy_v3_v3(av[0], av[1]);
-        /* Copy already calculated last edge. */
-        copy_v2_v2(auv[1], last_auv);
-        copy_v3_v3(av[1], last_av);
-      }
-      else {
-        compute_normalize_edge_vectors(auv,
-                                       av,
-                                       uv_map[corner],
-                                       uv_map[l_next],
-                                       positions[corner_verts[corner]],
-                                       positions[corner_verts[l_next]]);
-      }
-      edituv_get_edituv_stretch_angle(auv, av, &vbo_data[corner]);
     }
-  }
+  });
 }
 
 void extract_edituv_stretch_angle(const MeshRenderData &mr, gpu::VertBuf &vbo)
@@ -12,6 +12,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
 #include "BLI_ordered_edge.hh"
+#include "BLI_task.hh"
 
 #include "BKE_bvhutils.hh"
 #include "BKE_editmesh.hh"
@@ -81,13 +82,15 @@ static void statvis_calc_overhang(const MeshRenderData &mr, MutableSpan<float> r
     }
   }
   else {
-    for (const int face_i : mr.faces.index_range()) {
-      float fac = angle_normalized_v3v3(mr.face_normals[face_i], dir) / float(M_PI);
-      fac = overhang_remap(fac, min, max, minmax_irange);
-      for (const int loop_i : mr.faces[face_i]) {
-        r_overhang[loop_i] = fac;
+    threading::parallel_for(mr.faces.index_range(), 4096, [&](const IndexRange range) {
+      for (const int face_i : range) {
+        float fac = angle_normalized_v3v3(mr.face_normals[face_i], dir) / float(M_PI);
+        fac = overhang_remap(fac, min, max, minmax_irange);
+        for (const int loop_i : mr.faces[face_i]) {
+          r_overhang[loop_i] = fac;
+        }
       }
-    }
+    });
   }
 }
 
@@ -421,36 +424,38 @@ static void statvis_calc_distort(const MeshRenderData &mr, MutableSpan<float> r_
     }
   }
   else {
-    for (const int face_index : mr.faces.index_range()) {
-      const IndexRange face = mr.faces[face_index];
-      float fac = -1.0f;
-
-      if (face.size() > 3) {
-        const float *f_no = mr.face_normals[face_index];
-        fac = 0.0f;
-
-        for (const int corner : face.drop_front(1)) {
-          const int corner_prev = bke::mesh::face_corner_prev(face, corner);
-          const int corner_next = bke::mesh::face_corner_next(face, corner);
-          float no_corner[3];
-          normal_tri_v3(no_corner,
-                        mr.vert_positions[mr.corner_verts[corner_prev]],
-                        mr.vert_positions[mr.corner_verts[corner]],
-                        mr.vert_positions[mr.corner_verts[corner_next]]);
-          /* simple way to detect (what is most likely) concave */
-          if (dot_v3v3(f_no, no_corner) < 0.0f) {
-            negate_v3(no_corner);
+    threading::parallel_for(mr.faces.index_range(), 2048, [&](const IndexRange range) {
+      for (const int face_index : range) {
+        const IndexRange face = mr.faces[face_index];
+        float fac = -1.0f;
+
+        if (face.size() > 3) {
+          const float *f_no = mr.face_normals[face_index];
+          fac = 0.0f;
+
+          for (const int corner : face.drop_front(1)) {
+            const int corner_prev = bke::mesh::face_corner_prev(face, corner);
+            const int corner_next = bke::mesh::face_corner_next(face, corner);
+            float no_corner[3];
+            normal_tri_v3(no_corner,
+                          mr.vert_positions[mr.corner_verts[corner_prev]],
+                          mr.vert_positions[mr.corner_verts[corner]],
+                          mr.vert_positions[mr.corner_verts[corner_next]]);
+            /* simple way to detect (what is most likely) concave */
+            if (dot_v3v3(f_no, no_corner) < 0.0f) {
+              negate_v3(no_corner);
+            }
+            fac = max_ff(fac, angle_normalized_v3v3(f_no, no_corner));
           }
-          fac = max_ff(fac, angle_normalized_v3v3(f_no, no_corner));
+          fac *= 2.0f;
         }
-        fac *= 2.0f;
-      }
 
-      fac = distort_remap(fac, min, max, minmax_irange);
-      for (const int corner : face) {
-        r_distort[corner] = fac;
+        fac = distort_remap(fac, min, max, minmax_irange);
+        for (const int corner : face) {
+          r_distort[corner] = fac;
+        }
       }
-    }
+    });
   }
 }
 
@@ -20,6 +20,7 @@
 #include "BLI_memarena.h"
 #include "BLI_ordered_edge.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "BLT_translation.hh"
 
@@ -991,43 +992,56 @@ static void harmonic_ray_callback(void *userdata,
   }
 }
 
-static MDefBoundIsect *meshdeform_ray_tree_intersect(MeshDeformBind *mdb,
-                                                     const float co1[3],
-                                                     const float co2[3])
+/**
+ * Cast a ray from \a co1 to \a co2 against the cage. Does not allocate,
+ * so it is safe to call from multiple threads.
+ */
+static bool meshdeform_ray_tree_cast(const MeshDeformBind *mdb,
+                                     const float co1[3],
+                                     const float co2[3],
+                                     MeshDeformIsect *r_isect_mdef,
+                                     BVHTreeRayHit *r_hit)
 {
-  BVHTreeRayHit hit;
-  MeshDeformIsect isect_mdef;
   MeshRayCallbackData data = {
-      mdb,
-      &isect_mdef,
+      const_cast<MeshDeformBind *>(mdb),
+      r_isect_mdef,
   };
   float end[3], vec_normal[3];
 
   /* happens binding when a cage has no faces */
   if (UNLIKELY(mdb->bvhtree == nullptr)) {
-    return nullptr;
+    return false;
   }
 
   /* setup isec */
-  memset(&isect_mdef, 0, sizeof(isect_mdef));
-  isect_mdef.lambda = 1e10f;
+  memset(r_isect_mdef, 0, sizeof(*r_isect_mdef));
+  r_isect_mdef->lambda = 1e10f;
 
-  copy_v3_v3(isect_mdef.start, co1);
+  copy_v3_v3(r_isect_mdef->start, co1);
   copy_v3_v3(end, co2);
-  sub_v3_v3v3(isect_mdef.vec, end, isect_mdef.start);
-  isect_mdef.vec_length = normalize_v3_v3(vec_normal, isect_mdef.vec);
+  sub_v3_v3v3(r_isect_mdef->vec, end, r_isect_mdef->start);
+  r_isect_mdef->vec_length = normalize_v3_v3(vec_normal, r_isect_mdef->vec);
+
+  r_hit->index = -1;
+  r_hit->dist = BVH_RAYCAST_DIST_MAX;
+  return BLI_bvhtree_ray_cast_ex(mdb->bvhtree,
+                                 r_isect_mdef->start,
+                                 vec_normal,
+                                 0.0,
+                                 r_hit,
+                                 harmonic_ray_callback,
+                                 &data,
+                                 BVH_RAYCAST_WATERTIGHT) != -1;
+}
 
-  hit.index = -1;
-  hit.dist = BVH_RAYCAST_DIST_MAX;
-  if (BLI_bvhtree_ray_cast_ex(mdb->bvhtree,
-                              isect_mdef.start,
-                              vec_normal,
-                              0.0,
-                              &hit,
-                              harmonic_ray_callback,
-                              &data,
-                              BVH_RAYCAST_WATERTIGHT) != -1)
-  {
+static MDefBoundIsect *meshdeform_ray_tree_intersect(MeshDeformBind *mdb,
+                                                     const float co1[3],
+                                                     const float co2[3])
+{
+  BVHTreeRayHit hit;
+  MeshDeformIsect isect_mdef;
+
+  if (meshdeform_ray_tree_cast(mdb, co1, co2, &isect_mdef, &hit)) {
     const blender::Span<int> corner_verts = mdb->cagemesh_cache.corner_verts;
     const int face_i = mdb->cagemesh_cache.tri_faces[hit.index];
     const blender::IndexRange face = mdb->cagemesh_cache.faces[face_i];
@@ -1066,10 +1080,11 @@ static MDefBoundIsect *meshdeform_ray_tree_intersect(MeshDeformBind *mdb,
   return nullptr;
 }
 
-static int meshdeform_inside_cage(MeshDeformBind *mdb, float *co)
+static int meshdeform_inside_cage(const MeshDeformBind *mdb, const float *co)
 {
-  MDefBoundIsect *isect;
-  float outside[3], start[3], dir[3];
+  BVHTreeRayHit hit;
+  MeshDeformIsect isect_mdef;
+  float outside[3];
   int i;
 
   for (i = 1; i <= 6; i++) {
@@ -1077,12 +1092,9 @@ static int meshdeform_inside_cage(MeshDeformBind *mdb, float *co)
     outside[1] = co[1] + (mdb->max[1] - mdb->min[1] + 1.0f) * MESHDEFORM_OFFSET[i][1];
     outside[2] = co[2] + (mdb->max[2] - mdb->min[2] + 1.0f) * MESHDEFORM_OFFSET[i][2];
 
-    copy_v3_v3(start, co);
-    sub_v3_v3v3(dir, outside, start);
-    normalize_v3(dir);
-
-    isect = meshdeform_ray_tree_intersect(mdb, start, outside);
-    if (isect && !isect->facing) {
+    /* Only the facing of the hit is needed, so there is no need to allocate
+     * a #MDefBoundIsect (which would not be thread-safe). */
+    if (meshdeform_ray_tree_cast(mdb, co, outside, &isect_mdef, &hit) && !isect_mdef.isect) {
       return 1;
     }
   }
@@ -1454,7 +1466,6 @@ static void meshdeform_matrix_add_exterior_phi(
 static void meshdeform_matrix_solve(MeshDeformModifierData *mmd, MeshDeformBind *mdb)
 {
   LinearSolver *context;
-  float vec[3], gridvec[3];
   int a, b, x, y, z, totvar;
   char message[256];
 
@@ -1520,16 +1531,21 @@ static void meshdeform_matrix_solve(MeshDeformModifierData *mmd, MeshDeformBind
 
       if (mdb->weights) {
         /* static bind : compute weights for each vertex */
-        for (b = 0; b < mdb->verts_num; b++) {
-          if (mdb->inside[b]) {
-            copy_v3_v3(vec, mdb->vertexcos[b]);
-            gridvec[0] = (vec[0] - mdb->min[0] - mdb->halfwidth[0]) / mdb->width[0];
-            gridvec[1] = (vec[1] - mdb->min[1] - mdb->halfwidth[1]) / mdb->width[1];
-            gridvec[2] = (vec[2] - mdb->min[2] - mdb->halfwidth[2]) / mdb->width[2];
-
-            mdb->weights[b * mdb->cage_verts_num + a] = meshdeform_interp_w(mdb, gridvec, vec, a);
-          }
-        }
+        blender::threading::parallel_for(
+            blender::IndexRange(mdb->verts_num), 1024, [&](const blender::IndexRange range) {
+              float vec[3], gridvec[3];
+              for (const int b : range) {
+                if (mdb->inside[b]) {
+                  copy_v3_v3(vec, mdb->vertexcos[b]);
+                  gridvec[0] = (vec[0] - mdb->min[0] - mdb->halfwidth[0]) / mdb->width[0];
+                  gridvec[1] = (vec[1] - mdb->min[1] - mdb->halfwidth[1]) / mdb->width[1];
+                  gridvec[2] = (vec[2] - mdb->min[2] - mdb->halfwidth[2]) / mdb->width[2];
+
+                  mdb->weights[b * mdb->cage_verts_num + a] = meshdeform_interp_w(
+                      mdb, gridvec, vec, a);
+                }
+              }
+            });
       }
       else {
         MDefBindInfluence *inf;
@@ -1584,8 +1600,8 @@ static void harmonic_coordinates_bind(MeshDeformModifierData *mmd, MeshDeformBin
   MDefBindInfluence *inf;
   MDefInfluence *mdinf;
   MDefCell *cell;
-  float center[3], vec[3], maxwidth, totweight;
-  int a, b, x, y, z, totinside, offset;
+  float center[3], maxwidth, totweight;
+  int a, b, x, y, z, offset;
 
   /* compute bounding box of the cage mesh */
   INIT_MINMAX(mdb->min, mdb->max);
@@ -1654,19 +1670,13 @@ static void harmonic_coordinates_bind(MeshDeformModifierData *mmd, MeshDeformBin
 
   progress_bar(0, "Setting up mesh deform system");
 
-  totinside = 0;
-  for (a = 0; a < mdb->verts_num; a++) {
-    copy_v3_v3(vec, mdb->vertexcos[a]);
-    mdb->inside[a] = meshdeform_inside_cage(mdb, vec);
-    if (mdb->inside[a]) {
-      totinside++;
-    }
-  }
-  (void)totinside; /* Quiet set-but-unused warning (may be removed). */
-
-  /* free temporary MDefBoundIsects */
-  BLI_memarena_free(mdb->memarena);
-  mdb->memarena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, "harmonic coords arena");
+  /* Each vertex casts its own rays without allocating, so this is done in parallel. */
+  blender::threading::parallel_for(
+      blender::IndexRange(mdb->verts_num), 256, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          mdb->inside[i] = meshdeform_inside_cage(mdb, mdb->vertexcos[i]);
+        }
+      });
 
   /* start with all cells untyped */
   for (a = 0; a < mdb->size3; a++) {
@@ -288,6 +288,9 @@ static int init_indexer_entries_from_value(FileIndexerEntries &indexer_entries,
 struct AssetLibraryIndex {
   struct PreexistingFileIndexInfo {
     bool is_used = false;
+    /** File status from the directory listing, so it doesn't have to be queried again. */
+    int64_t mtime = 0;
+    size_t size = 0;
   };
 
   /**
@@ -371,7 +374,10 @@ struct AssetLibraryIndex {
     for (int i = 0; i < dir_entries_num; i++) {
       direntry *entry = &dir_entries[i];
       if (BLI_str_endswith(entry->relname, ".index.json")) {
-        this->preexisting_file_indices.add_as(std::string(entry->path));
+        PreexistingFileIndexInfo info;
+        info.mtime = int64_t(entry->s.st_mtime);
+        info.size = size_t(entry->s.st_size);
+        this->preexisting_file_indices.add_as(std::string(entry->path), info);
       }
     }
 
@@ -524,9 +530,33 @@ class AssetIndexFile : public AbstractFile {
   const size_t MIN_FILE_SIZE_WITH_ENTRIES = 32;
   std::string filename;
 
+ private:
+  /**
+   * Status of the index file. Index files are usually known from the directory listing done when
+   * indexing starts, so checking them doesn't require any file system access.
+   */
+  bool exists_ = false;
+  int64_t mtime_ = 0;
+  size_t size_ = 0;
+
+ public:
   AssetIndexFile(AssetLibraryIndex &library_index, StringRef index_file_path)
       : library_index(library_index), filename(index_file_path)
   {
+    if (const AssetLibraryIndex::PreexistingFileIndexInfo *info =
+            library_index.preexisting_file_indices.lookup_ptr(this->filename))
+    {
+      exists_ = true;
+      mtime_ = info->mtime;
+      size_ = info->size;
+      return;
+    }
+    BLI_stat_t st;
+    if (BLI_stat(this->get_file_path(), &st) != -1) {
+      exists_ = true;
+      mtime_ = int64_t(st.st_mtime);
+      size_ = size_t(st.st_size);
+    }
   }
 
   AssetIndexFile(AssetLibraryIndex &library_index, BlendFile &asset_filename)
@@ -544,12 +574,21 @@ class AssetIndexFile : public AbstractFile {
     return filename.c_str();
   }
 
+  bool exists() const
+  {
+    return exists_;
+  }
+
   /**
    * Returns whether the index file is older than the given asset file.
    */
   bool is_older_than(const BlendFile &asset_file) const
   {
-    return BLI_file_older(this->get_file_path(), asset_file.get_file_path());
+    BLI_stat_t st;
+    if (BLI_stat(asset_file.get_file_path(), &st) == -1) {
+      return false;
+    }
+    return mtime_ < int64_t(st.st_mtime);
   }
 
   /**
@@ -557,8 +596,7 @@ class AssetIndexFile : public AbstractFile {
    */
   bool constains_entries() const
   {
-    const size_t file_size = get_file_size();
-    return file_size >= MIN_FILE_SIZE_WITH_ENTRIES;
+    return size_ >= MIN_FILE_SIZE_WITH_ENTRIES;
   }
 
   std::unique_ptr<AssetIndex> read_contents() const
@@ -19,6 +19,7 @@
 #include "DNA_object_types.h"
 #include "DNA_scene_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_array_utils.h"
 #include "BLI_implicit_sharing.hh"
 #include "BLI_listbase.h"
@@ -586,43 +587,60 @@ static void um_arraystore_expand(UndoMesh *um)
 {
   Mesh *mesh = &um->mesh;
 
-  um_arraystore_cd_expand(um->store.vdata, &mesh->vert_data, mesh->verts_num);
-  um_arraystore_cd_expand(um->store.edata, &mesh->edge_data, mesh->edges_num);
-  um_arraystore_cd_expand(um->store.ldata, &mesh->corner_data, mesh->corners_num);
-  um_arraystore_cd_expand(um->store.pdata, &mesh->face_data, mesh->faces_num);
-
-  if (um->store.keyblocks) {
-    const size_t stride = mesh->key->elemsize;
-    KeyBlock *keyblock = static_cast<KeyBlock *>(mesh->key->block.first);
-    for (int i = 0; i < mesh->key->totkey; i++, keyblock = keyblock->next) {
-      BArrayState *state = um->store.keyblocks[i];
-      size_t state_len;
-      keyblock->data = BLI_array_store_state_data_get_alloc(state, &state_len);
-      BLI_assert(keyblock->totelem == (state_len / stride));
-      UNUSED_VARS_NDEBUG(stride);
-    }
-  }
-
-  if (um->store.face_offset_indices) {
-    const size_t stride = sizeof(*mesh->face_offset_indices);
-    BArrayState *state = um->store.face_offset_indices;
-    size_t state_len;
-    mesh->face_offset_indices = static_cast<int *>(
-        BLI_array_store_state_data_get_alloc(state, &state_len));
-    mesh->runtime->face_offsets_sharing_info = blender::implicit_sharing::info_for_mem_free(
-        mesh->face_offset_indices);
-    BLI_assert((mesh->faces_num + 1) == (state_len / stride));
-    UNUSED_VARS_NDEBUG(stride);
-  }
-  if (um->store.mselect) {
-    const size_t stride = sizeof(*mesh->mselect);
-    BArrayState *state = um->store.mselect;
-    size_t state_len;
-    mesh->mselect = static_cast<MSelect *>(
-        BLI_array_store_state_data_get_alloc(state, &state_len));
-    BLI_assert(mesh->totselect == (state_len / stride));
-    UNUSED_VARS_NDEBUG(stride);
-  }
+  /* Expanding only reads from the array stores, so every array can be expanded in parallel.
+   * Unlike compacting, this runs on the main thread while the user waits for undo. */
+  blender::threading::parallel_invoke(
+      4096 < (mesh->verts_num + mesh->edges_num + mesh->corners_num + mesh->faces_num),
+      [&]() { um_arraystore_cd_expand(um->store.vdata, &mesh->vert_data, mesh->verts_num); },
+      [&]() { um_arraystore_cd_expand(um->store.edata, &mesh->edge_data, mesh->edges_num); },
+      [&]() {
+        um_arraystore_cd_expand(um->store.ldata, &mesh->corner_data, mesh->corners_num);
+      },
+      [&]() { um_arraystore_cd_expand(um->store.pdata, &mesh->face_data, mesh->faces_num); },
+      [&]() {
+        if (um->store.keyblocks) {
+          const size_t stride = mesh->key->elemsize;
+          blender::Array<KeyBlock *> keyblocks(mesh->key->totkey);
+          KeyBlock *keyblock = static_cast<KeyBlock *>(mesh->key->block.first);
+          for (int i = 0; i < mesh->key->totkey; i++, keyblock = keyblock->next) {
+            keyblocks[i] = keyblock;
+          }
+          blender::threading::parallel_for(
+              keyblocks.index_range(), 1, [&](const blender::IndexRange range) {
+                for (const int i : range) {
+                  BArrayState *state = um->store.keyblocks[i];
+                  size_t state_len;
+                  keyblocks[i]->data = BLI_array_store_state_data_get_alloc(state, &state_len);
+                  BLI_assert(keyblocks[i]->totelem == (state_len / stride));
+                  UNUSED_VARS_NDEBUG(stride);
+                }
+              });
+        }
+      },
+      [&]() {
+        if (um->store.face_offset_indices) {
+          const size_t stride = sizeof(*mesh->face_offset_indices);
+          BArrayState *state = um->store.face_offset_indices;
+          size_t state_len;
+          mesh->face_offset_indices = static_cast<int *>(
+              BLI_array_store_state_data_get_alloc(state, &state_len));
+          mesh->runtime->face_offsets_sharing_info = blender::implicit_sharing::info_for_mem_free(
+              mesh->face_offset_indices);
+          BLI_assert((mesh->faces_num + 1) == (state_len / stride));
+          UNUSED_VARS_NDEBUG(stride);
+        }
+      },
+      [&]() {
+        if (um->store.mselect) {
+          const size_t stride = sizeof(*mesh->mselect);
+          BArrayState *state = um->store.mselect;
+          size_t state_len;
+          mesh->mselect = static_cast<MSelect *>(
+              BLI_array_store_state_data_get_alloc(state, &state_len));
+          BLI_assert(mesh->totselect == (state_len / stride));
+          UNUSED_VARS_NDEBUG(stride);
+        }
+      });
 }
 
 static void um_arraystore_free(UndoMesh *um)
@@ -10,6 +10,7 @@
 #include "BLI_path_util.h"
 #include "BLI_serialize.hh"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
@@ -249,6 +250,35 @@ static void clear_requested_bakes_in_modifier_cache(BakeGeometryNodesJob &job)
   }
 }
 
+/** Everything needed to write one baked frame to disk in a background task. */
+struct BakeFrameWriteTask {
+  std::string frame_file_name;
+  Vector<std::pair<NodeBakeRequest *, const bake::FrameCache *>> frames;
+};
+
+static void bake_frame_write_task_run(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  const BakeFrameWriteTask &task = *static_cast<const BakeFrameWriteTask *>(taskdata);
+  for (const auto &[request, frame_cache] : task.frames) {
+    const bake::BakePath &path = request->path;
+
+    char meta_path[FILE_MAX];
+    BLI_path_join(meta_path,
+                  sizeof(meta_path),
+                  path.meta_dir.c_str(),
+                  (task.frame_file_name + ".json").c_str());
+    BLI_file_ensure_parent_dir_exists(meta_path);
+    bake::DiskBlobWriter blob_writer{path.blobs_dir, task.frame_file_name};
+    fstream meta_file{meta_path, std::ios::out};
+    bake::serialize_bake(frame_cache->state, blob_writer, *request->blob_sharing, meta_file);
+  }
+}
+
+static void bake_frame_write_task_free(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  MEM_delete(static_cast<BakeFrameWriteTask *>(taskdata));
+}
+
 static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *worker_status)
 {
   BakeGeometryNodesJob &job = *static_cast<BakeGeometryNodesJob *>(customdata);
@@ -272,6 +302,12 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
   const float progress_per_frame = frame_step_size / frames_to_bake;
   const int old_frame = job.scene->r.cfra;
 
+  /* Frames are written to disk in the background while the next frame is evaluated. Only one
+   * frame is written at a time, so the blob sharing of each bake is only used from one thread,
+   * deduplicated data refers to frames that are already written, and at most one evaluated frame
+   * is waiting to be written. */
+  TaskPool *write_pool = BLI_task_pool_create_background(nullptr, TASK_PRIORITY_LOW);
+
   for (float frame_f = global_bake_start_frame; frame_f <= global_bake_end_frame;
        frame_f += frame_step_size)
   {
@@ -290,7 +326,8 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
 
     clear_requested_bakes_in_modifier_cache(job);
 
-    const std::string frame_file_name = bake::frame_to_file_name(frame);
+    BakeFrameWriteTask *write_task = MEM_new<BakeFrameWriteTask>(__func__);
+    write_task->frame_file_name = bake::frame_to_file_name(frame);
 
     for (NodeBakeRequest &request : job.bake_requests) {
       NodesModifierData &nmd = *request.nmd;
@@ -306,24 +343,20 @@ static void bake_geometry_nodes_startjob(void *customdata, wmJobWorkerStatus *wo
       if (frame_cache.frame != frame) {
         continue;
       }
-
-      const bake::BakePath path = request.path;
-
-      char meta_path[FILE_MAX];
-      BLI_path_join(meta_path,
-                    sizeof(meta_path),
-                    path.meta_dir.c_str(),
-                    (frame_file_name + ".json").c_str());
-      BLI_file_ensure_parent_dir_exists(meta_path);
-      bake::DiskBlobWriter blob_writer{path.blobs_dir, frame_file_name};
-      fstream meta_file{meta_path, std::ios::out};
-      bake::serialize_bake(frame_cache.state, blob_writer, *request.blob_sharing, meta_file);
+      write_task->frames.append({&request, &frame_cache});
     }
 
+    BLI_task_pool_work_and_wait(write_pool);
+    BLI_task_pool_push(
+        write_pool, bake_frame_write_task_run, write_task, true, bake_frame_write_task_free);
+
     worker_status->progress += progress_per_frame;
     worker_status->do_update = true;
   }
 
+  BLI_task_pool_work_and_wait(write_pool);
+  BLI_task_pool_free(write_pool);
+
   /* Tag simulations as being baked. */
   for (NodeBakeRequest &request : job.bake_requests) {
     if (request.node_type != GEO_NODE_SIMULATION_OUTPUT) {
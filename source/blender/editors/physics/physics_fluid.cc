@@ -424,6 +424,10 @@ static void fluid_bake_startjob(void *customdata, wmJobWorkerStatus *worker_stat
   DEG_id_tag_update(&job->ob->id, ID_RECALC_GEOMETRY);
 
   fluid_bake_sequence(job);
+#ifdef WITH_FLUID
+  /* The bake is only done once all cache files are written. */
+  BKE_fluid_cache_wait_writes();
+#endif
 
   worker_status->do_update = true;
   worker_status->stop = false;
@@ -26,6 +26,7 @@
 #include "BLI_array_utils.hh"
 #include "BLI_enumerable_thread_specific.hh"
 #include "BLI_kdtree.h"
+#include "BLI_map.hh"
 #include "BLI_rand.hh"
 #include "BLI_task.hh"
 
@@ -48,6 +49,13 @@ class DensityAddOperation : public CurvesSculptStrokeOperation {
   KDTree_3d *deformed_curve_roots_kdtree_ = nullptr;
   /** Root positions of curves that have been added in the current brush stroke. */
   Vector<float3> new_deformed_root_positions_;
+  /**
+   * Indices into #new_deformed_root_positions_ grouped by grid cells whose size is the minimum
+   * distance. It is extended in every stroke step, so that the new roots of a step can be checked
+   * against the roots added before without building a new tree of all of them.
+   */
+  Map<int3, Vector<int>> new_deformed_root_grid_;
+  float new_deformed_root_grid_cell_size_ = 0.0f;
   int original_curve_num_ = 0;
 
   friend struct DensityAddOperationExecutor;
@@ -64,6 +72,63 @@ class DensityAddOperation : public CurvesSculptStrokeOperation {
   }
 
   void on_stroke_extended(const bContext &C, const StrokeExtension &stroke_extension) override;
+
+ private:
+  int3 new_root_grid_cell(const float3 &position) const
+  {
+    return int3(math::floor(position / new_deformed_root_grid_cell_size_));
+  }
+
+  void add_new_root(const float3 &position)
+  {
+    const int index = new_deformed_root_positions_.append_and_get_index(position);
+    if (new_deformed_root_grid_cell_size_ > 0.0f) {
+      new_deformed_root_grid_.lookup_or_add_default(this->new_root_grid_cell(position))
+          .append(index);
+    }
+  }
+
+  void rebuild_new_root_grid(const float cell_size)
+  {
+    new_deformed_root_grid_.clear();
+    new_deformed_root_grid_cell_size_ = cell_size;
+    if (cell_size <= 0.0f) {
+      return;
+    }
+    for (const int i : new_deformed_root_positions_.index_range()) {
+      const float3 &position = new_deformed_root_positions_[i];
+      new_deformed_root_grid_.lookup_or_add_default(this->new_root_grid_cell(position)).append(i);
+    }
+  }
+
+  bool is_close_to_new_root(const float3 &position, const float min_distance) const
+  {
+    if (new_deformed_root_grid_cell_size_ <= 0.0f) {
+      return false;
+    }
+    /* The cell size is the minimum distance, so only the direct neighbor cells have to be
+     * checked. */
+    const int3 cell = this->new_root_grid_cell(position);
+    const float min_distance_sq = min_distance * min_distance;
+    for (int z = -1; z <= 1; z++) {
+      for (int y = -1; y <= 1; y++) {
+        for (int x = -1; x <= 1; x++) {
+          const Vector<int> *indices = new_deformed_root_grid_.lookup_ptr(cell + int3(x, y, z));
+          if (indices == nullptr) {
+            continue;
+          }
+          for (const int i : *indices) {
+            if (math::distance_squared(position, new_deformed_root_positions_[i]) <
+                min_distance_sq)
+            {
+              return true;
+            }
+          }
+        }
+      }
+    }
+    return false;
+  }
 };
 
 struct DensityAddOperationExecutor {
@@ -183,21 +248,21 @@ struct DensityAddOperationExecutor {
       this->prepare_curve_roots_kdtrees();
     }
 
-    const int already_added_curves = self_->new_deformed_root_positions_.size();
-    KDTree_3d *new_roots_kdtree = BLI_kdtree_3d_new(already_added_curves +
-                                                    new_positions_cu.size());
+    const float min_distance = brush_settings_->minimum_distance;
+    if (self_->new_deformed_root_grid_cell_size_ != min_distance) {
+      self_->rebuild_new_root_grid(min_distance);
+    }
+
+    KDTree_3d *new_roots_kdtree = BLI_kdtree_3d_new(new_positions_cu.size());
     BLI_SCOPED_DEFER([&]() { BLI_kdtree_3d_free(new_roots_kdtree); });
 
     /* Used to tag all curves that are too close to existing curves or too close to other new
      * curves. */
     Array<bool> new_curve_skipped(new_positions_cu.size(), false);
     threading::parallel_invoke(
-        512 < already_added_curves + new_positions_cu.size(),
-        /* Build kdtree from root points created by the current stroke. */
+        512 < new_positions_cu.size(),
+        /* Build kdtree from root points created in this step. */
         [&]() {
-          for (const int i : IndexRange(already_added_curves)) {
-            BLI_kdtree_3d_insert(new_roots_kdtree, -1, self_->new_deformed_root_positions_[i]);
-          }
           for (const int new_i : new_positions_cu.index_range()) {
             const float3 &root_pos_cu = new_positions_cu[new_i];
             BLI_kdtree_3d_insert(new_roots_kdtree, new_i, root_pos_cu);
@@ -205,7 +270,7 @@ struct DensityAddOperationExecutor {
           BLI_kdtree_3d_balance(new_roots_kdtree);
         },
         /* Check which new root points are close to roots that existed before the current stroke
-         * started. */
+         * started or that have been added by previous steps of the stroke. */
         [&]() {
           threading::parallel_for(
               new_positions_cu.index_range(), 128, [&](const IndexRange range) {
@@ -215,7 +280,9 @@ struct DensityAddOperationExecutor {
                   nearest.dist = FLT_MAX;
                   BLI_kdtree_3d_find_nearest(
                       self_->deformed_curve_roots_kdtree_, new_root_pos_cu, &nearest);
-                  if (nearest.dist < brush_settings_->minimum_distance) {
+                  if (nearest.dist < min_distance ||
+                      self_->is_close_to_new_root(new_root_pos_cu, min_distance))
+                  {
                     new_curve_skipped[new_i] = true;
                   }
                 }
@@ -231,12 +298,8 @@ struct DensityAddOperationExecutor {
       BLI_kdtree_3d_range_search_cb_cpp(
           new_roots_kdtree,
           root_pos_cu,
-          brush_settings_->minimum_distance,
+          min_distance,
           [&](const int other_new_i, const float * /*co*/, float /*dist_sq*/) {
-            if (other_new_i == -1) {
-              new_curve_skipped[new_i] = true;
-              return false;
-            }
             if (new_i == other_new_i) {
               return true;
             }
@@ -252,7 +315,9 @@ struct DensityAddOperationExecutor {
         new_uvs.remove_and_reorder(i);
       }
     }
-    self_->new_deformed_root_positions_.extend(new_positions_cu);
+    for (const float3 &position : new_positions_cu) {
+      self_->add_new_root(position);
+    }
 
     const Span<float3> corner_normals_su = surface_orig_->corner_normals();
     const Span<int3> surface_corner_tris_orig = surface_orig_->corner_tris();
@@ -177,9 +177,16 @@ void imapaint_image_update(
   if (texpaint || (sima && sima->lock)) {
     const int w = BLI_rcti_size_x(&imapaintpartial.dirty_region);
     const int h = BLI_rcti_size_y(&imapaintpartial.dirty_region);
-    /* Testing with partial update in uv editor too. */
-    BKE_image_update_gputexture(
-        image, iuser, imapaintpartial.dirty_region.xmin, imapaintpartial.dirty_region.ymin, w, h);
+    /* Testing with partial update in uv editor too. The image buffer of the user is already
+     * acquired, so use it directly instead of acquiring it again for every dirty region. */
+    ImageTile *image_tile = BKE_image_get_tile_from_iuser(image, iuser);
+    BKE_image_update_gputexture_delayed(image,
+                                        image_tile,
+                                        ibuf,
+                                        imapaintpartial.dirty_region.xmin,
+                                        imapaintpartial.dirty_region.ymin,
+                                        w,
+                                        h);
   }
 }
 
@@ -384,7 +384,10 @@ struct ProjPaintState {
   int thread_tot;
   int bucketMin[2];
   int bucketMax[2];
-  /** must lock threads while accessing these. */
+  /**
+   * Index of the next bucket to paint, counting only the buckets between #bucketMin and
+   * #bucketMax. Must be accessed atomically.
+   */
   int context_bucket_index;
 
   CurveMapping *cavity_curve;
@@ -4779,7 +4782,7 @@ static bool project_bucket_iter_init(ProjPaintState *ps, const float mval_f[2])
     ps->bucketMax[1] = ps->buckets_y;
   }
 
-  ps->context_bucket_index = ps->bucketMin[0] + ps->bucketMin[1] * ps->buckets_x;
+  ps->context_bucket_index = 0;
   return true;
 }
 
@@ -4790,26 +4793,27 @@ static bool project_bucket_iter_next(ProjPaintState *ps,
 {
   const int diameter = 2 * ps->brush_size;
 
-  const int max_bucket_idx = ps->bucketMax[0] + (ps->bucketMax[1] - 1) * ps->buckets_x;
+  /* The context index only counts the buckets within the brush bounds, so that threads don't
+   * contend on the atomic counter for buckets outside of them. */
+  const int range_x = ps->bucketMax[0] - ps->bucketMin[0];
+  const int range_num = range_x * (ps->bucketMax[1] - ps->bucketMin[1]);
 
-  for (int bidx = atomic_fetch_and_add_int32(&ps->context_bucket_index, 1); bidx < max_bucket_idx;
-       bidx = atomic_fetch_and_add_int32(&ps->context_bucket_index, 1))
+  for (int range_idx = atomic_fetch_and_add_int32(&ps->context_bucket_index, 1);
+       range_idx < range_num;
+       range_idx = atomic_fetch_and_add_int32(&ps->context_bucket_index, 1))
   {
-    const int bucket_y = bidx / ps->buckets_x;
-    const int bucket_x = bidx - (bucket_y * ps->buckets_x);
+    const int bucket_y = ps->bucketMin[1] + range_idx / range_x;
+    const int bucket_x = ps->bucketMin[0] + range_idx % range_x;
 
-    BLI_assert(bucket_y >= ps->bucketMin[1] && bucket_y < ps->bucketMax[1]);
-    if (bucket_x >= ps->bucketMin[0] && bucket_x < ps->bucketMax[0]) {
-      /* Use bucket_bounds for #project_bucket_isect_circle and #project_bucket_init. */
-      project_bucket_bounds(ps, bucket_x, bucket_y, bucket_bounds);
+    /* Use bucket_bounds for #project_bucket_isect_circle and #project_bucket_init. */
+    project_bucket_bounds(ps, bucket_x, bucket_y, bucket_bounds);
 
-      if ((ps->source != PROJ_SRC_VIEW) ||
-          project_bucket_isect_circle(mval, float(diameter * diameter), bucket_bounds))
-      {
-        *bucket_index = bidx;
+    if ((ps->source != PROJ_SRC_VIEW) ||
+        project_bucket_isect_circle(mval, float(diameter * diameter), bucket_bounds))
+    {
+      *bucket_index = bucket_x + bucket_y * ps->buckets_x;
 
-        return true;
-      }
+      return true;
     }
   }
 
@@ -115,6 +115,10 @@ struct PaintStroke {
   bool constrain_line;
   float2 constrained_pos;
 
+  /* Set when steps were added by #INBETWEEN_MOUSEMOVE events, the redraw is deferred until the
+   * #MOUSEMOVE event that ends the batch of queued motion events. */
+  bool redraw_pending;
+
   StrokeGetLocation get_location;
   StrokeTestStart test_start;
   StrokeUpdateStep update_step;
@@ -1630,11 +1634,17 @@ int paint_stroke_modal(bContext *C, wmOperator *op, const wmEvent *event, PaintS
     }
   }
 
-  /* Draw for all events (even in between) otherwise updating the brush
-   * display is noticeably delayed.
-   */
-  if (redraw && stroke->redraw) {
-    stroke->redraw(C, stroke, false);
+  /* High frequency input (tablets especially) queue many #INBETWEEN_MOUSEMOVE events per
+   * redraw, which are always followed by a #MOUSEMOVE event. Only redraw once for the whole
+   * batch, when handling that last event, instead of for every sample. */
+  if (event->type == INBETWEEN_MOUSEMOVE) {
+    stroke->redraw_pending |= redraw;
+  }
+  else {
+    if ((redraw || stroke->redraw_pending) && stroke->redraw) {
+      stroke->redraw(C, stroke, false);
+    }
+    stroke->redraw_pending = false;
   }
 
   return OPERATOR_RUNNING_MODAL;
@@ -7526,18 +7526,12 @@ void transform_positions(const Span<float3> src,
                          const float4x4 &transform,
                          const MutableSpan<float3> dst)
 {
-  BLI_assert(src.size() == dst.size());
-
-  for (const int i : src.index_range()) {
-    dst[i] = math::transform_point(transform, src[i]);
-  }
+  math::transform_points(src, transform, dst);
 }
 
 void transform_positions(const float4x4 &transform, const MutableSpan<float3> positions)
 {
-  for (const int i : positions.index_range()) {
-    positions[i] = math::transform_point(transform, positions[i]);
-  }
+  math::transform_points(transform, positions);
 }
 
 OffsetIndices<int> create_node_vert_offsets(Span<bke::pbvh::Node *> nodes, Array<int> &node_data)
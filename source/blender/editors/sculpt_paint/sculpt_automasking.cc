@@ -596,6 +596,44 @@ static void mesh_orig_vert_data_update(SculptOrigVertData &orig_data, const int
   orig_data.no = orig_data.normals[i];
 }
 
+/**
+ * Whether the factors only depend on the values that were computed for the whole mesh at the
+ * start of the stroke. Then they can be gathered directly for all vertices of a node instead of
+ * going through the generic per-vertex evaluation in #factor_get.
+ */
+static bool use_cached_factors_only(const SculptSession &ss, const Cache &cache)
+{
+  const SculptAttribute *factor_attr = ss.attrs.automasking_factor;
+  const SculptAttribute *stroke_id_attr = ss.attrs.automasking_stroke_id;
+  if (!factor_attr || !factor_attr->data || factor_attr->data_for_bmesh) {
+    return false;
+  }
+  if (stroke_id_attr && (!stroke_id_attr->data || stroke_id_attr->data_for_bmesh)) {
+    return false;
+  }
+  return (cache.settings.flags &
+          (BRUSH_AUTOMASKING_BRUSH_NORMAL | BRUSH_AUTOMASKING_CAVITY_ALL)) == 0;
+}
+
+/** \param verts: Either a #Span of vertex indices or an #IndexRange. */
+template<typename Verts>
+static void gather_cached_factors(const SculptSession &ss,
+                                  const Cache &cache,
+                                  const Verts &verts,
+                                  const MutableSpan<float> factors)
+{
+  const float *cached_factors = static_cast<const float *>(ss.attrs.automasking_factor->data);
+  for (const int i : verts.index_range()) {
+    factors[i] *= cached_factors[verts[i]];
+  }
+  if (const SculptAttribute *stroke_id_attr = ss.attrs.automasking_stroke_id) {
+    uchar *stroke_ids = static_cast<uchar *>(stroke_id_attr->data);
+    for (const int vert : verts) {
+      stroke_ids[vert] = cache.current_stroke_id;
+    }
+  }
+}
+
 void calc_vert_factors(const Object &object,
                        const Cache &cache,
                        const bke::pbvh::Node &node,
@@ -604,6 +642,11 @@ void calc_vert_factors(const Object &object,
 {
   SculptSession &ss = *object.sculpt;
 
+  if (use_cached_factors_only(ss, cache)) {
+    gather_cached_factors(ss, cache, verts, factors);
+    return;
+  }
+
   NodeData data = node_begin(object, &cache, node);
 
   for (const int i : verts.index_range()) {
@@ -651,6 +694,16 @@ void calc_grids_factors(const Object &object,
   SculptSession &ss = *object.sculpt;
   const SubdivCCG &subdiv_ccg = *ss.subdiv_ccg;
   const CCGKey key = BKE_subdiv_ccg_key_top_level(subdiv_ccg);
+
+  if (use_cached_factors_only(ss, cache)) {
+    for (const int i : grids.index_range()) {
+      const IndexRange node_range(i * key.grid_area, key.grid_area);
+      const IndexRange grid_range(grids[i] * key.grid_area, key.grid_area);
+      gather_cached_factors(ss, cache, grid_range, factors.slice(node_range));
+    }
+    return;
+  }
+
   NodeData data = node_begin(object, &cache, node);
 
   for (const int i : grids.index_range()) {
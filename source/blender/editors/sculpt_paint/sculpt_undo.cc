@@ -30,13 +30,17 @@
  * Operators must have the OPTYPE_UNDO flag set for this to work properly.
  */
 
+#include <array>
 #include <cstddef>
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array_store.h"
 #include "BLI_array_utils.hh"
 #include "BLI_listbase.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_key_types.h"
@@ -83,6 +87,21 @@ namespace blender::ed::sculpt_paint::undo {
 /* Uncomment to print the undo stack in the console on push/undo/redo. */
 // #define SCULPT_UNDO_DEBUG
 
+/**
+ * De-duplicate the arrays of undo nodes in the background once a step has been pushed, using the
+ * arrays of the same node in a previous step as reference, similar to mesh edit-mode undo.
+ */
+#define USE_ARRAY_STORE
+
+#ifdef USE_ARRAY_STORE
+/**
+ * Per-node arrays are much smaller than the arrays of a whole mesh, so use a smaller chunk size
+ * than mesh undo. Otherwise a single changed element would duplicate most of the array.
+ */
+#  define ARRAY_CHUNK_SIZE_IN_BYTES 4096
+#  define ARRAY_CHUNK_NUM_MIN 64
+#endif
+
 /* Implementation of undo system for objects in sculpt mode.
  *
  * Each undo step in sculpt mode consists of list of nodes, each node contains:
@@ -143,6 +162,24 @@ struct NodeGeometry {
   int faces_num;
 };
 
+#ifdef USE_ARRAY_STORE
+/**
+ * Every array of #Node has its own store, so that they can be de-duplicated in parallel.
+ */
+enum {
+  ARRAY_STORE_INDEX_POSITION = 0,
+  ARRAY_STORE_INDEX_ORIG_POSITION,
+  ARRAY_STORE_INDEX_COL,
+  ARRAY_STORE_INDEX_MASK,
+  ARRAY_STORE_INDEX_LOOP_COL,
+  ARRAY_STORE_INDEX_ORIG_LOOP_COL,
+  ARRAY_STORE_INDEX_VERT_INDICES,
+  ARRAY_STORE_INDEX_CORNER_INDICES,
+  ARRAY_STORE_INDEX_FACE_SETS,
+};
+#  define ARRAY_STORE_INDEX_NUM (ARRAY_STORE_INDEX_FACE_SETS + 1)
+#endif
+
 struct StepData {
   /**
    * The type of data stored in this undo step. For historical reasons this is often set when the
@@ -207,6 +244,19 @@ struct StepData {
   /** Storage of per-node undo data after creation of the undo step is finished. */
   Vector<std::unique_ptr<Node>> nodes;
 
+#ifdef USE_ARRAY_STORE
+  /**
+   * The tree node that each element of #nodes was created for, or null. Only used as key to find
+   * the states of the same node in a previous step, so the pointers are never dereferenced.
+   */
+  Vector<const bke::pbvh::Node *> pbvh_nodes;
+  /**
+   * De-duplicated storage of the arrays in #nodes, see #array_store_compact. Empty when the
+   * arrays are stored in the nodes themselves.
+   */
+  Array<std::array<BArrayState *, ARRAY_STORE_INDEX_NUM>> node_states;
+#endif
+
   size_t undo_size;
 };
 
@@ -248,6 +298,205 @@ static StepData *get_step_data()
   return nullptr;
 }
 
+#ifdef USE_ARRAY_STORE
+
+/* -------------------------------------------------------------------- */
+/** \name Array Store
+ * \{ */
+
+static struct {
+  BArrayStore *stores[ARRAY_STORE_INDEX_NUM];
+  /** The number of steps with #StepData::node_states. */
+  int users;
+  TaskPool *task_pool;
+} node_arraystore = {{nullptr}};
+
+/** Call the function with the array of the node that is stored at the given index. */
+template<typename Fn> static void node_array_call(Node &node, const int index, const Fn &fn)
+{
+  switch (index) {
+    case ARRAY_STORE_INDEX_POSITION:
+      fn(node.position);
+      break;
+    case ARRAY_STORE_INDEX_ORIG_POSITION:
+      fn(node.orig_position);
+      break;
+    case ARRAY_STORE_INDEX_COL:
+      fn(node.col);
+      break;
+    case ARRAY_STORE_INDEX_MASK:
+      fn(node.mask);
+      break;
+    case ARRAY_STORE_INDEX_LOOP_COL:
+      fn(node.loop_col);
+      break;
+    case ARRAY_STORE_INDEX_ORIG_LOOP_COL:
+      fn(node.orig_loop_col);
+      break;
+    case ARRAY_STORE_INDEX_VERT_INDICES:
+      fn(node.vert_indices);
+      break;
+    case ARRAY_STORE_INDEX_CORNER_INDICES:
+      fn(node.corner_indices);
+      break;
+    case ARRAY_STORE_INDEX_FACE_SETS:
+      fn(node.face_sets);
+      break;
+  }
+}
+
+static size_t array_chunk_size_calc(const size_t stride)
+{
+  return std::max(ARRAY_CHUNK_NUM_MIN, ARRAY_CHUNK_SIZE_IN_BYTES / power_of_2_max_i(stride));
+}
+
+static void array_store_compact(StepData &step_data, const StepData *step_data_ref)
+{
+  Map<const bke::pbvh::Node *, int> ref_indices;
+  if (step_data_ref) {
+    for (const int i : step_data_ref->pbvh_nodes.index_range()) {
+      if (step_data_ref->pbvh_nodes[i]) {
+        ref_indices.add(step_data_ref->pbvh_nodes[i], i);
+      }
+    }
+  }
+
+  threading::parallel_for(IndexRange(ARRAY_STORE_INDEX_NUM), 1, [&](const IndexRange range) {
+    for (const int store_index : range) {
+      for (const int i : step_data.nodes.index_range()) {
+        node_array_call(*step_data.nodes[i], store_index, [&](auto &array) {
+          if (array.is_empty()) {
+            return;
+          }
+          const size_t stride = sizeof(typename std::decay_t<decltype(array)>::value_type);
+          BArrayStore *&bs = node_arraystore.stores[store_index];
+          if (bs == nullptr) {
+            bs = BLI_array_store_create(stride, array_chunk_size_calc(stride));
+          }
+          const int ref_index = ref_indices.lookup_default(step_data.pbvh_nodes[i], -1);
+          const BArrayState *state_reference =
+              ref_index == -1 ? nullptr : step_data_ref->node_states[ref_index][store_index];
+          step_data.node_states[i][store_index] = BLI_array_store_state_add(
+              bs, array.data(), array.as_span().size_in_bytes(), state_reference);
+          array = {};
+        });
+      }
+    }
+  });
+}
+
+struct NodeArrayStoreTaskData {
+  StepData *step_data;
+  const StepData *step_data_ref;
+};
+
+static void array_store_compact_cb(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  const NodeArrayStoreTaskData *data = static_cast<NodeArrayStoreTaskData *>(taskdata);
+  array_store_compact(*data->step_data, data->step_data_ref);
+}
+
+/**
+ * Find the most recent step for the same object that can be used as reference for
+ * de-duplicating the arrays, starting at \a us.
+ */
+static const StepData *array_store_reference_find(const UndoStep *us, const StepData &step_data)
+{
+  for (; us; us = us->prev) {
+    if (us->type != BKE_UNDOSYS_TYPE_SCULPT) {
+      continue;
+    }
+    const StepData &step_data_iter = reinterpret_cast<const SculptUndoStep *>(us)->data;
+    if (step_data_iter.object_name == step_data.object_name &&
+        !step_data_iter.node_states.is_empty())
+    {
+      return &step_data_iter;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * Move the node arrays into de-duplicated states in a background task. The arrays must not be
+ * accessed again before #array_store_expand is called.
+ */
+static void array_store_compact_push(StepData &step_data, const UndoStep *us_ref)
+{
+  BLI_assert(step_data.node_states.is_empty());
+  if (step_data.nodes.is_empty() || step_data.pbvh_nodes.size() != step_data.nodes.size()) {
+    return;
+  }
+  /* The reference and the array stores must not be used by a previous task anymore. */
+  if (node_arraystore.task_pool) {
+    BLI_task_pool_work_and_wait(node_arraystore.task_pool);
+  }
+  else {
+    node_arraystore.task_pool = BLI_task_pool_create_background(nullptr, TASK_PRIORITY_LOW);
+  }
+
+  step_data.node_states.reinitialize(step_data.nodes.size());
+  step_data.node_states.fill({});
+  node_arraystore.users += 1;
+
+  NodeArrayStoreTaskData *data = MEM_cnew<NodeArrayStoreTaskData>(__func__);
+  data->step_data = &step_data;
+  data->step_data_ref = array_store_reference_find(us_ref, step_data);
+  BLI_task_pool_push(node_arraystore.task_pool, array_store_compact_cb, data, true, nullptr);
+}
+
+/**
+ * Remove the states of the step, copying their contents back into the node arrays first when
+ * \a expand is true.
+ */
+static void array_store_states_remove(StepData &step_data, const bool expand)
+{
+  if (step_data.node_states.is_empty()) {
+    return;
+  }
+  BLI_task_pool_work_and_wait(node_arraystore.task_pool);
+
+  for (const int i : step_data.nodes.index_range()) {
+    for (const int store_index : IndexRange(ARRAY_STORE_INDEX_NUM)) {
+      BArrayState *state = step_data.node_states[i][store_index];
+      if (state == nullptr) {
+        continue;
+      }
+      if (expand) {
+        node_array_call(*step_data.nodes[i], store_index, [&](auto &array) {
+          array.reinitialize(BLI_array_store_state_size_get(state) /
+                             sizeof(typename std::decay_t<decltype(array)>::value_type));
+          BLI_array_store_state_data_get(state, array.data());
+        });
+      }
+      BLI_array_store_state_remove(node_arraystore.stores[store_index], state);
+    }
+  }
+  step_data.node_states = {};
+
+  node_arraystore.users -= 1;
+  BLI_assert(node_arraystore.users >= 0);
+  if (node_arraystore.users == 0) {
+    for (BArrayStore *&bs : node_arraystore.stores) {
+      if (bs) {
+        BLI_array_store_destroy(bs);
+        bs = nullptr;
+      }
+    }
+    BLI_task_pool_free(node_arraystore.task_pool);
+    node_arraystore.task_pool = nullptr;
+  }
+}
+
+/** Move the contents of the de-duplicated states back into the node arrays. */
+static void array_store_expand(StepData &step_data)
+{
+  array_store_states_remove(step_data, true);
+}
+
+/** \} */
+
+#endif /* USE_ARRAY_STORE */
+
 #ifdef SCULPT_UNDO_DEBUG
 #  ifdef _
 #    undef _
@@ -1747,6 +1996,12 @@ void push_end_ex(Object &ob, const bool use_nested_undo)
 
   /* Move undo node storage from map to vector. */
   step_data->nodes.reserve(step_data->undo_nodes_by_pbvh_node.size());
+#ifdef USE_ARRAY_STORE
+  step_data->pbvh_nodes.resize(step_data->nodes.size(), nullptr);
+  for (const bke::pbvh::Node *node : step_data->undo_nodes_by_pbvh_node.keys()) {
+    step_data->pbvh_nodes.append(node);
+  }
+#endif
   for (std::unique_ptr<Node> &node : step_data->undo_nodes_by_pbvh_node.values()) {
     step_data->nodes.append(std::move(node));
   }
@@ -1863,6 +2118,12 @@ static bool step_encode(bContext * /*C*/, Main *bmain, UndoStep *us_p)
     bmain->is_memfile_undo_flush_needed = true;
   }
 
+#ifdef USE_ARRAY_STORE
+  /* The step is not added to the stack yet, so the last step is the previous one. */
+  array_store_compact_push(us->data,
+                           static_cast<const UndoStep *>(ED_undo_stack_get()->steps.last));
+#endif
+
   return true;
 }
 
@@ -1870,8 +2131,15 @@ static void step_decode_undo_impl(bContext *C, Depsgraph *depsgraph, SculptUndoS
 {
   BLI_assert(us->step.is_applied == true);
 
+#ifdef USE_ARRAY_STORE
+  array_store_expand(us->data);
+#endif
   restore_list(C, depsgraph, us->data);
   us->step.is_applied = false;
+#ifdef USE_ARRAY_STORE
+  /* Restoring swaps the contents of the arrays, so they have to be stored again. */
+  array_store_compact_push(us->data, us->step.prev);
+#endif
 
   print_nodes(*CTX_data_active_object(C), nullptr);
 }
@@ -1880,8 +2148,15 @@ static void step_decode_redo_impl(bContext *C, Depsgraph *depsgraph, SculptUndoS
 {
   BLI_assert(us->step.is_applied == false);
 
+#ifdef USE_ARRAY_STORE
+  array_store_expand(us->data);
+#endif
   restore_list(C, depsgraph, us->data);
   us->step.is_applied = true;
+#ifdef USE_ARRAY_STORE
+  /* Restoring swaps the contents of the arrays, so they have to be stored again. */
+  array_store_compact_push(us->data, us->step.prev);
+#endif
 
   print_nodes(*CTX_data_active_object(C), nullptr);
 }
@@ -1995,6 +2270,9 @@ static void step_decode(
 static void step_free(UndoStep *us_p)
 {
   SculptUndoStep *us = (SculptUndoStep *)us_p;
+#ifdef USE_ARRAY_STORE
+  array_store_states_remove(us->data, false);
+#endif
   free_step_data(us->data);
 }
 
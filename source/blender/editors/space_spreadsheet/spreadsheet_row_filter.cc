@@ -33,6 +33,15 @@ static IndexMask apply_filter_operation(const VArray<T> &data,
                                         const IndexMask &mask,
                                         IndexMaskMemory &memory)
 {
+  /* Most columns are stored attributes, avoid the virtual function call per row for those. */
+  if (data.is_span()) {
+    const Span<T> values = data.get_internal_span();
+    return IndexMask::from_predicate(
+        mask, GrainSize(4096), memory, [&](const int64_t i) { return check_fn(values[i]); });
+  }
+  if (data.is_single()) {
+    return check_fn(data.get_internal_single()) ? mask : IndexMask();
+  }
   return IndexMask::from_predicate(
       mask, GrainSize(1024), memory, [&](const int64_t i) { return check_fn(data[i]); });
 }
@@ -11,6 +11,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
 #include "BLI_bitmap.h"
 #include "BLI_linklist_stack.h"
 #include "BLI_math_geom.h"
@@ -18,6 +19,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_context.hh"
@@ -953,7 +955,7 @@ static bool bmesh_test_dist_add(BMVert *v0,
                                 BMVert *v2,
                                 float *dists, /* Optionally track original index. */
                                 int *index,
-                                const float mtx[3][3])
+                                const Span<float3> positions)
 {
   if ((BM_elem_flag_test(v0, BM_ELEM_SELECT) == 0) && (BM_elem_flag_test(v0, BM_ELEM_HIDDEN) == 0))
   {
@@ -975,20 +977,12 @@ static bool bmesh_test_dist_add(BMVert *v0,
         return false;
       }
 
-      float vm0[3], vm1[3], vm2[3];
-      mul_v3_m3v3(vm0, mtx, v0->co);
-      mul_v3_m3v3(vm1, mtx, v1->co);
-      mul_v3_m3v3(vm2, mtx, v2->co);
-
-      dist0 = geodesic_distance_propagate_across_triangle(vm0, vm1, vm2, dists[i1], dists[i2]);
+      dist0 = geodesic_distance_propagate_across_triangle(
+          positions[i0], positions[i1], positions[i2], dists[i1], dists[i2]);
     }
     else {
       /* Distance along edge. */
-      float vec[3];
-      sub_v3_v3v3(vec, v1->co, v0->co);
-      mul_m3_v3(mtx, vec);
-
-      dist0 = dists[i1] + len_v3(vec);
+      dist0 = dists[i1] + math::distance(positions[i0], positions[i1]);
     }
 
     if (dist0 < dists[i0]) {
@@ -1037,32 +1031,31 @@ void transform_convert_mesh_connectivity_distance(BMesh *bm,
   BLI_LINKSTACK_INIT(queue);
   BLI_LINKSTACK_INIT(queue_next);
 
+  /* Positions in the space distances are measured in, transformed once up-front since every
+   * vertex is visited many times while distances propagate. */
+  Array<float3> positions(bm->totvert);
+
   {
     /* Set indexes and initial distances for selected vertices. */
-    BMIter viter;
-    BMVert *v;
-    int i;
+    BM_mesh_elem_index_ensure(bm, BM_VERT);
+    BM_mesh_elem_table_ensure(bm, BM_VERT);
 
-    BM_ITER_MESH_INDEX (v, &viter, bm, BM_VERTS_OF_MESH, i) {
-      float dist;
-      BM_elem_index_set(v, i); /* set_inline */
+    threading::parallel_for(IndexRange(bm->totvert), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        const BMVert *v = BM_vert_at_index(bm, i);
+        mul_v3_m3v3(positions[i], mtx, v->co);
 
-      if (BM_elem_flag_test(v, BM_ELEM_SELECT) == 0 || BM_elem_flag_test(v, BM_ELEM_HIDDEN)) {
-        dist = FLT_MAX;
-        if (index != nullptr) {
-          index[i] = i;
+        if (BM_elem_flag_test(v, BM_ELEM_SELECT) == 0 || BM_elem_flag_test(v, BM_ELEM_HIDDEN)) {
+          dists[i] = FLT_MAX;
+        }
+        else {
+          dists[i] = 0.0f;
         }
-      }
-      else {
-        dist = 0.0f;
         if (index != nullptr) {
           index[i] = i;
         }
       }
-
-      dists[i] = dist;
-    }
-    bm->elem_index_dirty &= ~BM_VERT;
+    });
   }
 
   {
@@ -1107,7 +1100,7 @@ void transform_convert_mesh_connectivity_distance(BMesh *bm,
           std::swap(v1, v2);
         }
 
-        if (bmesh_test_dist_add(v2, v1, nullptr, dists, index, mtx)) {
+        if (bmesh_test_dist_add(v2, v1, nullptr, dists, index, positions)) {
           /* Add adjacent loose edges to the queue, or all edges if this is a loose edge.
            * Other edges are handled by propagation across edges below. */
           BMEdge *e_other;
@@ -1138,7 +1131,7 @@ void transform_convert_mesh_connectivity_distance(BMesh *bm,
             BMVert *v_other = l_other->v;
             BLI_assert(!ELEM(v_other, v1, v2));
 
-            if (bmesh_test_dist_add(v_other, v1, v2, dists, index, mtx)) {
+            if (bmesh_test_dist_add(v_other, v1, v2, dists, index, positions)) {
               /* Add adjacent edges to the queue, if they are ready to propagate across/along.
                * Always propagate along loose edges, and for other edges only propagate across
                * if both vertices have a known distances. */
@@ -1491,7 +1484,6 @@ static void VertsToTransData(TransInfo *t,
 static void createTransEditVerts(bContext * /*C*/, TransInfo *t)
 {
   FOREACH_TRANS_DATA_CONTAINER (t, tc) {
-    TransDataExtension *tx = nullptr;
     BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
     Mesh *mesh = static_cast<Mesh *>(tc->obedit->data);
     BMesh *bm = em->bm;
@@ -1623,87 +1615,108 @@ static void createTransEditVerts(bContext * /*C*/, TransInfo *t)
        * but this stores loads of extra stuff, for TFM_SHRINKFATTEN its even more overkill
        * since we may not use the 'alt' transform mode to maintain shell thickness,
        * but with generic transform code its hard to lazy init variables. */
-      tx = tc->data_ext = static_cast<TransDataExtension *>(
+      tc->data_ext = static_cast<TransDataExtension *>(
           MEM_callocN(tc->data_len * sizeof(TransDataExtension), "TransObData ext"));
     }
 
-    TransData *tob = tc->data;
-    TransDataMirror *td_mirror = tc->data_mirror;
-    BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, a) {
-      if (BM_elem_flag_test(eve, BM_ELEM_HIDDEN)) {
-        continue;
-      }
-
-      int island_index = -1;
-      if (island_data.island_vert_map) {
-        const int connected_index = (dists_index && dists_index[a] != -1) ? dists_index[a] : a;
-        island_index = island_data.island_vert_map[connected_index];
+    /* Assign the output slots serially so the elements can be filled in parallel. */
+    Array<int> data_index(bm->totvert, -1);
+    Array<int> mirror_index(bm->totvert, -1);
+    {
+      int data_offset = 0;
+      int mirror_offset = 0;
+      BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, a) {
+        if (BM_elem_flag_test(eve, BM_ELEM_HIDDEN)) {
+          continue;
+        }
+        if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
+          mirror_index[a] = mirror_offset++;
+        }
+        else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+          data_index[a] = data_offset++;
+        }
       }
+      BLI_assert(data_offset == tc->data_len);
+      BLI_assert(mirror_offset == tc->data_mirror_len);
+    }
 
-      if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
-        int elem_index = mirror_data.vert_map[a].index;
-        BMVert *v_src = BM_vert_at_index(bm, elem_index);
-
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          mirror_data.vert_map[a].flag |= TD_SELECTED;
+    BM_mesh_elem_table_ensure(bm, BM_VERT);
+    threading::parallel_for(IndexRange(bm->totvert), 1024, [&](const IndexRange range) {
+      for (const int a : range) {
+        BMVert *eve = BM_vert_at_index(bm, a);
+        if (data_index[a] == -1 && mirror_index[a] == -1) {
+          continue;
         }
 
-        td_mirror->extra = eve;
-        td_mirror->loc = eve->co;
-        copy_v3_v3(td_mirror->iloc, eve->co);
-        td_mirror->flag = mirror_data.vert_map[a].flag;
-        td_mirror->loc_src = v_src->co;
-        mesh_transdata_center_copy(&island_data, island_index, td_mirror->iloc, td_mirror->center);
-
-        td_mirror++;
-      }
-      else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-        /* Do not use the island center in case we are using islands
-         * only to get axis for snap/rotate to normal... */
-        VertsToTransData(t, tob, tx, em, eve, &island_data, island_index);
-        if (tx) {
-          tx++;
+        int island_index = -1;
+        if (island_data.island_vert_map) {
+          const int connected_index = (dists_index && dists_index[a] != -1) ? dists_index[a] : a;
+          island_index = island_data.island_vert_map[connected_index];
         }
 
-        /* Selected. */
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          tob->flag |= TD_SELECTED;
-        }
+        if (mirror_index[a] != -1) {
+          TransDataMirror *td_mirror = &tc->data_mirror[mirror_index[a]];
+          int elem_index = mirror_data.vert_map[a].index;
+          BMVert *v_src = BM_vert_at_index(bm, elem_index);
 
-        if (prop_mode) {
-          if (prop_mode & T_PROP_CONNECTED) {
-            tob->dist = dists[a];
-          }
-          else {
-            tob->dist = FLT_MAX;
+          if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+            mirror_data.vert_map[a].flag |= TD_SELECTED;
           }
+
+          td_mirror->extra = eve;
+          td_mirror->loc = eve->co;
+          copy_v3_v3(td_mirror->iloc, eve->co);
+          td_mirror->flag = mirror_data.vert_map[a].flag;
+          td_mirror->loc_src = v_src->co;
+          mesh_transdata_center_copy(
+              &island_data, island_index, td_mirror->iloc, td_mirror->center);
         }
+        else {
+          TransData *tob = &tc->data[data_index[a]];
+          TransDataExtension *tx = tc->data_ext ? &tc->data_ext[data_index[a]] : nullptr;
 
-        /* CrazySpace. */
-        transform_convert_mesh_crazyspace_transdata_set(
-            mtx,
-            smtx,
-            !crazyspace_data.defmats.is_empty() ? crazyspace_data.defmats[a].ptr() : nullptr,
-            crazyspace_data.quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
-                crazyspace_data.quats[a] :
-                nullptr,
-            tob);
+          /* Do not use the island center in case we are using islands
+           * only to get axis for snap/rotate to normal... */
+          VertsToTransData(t, tob, tx, em, eve, &island_data, island_index);
 
-        if (tc->use_mirror_axis_any) {
-          if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_X;
+          /* Selected. */
+          if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+            tob->flag |= TD_SELECTED;
           }
-          if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Y;
+
+          if (prop_mode) {
+            if (prop_mode & T_PROP_CONNECTED) {
+              tob->dist = dists[a];
+            }
+            else {
+              tob->dist = FLT_MAX;
+            }
           }
-          if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Z;
+
+          /* CrazySpace. */
+          transform_convert_mesh_crazyspace_transdata_set(
+              mtx,
+              smtx,
+              !crazyspace_data.defmats.is_empty() ? crazyspace_data.defmats[a].ptr() : nullptr,
+              crazyspace_data.quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
+                  crazyspace_data.quats[a] :
+                  nullptr,
+              tob);
+
+          if (tc->use_mirror_axis_any) {
+            if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
+              tob->flag |= TD_MIRROR_EDGE_X;
+            }
+            if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
+              tob->flag |= TD_MIRROR_EDGE_Y;
+            }
+            if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
+              tob->flag |= TD_MIRROR_EDGE_Z;
+            }
           }
         }
-
-        tob++;
       }
-    }
+    });
 
     transform_convert_mesh_islanddata_free(&island_data);
     transform_convert_mesh_mirrordata_free(&mirror_data);
@@ -457,17 +457,31 @@ static bool snap_object_is_snappable(const SnapObjectContext *sctx,
   return true;
 }
 
-/**
- * Walks through all objects in the scene to create the list of objects to snap.
- */
-static eSnapMode iter_snap_objects(SnapObjectContext *sctx, IterSnapObjsCallback sob_callback)
+static void snap_object_candidates_ensure(SnapObjectContext *sctx)
 {
-  eSnapMode ret = SCE_SNAP_TO_NONE;
-  eSnapMode tmp;
-
-  Scene *scene = DEG_get_input_scene(sctx->runtime.depsgraph);
-  ViewLayer *view_layer = DEG_get_input_view_layer(sctx->runtime.depsgraph);
+  Depsgraph *depsgraph = sctx->runtime.depsgraph;
   const eSnapTargetOP snap_target_select = sctx->runtime.params.snap_target_select;
+  const eSnapEditType edit_mode_type = sctx->runtime.params.edit_mode_type;
+  const uint64_t update_count = DEG_get_update_count(depsgraph);
+
+  auto &cache = sctx->object_cache;
+  if (cache.is_valid && cache.depsgraph == depsgraph && cache.v3d == sctx->runtime.v3d &&
+      cache.update_count == update_count && cache.snap_target_select == snap_target_select &&
+      cache.edit_mode_type == edit_mode_type)
+  {
+    return;
+  }
+
+  cache.candidates.clear();
+  cache.depsgraph = depsgraph;
+  cache.v3d = sctx->runtime.v3d;
+  cache.update_count = update_count;
+  cache.snap_target_select = snap_target_select;
+  cache.edit_mode_type = edit_mode_type;
+  cache.is_valid = true;
+
+  Scene *scene = DEG_get_input_scene(depsgraph);
+  ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
   BKE_view_layer_synced_ensure(scene, view_layer);
   Base *base_act = BKE_view_layer_active_base_get(view_layer);
 
@@ -477,31 +491,45 @@ static eSnapMode iter_snap_objects(SnapObjectContext *sctx, IterSnapObjsCallback
     }
 
     const bool is_object_active = (base == base_act);
-    Object *obj_eval = DEG_get_evaluated_object(sctx->runtime.depsgraph, base->object);
+    Object *obj_eval = DEG_get_evaluated_object(depsgraph, base->object);
     if (obj_eval->transflag & OB_DUPLI ||
         blender::bke::object_has_geometry_set_instances(*obj_eval))
     {
-      ListBase *lb = object_duplilist(sctx->runtime.depsgraph, sctx->scene, obj_eval);
+      ListBase *lb = object_duplilist(depsgraph, sctx->scene, obj_eval);
       LISTBASE_FOREACH (DupliObject *, dupli_ob, lb) {
         BLI_assert(DEG_is_evaluated_object(dupli_ob->ob));
-        if ((tmp = sob_callback(sctx,
-                                dupli_ob->ob,
-                                dupli_ob->ob_data,
-                                float4x4(dupli_ob->mat),
-                                is_object_active,
-                                false)) != SCE_SNAP_TO_NONE)
-        {
-          ret = tmp;
-        }
+        cache.candidates.append(
+            {dupli_ob->ob, dupli_ob->ob_data, float4x4(dupli_ob->mat), is_object_active, false});
       }
       free_object_duplilist(lb);
     }
 
     bool use_hide = false;
-    ID *ob_data = data_for_snap(obj_eval, sctx->runtime.params.edit_mode_type, &use_hide);
-    if ((tmp = sob_callback(
-             sctx, obj_eval, ob_data, obj_eval->object_to_world(), is_object_active, use_hide)) !=
-        SCE_SNAP_TO_NONE)
+    ID *ob_data = data_for_snap(obj_eval, edit_mode_type, &use_hide);
+    cache.candidates.append(
+        {obj_eval, ob_data, obj_eval->object_to_world(), is_object_active, use_hide});
+  }
+}
+
+/**
+ * Walks through all objects in the scene to create the list of objects to snap.
+ */
+static eSnapMode iter_snap_objects(SnapObjectContext *sctx, IterSnapObjsCallback sob_callback)
+{
+  eSnapMode ret = SCE_SNAP_TO_NONE;
+  eSnapMode tmp;
+
+  snap_object_candidates_ensure(sctx);
+
+  for (const SnapObjectContext::SnapObjectCandidate &candidate :
+       sctx->object_cache.candidates)
+  {
+    if ((tmp = sob_callback(sctx,
+                            candidate.ob_eval,
+                            candidate.ob_data,
+                            candidate.obmat,
+                            candidate.is_object_active,
+                            candidate.use_hide)) != SCE_SNAP_TO_NONE)
     {
       ret = tmp;
     }
@@ -10,6 +10,7 @@
 
 #include "BLI_map.hh"
 #include "BLI_math_geom.h"
+#include "BLI_vector.hh"
 
 #define MAX_CLIPPLANE_LEN 6
 
@@ -25,6 +26,28 @@ struct SnapObjectContext {
   };
   blender::Map<const ID *, std::unique_ptr<SnapCache>> editmesh_caches;
 
+  /**
+   * Objects (including dupli-instances) that pass the snap target filter. Building this list
+   * expands every instancer in the view layer, so it is reused by every snap query until the
+   * depsgraph is evaluated again (projecting individual elements runs one query per element).
+   */
+  struct SnapObjectCandidate {
+    const Object *ob_eval;
+    const ID *ob_data;
+    blender::float4x4 obmat;
+    bool is_object_active;
+    bool use_hide;
+  };
+  struct {
+    blender::Vector<SnapObjectCandidate> candidates;
+    const Depsgraph *depsgraph;
+    const View3D *v3d;
+    uint64_t update_count;
+    eSnapTargetOP snap_target_select;
+    eSnapEditType edit_mode_type;
+    bool is_valid;
+  } object_cache;
+
   /* Filter data, returns true to check this value. */
   struct {
     struct {
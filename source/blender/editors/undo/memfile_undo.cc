@@ -85,7 +85,13 @@ static bool memfile_undosys_step_encode(bContext * /*C*/, Main *bmain, UndoStep
   MemFileUndoStep *us_prev = (MemFileUndoStep *)BKE_undosys_step_find_by_type(
       ustack, BKE_UNDOSYS_TYPE_MEMFILE);
   us->data = BKE_memfile_undo_encode(bmain, us_prev ? us_prev->data : nullptr);
+  /* Chunks are compared to the previous step in the background, so this is an upper bound until
+   * the next push, which updates the size of the previous step once it is known. */
   us->step.data_size = us->data->undo_size;
+  if (us_prev != nullptr && us_prev->data->undo_size != us_prev->data->memfile.size) {
+    us_prev->data->undo_size = us_prev->data->memfile.size;
+    us_prev->step.data_size = us_prev->data->undo_size;
+  }
 
   /* Store the fact that we should not re-use old data with that undo step, and reset the Main
    * flag. */
@@ -32,6 +32,8 @@
  * 3. Override the `call` function.
  */
 
+#include <limits>
+
 #include "BLI_hash.hh"
 
 #include "FN_multi_function_context.hh"
@@ -119,6 +121,12 @@ class MultiFunction : NonCopyable, NonMovable {
      * educated guess about a good grain size.
      */
     bool uniform_execution_time = true;
+    /**
+     * Largest number of indices that should be processed at once. Multi-functions that compute
+     * many intermediate arrays (like procedures) are faster when they are called with chunks
+     * that are small enough for the intermediate arrays to stay in the CPU cache.
+     */
+    int64_t max_chunk_size = std::numeric_limits<int64_t>::max();
   };
 
   ExecutionHints execution_hints() const;
@@ -14,11 +14,13 @@
  */
 
 #include <mutex>
+#include <optional>
 #include <variant>
 
 #include "BLI_generic_pointer.hh"
 #include "BLI_generic_vector_array.hh"
 #include "BLI_generic_virtual_vector_array.hh"
+#include "BLI_memory_utils.hh"
 #include "BLI_resource_scope.hh"
 
 #include "FN_multi_function_signature.hh"
@@ -27,7 +29,13 @@ namespace blender::fn::multi_function {
 
 class ParamsBuilder {
  private:
-  std::unique_ptr<ResourceScope> scope_;
+  /**
+   * Memory used by #scope_ before it allocates. Most functions are called with few parameters that
+   * need temporary buffers (e.g. ignored outputs of single values) so this avoids allocations for
+   * the common case. Declared before the scope, because it has to outlive it.
+   */
+  AlignedBuffer<256, 8> scope_buffer_;
+  std::optional<ResourceScope> scope_;
   const Signature *signature_;
   const IndexMask &mask_;
   int64_t min_array_size_;
@@ -221,7 +229,8 @@ class ParamsBuilder {
   ResourceScope &resource_scope()
   {
     if (!scope_) {
-      scope_ = std::make_unique<ResourceScope>();
+      scope_.emplace();
+      scope_->linear_allocator().provide_buffer(scope_buffer_);
     }
     return *scope_;
   }
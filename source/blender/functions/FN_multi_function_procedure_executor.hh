@@ -17,6 +17,8 @@ class ProcedureExecutor : public MultiFunction {
  private:
   Signature signature_;
   const Procedure &procedure_;
+  /** See #ExecutionHints::max_chunk_size. */
+  int64_t max_chunk_size_;
 
  public:
   ProcedureExecutor(const Procedure &procedure);
@@ -140,17 +140,96 @@ static Set<GFieldRef> find_varying_fields(const FieldTreeInfo &field_tree_info,
   return found_fields;
 }
 
+/**
+ * Identifies a function call in the procedure. Calling the same function with the same input
+ * variables again always gives the same result, so the second call can be skipped.
+ */
+struct CallKey {
+  const mf::MultiFunction *fn;
+  Vector<const mf::Variable *, 8> inputs;
+
+  uint64_t hash() const
+  {
+    uint64_t hash = get_default_hash(fn);
+    for (const mf::Variable *variable : inputs) {
+      hash = hash * 33 ^ get_default_hash(variable);
+    }
+    return hash;
+  }
+
+  BLI_STRUCT_EQUALITY_OPERATORS_2(CallKey, fn, inputs)
+};
+
+/**
+ * Identifies a constant value, so that equal constants that are used by different operations share
+ * the same variable. This allows deduplicating the operations that use them.
+ */
+struct ConstantKey {
+  const CPPType *type;
+  const void *value;
+
+  uint64_t hash() const
+  {
+    return type->hash_or_fallback(value, get_default_hash(value));
+  }
+
+  friend bool operator==(const ConstantKey &a, const ConstantKey &b)
+  {
+    if (a.type != b.type) {
+      return false;
+    }
+    return a.value == b.value || a.type->is_equal_or_false(a.value, b.value);
+  }
+};
+
+/**
+ * Use the variables that were computed by an equivalent call for the outputs of the given
+ * operation. This is not possible when the other call ignored an output that is used now.
+ */
+static bool try_reuse_call_outputs(const FieldOperation &operation,
+                                   const Span<mf::Variable *> existing_outputs,
+                                   const FieldTreeInfo &field_tree_info,
+                                   const Span<GFieldRef> output_fields,
+                                   Map<GFieldRef, mf::Variable *> &variable_by_field)
+{
+  for (const int output_index : existing_outputs.index_range()) {
+    if (existing_outputs[output_index] != nullptr) {
+      continue;
+    }
+    const GFieldRef output_field{operation, output_index};
+    if (!field_tree_info.field_users.lookup(output_field).is_empty() ||
+        output_fields.contains(output_field))
+    {
+      return false;
+    }
+  }
+  for (const int output_index : existing_outputs.index_range()) {
+    if (mf::Variable *variable = existing_outputs[output_index]) {
+      variable_by_field.add_new({operation, output_index}, variable);
+    }
+  }
+  return true;
+}
+
 /**
  * Builds the #procedure so that it computes the fields.
+ *
+ * \param folded_fields: Fields that have been evaluated already. Their values are passed into the
+ * procedure as parameters after the field inputs.
  */
 static void build_multi_function_procedure_for_fields(mf::Procedure &procedure,
                                                       ResourceScope &scope,
                                                       const FieldTreeInfo &field_tree_info,
-                                                      Span<GFieldRef> output_fields)
+                                                      Span<GFieldRef> output_fields,
+                                                      Span<GFieldRef> folded_fields = {})
 {
   mf::ProcedureBuilder builder{procedure};
   /* Every input, intermediate and output field corresponds to a variable in the procedure. */
   Map<GFieldRef, mf::Variable *> variable_by_field;
+  /* Different fields can compute the same thing, e.g. when the same math is done by multiple
+   * nodes. Those fields share the same variables. */
+  Map<CallKey, Vector<mf::Variable *>> output_variables_by_call;
+  Map<ConstantKey, mf::Variable *> variable_by_constant;
 
   /* Start by adding the field inputs as parameters to the procedure. */
   for (const FieldInput &field_input : field_tree_info.deduplicated_field_inputs) {
@@ -158,6 +237,11 @@ static void build_multi_function_procedure_for_fields(mf::Procedure &procedure,
         mf::DataType::ForSingle(field_input.cpp_type()), field_input.debug_name());
     variable_by_field.add_new({field_input, 0}, &variable);
   }
+  for (const GFieldRef &field : folded_fields) {
+    mf::Variable &variable = builder.add_input_parameter(
+        mf::DataType::ForSingle(field.cpp_type()), "Folded");
+    variable_by_field.add_new(field, &variable);
+  }
 
   /* Utility struct that is used to do proper depth first search traversal of the tree below. */
   struct FieldWithIndex {
@@ -198,6 +282,24 @@ static void build_multi_function_procedure_for_fields(mf::Procedure &procedure,
             /* All inputs variables are ready, now gather all variables that are used by the
              * function and call it. */
             const mf::MultiFunction &multi_function = operation_node.multi_function();
+
+            CallKey call_key{&multi_function, {}};
+            for (const GField &input_field : operation_inputs) {
+              call_key.inputs.append(variable_by_field.lookup(input_field));
+            }
+            if (const Vector<mf::Variable *> *existing_outputs =
+                    output_variables_by_call.lookup_ptr(call_key))
+            {
+              if (try_reuse_call_outputs(operation_node,
+                                         *existing_outputs,
+                                         field_tree_info,
+                                         output_fields,
+                                         variable_by_field))
+              {
+                break;
+              }
+            }
+
             Vector<mf::Variable *> variables(multi_function.param_amount());
 
             int param_input_index = 0;
@@ -232,15 +334,29 @@ static void build_multi_function_procedure_for_fields(mf::Procedure &procedure,
               }
             }
             builder.add_call_with_all_variables(multi_function, variables);
+
+            Vector<mf::Variable *> output_variables;
+            for (const int param_index : multi_function.param_indices()) {
+              if (multi_function.param_type(param_index).interface_type() ==
+                  mf::ParamType::Output)
+              {
+                output_variables.append(variables[param_index]);
+              }
+            }
+            output_variables_by_call.add(std::move(call_key), std::move(output_variables));
           }
           break;
         }
         case FieldNodeType::Constant: {
           const FieldConstant &constant_node = static_cast<const FieldConstant &>(field_node);
-          const mf::MultiFunction &fn = procedure.construct_function<mf::CustomMF_GenericConstant>(
-              constant_node.type(), constant_node.value().get(), false);
-          mf::Variable &new_variable = *builder.add_call<1>(fn)[0];
-          variable_by_field.add_new(field, &new_variable);
+          const ConstantKey constant_key{&constant_node.type(), constant_node.value().get()};
+          mf::Variable *variable = variable_by_constant.lookup_or_add_cb(constant_key, [&]() {
+            const mf::MultiFunction &fn =
+                procedure.construct_function<mf::CustomMF_GenericConstant>(
+                    constant_node.type(), constant_node.value().get(), false);
+            return builder.add_call<1>(fn)[0];
+          });
+          variable_by_field.add_new(field, variable);
           break;
         }
       }
@@ -261,13 +377,13 @@ static void build_multi_function_procedure_for_fields(mf::Procedure &procedure,
     builder.add_output_parameter(*variable);
   }
 
-  /* Remove the variables that should not be destructed from the map. */
-  for (const GFieldRef &field : output_fields) {
-    variable_by_field.remove(field);
-  }
-  /* Add destructor calls for the remaining variables. */
+  /* Add destructor calls for the remaining variables. Since multiple fields may share the same
+   * variable, make sure that every variable is only destructed once. */
+  Set<mf::Variable *> handled_variables = std::move(already_output_variables);
   for (mf::Variable *variable : variable_by_field.values()) {
-    builder.add_destruct(*variable);
+    if (handled_variables.add(variable)) {
+      builder.add_destruct(*variable);
+    }
   }
 
   mf::ReturnInstruction &return_instr = builder.add_return();
@@ -365,12 +481,83 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
     }
   }
 
+  /* Operations that don't depend on varying inputs but are used by varying fields are evaluated
+   * only once upfront. Otherwise, they would be evaluated again for every chunk of indices that
+   * the procedure is executed with. */
+  VectorSet<GFieldRef> folded_fields;
+  for (const GFieldRef &field : varying_fields) {
+    if (field.node().node_type() != FieldNodeType::Operation) {
+      continue;
+    }
+    const FieldOperation &operation = static_cast<const FieldOperation &>(field.node());
+    for (const GFieldRef input_field : operation.inputs()) {
+      if (input_field.node().node_type() == FieldNodeType::Operation &&
+          !varying_fields.contains(input_field))
+      {
+        folded_fields.add(input_field);
+      }
+    }
+  }
+  Vector<GVArray> folded_varrays;
+
+  /* Evaluate constant fields if necessary. */
+  if (!constant_fields_to_evaluate.is_empty() || !folded_fields.is_empty()) {
+    Vector<GFieldRef> fields_to_evaluate_once = constant_fields_to_evaluate;
+    for (const GFieldRef &field : folded_fields) {
+      if (!constant_fields_to_evaluate.contains(field)) {
+        fields_to_evaluate_once.append(field);
+      }
+    }
+
+    /* Build the procedure for those fields. */
+    mf::Procedure procedure;
+    build_multi_function_procedure_for_fields(
+        procedure, scope, field_tree_info, fields_to_evaluate_once);
+    mf::ProcedureExecutor procedure_executor{procedure};
+    const IndexMask mask(1);
+    mf::ParamsBuilder mf_params{procedure_executor, &mask};
+    mf::ContextBuilder mf_context;
+
+    /* Provide inputs to the procedure executor. */
+    for (const GVArray &varray : field_context_inputs) {
+      mf_params.add_readonly_single_input(varray);
+    }
+
+    Map<GFieldRef, GVArray> varray_by_field;
+    for (const GFieldRef &field : fields_to_evaluate_once) {
+      const CPPType &type = field.cpp_type();
+      /* Allocate memory where the computed value will be stored in. */
+      void *buffer = scope.linear_allocator().allocate(type.size(), type.alignment());
+
+      if (!type.is_trivially_destructible()) {
+        /* Destruct value in the end. */
+        scope.add_destruct_call([buffer, &type]() { type.destruct(buffer); });
+      }
+
+      /* Pass output buffer to the procedure executor. */
+      mf_params.add_uninitialized_single_output({type, buffer, 1});
+
+      /* Create virtual array that can be used after the procedure has been executed below. */
+      varray_by_field.add(field, GVArray::ForSingleRef(type, array_size, buffer));
+    }
+
+    procedure_executor.call(mask, mf_params, mf_context);
+
+    for (const int i : constant_fields_to_evaluate.index_range()) {
+      const int out_index = constant_field_indices[i];
+      r_varrays[out_index] = varray_by_field.lookup(constant_fields_to_evaluate[i]);
+    }
+    for (const GFieldRef &field : folded_fields) {
+      folded_varrays.append(varray_by_field.lookup(field));
+    }
+  }
+
   /* Evaluate varying fields if necessary. */
   if (!varying_fields_to_evaluate.is_empty()) {
     /* Build the procedure for those fields. */
     mf::Procedure procedure;
     build_multi_function_procedure_for_fields(
-        procedure, scope, field_tree_info, varying_fields_to_evaluate);
+        procedure, scope, field_tree_info, varying_fields_to_evaluate, folded_fields);
     mf::ProcedureExecutor procedure_executor{procedure};
 
     mf::ParamsBuilder mf_params{procedure_executor, &mask};
@@ -380,6 +567,9 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
     for (const GVArray &varray : field_context_inputs) {
       mf_params.add_readonly_single_input(varray);
     }
+    for (const GVArray &varray : folded_varrays) {
+      mf_params.add_readonly_single_input(varray);
+    }
 
     for (const int i : varying_fields_to_evaluate.index_range()) {
       const GFieldRef &field = varying_fields_to_evaluate[i];
@@ -417,44 +607,6 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
     procedure_executor.call_auto(mask, mf_params, mf_context);
   }
 
-  /* Evaluate constant fields if necessary. */
-  if (!constant_fields_to_evaluate.is_empty()) {
-    /* Build the procedure for those fields. */
-    mf::Procedure procedure;
-    build_multi_function_procedure_for_fields(
-        procedure, scope, field_tree_info, constant_fields_to_evaluate);
-    mf::ProcedureExecutor procedure_executor{procedure};
-    const IndexMask mask(1);
-    mf::ParamsBuilder mf_params{procedure_executor, &mask};
-    mf::ContextBuilder mf_context;
-
-    /* Provide inputs to the procedure executor. */
-    for (const GVArray &varray : field_context_inputs) {
-      mf_params.add_readonly_single_input(varray);
-    }
-
-    for (const int i : constant_fields_to_evaluate.index_range()) {
-      const GFieldRef &field = constant_fields_to_evaluate[i];
-      const CPPType &type = field.cpp_type();
-      /* Allocate memory where the computed value will be stored in. */
-      void *buffer = scope.linear_allocator().allocate(type.size(), type.alignment());
-
-      if (!type.is_trivially_destructible()) {
-        /* Destruct value in the end. */
-        scope.add_destruct_call([buffer, &type]() { type.destruct(buffer); });
-      }
-
-      /* Pass output buffer to the procedure executor. */
-      mf_params.add_uninitialized_single_output({type, buffer, 1});
-
-      /* Create virtual array that can be used after the procedure has been executed below. */
-      const int out_index = constant_field_indices[i];
-      r_varrays[out_index] = GVArray::ForSingleRef(type, array_size, buffer);
-    }
-
-    procedure_executor.call(mask, mf_params, mf_context);
-  }
-
   /* Copy data to supplied destination arrays if necessary. In some cases the evaluation above
    * has written the computed data in the right place already. */
   if (!dst_varrays.is_empty()) {
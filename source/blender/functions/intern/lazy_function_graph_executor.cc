@@ -1122,60 +1122,85 @@ class Executor {
     }
 
     const Span<const InputSocket *> targets = from_socket.targets();
-    for (const InputSocket *target_socket : targets) {
-      const Node &target_node = target_socket->node();
+    for (int64_t target_i = 0; target_i < targets.size();) {
+      const InputSocket &first_target_socket = *targets[target_i];
+      const Node &target_node = first_target_socket.node();
       NodeState &node_state = *node_states_[target_node.index_in_graph()];
-      const int input_index = target_socket->index();
-      InputState &input_state = node_state.inputs[input_index];
-      const bool is_last_target = target_socket == targets.last();
+
+      /* Links to multiple inputs of the same node are handled together, so that the node only has
+       * to be locked once. */
+      int64_t targets_in_node_num = 1;
+      while (target_i + targets_in_node_num < targets.size() &&
+             &targets[target_i + targets_in_node_num]->node() == &target_node)
+      {
+        targets_in_node_num++;
+      }
+      const Span<const InputSocket *> node_targets = targets.slice(target_i,
+                                                                   targets_in_node_num);
+      target_i += targets_in_node_num;
+      const bool has_last_target = target_i == targets.size();
+
+      for (const InputSocket *target_socket : node_targets) {
+        const InputState &input_state = node_state.inputs[target_socket->index()];
 #ifndef NDEBUG
-      if (input_state.value != nullptr) {
-        if (self_.logger_ != nullptr) {
-          self_.logger_->dump_when_input_is_set_twice(*target_socket, from_socket, local_context);
+        if (input_state.value != nullptr) {
+          if (self_.logger_ != nullptr) {
+            self_.logger_->dump_when_input_is_set_twice(
+                *target_socket, from_socket, local_context);
+          }
+          BLI_assert_unreachable();
         }
-        BLI_assert_unreachable();
-      }
 #endif
-      BLI_assert(!input_state.was_ready_for_execution);
-      BLI_assert(target_socket->type() == type);
-      BLI_assert(target_socket->origin() == &from_socket);
+        BLI_assert(!input_state.was_ready_for_execution);
+        BLI_assert(target_socket->type() == type);
+        BLI_assert(target_socket->origin() == &from_socket);
+        UNUSED_VARS_NDEBUG(input_state);
 
-      if (self_.logger_ != nullptr) {
-        self_.logger_->log_socket_value(*target_socket, value_to_forward, local_context);
+        if (self_.logger_ != nullptr) {
+          self_.logger_->log_socket_value(*target_socket, value_to_forward, local_context);
+        }
       }
+
       if (target_node.is_interface()) {
         /* Forward the value to the outside of the graph. */
-        const int graph_output_index =
-            self_.graph_output_index_by_socket_index_[target_socket->index()];
-        if (graph_output_index != -1 &&
-            params_->get_output_usage(graph_output_index) != ValueUsage::Unused)
-        {
-          void *dst_buffer = params_->get_output_data_ptr(graph_output_index);
-          if (is_last_target) {
-            type.move_construct(value_to_forward.get(), dst_buffer);
-          }
-          else {
-            type.copy_construct(value_to_forward.get(), dst_buffer);
+        for (const InputSocket *target_socket : node_targets) {
+          const bool is_last_target = has_last_target && target_socket == node_targets.last();
+          const int graph_output_index =
+              self_.graph_output_index_by_socket_index_[target_socket->index()];
+          if (graph_output_index != -1 &&
+              params_->get_output_usage(graph_output_index) != ValueUsage::Unused)
+          {
+            void *dst_buffer = params_->get_output_data_ptr(graph_output_index);
+            if (is_last_target) {
+              type.move_construct(value_to_forward.get(), dst_buffer);
+            }
+            else {
+              type.copy_construct(value_to_forward.get(), dst_buffer);
+            }
+            params_->output_set(graph_output_index);
           }
-          params_->output_set(graph_output_index);
         }
         continue;
       }
       this->with_locked_node(
           target_node, node_state, current_task, local_data, [&](LockedNode &locked_node) {
-            if (input_state.usage == ValueUsage::Unused) {
-              return;
-            }
-            if (is_last_target) {
-              /* No need to make a copy if this is the last target. */
-              this->forward_value_to_input(
-                  locked_node, input_state, value_to_forward, current_task);
-              value_to_forward = {};
-            }
-            else {
-              void *buffer = local_data.allocator->allocate(type.size(), type.alignment());
-              type.copy_construct(value_to_forward.get(), buffer);
-              this->forward_value_to_input(locked_node, input_state, {type, buffer}, current_task);
+            for (const InputSocket *target_socket : node_targets) {
+              InputState &input_state = node_state.inputs[target_socket->index()];
+              if (input_state.usage == ValueUsage::Unused) {
+                continue;
+              }
+              if (has_last_target && target_socket == node_targets.last()) {
+                /* No need to make a copy if this is the last target. */
+                this->forward_value_to_input(
+                    locked_node, input_state, value_to_forward, current_task);
+                value_to_forward = {};
+              }
+              else {
+                void *buffer = local_data.allocator->allocate(type.size(), type.alignment());
+                type.copy_construct(value_to_forward.get(), buffer);
+                this->forward_value_to_input(
+                    locked_node, input_state, {type, buffer}, current_task);
+              }
             }
           });
     }
@@ -113,6 +113,67 @@ static void add_sliced_parameters(const Signature &signature,
   }
 }
 
+/**
+ * Call the function for a slice of the mask. If the function allocates arrays for all indices, the
+ * indices are shifted so that those arrays don't have to be larger than the slice.
+ */
+static void call_slice(const MultiFunction &fn,
+                       const Signature &signature,
+                       const ExecutionHints &hints,
+                       const IndexMask &mask,
+                       const IndexRange sub_range,
+                       Params params,
+                       Context context)
+{
+  const IndexMask sliced_mask = mask.slice(sub_range);
+  if (!hints.allocates_array) {
+    /* There is no benefit to changing indices in this case. */
+    fn.call(sliced_mask, params, context);
+    return;
+  }
+  if (sliced_mask[0] < sub_range.size()) {
+    /* The indices are low, no need to offset them. */
+    fn.call(sliced_mask, params, context);
+    return;
+  }
+  const int64_t input_slice_start = sliced_mask[0];
+  const int64_t input_slice_size = sliced_mask.last() - input_slice_start + 1;
+  const IndexRange input_slice_range{input_slice_start, input_slice_size};
+
+  IndexMaskMemory memory;
+  const int64_t offset = -input_slice_start;
+  const IndexMask shifted_mask = mask.slice_and_shift(sub_range, offset, memory);
+
+  ParamsBuilder sliced_params{fn, &shifted_mask};
+  add_sliced_parameters(signature, params, input_slice_range, sliced_params);
+  fn.call(shifted_mask, sliced_params, context);
+}
+
+/**
+ * Process the range of the mask in chunks that are not larger than #ExecutionHints::max_chunk_size
+ * one after another. Compared to processing everything at once, this keeps intermediate data in
+ * the CPU cache.
+ */
+static void call_in_chunks(const MultiFunction &fn,
+                           const Signature &signature,
+                           const ExecutionHints &hints,
+                           const IndexMask &mask,
+                           const IndexRange range,
+                           Params params,
+                           Context context)
+{
+  if (range.size() <= hints.max_chunk_size) {
+    call_slice(fn, signature, hints, mask, range, params, context);
+    return;
+  }
+  for (int64_t start = range.start(); start < range.one_after_last();
+       start += hints.max_chunk_size)
+  {
+    const int64_t chunk_size = std::min(hints.max_chunk_size, range.one_after_last() - start);
+    call_slice(fn, signature, hints, mask, IndexRange(start, chunk_size), params, context);
+  }
+}
+
 void MultiFunction::call_auto(const IndexMask &mask, Params params, Context context) const
 {
   if (mask.is_empty()) {
@@ -121,42 +182,25 @@ void MultiFunction::call_auto(const IndexMask &mask, Params params, Context cont
   const ExecutionHints hints = this->execution_hints();
   const int64_t grain_size = compute_grain_size(hints, mask);
 
-  if (mask.size() <= grain_size) {
+  const bool supports_slicing = supports_threading_by_slicing_params(*this);
+  if (!supports_slicing) {
     this->call(mask, params, context);
     return;
   }
 
-  const bool supports_threading = supports_threading_by_slicing_params(*this);
-  if (!supports_threading) {
-    this->call(mask, params, context);
+  if (mask.size() <= grain_size) {
+    if (mask.size() <= hints.max_chunk_size) {
+      this->call(mask, params, context);
+      return;
+    }
+    call_in_chunks(*this, *signature_ref_, hints, mask, mask.index_range(), params, context);
     return;
   }
 
   const int64_t alignment = compute_alignment(grain_size);
   threading::parallel_for_aligned(
       mask.index_range(), grain_size, alignment, [&](const IndexRange sub_range) {
-        const IndexMask sliced_mask = mask.slice(sub_range);
-        if (!hints.allocates_array) {
-          /* There is no benefit to changing indices in this case. */
-          this->call(sliced_mask, params, context);
-          return;
-        }
-        if (sliced_mask[0] < grain_size) {
-          /* The indices are low, no need to offset them. */
-          this->call(sliced_mask, params, context);
-          return;
-        }
-        const int64_t input_slice_start = sliced_mask[0];
-        const int64_t input_slice_size = sliced_mask.last() - input_slice_start + 1;
-        const IndexRange input_slice_range{input_slice_start, input_slice_size};
-
-        IndexMaskMemory memory;
-        const int64_t offset = -input_slice_start;
-        const IndexMask shifted_mask = mask.slice_and_shift(sub_range, offset, memory);
-
-        ParamsBuilder sliced_params{*this, &shifted_mask};
-        add_sliced_parameters(*signature_ref_, params, input_slice_range, sliced_params);
-        this->call(shifted_mask, sliced_params, context);
+        call_in_chunks(*this, *signature_ref_, hints, mask, sub_range, params, context);
       });
 }
 
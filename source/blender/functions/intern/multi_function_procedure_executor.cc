@@ -17,6 +17,22 @@ ProcedureExecutor::ProcedureExecutor(const Procedure &procedure) : procedure_(pr
   }
 
   this->set_signature(&signature_);
+
+  /* Process the indices in chunks that are small enough so that all the variables of the
+   * procedure fit into the CPU cache at the same time. That way, a chain of instructions has
+   * almost the same memory access pattern as a single fused loop.
+   * The numbers are chosen to fit into the L2 cache of typical CPUs while still keeping the
+   * overhead of interpreting the instructions low. */
+  const int64_t cache_size = 256 * 1024;
+  const int64_t min_chunk_size = 1024;
+  int64_t bytes_per_index = 0;
+  for (const Variable *variable : procedure.variables()) {
+    const DataType data_type = variable->data_type();
+    if (data_type.is_single()) {
+      bytes_per_index += data_type.single_type().size();
+    }
+  }
+  max_chunk_size_ = std::max(min_chunk_size, cache_size / std::max<int64_t>(bytes_per_index, 1));
 }
 
 using IndicesSplitVectors = std::array<Vector<int64_t>, 2>;
@@ -1246,6 +1262,7 @@ MultiFunction::ExecutionHints ProcedureExecutor::get_execution_hints() const
   ExecutionHints hints;
   hints.allocates_array = true;
   hints.min_grain_size = 10000;
+  hints.max_chunk_size = max_chunk_size_;
   return hints;
 }
 
@@ -4,6 +4,8 @@
 
 #include "testing/testing.h"
 
+#include <atomic>
+
 #include "BLI_cpp_type.hh"
 #include "FN_field.hh"
 #include "FN_multi_function_builder.hh"
@@ -281,4 +283,32 @@ TEST(field, IgnoredOutput)
   EXPECT_EQ(results.get(3), 5);
 }
 
+TEST(field, SameOperationInDifferentFields)
+{
+  std::atomic<int> evaluations = 0;
+  auto double_fn = mf::build::SI1_SO<int, int>("double", [&](const int a) {
+    evaluations++;
+    return a * 2;
+  });
+  auto add_fn = mf::build::SI2_SO<int, int, int>("add", [](int a, int b) { return a + b; });
+
+  GField index_field{std::make_shared<IndexFieldInput>()};
+  /* Two separate operations that compute the same thing. */
+  GField double_field_1{FieldOperation::Create(double_fn, {index_field}), 0};
+  GField double_field_2{FieldOperation::Create(double_fn, {index_field}), 0};
+  Field<int> sum_field{FieldOperation::Create(add_fn, {double_field_1, double_field_2}), 0};
+
+  Array<int> result(4);
+  FieldContext context;
+  FieldEvaluator evaluator{context, 4};
+  evaluator.add_with_destination(sum_field, result.as_mutable_span());
+  evaluator.evaluate();
+
+  EXPECT_EQ(result[0], 0);
+  EXPECT_EQ(result[1], 4);
+  EXPECT_EQ(result[2], 8);
+  EXPECT_EQ(result[3], 12);
+  EXPECT_EQ(evaluations, 4);
+}
+
 }  // namespace blender::fn::tests
@@ -179,4 +179,37 @@ TEST(lazy_function, GraphWithCycle)
   EXPECT_EQ(result, 10 * 2 * 5);
 }
 
+TEST(lazy_function, OutputLinkedToSameNodeTwice)
+{
+  const AddLazyFunction add_fn;
+
+  Graph graph;
+  FunctionNode &add_node_1 = graph.add_function(add_fn);
+  FunctionNode &add_node_2 = graph.add_function(add_fn);
+
+  GraphInputSocket &input_socket = graph.add_input(CPPType::get<int>());
+  GraphOutputSocket &output_socket_1 = graph.add_output(CPPType::get<int>());
+  GraphOutputSocket &output_socket_2 = graph.add_output(CPPType::get<int>());
+
+  const int value_1 = 1;
+  graph.add_link(input_socket, add_node_1.input(0));
+  add_node_1.input(1).set_default_value(&value_1);
+  graph.add_link(add_node_1.output(0), add_node_2.input(0));
+  graph.add_link(add_node_1.output(0), add_node_2.input(1));
+  graph.add_link(add_node_1.output(0), output_socket_2);
+  graph.add_link(add_node_2.output(0), output_socket_1);
+
+  graph.update_node_indices();
+
+  GraphExecutor executor_fn{
+      graph, {&input_socket}, {&output_socket_1, &output_socket_2}, nullptr, nullptr, nullptr};
+  int result_1 = 0;
+  int result_2 = 0;
+  execute_lazy_function_eagerly(
+      executor_fn, nullptr, nullptr, std::make_tuple(4), std::make_tuple(&result_1, &result_2));
+
+  EXPECT_EQ(result_1, 10);
+  EXPECT_EQ(result_2, 5);
+}
+
 }  // namespace blender::fn::lazy_function::tests
@@ -60,6 +60,68 @@ TEST(multi_function, AddFunction)
   EXPECT_EQ(output[2], 36);
 }
 
+class ChunkedAddOneFunction : public MultiFunction {
+ public:
+  mutable int64_t max_array_size = 0;
+
+  ChunkedAddOneFunction()
+  {
+    static Signature signature = []() {
+      Signature signature;
+      SignatureBuilder builder("Add One", signature);
+      builder.single_input<int>("A");
+      builder.single_output<int>("Result");
+      return signature;
+    }();
+    this->set_signature(&signature);
+  }
+
+  void call(const IndexMask &mask, Params params, Context /*context*/) const override
+  {
+    const VArray<int> &a = params.readonly_single_input<int>(0, "A");
+    MutableSpan<int> result = params.uninitialized_single_output<int>(1, "Result");
+    max_array_size = std::max(max_array_size, mask.min_array_size());
+
+    mask.foreach_index([&](const int64_t i) { result[i] = a[i] + 1; });
+  }
+
+  ExecutionHints get_execution_hints() const override
+  {
+    ExecutionHints hints;
+    hints.allocates_array = true;
+    hints.min_grain_size = 1000000;
+    hints.max_chunk_size = 100;
+    return hints;
+  }
+};
+
+TEST(multi_function, CallAutoInChunks)
+{
+  ChunkedAddOneFunction fn;
+
+  Array<int> input(1000);
+  for (const int64_t i : input.index_range()) {
+    input[i] = int(i);
+  }
+  Array<int> output(1000, -1);
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_every_nth(3, 300, 1, memory);
+  ParamsBuilder params(fn, &mask);
+  params.add_readonly_single_input(input.as_span());
+  params.add_uninitialized_single_output(output.as_mutable_span());
+
+  ContextBuilder context;
+
+  fn.call_auto(mask, params, context);
+
+  /* Every chunk contains at most 100 indices, which are shifted to start at zero. */
+  EXPECT_LE(fn.max_array_size, 300);
+  for (const int64_t i : output.index_range()) {
+    EXPECT_EQ(output[i], i % 3 == 1 && i < 900 ? i + 1 : -1);
+  }
+}
+
 TEST(multi_function, AddPrefixFunction)
 {
   AddPrefixFunction fn;
@@ -315,6 +315,15 @@ struct GatherTasksInfo {
   GatherOffsets r_offsets;
 };
 
+/** Tasks gathered for a part of the instances in parallel, see #GatherTasksInfo. */
+struct GatherTasksChunk {
+  Vector<std::unique_ptr<GArray<>>> temporary_arrays;
+  AllInstancesInfo instances;
+  GatherTasks tasks;
+  /** Total size of the gathered geometry, which is the offset for the next chunk. */
+  GatherOffsets offsets;
+};
+
 /**
  * Information about the parent instances in the current context.
  */
@@ -366,9 +375,7 @@ static void copy_transformed_positions(const Span<float3> src,
                                        MutableSpan<float3> dst)
 {
   threading::parallel_for(src.index_range(), 1024, [&](const IndexRange range) {
-    for (const int i : range) {
-      dst[i] = math::transform_point(transform, src[i]);
-    }
+    math::transform_points(src.slice(range), transform, dst.slice(range));
   });
 }
 
@@ -574,9 +581,12 @@ static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
   /* If at top level, get instance indices from selection field, else use all instances. */
   const IndexMask indices = is_top_level ? gather_info.selection :
                                            IndexMask(IndexRange(instances.instances_num()));
-  indices.foreach_index([&](const int i) {
+
+  const auto gather_instance = [&](GatherTasksInfo &info,
+                                   InstanceContext &instance_context,
+                                   const int i) {
     /* If at top level, retrieve depth from gather_info, else continue with target_depth. */
-    const int child_target_depth = is_top_level ? gather_info.depths[i] : target_depth;
+    const int child_target_depth = is_top_level ? info.depths[i] : target_depth;
     const int handle = handles[i];
     const float4x4 &transform = transforms[i];
     const InstanceReference &reference = references[handle];
@@ -600,7 +610,7 @@ static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
     }
 
     uint32_t local_instance_id = 0;
-    if (gather_info.create_id_attribute_on_any_component) {
+    if (info.create_id_attribute_on_any_component) {
       if (stored_instance_ids.is_empty()) {
         local_instance_id = uint32_t(i);
       }
@@ -618,14 +628,120 @@ static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
                                       const float4x4 &transform,
                                       const uint32_t id) {
                                     instance_context.id = id;
-                                    gather_realize_tasks_recursive(gather_info,
+                                    gather_realize_tasks_recursive(info,
                                                                    current_depth + 1,
                                                                    child_target_depth,
                                                                    instance_geometry_set,
                                                                    transform,
                                                                    instance_context);
                                   });
+  };
+
+  /* Gathering is mostly spent in hash table lookups of the instanced geometries, so it is worth
+   * to split it up when there are many instances. The order of the tasks has to stay the same as
+   * in the single threaded case to get deterministic element order in the output. */
+  constexpr int64_t chunk_size = 1024;
+  if (indices.size() <= chunk_size) {
+    indices.foreach_index(
+        [&](const int i) { gather_instance(gather_info, instance_context, i); });
+    return;
+  }
+
+  const int64_t chunks_num = int64_t(divide_ceil_ul(uint64_t(indices.size()), chunk_size));
+  Array<GatherTasksChunk> chunks(chunks_num);
+  threading::parallel_for(chunks.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t chunk_i : range) {
+      GatherTasksChunk &chunk = chunks[chunk_i];
+      GatherTasksInfo chunk_info = {gather_info.pointclouds,
+                                    gather_info.meshes,
+                                    gather_info.curves,
+                                    gather_info.grease_pencils,
+                                    gather_info.instances_attriubutes,
+                                    gather_info.create_id_attribute_on_any_component,
+                                    gather_info.selection,
+                                    gather_info.depths,
+                                    chunk.temporary_arrays};
+      InstanceContext chunk_instance_context = instance_context;
+      const int64_t chunk_start = chunk_i * chunk_size;
+      const IndexMask chunk_indices = indices.slice(
+          chunk_start, std::min(chunk_size, indices.size() - chunk_start));
+      chunk_indices.foreach_index(
+          [&](const int i) { gather_instance(chunk_info, chunk_instance_context, i); });
+      chunk.instances = std::move(chunk_info.instances);
+      chunk.tasks = std::move(chunk_info.r_tasks);
+      chunk.offsets = chunk_info.r_offsets;
+    }
+  });
+
+  /* Every chunk has been gathered with offsets starting at zero. Their final start indices are the
+   * accumulated sizes of all previously gathered geometry. */
+  Array<GatherOffsets> chunk_start_offsets(chunks_num);
+  GatherOffsets &offsets = gather_info.r_offsets;
+  for (const int64_t chunk_i : chunks.index_range()) {
+    const GatherOffsets &chunk_offsets = chunks[chunk_i].offsets;
+    chunk_start_offsets[chunk_i] = offsets;
+    offsets.pointcloud_offset += chunk_offsets.pointcloud_offset;
+    offsets.mesh_offsets.vertex += chunk_offsets.mesh_offsets.vertex;
+    offsets.mesh_offsets.edge += chunk_offsets.mesh_offsets.edge;
+    offsets.mesh_offsets.face += chunk_offsets.mesh_offsets.face;
+    offsets.mesh_offsets.loop += chunk_offsets.mesh_offsets.loop;
+    offsets.curves_offsets.point += chunk_offsets.curves_offsets.point;
+    offsets.curves_offsets.curve += chunk_offsets.curves_offsets.curve;
+    offsets.grease_pencil_layer_offset += chunk_offsets.grease_pencil_layer_offset;
+  }
+  threading::parallel_for(chunks.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t chunk_i : range) {
+      const GatherOffsets &start = chunk_start_offsets[chunk_i];
+      GatherTasks &tasks = chunks[chunk_i].tasks;
+      for (RealizePointCloudTask &task : tasks.pointcloud_tasks) {
+        task.start_index += start.pointcloud_offset;
+      }
+      for (RealizeMeshTask &task : tasks.mesh_tasks) {
+        task.start_indices.vertex += start.mesh_offsets.vertex;
+        task.start_indices.edge += start.mesh_offsets.edge;
+        task.start_indices.face += start.mesh_offsets.face;
+        task.start_indices.loop += start.mesh_offsets.loop;
+      }
+      for (RealizeCurveTask &task : tasks.curve_tasks) {
+        task.start_indices.point += start.curves_offsets.point;
+        task.start_indices.curve += start.curves_offsets.curve;
+      }
+      for (RealizeGreasePencilTask &task : tasks.grease_pencil_tasks) {
+        task.start_index += start.grease_pencil_layer_offset;
+      }
+    }
   });
+
+  for (GatherTasksChunk &chunk : chunks) {
+    GatherTasks &tasks = gather_info.r_tasks;
+    tasks.pointcloud_tasks.extend(std::make_move_iterator(chunk.tasks.pointcloud_tasks.begin()),
+                                  std::make_move_iterator(chunk.tasks.pointcloud_tasks.end()));
+    tasks.mesh_tasks.extend(std::make_move_iterator(chunk.tasks.mesh_tasks.begin()),
+                            std::make_move_iterator(chunk.tasks.mesh_tasks.end()));
+    tasks.curve_tasks.extend(std::make_move_iterator(chunk.tasks.curve_tasks.begin()),
+                             std::make_move_iterator(chunk.tasks.curve_tasks.end()));
+    tasks.grease_pencil_tasks.extend(
+        std::make_move_iterator(chunk.tasks.grease_pencil_tasks.begin()),
+        std::make_move_iterator(chunk.tasks.grease_pencil_tasks.end()));
+    tasks.edit_data_tasks.extend(chunk.tasks.edit_data_tasks);
+    if (!tasks.first_volume) {
+      tasks.first_volume = std::move(chunk.tasks.first_volume);
+    }
+
+    AllInstancesInfo &instances_info = gather_info.instances;
+    instances_info.attribute_fallback.extend(
+        std::make_move_iterator(chunk.instances.attribute_fallback.begin()),
+        std::make_move_iterator(chunk.instances.attribute_fallback.end()));
+    instances_info.instances_components_to_merge.extend(
+        std::make_move_iterator(chunk.instances.instances_components_to_merge.begin()),
+        std::make_move_iterator(chunk.instances.instances_components_to_merge.end()));
+    instances_info.instances_components_transforms.extend(
+        chunk.instances.instances_components_transforms);
+
+    gather_info.r_temporary_arrays.extend(
+        std::make_move_iterator(chunk.temporary_arrays.begin()),
+        std::make_move_iterator(chunk.temporary_arrays.end()));
+  }
 }
 
 /**
@@ -142,6 +142,27 @@ static std::string cache_dir_get()
   return cache_dir;
 }
 
+/**
+ * Program binaries are only valid for the driver that created them, so each driver version gets
+ * its own sub-directory. After a driver update, shaders are compiled again instead of failing to
+ * load the old binaries one by one.
+ */
+static std::string driver_cache_dir_get()
+{
+  using namespace blender;
+  std::string driver_str;
+  for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+    const char *str = reinterpret_cast<const char *>(glGetString(name));
+    driver_str += str ? str : "";
+    driver_str += "_";
+  }
+  std::string cache_dir = cache_dir_get() +
+                          std::to_string(DefaultHash<std::string>{}(driver_str)) + SEP_STR;
+  BLI_dir_create_recursive(cache_dir.c_str());
+
+  return cache_dir;
+}
+
 void GPU_compilation_subprocess_run(const char *subprocess_name)
 {
   using namespace blender;
@@ -180,7 +201,7 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
   GPUContext *gpu_context = GPU_context_create(nullptr, ghost_context);
   GPU_init();
 
-  std::string cache_dir = cache_dir_get();
+  std::string cache_dir = driver_cache_dir_get();
 
   while (true) {
     /* Process events to avoid crashes on Wayland.
@@ -249,7 +270,9 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
           std::cout << "Compilation Subprocess: Failed to load cached shader binary " << hash_str
                     << "\n";
           /* We can't compile the shader anymore since we have written over the source code,
-           * but we delete the cache for the next time this shader is requested. */
+           * but we delete the cache for the next time this shader is requested. Clear the size so
+           * the shader is compiled in the main process instead of loading the invalid binary. */
+          reinterpret_cast<ShaderBinaryHeader *>(shared_mem.get_data())->size = 0;
           file.close();
           BLI_delete(cache_path.c_str(), false, false);
         }
@@ -283,15 +306,17 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
   GHOST_DisposeSystem(ghost_system);
 }
 
-void GPU_shader_cache_dir_clear_old()
+static void cache_dir_clear_old(const char *dir)
 {
-  std::string cache_dir = cache_dir_get();
-
   direntry *entries = nullptr;
-  uint32_t dir_len = BLI_filelist_dir_contents(cache_dir.c_str(), &entries);
+  uint32_t dir_len = BLI_filelist_dir_contents(dir, &entries);
   for (int i : blender::IndexRange(dir_len)) {
     direntry entry = entries[i];
     if (S_ISDIR(entry.s.st_mode)) {
+      /* Sub-directories for each driver version. */
+      if (!FILENAME_IS_CURRPAR(entry.relname)) {
+        cache_dir_clear_old(entry.path);
+      }
       continue;
     }
     const time_t ts_now = time(nullptr);
@@ -303,4 +328,10 @@ void GPU_shader_cache_dir_clear_old()
   BLI_filelist_free(entries, dir_len);
 }
 
+void GPU_shader_cache_dir_clear_old()
+{
+  std::string cache_dir = cache_dir_get();
+  cache_dir_clear_old(cache_dir.c_str());
+}
+
 #endif
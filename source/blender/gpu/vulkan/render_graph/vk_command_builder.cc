@@ -88,6 +88,9 @@ void VKCommandBuilder::build_node_group(VKRenderGraph &render_graph,
                                         std::optional<NodeHandle> &r_rendering_scope)
 {
   bool is_rendering = false;
+  /* All barriers of the node group are recorded before its first command. They are collected and
+   * sent as a single pipeline barrier so the driver doesn't have to process a barrier per node. */
+  reset_barriers();
   for (NodeHandle node_handle : node_group) {
     VKRenderGraphNode &node = render_graph.nodes_[node_handle];
     build_pipeline_barriers(render_graph, command_buffer, node_handle, node.pipeline_stage_get());
@@ -95,6 +98,7 @@ void VKCommandBuilder::build_node_group(VKRenderGraph &render_graph,
       layer_tracking_begin(render_graph, node_handle);
     }
   }
+  send_pipeline_barriers(command_buffer);
 
   for (NodeHandle node_handle : node_group) {
     VKRenderGraphNode &node = render_graph.nodes_[node_handle];
@@ -225,10 +229,52 @@ void VKCommandBuilder::build_pipeline_barriers(VKRenderGraph &render_graph,
                                                NodeHandle node_handle,
                                                VkPipelineStageFlags pipeline_stage)
 {
-  reset_barriers();
+  /* Barriers inside a single pipeline barrier command are not ordered. When the node accesses a
+   * resource that already has a pending barrier, the pending barriers have to be sent first. */
+  if (node_has_pending_barriers(render_graph, node_handle)) {
+    send_pipeline_barriers(command_buffer);
+  }
   add_image_barriers(render_graph, node_handle, pipeline_stage);
   add_buffer_barriers(render_graph, node_handle, pipeline_stage);
-  send_pipeline_barriers(command_buffer);
+}
+
+bool VKCommandBuilder::node_has_pending_barriers(const VKRenderGraph &render_graph,
+                                                 NodeHandle node_handle) const
+{
+  if (vk_image_memory_barriers_.is_empty() && vk_buffer_memory_barriers_.is_empty()) {
+    return false;
+  }
+  auto has_pending_barrier = [&](const VKRenderGraphLink &link) {
+    const VKResourceStateTracker::Resource &resource = render_graph.resources_.resources_.lookup(
+        link.resource.handle);
+    if (resource.type == VKResourceType::BUFFER) {
+      for (const VkBufferMemoryBarrier &vk_buffer_memory_barrier : vk_buffer_memory_barriers_) {
+        if (vk_buffer_memory_barrier.buffer == resource.buffer.vk_buffer) {
+          return true;
+        }
+      }
+      return false;
+    }
+    for (const VkImageMemoryBarrier &vk_image_memory_barrier : vk_image_memory_barriers_) {
+      if (vk_image_memory_barrier.image == resource.image.vk_image) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  const VKRenderGraphNodeLinks &links = render_graph.links_[node_handle];
+  for (const VKRenderGraphLink &link : links.inputs) {
+    if (has_pending_barrier(link)) {
+      return true;
+    }
+  }
+  for (const VKRenderGraphLink &link : links.outputs) {
+    if (has_pending_barrier(link)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 /** \} */
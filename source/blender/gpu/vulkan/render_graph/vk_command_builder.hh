@@ -116,13 +116,19 @@ class VKCommandBuilder {
                         std::optional<NodeHandle> &r_rendering_scope);
 
   /**
-   * Build the pipeline barriers that should be recorded before any other commands of the node
-   * group the given node is part of is being recorded.
+   * Add the pipeline barriers that should be recorded before any other commands of the node
+   * group the given node is part of is being recorded. The barriers are collected until
+   * `send_pipeline_barriers` is called.
    */
   void build_pipeline_barriers(VKRenderGraph &render_graph,
                                VKCommandBufferInterface &command_buffer,
                                NodeHandle node_handle,
                                VkPipelineStageFlags pipeline_stage);
+  /**
+   * Check if any resource accessed by the given node is part of the barriers that haven't been
+   * sent yet.
+   */
+  bool node_has_pending_barriers(const VKRenderGraph &render_graph, NodeHandle node_handle) const;
   void reset_barriers();
   void send_pipeline_barriers(VKCommandBufferInterface &command_buffer);
 
@@ -19,7 +19,12 @@
 
 #include "GPU_capabilities.hh"
 
+#include "BLI_fileops.h"
 #include "BLI_math_matrix_types.hh"
+#include "BLI_path_util.h"
+#include "BLI_string.h"
+
+#include "BKE_appdir.hh"
 
 #include "GHOST_C-api.h"
 
@@ -52,6 +57,7 @@ void VKDevice::deinit()
   samplers_.free();
   destroy_discarded_resources();
   pipelines.free_data();
+  pipeline_cache_save();
   vkDestroyPipelineCache(vk_device_, vk_pipeline_cache_, vk_allocation_callbacks);
   descriptor_set_layouts_.deinit();
   vmaDestroyAllocator(mem_allocator_);
@@ -183,12 +189,103 @@ void VKDevice::init_memory_allocator()
   vmaCreateAllocator(&info, &mem_allocator_);
 }
 
+/**
+ * The pipeline cache is stored per device, so switching between GPUs doesn't invalidate it.
+ */
+static bool pipeline_cache_filepath_get(const VkPhysicalDeviceProperties &properties,
+                                        char *r_filepath,
+                                        const size_t filepath_maxncpy)
+{
+  char cache_dir[FILE_MAX];
+  if (!BKE_appdir_folder_caches(cache_dir, sizeof(cache_dir))) {
+    return false;
+  }
+  BLI_path_append(cache_dir, sizeof(cache_dir), "vk-pipeline-cache");
+  if (!BLI_dir_create_recursive(cache_dir)) {
+    return false;
+  }
+  char filename[64];
+  SNPRINTF(filename, "%x_%x.bin", properties.vendorID, properties.deviceID);
+  BLI_path_join(r_filepath, filepath_maxncpy, cache_dir, filename);
+  return true;
+}
+
+/**
+ * Check if the cache data was created by the same device and driver. Drivers are supposed to
+ * reject incompatible data themselves, but not all of them do so reliably.
+ */
+static bool pipeline_cache_data_is_compatible(const VkPhysicalDeviceProperties &properties,
+                                              const void *data,
+                                              const size_t data_size)
+{
+  if (data_size < sizeof(VkPipelineCacheHeaderVersionOne)) {
+    return false;
+  }
+  VkPipelineCacheHeaderVersionOne header;
+  memcpy(&header, data, sizeof(header));
+  return header.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne) &&
+         header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+         header.vendorID == properties.vendorID && header.deviceID == properties.deviceID &&
+         memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
 void VKDevice::init_pipeline_cache()
 {
   VK_ALLOCATION_CALLBACKS;
   VkPipelineCacheCreateInfo create_info = {};
   create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-  vkCreatePipelineCache(vk_device_, &create_info, vk_allocation_callbacks, &vk_pipeline_cache_);
+
+  /* Reuse the pipelines compiled in previous sessions. */
+  void *initial_data = nullptr;
+  char filepath[FILE_MAX];
+  if (pipeline_cache_filepath_get(vk_physical_device_properties_, filepath, sizeof(filepath))) {
+    size_t data_size = 0;
+    initial_data = BLI_file_read_binary_as_mem(filepath, 0, &data_size);
+    if (initial_data &&
+        pipeline_cache_data_is_compatible(vk_physical_device_properties_, initial_data, data_size))
+    {
+      create_info.initialDataSize = data_size;
+      create_info.pInitialData = initial_data;
+    }
+  }
+
+  if (vkCreatePipelineCache(
+          vk_device_, &create_info, vk_allocation_callbacks, &vk_pipeline_cache_) != VK_SUCCESS &&
+      create_info.pInitialData)
+  {
+    /* Start with an empty cache when the stored data is rejected. */
+    create_info.initialDataSize = 0;
+    create_info.pInitialData = nullptr;
+    vkCreatePipelineCache(vk_device_, &create_info, vk_allocation_callbacks, &vk_pipeline_cache_);
+  }
+  MEM_SAFE_FREE(initial_data);
+}
+
+void VKDevice::pipeline_cache_save()
+{
+  char filepath[FILE_MAX];
+  if (vk_pipeline_cache_ == VK_NULL_HANDLE ||
+      !pipeline_cache_filepath_get(vk_physical_device_properties_, filepath, sizeof(filepath)))
+  {
+    return;
+  }
+  size_t data_size = 0;
+  vkGetPipelineCacheData(vk_device_, vk_pipeline_cache_, &data_size, nullptr);
+  if (data_size == 0) {
+    return;
+  }
+  Array<char> data(data_size);
+  if (vkGetPipelineCacheData(vk_device_, vk_pipeline_cache_, &data_size, data.data()) !=
+      VK_SUCCESS)
+  {
+    return;
+  }
+  FILE *file = BLI_fopen(filepath, "wb");
+  if (file == nullptr) {
+    return;
+  }
+  fwrite(data.data(), 1, data_size, file);
+  fclose(file);
 }
 
 void VKDevice::init_dummy_buffer(VKContext &context)
@@ -268,6 +268,8 @@ class VKDevice : public NonCopyable {
   void init_debug_callbacks();
   void init_memory_allocator();
   void init_pipeline_cache();
+  /** Write the pipeline cache to disk, so the next session can reuse the compiled pipelines. */
+  void pipeline_cache_save();
   /**
    * Initialize the functions struct with extension specific function pointer.
    */
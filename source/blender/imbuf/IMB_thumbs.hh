@@ -84,6 +84,11 @@ void IMB_thumb_makedirs();
  * Special function for loading a thumbnail embedded into a blend file.
  */
 ImBuf *IMB_thumb_load_blend(const char *blen_path, const char *blen_group, const char *blen_id);
+/**
+ * Close the `.blend` files that #IMB_thumb_load_blend keeps open to speed up loading the previews
+ * of multiple IDs from the same file.
+ */
+void IMB_thumb_blend_handles_free();
 
 /**
  * Special function for previewing fonts.
@@ -20,6 +20,7 @@
 
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -593,16 +594,19 @@ static void ffmpeg_postprocess(ImBufAnim *anim, AVFrame *input, ImBuf *ibuf)
     /* Decode, then do vertical flip into destination. */
     BKE_ffmpeg_sws_scale_frame(anim->img_convert_ctx, anim->pFrameRGB, input);
 
-    /* Use negative line size to do vertical image flip. */
-    const int src_linesize[4] = {-rgb_linesize, 0, 0, 0};
-    const uint8_t *const src[4] = {
-        rgb_data + (anim->y - 1) * rgb_linesize, nullptr, nullptr, nullptr};
-    int dst_size = av_image_get_buffer_size(AVPixelFormat(anim->pFrameRGB->format),
-                                            anim->pFrameRGB->width,
-                                            anim->pFrameRGB->height,
-                                            1);
-    av_image_copy_to_buffer(
-        ibuf->byte_buffer.data, dst_size, src, src_linesize, AV_PIX_FMT_RGBA, anim->x, anim->y, 1);
+    /* Copy the rows in reverse order to do the vertical image flip. The rows are copied in
+     * parallel, a single thread can't saturate the memory bandwidth for large frames. */
+    blender::threading::memory_bandwidth_bound_task(
+        int64_t(ibuf_linesize) * anim->y * 2, [&]() {
+          blender::threading::parallel_for(
+              blender::IndexRange(anim->y), 64, [&](const blender::IndexRange rows) {
+                for (const int64_t y : rows) {
+                  memcpy(ibuf->byte_buffer.data + y * ibuf_linesize,
+                         rgb_data + (anim->y - 1 - y) * rgb_linesize,
+                         size_t(ibuf_linesize));
+                }
+              });
+        });
   }
 
   if (filter_y) {
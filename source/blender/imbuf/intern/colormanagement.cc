@@ -1634,6 +1634,28 @@ static void display_buffer_init_handle(void *handle_v,
   handle->float_colorspace = init_data->float_colorspace;
 }
 
+/**
+ * Convert a slice of the buffer to scene linear space. Uses the CPU processor that is cached in
+ * the color space, instead of creating a new processor for every slice.
+ */
+static void display_buffer_to_scene_linear(float *buffer,
+                                           const int width,
+                                           const int height,
+                                           const int channels,
+                                           const char *from_colorspace,
+                                           const bool predivide)
+{
+  if (STREQ(from_colorspace, global_role_scene_linear)) {
+    return;
+  }
+  ColorSpace *colorspace = colormanage_colorspace_get_named(from_colorspace);
+  if (colorspace == nullptr || IMB_colormanagement_space_is_scene_linear(colorspace)) {
+    return;
+  }
+  IMB_colormanagement_colorspace_to_scene_linear(
+      buffer, width, height, channels, colorspace, predivide);
+}
+
 static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
                                                    int height,
                                                    float *linear_buffer,
@@ -1652,32 +1674,18 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
     uchar *byte_buffer = handle->byte_buffer;
 
     const char *from_colorspace = handle->byte_colorspace;
-    const char *to_colorspace = global_role_scene_linear;
-
-    float *fp;
-    uchar *cp;
-    const size_t i_last = size_t(width) * height;
-    size_t i;
 
-    /* first convert byte buffer to float, keep in image space */
-    for (i = 0, fp = linear_buffer, cp = byte_buffer; i != i_last;
-         i++, fp += channels, cp += channels)
-    {
-      if (channels == 3) {
-        rgb_uchar_to_float(fp, cp);
-      }
-      else if (channels == 4) {
-        rgba_uchar_to_float(fp, cp);
-      }
-      else {
-        BLI_assert_msg(0, "Buffers of 3 or 4 channels are only supported here");
-      }
+    /* First convert byte buffer to float, keep in image space. All channels are converted the
+     * same way, so this is a single loop that can be vectorized. */
+    BLI_assert_msg(ELEM(channels, 3, 4), "Buffers of 3 or 4 channels are only supported here");
+    for (size_t i = 0; i < buffer_size; i++) {
+      linear_buffer[i] = float(byte_buffer[i]) * (1.0f / 255.0f);
     }
 
     if (!is_data && !is_data_display) {
       /* convert float buffer to scene linear space */
-      IMB_colormanagement_transform(
-          linear_buffer, width, height, channels, from_colorspace, to_colorspace, false);
+      display_buffer_to_scene_linear(
+          linear_buffer, width, height, channels, from_colorspace, false);
     }
 
     *is_straight_alpha = true;
@@ -1690,13 +1698,12 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
      */
 
     const char *from_colorspace = handle->float_colorspace;
-    const char *to_colorspace = global_role_scene_linear;
 
     memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
 
     if (!is_data && !is_data_display) {
-      IMB_colormanagement_transform(
-          linear_buffer, width, height, channels, from_colorspace, to_colorspace, predivide);
+      display_buffer_to_scene_linear(
+          linear_buffer, width, height, channels, from_colorspace, predivide);
     }
 
     *is_straight_alpha = false;
@@ -2330,6 +2337,7 @@ void IMB_colormanagement_imbuf_to_byte_texture(uchar *out_buffer,
                                                const ImBuf *ibuf,
                                                const bool store_premultiplied)
 {
+  using namespace blender;
   /* Byte buffer storage, only for sRGB, scene linear and data texture since other
    * color space conversions can't be done on the GPU. */
   BLI_assert(ibuf->byte_buffer.data);
@@ -2341,31 +2349,34 @@ void IMB_colormanagement_imbuf_to_byte_texture(uchar *out_buffer,
   const uchar *in_buffer = ibuf->byte_buffer.data;
   const bool use_premultiply = IMB_alpha_affects_rgb(ibuf) && store_premultiplied;
 
-  for (int y = 0; y < height; y++) {
-    const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-    const size_t out_offset = y * width;
-    const uchar *in = in_buffer + in_offset * 4;
-    uchar *out = out_buffer + out_offset * 4;
-
-    if (use_premultiply) {
-      /* Premultiply only. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = (in[0] * in[3]) >> 8;
-        out[1] = (in[1] * in[3]) >> 8;
-        out[2] = (in[2] * in[3]) >> 8;
-        out[3] = in[3];
+  /* Rows are independent, convert them in parallel. */
+  threading::parallel_for(IndexRange(height), 64, [&](const IndexRange rows) {
+    for (const int y : rows) {
+      const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
+      const size_t out_offset = y * width;
+      const uchar *in = in_buffer + in_offset * 4;
+      uchar *out = out_buffer + out_offset * 4;
+
+      if (use_premultiply) {
+        /* Premultiply only. */
+        for (int x = 0; x < width; x++, in += 4, out += 4) {
+          out[0] = (in[0] * in[3]) >> 8;
+          out[1] = (in[1] * in[3]) >> 8;
+          out[2] = (in[2] * in[3]) >> 8;
+          out[3] = in[3];
+        }
       }
-    }
-    else {
-      /* Copy only. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = in[0];
-        out[1] = in[1];
-        out[2] = in[2];
-        out[3] = in[3];
+      else {
+        /* Copy only. */
+        for (int x = 0; x < width; x++, in += 4, out += 4) {
+          out[0] = in[0];
+          out[1] = in[1];
+          out[2] = in[2];
+          out[3] = in[3];
+        }
       }
     }
-  }
+  });
 }
 
 struct ImbufByteToFloatData {
@@ -2413,6 +2424,7 @@ void IMB_colormanagement_imbuf_to_float_texture(float *out_buffer,
                                                 const ImBuf *ibuf,
                                                 const bool store_premultiplied)
 {
+  using namespace blender;
   /* Float texture are stored in scene linear color space, with premultiplied
    * alpha depending on the image alpha mode. */
   if (ibuf->float_buffer.data) {
@@ -2421,42 +2433,44 @@ void IMB_colormanagement_imbuf_to_float_texture(float *out_buffer,
     const int in_channels = ibuf->channels;
     const bool use_unpremultiply = IMB_alpha_affects_rgb(ibuf) && !store_premultiplied;
 
-    for (int y = 0; y < height; y++) {
-      const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-      const size_t out_offset = y * width;
-      const float *in = in_buffer + in_offset * in_channels;
-      float *out = out_buffer + out_offset * 4;
-
-      if (in_channels == 1) {
-        /* Copy single channel. */
-        for (int x = 0; x < width; x++, in += 1, out += 4) {
-          out[0] = in[0];
-          out[1] = in[0];
-          out[2] = in[0];
-          out[3] = in[0];
-        }
-      }
-      else if (in_channels == 3) {
-        /* Copy RGB. */
-        for (int x = 0; x < width; x++, in += 3, out += 4) {
-          out[0] = in[0];
-          out[1] = in[1];
-          out[2] = in[2];
-          out[3] = 1.0f;
+    threading::parallel_for(IndexRange(height), 64, [&](const IndexRange rows) {
+      for (const int y : rows) {
+        const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
+        const size_t out_offset = y * width;
+        const float *in = in_buffer + in_offset * in_channels;
+        float *out = out_buffer + out_offset * 4;
+
+        if (in_channels == 1) {
+          /* Copy single channel. */
+          for (int x = 0; x < width; x++, in += 1, out += 4) {
+            out[0] = in[0];
+            out[1] = in[0];
+            out[2] = in[0];
+            out[3] = in[0];
+          }
         }
-      }
-      else if (in_channels == 4) {
-        /* Copy or convert RGBA. */
-        if (use_unpremultiply) {
-          for (int x = 0; x < width; x++, in += 4, out += 4) {
-            premul_to_straight_v4_v4(out, in);
+        else if (in_channels == 3) {
+          /* Copy RGB. */
+          for (int x = 0; x < width; x++, in += 3, out += 4) {
+            out[0] = in[0];
+            out[1] = in[1];
+            out[2] = in[2];
+            out[3] = 1.0f;
           }
         }
-        else {
-          memcpy(out, in, sizeof(float[4]) * width);
+        else if (in_channels == 4) {
+          /* Copy or convert RGBA. */
+          if (use_unpremultiply) {
+            for (int x = 0; x < width; x++, in += 4, out += 4) {
+              premul_to_straight_v4_v4(out, in);
+            }
+          }
+          else {
+            memcpy(out, in, sizeof(float[4]) * width);
+          }
         }
       }
-    }
+    });
   }
   else {
     /* Byte source buffer. */
@@ -6,11 +6,13 @@
  * \ingroup imbuf
  */
 
+#include <atomic>
 #include <cmath>
 
 #include "MEM_guardedalloc.h"
 
 #include "BLI_math_base.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "IMB_filter.hh"
@@ -330,7 +332,7 @@ void IMB_filter_extend(ImBuf *ibuf, char *mask, int filter)
   void *srcbuf = ibuf->float_buffer.data ? (void *)ibuf->float_buffer.data :
                                            (void *)ibuf->byte_buffer.data;
   char *srcmask = mask;
-  int cannot_early_out = 1, r, n, k, i, j, c;
+  int cannot_early_out = 1, r, n;
   float weight[25];
 
   /* build a weights buffer */
@@ -357,85 +359,94 @@ void IMB_filter_extend(ImBuf *ibuf, char *mask, int filter)
 
   /* run passes */
   for (r = 0; cannot_early_out == 1 && r < filter; r++) {
-    int x, y;
-    cannot_early_out = 0;
-
-    for (y = 0; y < height; y++) {
-      for (x = 0; x < width; x++) {
-        const int index = filter_make_index(x, y, width, height);
+    /* Each pass reads from the source and writes to the destination buffer,
+     * so rows can be processed in parallel. */
+    std::atomic<bool> changed = false;
+
+    const blender::IndexRange all_rows(height);
+    blender::threading::parallel_for(all_rows, 16, [&](const blender::IndexRange rows) {
+      for (const int y : rows) {
+        for (int x = 0; x < width; x++) {
+          const int index = filter_make_index(x, y, width, height);
+
+          /* only update unassigned pixels */
+          if (check_pixel_assigned(srcbuf, srcmask, index, depth, is_float)) {
+            continue;
+          }
+          if (!check_pixel_assigned(
+                  srcbuf, srcmask, filter_make_index(x - 1, y, width, height), depth, is_float) &&
+              !check_pixel_assigned(
+                  srcbuf, srcmask, filter_make_index(x + 1, y, width, height), depth, is_float) &&
+              !check_pixel_assigned(
+                  srcbuf, srcmask, filter_make_index(x, y - 1, width, height), depth, is_float) &&
+              !check_pixel_assigned(
+                  srcbuf, srcmask, filter_make_index(x, y + 1, width, height), depth, is_float))
+          {
+            continue;
+          }
 
-        /* only update unassigned pixels */
-        if (!check_pixel_assigned(srcbuf, srcmask, index, depth, is_float)) {
           float tmp[4];
           float wsum = 0;
           float acc[4] = {0, 0, 0, 0};
-          k = 0;
-
-          if (check_pixel_assigned(
-                  srcbuf, srcmask, filter_make_index(x - 1, y, width, height), depth, is_float) ||
-              check_pixel_assigned(
-                  srcbuf, srcmask, filter_make_index(x + 1, y, width, height), depth, is_float) ||
-              check_pixel_assigned(
-                  srcbuf, srcmask, filter_make_index(x, y - 1, width, height), depth, is_float) ||
-              check_pixel_assigned(
-                  srcbuf, srcmask, filter_make_index(x, y + 1, width, height), depth, is_float))
-          {
-            for (i = -n; i <= n; i++) {
-              for (j = -n; j <= n; j++) {
-                if (i != 0 || j != 0) {
-                  const int tmpindex = filter_make_index(x + i, y + j, width, height);
-
-                  if (check_pixel_assigned(srcbuf, srcmask, tmpindex, depth, is_float)) {
-                    if (is_float) {
-                      for (c = 0; c < depth; c++) {
-                        tmp[c] = ((const float *)srcbuf)[depth * tmpindex + c];
-                      }
+          int k = 0;
+
+          for (int i = -n; i <= n; i++) {
+            for (int j = -n; j <= n; j++) {
+              if (i != 0 || j != 0) {
+                const int tmpindex = filter_make_index(x + i, y + j, width, height);
+
+                if (check_pixel_assigned(srcbuf, srcmask, tmpindex, depth, is_float)) {
+                  if (is_float) {
+                    for (int c = 0; c < depth; c++) {
+                      tmp[c] = ((const float *)srcbuf)[depth * tmpindex + c];
                     }
-                    else {
-                      for (c = 0; c < depth; c++) {
-                        tmp[c] = float(((const uchar *)srcbuf)[depth * tmpindex + c]);
-                      }
+                  }
+                  else {
+                    for (int c = 0; c < depth; c++) {
+                      tmp[c] = float(((const uchar *)srcbuf)[depth * tmpindex + c]);
                     }
+                  }
 
-                    wsum += weight[k];
+                  wsum += weight[k];
 
-                    for (c = 0; c < depth; c++) {
-                      acc[c] += weight[k] * tmp[c];
-                    }
+                  for (int c = 0; c < depth; c++) {
+                    acc[c] += weight[k] * tmp[c];
                   }
                 }
-                k++;
               }
+              k++;
             }
+          }
 
-            if (wsum != 0) {
-              for (c = 0; c < depth; c++) {
-                acc[c] /= wsum;
-              }
+          if (wsum != 0) {
+            for (int c = 0; c < depth; c++) {
+              acc[c] /= wsum;
+            }
 
-              if (is_float) {
-                for (c = 0; c < depth; c++) {
-                  ((float *)dstbuf)[depth * index + c] = acc[c];
-                }
+            if (is_float) {
+              for (int c = 0; c < depth; c++) {
+                ((float *)dstbuf)[depth * index + c] = acc[c];
               }
-              else {
-                for (c = 0; c < depth; c++) {
-                  ((uchar *)dstbuf)[depth * index + c] = acc[c] > 255 ?
-                                                             255 :
-                                                             (acc[c] < 0 ? 0 :
-                                                                           uchar(roundf(acc[c])));
-                }
+            }
+            else {
+              for (int c = 0; c < depth; c++) {
+                ((uchar *)dstbuf)[depth * index + c] = acc[c] > 255 ?
+                                                           255 :
+                                                           (acc[c] < 0 ? 0 :
+                                                                         uchar(roundf(acc[c])));
               }
+            }
 
-              if (dstmask != nullptr) {
-                dstmask[index] = FILTER_MASK_MARGIN; /* assigned */
-              }
-              cannot_early_out = 1;
+            if (dstmask != nullptr) {
+              dstmask[index] = FILTER_MASK_MARGIN; /* assigned */
             }
+            changed.store(true, std::memory_order_relaxed);
           }
         }
       }
-    }
+    });
+
+    cannot_early_out = changed;
 
     /* keep the original buffer up to date. */
     memcpy(srcbuf, dstbuf, bsize);
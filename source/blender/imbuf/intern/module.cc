@@ -14,6 +14,7 @@
 #include "IMB_colormanagement_intern.hh"
 #include "IMB_filetype.hh"
 #include "IMB_imbuf.hh"
+#include "IMB_thumbs.hh"
 
 void IMB_init()
 {
@@ -25,6 +26,7 @@ void IMB_init()
 
 void IMB_exit()
 {
+  IMB_thumb_blend_handles_free();
   imb_filetypes_exit();
   colormanagement_exit();
   imb_mmap_lock_exit();
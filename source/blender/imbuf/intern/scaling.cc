@@ -8,6 +8,7 @@
 
 #include <cmath>
 
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
 
@@ -227,7 +228,7 @@ MINLINE void premul_ushort_to_straight_uchar(uchar *result, const ushort color[4
 
 void imb_onehalf_no_alloc(ImBuf *ibuf2, ImBuf *ibuf1)
 {
-  int x, y;
+  using namespace blender;
   const bool do_rect = (ibuf1->byte_buffer.data != nullptr);
   const bool do_float = (ibuf1->float_buffer.data != nullptr) &&
                         (ibuf2->float_buffer.data != nullptr);
@@ -245,61 +246,56 @@ void imb_onehalf_no_alloc(ImBuf *ibuf2, ImBuf *ibuf1)
     return;
   }
 
-  if (do_rect) {
-    uchar *cp1, *cp2, *dest;
-
-    cp1 = ibuf1->byte_buffer.data;
-    dest = ibuf2->byte_buffer.data;
-
-    for (y = ibuf2->y; y > 0; y--) {
-      cp2 = cp1 + (ibuf1->x << 2);
-      for (x = ibuf2->x; x > 0; x--) {
-        ushort p1i[8], p2i[8], desti[4];
-
-        straight_uchar_to_premul_ushort(p1i, cp1);
-        straight_uchar_to_premul_ushort(p2i, cp2);
-        straight_uchar_to_premul_ushort(p1i + 4, cp1 + 4);
-        straight_uchar_to_premul_ushort(p2i + 4, cp2 + 4);
-
-        desti[0] = (uint(p1i[0]) + p2i[0] + p1i[4] + p2i[4]) >> 2;
-        desti[1] = (uint(p1i[1]) + p2i[1] + p1i[5] + p2i[5]) >> 2;
-        desti[2] = (uint(p1i[2]) + p2i[2] + p1i[6] + p2i[6]) >> 2;
-        desti[3] = (uint(p1i[3]) + p2i[3] + p1i[7] + p2i[7]) >> 2;
-
-        premul_ushort_to_straight_uchar(dest, desti);
+  /* Each output row is computed from two input rows, so rows can be computed in parallel. */
+  const int64_t src_row_size = int64_t(ibuf1->x) * 4;
+  const int64_t dst_row_size = int64_t(ibuf2->x) * 4;
 
-        cp1 += 8;
-        cp2 += 8;
-        dest += 4;
-      }
-      cp1 = cp2;
-      if (ibuf1->x & 1) {
-        cp1 += 4;
+  if (do_rect) {
+    threading::parallel_for(IndexRange(ibuf2->y), 32, [&](const IndexRange y_range) {
+      for (const int64_t y : y_range) {
+        const uchar *cp1 = ibuf1->byte_buffer.data + src_row_size * 2 * y;
+        const uchar *cp2 = cp1 + src_row_size;
+        uchar *dest = ibuf2->byte_buffer.data + dst_row_size * y;
+        for (int x = ibuf2->x; x > 0; x--) {
+          ushort p1i[8], p2i[8], desti[4];
+
+          straight_uchar_to_premul_ushort(p1i, cp1);
+          straight_uchar_to_premul_ushort(p2i, cp2);
+          straight_uchar_to_premul_ushort(p1i + 4, cp1 + 4);
+          straight_uchar_to_premul_ushort(p2i + 4, cp2 + 4);
+
+          desti[0] = (uint(p1i[0]) + p2i[0] + p1i[4] + p2i[4]) >> 2;
+          desti[1] = (uint(p1i[1]) + p2i[1] + p1i[5] + p2i[5]) >> 2;
+          desti[2] = (uint(p1i[2]) + p2i[2] + p1i[6] + p2i[6]) >> 2;
+          desti[3] = (uint(p1i[3]) + p2i[3] + p1i[7] + p2i[7]) >> 2;
+
+          premul_ushort_to_straight_uchar(dest, desti);
+
+          cp1 += 8;
+          cp2 += 8;
+          dest += 4;
+        }
       }
-    }
+    });
   }
 
   if (do_float) {
-    float *p1f, *p2f, *destf;
-
-    p1f = ibuf1->float_buffer.data;
-    destf = ibuf2->float_buffer.data;
-    for (y = ibuf2->y; y > 0; y--) {
-      p2f = p1f + (ibuf1->x << 2);
-      for (x = ibuf2->x; x > 0; x--) {
-        destf[0] = 0.25f * (p1f[0] + p2f[0] + p1f[4] + p2f[4]);
-        destf[1] = 0.25f * (p1f[1] + p2f[1] + p1f[5] + p2f[5]);
-        destf[2] = 0.25f * (p1f[2] + p2f[2] + p1f[6] + p2f[6]);
-        destf[3] = 0.25f * (p1f[3] + p2f[3] + p1f[7] + p2f[7]);
-        p1f += 8;
-        p2f += 8;
-        destf += 4;
-      }
-      p1f = p2f;
-      if (ibuf1->x & 1) {
-        p1f += 4;
+    threading::parallel_for(IndexRange(ibuf2->y), 32, [&](const IndexRange y_range) {
+      for (const int64_t y : y_range) {
+        const float *p1f = ibuf1->float_buffer.data + src_row_size * 2 * y;
+        const float *p2f = p1f + src_row_size;
+        float *destf = ibuf2->float_buffer.data + dst_row_size * y;
+        for (int x = ibuf2->x; x > 0; x--) {
+          destf[0] = 0.25f * (p1f[0] + p2f[0] + p1f[4] + p2f[4]);
+          destf[1] = 0.25f * (p1f[1] + p2f[1] + p1f[5] + p2f[5]);
+          destf[2] = 0.25f * (p1f[2] + p2f[2] + p1f[6] + p2f[6]);
+          destf[3] = 0.25f * (p1f[3] + p2f[3] + p1f[7] + p2f[7]);
+          p1f += 8;
+          p2f += 8;
+          destf += 4;
+        }
       }
-    }
+    });
   }
 }
 
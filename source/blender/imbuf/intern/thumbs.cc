@@ -694,6 +694,8 @@ void IMB_thumb_locks_release()
     BLI_gset_free(thumb_locks.locked_paths, MEM_freeN);
     thumb_locks.locked_paths = nullptr;
     BLI_condition_end(&thumb_locks.cond);
+    /* No thumbnails are generated anymore, don't keep the files open. */
+    IMB_thumb_blend_handles_free();
   }
 
   BLI_thread_unlock(LOCK_IMAGE);
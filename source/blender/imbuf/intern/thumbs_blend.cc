@@ -9,9 +9,13 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
+#include <string>
 
+#include "BLI_fileops.h"
 #include "BLI_listbase.h" /* Needed due to import of BLO_readfile.hh */
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLO_readfile.hh"
 
@@ -24,25 +28,92 @@
 
 #include "MEM_guardedalloc.h"
 
-/* NOTE: we should handle all previews for a same group at once, would avoid reopening
- * `.blend` file for each and every ID. However, this adds some complexity,
- * so keep it for later. */
+/* -------------------------------------------------------------------- */
+/** \name Blend Handle Cache
+ *
+ * Opening a `.blend` file reads all of its block headers, which is slow for large asset libraries
+ * where the previews of many IDs are loaded from the same file. So handles are kept open after
+ * use and reused for the following IDs of the same file. Every handle is only used by one thread
+ * at a time, multiple handles can be open for the same file.
+ * \{ */
+
+struct CachedBlendHandle {
+  std::string filepath;
+  int64_t mtime;
+  BlendHandle *handle;
+};
+
+/** Maximum number of handles kept open, the least recently used ones are closed first. */
+static constexpr int64_t BLEND_HANDLES_MAX = 8;
+
+static std::mutex blend_handles_mutex;
+static blender::Vector<CachedBlendHandle> blend_handles;
+
+static CachedBlendHandle blend_handle_acquire(const char *blen_path)
+{
+  BLI_stat_t st;
+  if (BLI_stat(blen_path, &st) == -1) {
+    return {blen_path, 0, nullptr};
+  }
+  const int64_t mtime = int64_t(st.st_mtime);
+  {
+    std::lock_guard lock{blend_handles_mutex};
+    for (int64_t i = blend_handles.size() - 1; i >= 0; i--) {
+      if (blend_handles[i].mtime == mtime && blend_handles[i].filepath == blen_path) {
+        CachedBlendHandle cached = std::move(blend_handles[i]);
+        blend_handles.remove(i);
+        return cached;
+      }
+    }
+  }
+
+  BlendFileReadReport bf_reports = {};
+  bf_reports.reports = nullptr;
+  return {blen_path, mtime, BLO_blendhandle_from_file(blen_path, &bf_reports)};
+}
+
+static void blend_handle_release(CachedBlendHandle cached)
+{
+  BlendHandle *handle_to_close = nullptr;
+  {
+    std::lock_guard lock{blend_handles_mutex};
+    if (blend_handles.size() >= BLEND_HANDLES_MAX) {
+      handle_to_close = blend_handles.first().handle;
+      blend_handles.remove(0);
+    }
+    blend_handles.append(std::move(cached));
+  }
+  if (handle_to_close) {
+    BLO_blendhandle_close(handle_to_close);
+  }
+}
+
+void IMB_thumb_blend_handles_free()
+{
+  std::lock_guard lock{blend_handles_mutex};
+  for (CachedBlendHandle &cached : blend_handles) {
+    BLO_blendhandle_close(cached.handle);
+  }
+  blend_handles.clear_and_shrink();
+}
+
+/** \} */
+
 static ImBuf *imb_thumb_load_from_blend_id(const char *blen_path,
                                            const char *blen_group,
                                            const char *blen_id)
 {
   ImBuf *ima = nullptr;
-  BlendFileReadReport bf_reports = {};
-  bf_reports.reports = nullptr;
 
-  BlendHandle *libfiledata = BLO_blendhandle_from_file(blen_path, &bf_reports);
-  if (libfiledata == nullptr) {
+  CachedBlendHandle libfiledata = blend_handle_acquire(blen_path);
+  if (libfiledata.handle == nullptr) {
     return nullptr;
   }
 
   int idcode = BKE_idtype_idcode_from_name(blen_group);
-  PreviewImage *preview = BLO_blendhandle_get_preview_for_id(libfiledata, idcode, blen_id);
-  BLO_blendhandle_close(libfiledata);
+  PreviewImage *preview = BLO_blendhandle_get_preview_for_id(
+      libfiledata.handle, idcode, blen_id);
+  blend_handle_release(std::move(libfiledata));
 
   if (preview) {
     ima = BKE_previewimg_to_imbuf(preview, ICON_SIZE_PREVIEW);
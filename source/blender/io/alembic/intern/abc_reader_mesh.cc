@@ -22,6 +22,7 @@
 #include "BLI_map.hh"
 #include "BLI_math_vector.h"
 #include "BLI_ordered_edge.hh"
+#include "BLI_task.h"
 
 #include "BLT_translation.hh"
 
@@ -33,12 +34,16 @@
 #include "BKE_mesh.hh"
 #include "BKE_object.hh"
 
+#include <atomic>
+
 using Alembic::Abc::FloatArraySamplePtr;
 using Alembic::Abc::Int32ArraySamplePtr;
 using Alembic::Abc::P3fArraySamplePtr;
 using Alembic::Abc::PropertyHeader;
 using Alembic::Abc::V3fArraySamplePtr;
 
+using Alembic::AbcCoreAbstract::index_t;
+
 using Alembic::AbcGeom::IC3fGeomParam;
 using Alembic::AbcGeom::IC4fGeomParam;
 using Alembic::AbcGeom::IFaceSet;
@@ -178,10 +183,23 @@ void read_mverts(Mesh &mesh, const P3fArraySamplePtr positions, const N3fArraySa
   }
 }
 
-static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
+/**
+ * Read the faces and corners, together with the UVs that are stored per corner. When
+ * `write_topology` is false the mesh is known to have the topology of the sample already, and
+ * only the UVs are written so that the topology arrays of the mesh can stay shared.
+ */
+static void read_mpolys(CDStreamConfig &config,
+                        const AbcMeshData &mesh_data,
+                        const bool write_topology)
 {
-  int *face_offsets = config.face_offsets;
-  int *corner_verts = config.corner_verts;
+  int *face_offsets = nullptr;
+  int *corner_verts = nullptr;
+  if (write_topology) {
+    face_offsets = config.mesh->face_offsets_for_write().data();
+    corner_verts = config.mesh->corner_verts_for_write().data();
+    config.face_offsets = face_offsets;
+    config.corner_verts = corner_verts;
+  }
   float2 *mloopuvs = config.mloopuv;
 
   const Int32ArraySamplePtr &face_indices = mesh_data.face_indices;
@@ -199,10 +217,16 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
   uint uv_index = 0;
   bool seen_invalid_geometry = false;
 
+  if (!write_topology && !do_uvs) {
+    return;
+  }
+
   for (int i = 0; i < face_counts->size(); i++) {
     const int face_size = (*face_counts)[i];
 
-    face_offsets[i] = loop_index;
+    if (write_topology) {
+      face_offsets[i] = loop_index;
+    }
 
     /* Polygons are always assumed to be smooth-shaded. If the Alembic mesh should be flat-shaded,
      * this is encoded in custom loop normals. See #71246. */
@@ -213,7 +237,9 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     uint last_vertex_index = 0;
     for (int f = 0; f < face_size; f++, loop_index++, rev_loop_index--) {
       const int vert = (*face_indices)[loop_index];
-      corner_verts[rev_loop_index] = vert;
+      if (write_topology) {
+        corner_verts[rev_loop_index] = vert;
+      }
 
       if (f > 0 && vert == last_vertex_index) {
         /* This face is invalid, as it has consecutive loops from the same vertex. This is caused
@@ -236,6 +262,10 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     }
   }
 
+  if (!write_topology) {
+    return;
+  }
+
   bke::mesh_calc_edges(*config.mesh, false, false);
   if (seen_invalid_geometry) {
     if (config.modifier_error_message) {
@@ -435,11 +465,11 @@ static bool samples_have_same_topology(const SampleType &sample, const SampleTyp
 static void read_mesh_sample(const std::string &iobject_full_name,
                              ImportSettings *settings,
                              const IPolyMeshSchema &schema,
+                             const IPolyMeshSchema::Sample &sample,
                              const ISampleSelector &selector,
+                             const bool reuse_topology,
                              CDStreamConfig &config)
 {
-  const IPolyMeshSchema::Sample sample = schema.getValue(selector);
-
   AbcMeshData abc_mesh_data;
   abc_mesh_data.face_counts = sample.getFaceCounts();
   abc_mesh_data.face_indices = sample.getFaceIndices();
@@ -470,7 +500,7 @@ static void read_mesh_sample(const std::string &iobject_full_name,
   }
 
   if ((settings->read_flag & MOD_MESHSEQ_READ_POLY) != 0) {
-    read_mpolys(config, abc_mesh_data);
+    read_mpolys(config, abc_mesh_data, !reuse_topology);
     process_normals(config, schema.getNormalsParam(), selector);
   }
 
@@ -491,8 +521,9 @@ static CDStreamConfig get_config(Mesh *mesh)
   CDStreamConfig config;
   config.mesh = mesh;
   config.positions = mesh->vert_positions_for_write().data();
-  config.corner_verts = mesh->corner_verts_for_write().data();
-  config.face_offsets = mesh->face_offsets_for_write().data();
+  /* Only written by #read_mpolys, which gets mutable arrays when the topology changes. */
+  config.corner_verts = mesh->corner_verts().data();
+  config.face_offsets = mesh->face_offsets().data();
   config.totvert = mesh->verts_num;
   config.totloop = mesh->corners_num;
   config.faces_num = mesh->faces_num;
@@ -504,6 +535,107 @@ static CDStreamConfig get_config(Mesh *mesh)
 
 /* ************************************************************************** */
 
+/* -------------------------------------------------------------------- */
+/** \name Sample Cache
+ *
+ * Reading a frame checks the topology and then reads the mesh, which used to decode the same
+ * sample several times. The last sample is kept instead, and while the cache is streamed by the
+ * Mesh Sequence Cache modifier the next sample in the playback direction is read on a worker
+ * thread, so that it is ready when the frame changes.
+ * \{ */
+
+/** Upper limit of the memory used by cached samples of all mesh readers. */
+static constexpr int64_t prefetch_memory_budget = int64_t(1) << 30;
+static std::atomic<int64_t> prefetch_memory_used = 0;
+
+static int64_t sample_memory_size(const IPolyMeshSchema::Sample &sample)
+{
+  int64_t size = 0;
+  if (const P3fArraySamplePtr &positions = sample.getPositions()) {
+    size += int64_t(positions->size()) * sizeof(Alembic::Abc::V3f);
+  }
+  if (const Int32ArraySamplePtr &face_indices = sample.getFaceIndices()) {
+    size += int64_t(face_indices->size()) * sizeof(int32_t);
+  }
+  if (const Int32ArraySamplePtr &face_counts = sample.getFaceCounts()) {
+    size += int64_t(face_counts->size()) * sizeof(int32_t);
+  }
+  return size;
+}
+
+IPolyMeshSchema::Sample AbcMeshReader::get_sample(const ISampleSelector &sample_sel)
+{
+  const index_t index = sample_sel.getIndex(m_schema.getTimeSampling(),
+                                            m_schema.getNumSamples());
+  if (index == m_current_sample.index) {
+    return m_current_sample.sample;
+  }
+
+  prefetch_wait();
+  const index_t previous_index = m_current_sample.index;
+  prefetch_memory_used -= m_current_sample.memory;
+  m_current_sample = {};
+  if (m_prefetched_sample.index == index) {
+    m_current_sample = std::move(m_prefetched_sample);
+    m_prefetched_sample = {};
+  }
+  else {
+    prefetch_memory_used -= m_prefetched_sample.memory;
+    m_prefetched_sample = {};
+    m_current_sample.sample = m_schema.getValue(ISampleSelector(index));
+    m_current_sample.memory = sample_memory_size(m_current_sample.sample);
+    m_current_sample.index = index;
+    prefetch_memory_used += m_current_sample.memory;
+  }
+
+  /* File sequences open a different archive for every frame, nothing can be read ahead. */
+  if (m_use_prefetch && !m_is_reading_a_file_sequence && previous_index != -1) {
+    const index_t next_index = index < previous_index ? index - 1 : index + 1;
+    if (next_index >= 0 && next_index < index_t(m_schema.getNumSamples()) &&
+        prefetch_memory_used + m_current_sample.memory <= prefetch_memory_budget)
+    {
+      prefetch_sample(next_index);
+    }
+  }
+  return m_current_sample.sample;
+}
+
+void AbcMeshReader::prefetch_sample(const index_t index)
+{
+  if (m_prefetch_pool == nullptr) {
+    m_prefetch_pool = BLI_task_pool_create_background(this, TASK_PRIORITY_LOW);
+  }
+  m_prefetched_sample.index = index;
+  BLI_task_pool_push(
+      m_prefetch_pool,
+      [](TaskPool *__restrict pool, void * /*taskdata*/) {
+        AbcMeshReader *reader = static_cast<AbcMeshReader *>(BLI_task_pool_user_data(pool));
+        CachedSample &cached = reader->m_prefetched_sample;
+        try {
+          cached.sample = reader->m_schema.getValue(ISampleSelector(cached.index));
+        }
+        catch (Alembic::Util::Exception & /*ex*/) {
+          /* The error is reported when the sample is read for the frame. */
+          cached = {};
+          return;
+        }
+        cached.memory = sample_memory_size(cached.sample);
+        prefetch_memory_used += cached.memory;
+      },
+      nullptr,
+      false,
+      nullptr);
+}
+
+void AbcMeshReader::prefetch_wait()
+{
+  if (m_prefetch_pool) {
+    BLI_task_pool_work_and_wait(m_prefetch_pool);
+  }
+}
+
+/** \} */
+
 AbcMeshReader::AbcMeshReader(const IObject &object, ImportSettings &settings)
     : AbcObjectReader(object, settings)
 {
@@ -515,6 +647,15 @@ AbcMeshReader::AbcMeshReader(const IObject &object, ImportSettings &settings)
   get_min_max_time(m_iobject, m_schema, m_min_time, m_max_time);
 }
 
+AbcMeshReader::~AbcMeshReader()
+{
+  prefetch_wait();
+  if (m_prefetch_pool) {
+    BLI_task_pool_free(m_prefetch_pool);
+  }
+  prefetch_memory_used -= m_current_sample.memory + m_prefetched_sample.memory;
+}
+
 bool AbcMeshReader::valid() const
 {
   return m_schema.valid();
@@ -625,7 +766,7 @@ bool AbcMeshReader::topology_changed(const Mesh *existing_mesh, const ISampleSel
 {
   IPolyMeshSchema::Sample sample;
   try {
-    sample = m_schema.getValue(sample_sel);
+    sample = get_sample(sample_sel);
   }
   catch (Alembic::Util::Exception &ex) {
     printf("Alembic: error reading mesh sample for '%s/%s' at time %f: %s\n",
@@ -697,6 +838,7 @@ void AbcMeshReader::read_geometry(bke::GeometrySet &geometry_set,
     return;
   }
 
+  m_use_prefetch = true;
   Mesh *new_mesh = read_mesh(mesh, sample_sel, read_flag, velocity_name, velocity_scale, err_str);
 
   geometry_set.replace_mesh(new_mesh);
@@ -711,7 +853,7 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
 {
   IPolyMeshSchema::Sample sample;
   try {
-    sample = m_schema.getValue(sample_sel);
+    sample = get_sample(sample_sel);
   }
   catch (Alembic::Util::Exception &ex) {
     if (err_str != nullptr) {
@@ -752,6 +894,11 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   settings.velocity_name = velocity_name;
   settings.velocity_scale = velocity_scale;
 
+  /* Whether the existing mesh already has the faces and corners of the sample. In that case only
+   * the positions and the other per-frame data are read, and the topology arrays stay shared with
+   * the input mesh (and with its draw caches). */
+  bool reuse_topology = false;
+
   if (topology_changed(existing_mesh, sample_sel)) {
     new_mesh = BKE_mesh_new_nomain_from_template(
         existing_mesh, positions->size(), 0, face_counts->size(), face_indices->size());
@@ -773,6 +920,9 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
             "read!");
       }
     }
+    else {
+      reuse_topology = true;
+    }
   }
 
   Mesh *mesh_to_export = new_mesh ? new_mesh : existing_mesh;
@@ -780,7 +930,8 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   config.time = sample_sel.getRequestedTime();
   config.modifier_error_message = err_str;
 
-  read_mesh_sample(m_iobject.getFullName(), &settings, m_schema, sample_sel, config);
+  read_mesh_sample(
+      m_iobject.getFullName(), &settings, m_schema, sample, sample_sel, reuse_topology, config);
 
   if (new_mesh) {
     /* Here we assume that the number of materials doesn't change, i.e. that
@@ -900,7 +1051,7 @@ static void read_subd_sample(const std::string &iobject_full_name,
     /* Alembic's 'SubD' scheme is used to store subdivision surfaces, i.e. the pre-subdivision
      * mesh. Currently we don't add a subdivision modifier when we load such data. This code is
      * assuming that the subdivided surface should be smooth. */
-    read_mpolys(config, abc_mesh_data);
+    read_mpolys(config, abc_mesh_data, true);
     process_no_normals(config);
   }
 
@@ -1127,6 +1278,7 @@ void AbcSubDReader::read_geometry(bke::GeometrySet &geometry_set,
     return;
   }
 
+  m_use_prefetch = true;
   Mesh *new_mesh = read_mesh(mesh, sample_sel, read_flag, velocity_name, velocity_scale, err_str);
 
   geometry_set.replace_mesh(new_mesh);
@@ -15,14 +15,30 @@
 #include <Alembic/AbcGeom/ISubD.h>
 
 struct Mesh;
+struct TaskPool;
 
 namespace blender::io::alembic {
 
 class AbcMeshReader final : public AbcObjectReader {
   Alembic::AbcGeom::IPolyMeshSchema m_schema;
 
+  /** A decoded sample, with the number of bytes of its arrays. */
+  struct CachedSample {
+    Alembic::AbcCoreAbstract::index_t index = -1;
+    Alembic::AbcGeom::IPolyMeshSchema::Sample sample;
+    int64_t memory = 0;
+  };
+  /** Last sample returned by #get_sample, shared by the topology check and the reading. */
+  CachedSample m_current_sample;
+  /** Sample read ahead on a worker thread, only accessed after #prefetch_wait. */
+  CachedSample m_prefetched_sample;
+  TaskPool *m_prefetch_pool = nullptr;
+  /** Read ahead only while streaming the cache, not for the initial import. */
+  bool m_use_prefetch = false;
+
  public:
   AbcMeshReader(const Alembic::Abc::IObject &object, ImportSettings &settings);
+  ~AbcMeshReader() override;
 
   bool valid() const override;
   bool accepts_object_type(const Alembic::AbcCoreAbstract::ObjectHeader &alembic_header,
@@ -48,6 +64,16 @@ class AbcMeshReader final : public AbcObjectReader {
                         const Alembic::Abc::ISampleSelector &sample_sel) override;
 
  private:
+  /**
+   * Return the sample for the selector, reusing the previously read or prefetched sample when
+   * possible. When prefetching is enabled, this starts reading the sample that follows in the
+   * playback direction. Throws like #IPolyMeshSchema::getValue.
+   */
+  Alembic::AbcGeom::IPolyMeshSchema::Sample get_sample(
+      const Alembic::Abc::ISampleSelector &sample_sel);
+  void prefetch_sample(Alembic::AbcCoreAbstract::index_t index);
+  void prefetch_wait();
+
   void readFaceSetsSample(Main *bmain,
                           Mesh *mesh,
                           const Alembic::AbcGeom::ISampleSelector &sample_sel);
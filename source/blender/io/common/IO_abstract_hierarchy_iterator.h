@@ -39,6 +39,7 @@ namespace blender::io {
 
 class AbstractHierarchyWriter;
 class DupliParentFinder;
+struct DupliDataObject;
 
 /* HierarchyContext structs are created by the AbstractHierarchyIterator. Each HierarchyContext
  * struct contains everything necessary to export a single object to a file. */
@@ -201,10 +202,16 @@ class AbstractHierarchyIterator {
   /* Mapping from ID to its export path. This is used for instancing; given an
    * instanced datablock, the export path of the original can be looked up. */
   typedef std::map<ID *, std::string> ExportPathMap;
+  /* Mapping from instanced geometry to the object that represents it in the export. */
+  typedef std::map<ID *, DupliDataObject *> DupliDataObjectMap;
 
  protected:
   ExportGraph export_graph_;
   ExportPathMap duplisource_export_path_;
+  /* Objects for duplis that instance geometry (for example from geometry nodes) instead of an
+   * object. All instances of the same geometry share one object, so that the geometry is exported
+   * once and referenced by the other instances. Only valid during one iterate_and_write(). */
+  DupliDataObjectMap dupli_data_objects_;
   Main *bmain_;
   Depsgraph *depsgraph_;
   WriterMap writers_;
@@ -258,6 +265,10 @@ class AbstractHierarchyIterator {
                           Object *duplicator,
                           const DupliParentFinder &dupli_parent_finder);
 
+  /* Return the object to export for the dupli. This is the duplicated object itself, or an
+   * evaluated copy of it that uses the instanced geometry as its data. */
+  Object *get_dupli_export_object(const DupliObject *dupli_object);
+
   void context_update_for_graph_index(HierarchyContext *context,
                                       const ExportGraph::key_type &graph_index) const;
 
@@ -14,6 +14,7 @@
 #include "BKE_duplilist.hh"
 #include "BKE_key.hh"
 #include "BKE_object.hh"
+#include "BKE_object_types.hh"
 #include "BKE_particle.h"
 
 #include "BLI_assert.h"
@@ -29,8 +30,15 @@
 
 #include "DEG_depsgraph_query.hh"
 
+#include "MEM_guardedalloc.h"
+
 namespace blender::io {
 
+struct DupliDataObject {
+  Object object;
+  bke::ObjectRuntime runtime;
+};
+
 const HierarchyContext *HierarchyContext::root()
 {
   return nullptr;
@@ -398,6 +406,15 @@ void AbstractHierarchyIterator::export_graph_clear()
     }
   }
   export_graph_.clear();
+
+  /* The instanced geometry is owned by the evaluated duplicator, so the pointers cannot be used
+   * to find the originals in the next frame. */
+  for (const DupliDataObjectMap::value_type &it : dupli_data_objects_) {
+    duplisource_export_path_.erase(it.first);
+    duplisource_export_path_.erase(&it.second->object.id);
+    MEM_delete(it.second);
+  }
+  dupli_data_objects_.clear();
 }
 
 void AbstractHierarchyIterator::visit_object(Object *object,
@@ -445,7 +462,7 @@ void AbstractHierarchyIterator::visit_dupli_object(DupliObject *dupli_object,
                                                    const DupliParentFinder &dupli_parent_finder)
 {
   HierarchyContext *context = new HierarchyContext();
-  context->object = dupli_object->ob;
+  context->object = get_dupli_export_object(dupli_object);
   context->duplicator = duplicator;
   context->persistent_id = PersistentID(dupli_object);
   context->weak_export = false;
@@ -476,11 +493,34 @@ AbstractHierarchyIterator::ExportGraph::key_type AbstractHierarchyIterator::
   const DupliObject *dupli_parent = dupli_parent_finder.find_suitable_export_parent(dupli_object);
 
   if (dupli_parent != nullptr) {
-    return ObjectIdentifier::for_duplicated_object(dupli_parent, context->duplicator);
+    ObjectIdentifier parent_id = ObjectIdentifier::for_duplicated_object(dupli_parent,
+                                                                         context->duplicator);
+    /* Match the key of the parent's own context, see visit_dupli_object(). */
+    parent_id.object = get_dupli_export_object(dupli_parent);
+    return parent_id;
   }
   return ObjectIdentifier::for_real_object(context->duplicator);
 }
 
+Object *AbstractHierarchyIterator::get_dupli_export_object(const DupliObject *dupli_object)
+{
+  ID *ob_data = dupli_object->ob_data;
+  if (ob_data == nullptr || ob_data == dupli_object->ob->data) {
+    return dupli_object->ob;
+  }
+
+  DupliDataObject *&data_object = dupli_data_objects_[ob_data];
+  if (data_object == nullptr) {
+    /* Same as the temporary dupli objects of the depsgraph object iterator. */
+    data_object = MEM_new<DupliDataObject>(__func__);
+    data_object->object = dna::shallow_copy(*dupli_object->ob);
+    data_object->runtime = *dupli_object->ob->runtime;
+    data_object->object.runtime = &data_object->runtime;
+    BKE_object_replace_data_on_shallow_copy(&data_object->object, ob_data);
+  }
+  return &data_object->object;
+}
+
 void AbstractHierarchyIterator::context_update_for_graph_index(
     HierarchyContext *context, const ExportGraph::key_type &graph_index) const
 {
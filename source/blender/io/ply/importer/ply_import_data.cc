@@ -10,63 +10,15 @@
 #include "ply_data.hh"
 #include "ply_import_buffer.hh"
 
+#include "BLI_array.hh"
 #include "BLI_endian_switch.h"
+#include "BLI_offset_indices.hh"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 
-#include "fast_float.h"
+#include "IO_string_utils.hh"
 
-#include <charconv>
-
-static bool is_whitespace(char c)
-{
-  return c <= ' ';
-}
-
-static const char *drop_whitespace(const char *p, const char *end)
-{
-  while (p < end && is_whitespace(*p)) {
-    ++p;
-  }
-  return p;
-}
-
-static const char *drop_non_whitespace(const char *p, const char *end)
-{
-  while (p < end && !is_whitespace(*p)) {
-    ++p;
-  }
-  return p;
-}
-
-static const char *drop_plus(const char *p, const char *end)
-{
-  if (p < end && *p == '+') {
-    ++p;
-  }
-  return p;
-}
-
-static const char *parse_float(const char *p, const char *end, float fallback, float &dst)
-{
-  p = drop_whitespace(p, end);
-  p = drop_plus(p, end);
-  fast_float::from_chars_result res = fast_float::from_chars(p, end, dst);
-  if (ELEM(res.ec, std::errc::invalid_argument, std::errc::result_out_of_range)) {
-    dst = fallback;
-  }
-  return res.ptr;
-}
-
-static const char *parse_int(const char *p, const char *end, int fallback, int &dst)
-{
-  p = drop_whitespace(p, end);
-  p = drop_plus(p, end);
-  std::from_chars_result res = std::from_chars(p, end, dst);
-  if (ELEM(res.ec, std::errc::invalid_argument, std::errc::result_out_of_range)) {
-    dst = fallback;
-  }
-  return res.ptr;
-}
+#include <algorithm>
 
 static void endian_switch(uint8_t *ptr, int type_size)
 {
@@ -127,13 +79,8 @@ static int get_index(const PlyElement &element, StringRef property)
   return -1;
 }
 
-static const char *parse_row_ascii(PlyReadBuffer &file, Vector<float> &r_values)
+static void parse_values_ascii(const Span<char> line, MutableSpan<float> r_values)
 {
-  Span<char> line = file.read_line();
-  if (line.is_empty()) {
-    return "Could not read row of ascii property";
-  }
-
   /* Parse whole line as floats. */
   const char *p = line.data();
   const char *end = p + line.size();
@@ -143,6 +90,49 @@ static const char *parse_row_ascii(PlyReadBuffer &file, Vector<float> &r_values)
     p = parse_float(p, end, 0.0f, val);
     r_values[value_idx++] = val;
   }
+}
+
+static const char *parse_row_ascii(PlyReadBuffer &file, Vector<float> &r_values)
+{
+  Span<char> line = file.read_line();
+  if (line.is_empty()) {
+    return "Could not read row of ascii property";
+  }
+  parse_values_ascii(line, r_values);
+  return nullptr;
+}
+
+/**
+ * Parse the next `rows_num` ascii rows in parallel. The lines are copied out of the read buffer
+ * first, then every line is parsed into its own `values_per_row` values of `r_values`.
+ */
+static const char *parse_rows_ascii(PlyReadBuffer &file,
+                                    const int rows_num,
+                                    const int values_per_row,
+                                    Vector<char> &r_text,
+                                    Vector<int> &r_line_offsets,
+                                    MutableSpan<float> r_values)
+{
+  r_text.clear();
+  r_line_offsets.clear();
+  for (int i = 0; i < rows_num; i++) {
+    Span<char> line = file.read_line();
+    if (line.is_empty()) {
+      return "Could not read row of ascii property";
+    }
+    r_line_offsets.append(int(r_text.size()));
+    r_text.extend(line);
+  }
+  r_line_offsets.append(int(r_text.size()));
+
+  const OffsetIndices<int> lines = r_line_offsets.as_span();
+  threading::parallel_for(IndexRange(rows_num), 256, [&](const IndexRange range) {
+    for (const int i : range) {
+      MutableSpan<float> row_values = r_values.slice(i * values_per_row, values_per_row);
+      row_values.fill(0.0f);
+      parse_values_ascii(r_text.as_span().slice(lines[i]), row_values);
+    }
+  });
   return nullptr;
 }
 
@@ -293,34 +283,22 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     scratch.resize(element.stride);
   }
 
-  for (int i = 0; i < element.count; i++) {
-
-    const char *error = nullptr;
-    if (header.type == PlyFormatType::ASCII) {
-      error = parse_row_ascii(file, value_vec);
-    }
-    else {
-      error = parse_row_binary(file, header, element, scratch, value_vec);
-    }
-    if (error != nullptr) {
-      return error;
-    }
-
+  auto add_vertex = [&](const Span<float> row, const int i) {
     /* Vertex coord */
     float3 vertex3;
-    vertex3.x = value_vec[vertex_index.x];
-    vertex3.y = value_vec[vertex_index.y];
-    vertex3.z = value_vec[vertex_index.z];
+    vertex3.x = row[vertex_index.x];
+    vertex3.y = row[vertex_index.y];
+    vertex3.z = row[vertex_index.z];
     data->vertices.append(vertex3);
 
     /* Vertex color */
     if (has_color) {
       float4 colors4;
-      colors4.x = value_vec[color_index.x] / color_norm.x;
-      colors4.y = value_vec[color_index.y] / color_norm.y;
-      colors4.z = value_vec[color_index.z] / color_norm.z;
+      colors4.x = row[color_index.x] / color_norm.x;
+      colors4.y = row[color_index.y] / color_norm.y;
+      colors4.z = row[color_index.z] / color_norm.z;
       if (has_alpha) {
-        colors4.w = value_vec[alpha_index] / color_norm.w;
+        colors4.w = row[alpha_index] / color_norm.w;
       }
       else {
         colors4.w = 1.0f;
@@ -331,25 +309,54 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     /* If normals */
     if (has_normal) {
       float3 normals3;
-      normals3.x = value_vec[normal_index.x];
-      normals3.y = value_vec[normal_index.y];
-      normals3.z = value_vec[normal_index.z];
+      normals3.x = row[normal_index.x];
+      normals3.y = row[normal_index.y];
+      normals3.z = row[normal_index.z];
       data->vertex_normals.append(normals3);
     }
 
     /* If uv */
     if (has_uv) {
       float2 uvmap;
-      uvmap.x = value_vec[uv_index.x];
-      uvmap.y = value_vec[uv_index.y];
+      uvmap.x = row[uv_index.x];
+      uvmap.y = row[uv_index.y];
       data->uv_coordinates.append(uvmap);
     }
 
     /* Custom attributes */
     for (const int64_t ci : custom_attr_indices.index_range()) {
-      float value = value_vec[custom_attr_indices[ci]];
+      float value = row[custom_attr_indices[ci]];
       data->vertex_custom_attr[ci].data[i] = value;
     }
+  };
+
+  if (header.type == PlyFormatType::ASCII) {
+    /* Parse batches of rows in parallel, the values only depend on their own line. */
+    const int batch_rows = 16 * 1024;
+    const int values_per_row = int(element.properties.size());
+    Vector<char> text;
+    Vector<int> line_offsets;
+    Array<float> values(int64_t(std::min(batch_rows, element.count)) * values_per_row);
+    for (int batch_start = 0; batch_start < element.count; batch_start += batch_rows) {
+      const int rows_num = std::min(batch_rows, element.count - batch_start);
+      const char *error = parse_rows_ascii(
+          file, rows_num, values_per_row, text, line_offsets, values);
+      if (error != nullptr) {
+        return error;
+      }
+      for (const int i : IndexRange(rows_num)) {
+        add_vertex(values.as_span().slice(i * values_per_row, values_per_row), batch_start + i);
+      }
+    }
+    return nullptr;
+  }
+
+  for (int i = 0; i < element.count; i++) {
+    const char *error = parse_row_binary(file, header, element, scratch, value_vec);
+    if (error != nullptr) {
+      return error;
+    }
+    add_vertex(value_vec, i);
   }
   return nullptr;
 }
@@ -13,9 +13,11 @@
 
 #include "GEO_mesh_merge_by_distance.hh"
 
+#include "BLI_array_utils.hh"
 #include "BLI_color.hh"
 #include "BLI_math_vector.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "ply_import_mesh.hh"
 
@@ -52,20 +54,23 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
     MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
 
     /* Fill in face data. */
-    uint32_t offset = 0;
     for (const int i : data.face_sizes.index_range()) {
-      uint32_t size = data.face_sizes[i];
-      face_offsets[i] = offset;
-      for (int j = 0; j < size; j++) {
-        uint32_t v = data.face_vertices[offset + j];
-        if (v >= mesh->verts_num) {
-          fprintf(stderr, "Invalid PLY vertex index in face %i loop %i: %u\n", i, j, v);
-          v = 0;
+      face_offsets[i] = int(data.face_sizes[i]);
+    }
+    const OffsetIndices faces = offset_indices::accumulate_counts_to_offsets(face_offsets);
+    threading::parallel_for(faces.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        const IndexRange face = faces[i];
+        for (const int j : IndexRange(face.size())) {
+          uint32_t v = data.face_vertices[face[j]];
+          if (v >= mesh->verts_num) {
+            fprintf(stderr, "Invalid PLY vertex index in face %i loop %i: %u\n", i, j, v);
+            v = 0;
+          }
+          corner_verts[face[j]] = int(v);
         }
-        corner_verts[offset + j] = data.face_vertices[offset + j];
       }
-      offset += size;
-    }
+    });
   }
 
   /* Vertex colors */
@@ -75,14 +80,14 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
         "Col", bke::AttrDomain::Point);
 
     if (params.vertex_colors == PLY_VERTEX_COLOR_SRGB) {
-      for (const int i : data.vertex_colors.index_range()) {
-        srgb_to_linearrgb_v4(colors.span[i], data.vertex_colors[i]);
-      }
+      threading::parallel_for(data.vertex_colors.index_range(), 4096, [&](const IndexRange range) {
+        for (const int i : range) {
+          srgb_to_linearrgb_v4(colors.span[i], data.vertex_colors[i]);
+        }
+      });
     }
     else {
-      for (const int i : data.vertex_colors.index_range()) {
-        copy_v4_v4(colors.span[i], data.vertex_colors[i]);
-      }
+      colors.span.copy_from(data.vertex_colors.as_span().cast<ColorGeometry4f>());
     }
     colors.finish();
     BKE_id_attributes_active_color_set(&mesh->id, "Col");
@@ -93,9 +98,8 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
   if (!data.uv_coordinates.is_empty()) {
     bke::SpanAttributeWriter<float2> uv_map = attributes.lookup_or_add_for_write_only_span<float2>(
         "UVMap", bke::AttrDomain::Corner);
-    for (const int i : data.face_vertices.index_range()) {
-      uv_map.span[i] = data.uv_coordinates[data.face_vertices[i]];
-    }
+    array_utils::gather(
+        data.uv_coordinates.as_span(), data.face_vertices.as_span(), uv_map.span);
     uv_map.finish();
   }
 
@@ -9,9 +9,12 @@
 #include <cstdint>
 #include <cstdio>
 
+#include "BKE_lib_id.hh"
 #include "BKE_mesh.hh"
 
 #include "BLI_array.hh"
+#include "BLI_memory_utils.hh"
+#include "BLI_mmap.h"
 
 #include "DNA_mesh_types.h"
 
@@ -24,7 +27,6 @@ namespace blender::io::stl {
 
 Mesh *read_stl_binary(FILE *file, const bool use_custom_normals)
 {
-  const int chunk_size = 1024;
   uint32_t num_tris = 0;
   fseek(file, BINARY_HEADER_SIZE, SEEK_SET);
   if (fread(&num_tris, sizeof(uint32_t), 1, file) != 1) {
@@ -36,16 +38,29 @@ Mesh *read_stl_binary(FILE *file, const bool use_custom_normals)
     return BKE_mesh_new_nomain(0, 0, 0, 0);
   }
 
-  Array<PackedTriangle> tris_buf(chunk_size);
-  STLMeshHelper stl_mesh(num_tris, use_custom_normals);
-  size_t num_read_tris;
-  while ((num_read_tris = fread(tris_buf.data(), sizeof(PackedTriangle), chunk_size, file))) {
-    for (size_t i = 0; i < num_read_tris; i++) {
-      stl_mesh.add_triangle(tris_buf[i]);
+  const size_t tris_offset = BINARY_HEADER_SIZE + sizeof(uint32_t);
+  const size_t tris_size = size_t(num_tris) * BINARY_STRIDE;
+  if (BLI_mmap_file *mmap_file = BLI_mmap_open(fileno(file))) {
+    BLI_SCOPED_DEFER([&]() { BLI_mmap_free(mmap_file); });
+    if (BLI_mmap_get_length(mmap_file) >= tris_offset + tris_size) {
+      BLI_mmap_advise(mmap_file, tris_offset, tris_size, BLI_MMAP_ADVICE_WILLNEED);
+      const PackedTriangle *tris = reinterpret_cast<const PackedTriangle *>(
+          static_cast<const char *>(BLI_mmap_get_pointer(mmap_file)) + tris_offset);
+      Mesh *mesh = stl_triangles_to_mesh({tris, num_tris}, use_custom_normals);
+      if (BLI_mmap_any_io_error(mmap_file)) {
+        BKE_id_free(nullptr, mesh);
+        return nullptr;
+      }
+      return mesh;
     }
   }
 
-  return stl_mesh.to_mesh();
+  /* Memory mapping is not available, read all triangles at once instead. */
+  Array<PackedTriangle> tris(num_tris, NoInitialization());
+  fseek(file, long(tris_offset), SEEK_SET);
+  const size_t num_read_tris = fread(tris.data(), sizeof(PackedTriangle), num_tris, file);
+  return stl_triangles_to_mesh(tris.as_span().take_front(int64_t(num_read_tris)),
+                               use_custom_normals);
 }
 
 }  // namespace blender::io::stl
@@ -25,6 +25,10 @@ struct Mesh;
 
 namespace blender::io::stl {
 
+/**
+ * Read the triangles of a binary STL file, memory mapping it when possible so the triangles are
+ * decoded straight from the file into the mesh.
+ */
 Mesh *read_stl_binary(FILE *file, bool use_custom_normals);
 
 }  // namespace blender::io::stl
@@ -6,12 +6,17 @@
  * \ingroup stl
  */
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 
 #include "BKE_mesh.hh"
 
 #include "BLI_array_utils.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_map.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "DNA_mesh_types.h"
 
@@ -53,16 +58,21 @@ bool STLMeshHelper::add_triangle(const PackedTriangle &data)
   return true;
 }
 
-Mesh *STLMeshHelper::to_mesh()
+static void report_removed_triangles(const int degenerate_tris_num, const int duplicate_tris_num)
 {
-  if (degenerate_tris_num_ > 0) {
-    std::cout << "STL Importer: " << degenerate_tris_num_ << " degenerate triangles were removed"
+  if (degenerate_tris_num > 0) {
+    std::cout << "STL Importer: " << degenerate_tris_num << " degenerate triangles were removed"
               << std::endl;
   }
-  if (duplicate_tris_num_ > 0) {
-    std::cout << "STL Importer: " << duplicate_tris_num_ << " duplicate triangles were removed"
+  if (duplicate_tris_num > 0) {
+    std::cout << "STL Importer: " << duplicate_tris_num << " duplicate triangles were removed"
               << std::endl;
   }
+}
+
+Mesh *STLMeshHelper::to_mesh()
+{
+  report_removed_triangles(degenerate_tris_num_, duplicate_tris_num_);
 
   Mesh *mesh = BKE_mesh_new_nomain(verts_.size(), 0, tris_.size(), tris_.size() * 3);
   mesh->vert_positions_for_write().copy_from(verts_);
@@ -79,4 +89,146 @@ Mesh *STLMeshHelper::to_mesh()
   return mesh;
 }
 
+/** Three values compared bit-wise, used for both vertex positions and sorted triangle indices. */
+struct WeldKey {
+  uint32_t a, b, c;
+
+  uint64_t hash() const
+  {
+    uint64_t h = (uint64_t(a) * 0x9E3779B97F4A7C15ull) ^ (uint64_t(b) * 0xC2B2AE3D27D4EB4Full) ^
+                 (uint64_t(c) * 0x165667B19E3779F9ull);
+    return h ^ (h >> 29);
+  }
+  friend bool operator==(const WeldKey &x, const WeldKey &y)
+  {
+    return x.a == y.a && x.b == y.b && x.c == y.c;
+  }
+};
+
+static WeldKey weld_key_from_position(const float3 &position)
+{
+  WeldKey key;
+  memcpy(&key, &position, sizeof(key));
+  return key;
+}
+
+/**
+ * For every element, find the index of the first element with the same key. The elements are
+ * distributed into buckets by hash, and each bucket is de-duplicated with its own hash map in
+ * parallel. Since every bucket is processed in index order, the result is the same as adding all
+ * elements to a single #VectorSet in order.
+ */
+template<typename GetKeyFn>
+static Array<int> first_occurrence_indices(const int size, const GetKeyFn &get_key)
+{
+  constexpr int buckets_num = 256;
+  Array<uint8_t> element_buckets(size);
+  threading::parallel_for(IndexRange(size), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      element_buckets[i] = uint8_t(get_key(i).hash() >> 56);
+    }
+  });
+
+  Array<int> bucket_offsets(buckets_num + 1, 0);
+  for (const uint8_t bucket : element_buckets) {
+    bucket_offsets[bucket]++;
+  }
+  const OffsetIndices buckets = offset_indices::accumulate_counts_to_offsets(bucket_offsets);
+  Array<int> bucket_elements(size);
+  {
+    Array<int> bucket_fill(buckets_num, 0);
+    for (const int i : IndexRange(size)) {
+      const int bucket = element_buckets[i];
+      bucket_elements[buckets[bucket][bucket_fill[bucket]++]] = i;
+    }
+  }
+
+  Array<int> first_indices(size);
+  threading::parallel_for(buckets.index_range(), 1, [&](const IndexRange range) {
+    Map<WeldKey, int> first_by_key;
+    for (const int bucket : range) {
+      const Span<int> elements = bucket_elements.as_span().slice(buckets[bucket]);
+      first_by_key.clear();
+      first_by_key.reserve(elements.size());
+      for (const int i : elements) {
+        first_indices[i] = first_by_key.lookup_or_add(get_key(i), i);
+      }
+    }
+  });
+  return first_indices;
+}
+
+Mesh *stl_triangles_to_mesh(const Span<PackedTriangle> tris, const bool use_custom_normals)
+{
+  const int tris_num = int(tris.size());
+  const int corners_num = tris_num * 3;
+
+  /* Merge vertices with the same position, numbered in order of their first use. */
+  const Array<int> corner_first_corner = first_occurrence_indices(corners_num, [&](const int i) {
+    return weld_key_from_position(tris[i / 3].vertices[i % 3]);
+  });
+  Array<int> corner_vert_indices(corners_num);
+  int verts_num = 0;
+  for (const int corner : IndexRange(corners_num)) {
+    const int first_corner = corner_first_corner[corner];
+    corner_vert_indices[corner] = first_corner == corner ? verts_num++ :
+                                                           corner_vert_indices[first_corner];
+  }
+
+  /* Remove degenerate triangles and all but the first of the triangles using the same
+   * vertices. Degenerate triangles can't match non-degenerate ones, as they repeat a vertex. */
+  const Array<int> tri_first_tri = first_occurrence_indices(tris_num, [&](const int i) {
+    std::array<int, 3> verts = {corner_vert_indices[i * 3],
+                                corner_vert_indices[i * 3 + 1],
+                                corner_vert_indices[i * 3 + 2]};
+    std::sort(verts.begin(), verts.end());
+    return WeldKey{uint32_t(verts[0]), uint32_t(verts[1]), uint32_t(verts[2])};
+  });
+  Array<bool> tri_is_degenerate(tris_num);
+  Array<bool> tri_is_used(tris_num);
+  threading::parallel_for(IndexRange(tris_num), 4096, [&](const IndexRange range) {
+    for (const int tri : range) {
+      const int v1 = corner_vert_indices[tri * 3];
+      const int v2 = corner_vert_indices[tri * 3 + 1];
+      const int v3 = corner_vert_indices[tri * 3 + 2];
+      tri_is_degenerate[tri] = (v1 == v2) || (v1 == v3) || (v2 == v3);
+      tri_is_used[tri] = !tri_is_degenerate[tri] && tri_first_tri[tri] == tri;
+    }
+  });
+  IndexMaskMemory memory;
+  const IndexMask used_tris = IndexMask::from_bools(tri_is_used, memory);
+  const int degenerate_tris_num = int(
+      array_utils::count_booleans(VArray<bool>::ForSpan(tri_is_degenerate)));
+  report_removed_triangles(degenerate_tris_num,
+                           tris_num - int(used_tris.size()) - degenerate_tris_num);
+
+  Mesh *mesh = BKE_mesh_new_nomain(verts_num, 0, used_tris.size(), used_tris.size() * 3);
+  MutableSpan<float3> positions = mesh->vert_positions_for_write();
+  threading::parallel_for(IndexRange(corners_num), 4096, [&](const IndexRange range) {
+    for (const int corner : range) {
+      if (corner_first_corner[corner] == corner) {
+        positions[corner_vert_indices[corner]] = tris[corner / 3].vertices[corner % 3];
+      }
+    }
+  });
+  offset_indices::fill_constant_group_size(3, 0, mesh->face_offsets_for_write());
+  MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
+  used_tris.foreach_index(GrainSize(4096), [&](const int tri, const int face) {
+    corner_verts.slice(face * 3, 3).copy_from(corner_vert_indices.as_span().slice(tri * 3, 3));
+  });
+
+  /* NOTE: edges must be calculated first before setting custom normals. */
+  bke::mesh_calc_edges(*mesh, false, false);
+
+  if (use_custom_normals && !used_tris.is_empty()) {
+    Array<float3> corner_normals(mesh->corners_num);
+    used_tris.foreach_index(GrainSize(4096), [&](const int tri, const int face) {
+      corner_normals.as_mutable_span().slice(face * 3, 3).fill(tris[tri].normal);
+    });
+    BKE_mesh_set_custom_normals(mesh, reinterpret_cast<float(*)[3]>(corner_normals.data()));
+  }
+
+  return mesh;
+}
+
 }  // namespace blender::io::stl
@@ -11,6 +11,7 @@
 #include <cstdint>
 
 #include "BLI_math_vector_types.hh"
+#include "BLI_span.hh"
 #include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
 #include "stl_data.hh"
@@ -67,4 +68,10 @@ class STLMeshHelper {
   Mesh *to_mesh();
 };
 
+/**
+ * Create a mesh from binary STL triangles, which can be directly mapped from the file. Duplicate
+ * vertices and triangles are merged in parallel, with the same result as #STLMeshHelper.
+ */
+Mesh *stl_triangles_to_mesh(Span<PackedTriangle> tris, bool use_custom_normals);
+
 }  // namespace blender::io::stl
@@ -16,6 +16,7 @@
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
 #include "BKE_geometry_set.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_main.hh"
 #include "BKE_material.h"
 #include "BKE_mesh.hh"
@@ -157,10 +158,18 @@ USDMeshReader::USDMeshReader(const pxr::UsdPrim &prim,
       mesh_prim_(prim),
       is_left_handed_(false),
       is_time_varying_(false),
-      is_initial_load_(false)
+      is_initial_load_(false),
+      prefetched_mesh_(nullptr)
 {
 }
 
+USDMeshReader::~USDMeshReader()
+{
+  if (prefetched_mesh_ && (object_ == nullptr || prefetched_mesh_ != object_->data)) {
+    BKE_id_free(nullptr, prefetched_mesh_);
+  }
+}
+
 static const std::optional<bke::AttrDomain> convert_usd_varying_to_blender(
     const pxr::TfToken usd_domain)
 {
@@ -195,10 +204,8 @@ void USDMeshReader::create_object(Main *bmain, const double /*motionSampleTime*/
   object_->data = mesh;
 }
 
-void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+Mesh *USDMeshReader::read_initial_mesh(Mesh *mesh, const double motionSampleTime)
 {
-  Mesh *mesh = (Mesh *)object_->data;
-
   is_initial_load_ = true;
   const USDMeshReadParams params = create_mesh_read_params(motionSampleTime,
                                                            import_params_.mesh_read_flag);
@@ -206,6 +213,24 @@ void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
   Mesh *read_mesh = this->read_mesh(mesh, params, nullptr);
 
   is_initial_load_ = false;
+  return read_mesh;
+}
+
+void USDMeshReader::prefetch_object_data(const double motionSampleTime)
+{
+  prefetched_mesh_ = this->read_initial_mesh((Mesh *)object_->data, motionSampleTime);
+}
+
+void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+{
+  Mesh *mesh = (Mesh *)object_->data;
+
+  Mesh *read_mesh = prefetched_mesh_;
+  prefetched_mesh_ = nullptr;
+  if (read_mesh == nullptr) {
+    read_mesh = this->read_initial_mesh(mesh, motionSampleTime);
+  }
+
   if (read_mesh != mesh) {
     BKE_mesh_nomain_to_mesh(read_mesh, mesh, object_);
   }
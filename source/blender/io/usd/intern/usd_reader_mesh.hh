@@ -40,14 +40,19 @@ class USDMeshReader : public USDGeomReader {
    * implemented.  Note this will break if faces or positions vary. */
   bool is_initial_load_;
 
+  /** Mesh read by #prefetch_object_data, consumed by #read_object_data. */
+  Mesh *prefetched_mesh_;
+
  public:
   USDMeshReader(const pxr::UsdPrim &prim,
                 const USDImportParams &import_params,
                 const ImportSettings &settings);
+  ~USDMeshReader() override;
 
   bool valid() const override;
 
   void create_object(Main *bmain, double motionSampleTime) override;
+  void prefetch_object_data(double motionSampleTime) override;
   void read_object_data(Main *bmain, double motionSampleTime) override;
 
   void read_geometry(bke::GeometrySet &geometry_set,
@@ -71,6 +76,7 @@ class USDMeshReader : public USDGeomReader {
   void process_normals_face_varying(Mesh *mesh);
   /** Set USD uniform (per-face) normals as Blender loop normals. */
   void process_normals_uniform(Mesh *mesh);
+  Mesh *read_initial_mesh(Mesh *mesh, double motionSampleTime);
   void readFaceSetsSample(Main *bmain, Mesh *mesh, double motionSampleTime);
   void assign_facesets_to_material_indices(double motionSampleTime,
                                            MutableSpan<int> material_indices,
@@ -108,6 +108,12 @@ class USDPrimReader {
   virtual bool valid() const;
 
   virtual void create_object(Main *bmain, double motionSampleTime) = 0;
+  /**
+   * Read the object data that does not require access to #Main (e.g. mesh geometry) ahead of
+   * #read_object_data. Called for many readers in parallel after all objects are created,
+   * so implementations may only modify data owned by this reader.
+   */
+  virtual void prefetch_object_data(double /*motionSampleTime*/){};
   virtual void read_object_data(Main * /*bmain*/, double /*motionSampleTime*/){};
 
   Object *object() const;
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <charconv>
+#include <cmath>
 #include <cstdio>
 #include <type_traits>
 
@@ -71,19 +73,32 @@ class FormatHandler : NonCopyable, NonMovable {
 
   void write_obj_vertex(float x, float y, float z)
   {
-    write_impl("v {:.6f} {:.6f} {:.6f}\n", x, y, z);
+    char *dst = write_begin(max_record_len);
+    dst = append_str(dst, "v");
+    dst = append_fixed<6>(append_fixed<6>(append_fixed<6>(dst, x), y), z);
+    write_end(append_str(dst, "\n"));
   }
   void write_obj_vertex_color(float x, float y, float z, float r, float g, float b)
   {
-    write_impl("v {:.6f} {:.6f} {:.6f} {:.4f} {:.4f} {:.4f}\n", x, y, z, r, g, b);
+    char *dst = write_begin(max_record_len);
+    dst = append_str(dst, "v");
+    dst = append_fixed<6>(append_fixed<6>(append_fixed<6>(dst, x), y), z);
+    dst = append_fixed<4>(append_fixed<4>(append_fixed<4>(dst, r), g), b);
+    write_end(append_str(dst, "\n"));
   }
   void write_obj_uv(float x, float y)
   {
-    write_impl("vt {:.6f} {:.6f}\n", x, y);
+    char *dst = write_begin(max_record_len);
+    dst = append_str(dst, "vt");
+    dst = append_fixed<6>(append_fixed<6>(dst, x), y);
+    write_end(append_str(dst, "\n"));
   }
   void write_obj_normal(float x, float y, float z)
   {
-    write_impl("vn {:.4f} {:.4f} {:.4f}\n", x, y, z);
+    char *dst = write_begin(max_record_len);
+    dst = append_str(dst, "vn");
+    dst = append_fixed<4>(append_fixed<4>(append_fixed<4>(dst, x), y), z);
+    write_end(append_str(dst, "\n"));
   }
   void write_obj_face_begin()
   {
@@ -95,19 +110,23 @@ class FormatHandler : NonCopyable, NonMovable {
   }
   void write_obj_face_v_uv_normal(int v, int uv, int n)
   {
-    write_impl(" {}/{}/{}", v, uv, n);
+    char *dst = append_int(append_str(write_begin(max_record_len), " "), v);
+    dst = append_int(append_str(append_int(append_str(dst, "/"), uv), "/"), n);
+    write_end(dst);
   }
   void write_obj_face_v_normal(int v, int n)
   {
-    write_impl(" {}//{}", v, n);
+    char *dst = append_int(append_str(write_begin(max_record_len), " "), v);
+    write_end(append_int(append_str(dst, "//"), n));
   }
   void write_obj_face_v_uv(int v, int uv)
   {
-    write_impl(" {}/{}", v, uv);
+    char *dst = append_int(append_str(write_begin(max_record_len), " "), v);
+    write_end(append_int(append_str(dst, "/"), uv));
   }
   void write_obj_face_v(int v)
   {
-    write_impl(" {}", v);
+    write_end(append_int(append_str(write_begin(max_record_len), " "), v));
   }
   void write_obj_usemtl(StringRef s)
   {
@@ -198,6 +217,71 @@ class FormatHandler : NonCopyable, NonMovable {
   }
 
  private:
+  /**
+   * Upper bound of the length of the records written with #write_begin: six numbers formatted by
+   * #append_fixed which are at most 48 characters each, when falling back to fmt.
+   */
+  static constexpr size_t max_record_len = 6 * 48 + 4;
+
+  /**
+   * Format `value` with a leading space, identical to `{:.Precision f}`. The frequently written
+   * coordinates are formatted without going through fmt: a float times a power of ten up to
+   * 10^6 is exact in a double, so rounding it to an integer gives the correctly rounded digits.
+   */
+  template<int Precision> static char *append_fixed(char *dst, const float value)
+  {
+    static_assert(Precision >= 1 && Precision <= 6);
+    constexpr uint64_t scale = Precision == 1 ? 10 :
+                               Precision == 2 ? 100 :
+                               Precision == 3 ? 1000 :
+                               Precision == 4 ? 10000 :
+                               Precision == 5 ? 100000 :
+                                                1000000;
+    *dst++ = ' ';
+    const double scaled = std::nearbyint(std::abs(double(value)) * double(scale));
+    if (!(scaled < 1e15)) {
+      /* Large, infinite or NaN values. */
+      return fmt::format_to(dst, "{:.{}f}", value, Precision);
+    }
+    if (std::signbit(value)) {
+      *dst++ = '-';
+    }
+    const uint64_t digits = uint64_t(scaled);
+    dst = std::to_chars(dst, dst + 20, digits / scale).ptr;
+    *dst++ = '.';
+    uint64_t fraction = digits % scale;
+    for (int i = Precision - 1; i >= 0; i--) {
+      dst[i] = char('0' + fraction % 10);
+      fraction /= 10;
+    }
+    return dst + Precision;
+  }
+  static char *append_int(char *dst, const int value)
+  {
+    return std::to_chars(dst, dst + 12, value).ptr;
+  }
+  template<size_t N> static char *append_str(char *dst, const char (&str)[N])
+  {
+    memcpy(dst, str, N - 1);
+    return dst + N - 1;
+  }
+
+  /* Get space for writing up to `max_len` characters directly at the end of the last block. */
+  char *write_begin(const size_t max_len)
+  {
+    ensure_space(max_len);
+    VectorChar &bb = blocks_.last();
+    const int64_t size = bb.size();
+    bb.resize(size + int64_t(max_len));
+    return bb.data() + size;
+  }
+  /* Finish writing started with #write_begin, `end` is after the last written character. */
+  void write_end(const char *end)
+  {
+    VectorChar &bb = blocks_.last();
+    bb.resize(end - bb.data());
+  }
+
   /* Ensure the last block contains at least this amount of free space.
    * If not, add a new block with max of block size & the amount of space needed. */
   void ensure_space(size_t at_least)
@@ -23,6 +23,7 @@
 
 #include "BLI_math_vector.h"
 #include "BLI_set.hh"
+#include "BLI_task.hh"
 
 #include "IO_wavefront_obj.hh"
 #include "importer_mesh_utils.hh"
@@ -67,12 +68,11 @@ Mesh *MeshFromGeometry::create_mesh(const OBJImportParams &import_params)
 
 Object *MeshFromGeometry::create_mesh_object(
     Main *bmain,
+    Mesh *mesh,
     Map<std::string, std::unique_ptr<MTLMaterial>> &materials,
     Map<std::string, Material *> &created_materials,
     const OBJImportParams &import_params)
 {
-  Mesh *mesh = this->create_mesh(import_params);
-
   if (mesh == nullptr) {
     return nullptr;
   }
@@ -217,44 +217,42 @@ void MeshFromGeometry::create_faces(Mesh *mesh, bool use_vertex_groups)
                                                                 bke::AttrDomain::Face);
   }
 
-  int corner_index = 0;
-
-  for (int face_idx = 0; face_idx < mesh->faces_num; ++face_idx) {
-    const FaceElem &curr_face = mesh_geometry_.face_elements_[face_idx];
-    if (curr_face.corner_count_ < 3) {
-      /* Don't add single vertex face, or edges. */
-      std::cerr << "Face with less than 3 vertices found, skipping." << std::endl;
-      continue;
-    }
-
-    face_offsets[face_idx] = corner_index;
-    if (do_sharp) {
-      sharp_faces.span[face_idx] = !curr_face.shaded_smooth;
-    }
-    material_indices.span[face_idx] = curr_face.material_index;
-    /* Importing obj files without any materials would result in negative indices, which is not
-     * supported. */
-    if (material_indices.span[face_idx] < 0) {
-      material_indices.span[face_idx] = 0;
+  for (const int face_idx : IndexRange(mesh->faces_num)) {
+    face_offsets[face_idx] = mesh_geometry_.face_elements_[face_idx].corner_count_;
+  }
+  const OffsetIndices faces = offset_indices::accumulate_counts_to_offsets(face_offsets);
+
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face_idx : range) {
+      const FaceElem &curr_face = mesh_geometry_.face_elements_[face_idx];
+      BLI_assert(curr_face.corner_count_ >= 3);
+      if (do_sharp) {
+        sharp_faces.span[face_idx] = !curr_face.shaded_smooth;
+      }
+      /* Importing obj files without any materials would result in negative indices, which is not
+       * supported. */
+      material_indices.span[face_idx] = std::max(curr_face.material_index, 0);
+
+      const IndexRange face = faces[face_idx];
+      for (const int idx : IndexRange(curr_face.corner_count_)) {
+        const FaceCorner &curr_corner =
+            mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
+        corner_verts[face[idx]] = mesh_geometry_.global_to_local_vertices_.lookup_default(
+            curr_corner.vert_index, 0);
+      }
     }
-
-    for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
-      const FaceCorner &curr_corner = mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
-      corner_verts[corner_index] = mesh_geometry_.global_to_local_vertices_.lookup_default(
-          curr_corner.vert_index, 0);
-
-      /* Setup vertex group data, if needed. */
-      if (!dverts.is_empty()) {
-        const int group_index = curr_face.vertex_group_index;
-        /* NOTE: face might not belong to any group. */
-        if (group_index >= 0 || true) {
-          MDeformWeight *dw = BKE_defvert_ensure_index(&dverts[corner_verts[corner_index]],
-                                                       group_index);
-          dw->weight = 1.0f;
-        }
+  });
+
+  /* Setup vertex group data, if needed. This is not done in parallel because vertices are shared
+   * between faces. */
+  if (!dverts.is_empty()) {
+    for (const int face_idx : faces.index_range()) {
+      const int group_index = mesh_geometry_.face_elements_[face_idx].vertex_group_index;
+      /* NOTE: face might not belong to any group. */
+      for (const int vert : corner_verts.slice(faces[face_idx])) {
+        MDeformWeight *dw = BKE_defvert_ensure_index(&dverts[vert], group_index);
+        dw->weight = 1.0f;
       }
-
-      corner_index++;
     }
   }
 
@@ -305,24 +303,31 @@ void MeshFromGeometry::create_uv_verts(Mesh *mesh)
   bke::SpanAttributeWriter<float2> uv_map = attributes.lookup_or_add_for_write_only_span<float2>(
       "UVMap", bke::AttrDomain::Corner);
 
-  int corner_index = 0;
-  bool added_uv = false;
-
-  for (const FaceElem &curr_face : mesh_geometry_.face_elements_) {
-    for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
-      const FaceCorner &curr_corner = mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
-      if (curr_corner.uv_vert_index >= 0 &&
-          curr_corner.uv_vert_index < global_vertices_.uv_vertices.size())
-      {
-        uv_map.span[corner_index] = global_vertices_.uv_vertices[curr_corner.uv_vert_index];
-        added_uv = true;
-      }
-      else {
-        uv_map.span[corner_index] = {0.0f, 0.0f};
-      }
-      corner_index++;
-    }
-  }
+  const OffsetIndices faces = mesh->faces();
+  const Span<float2> uv_vertices = global_vertices_.uv_vertices;
+  const bool added_uv = threading::parallel_reduce(
+      faces.index_range(),
+      1024,
+      false,
+      [&](const IndexRange range, bool added) {
+        for (const int face_idx : range) {
+          const FaceElem &curr_face = mesh_geometry_.face_elements_[face_idx];
+          const IndexRange face = faces[face_idx];
+          for (const int idx : IndexRange(curr_face.corner_count_)) {
+            const FaceCorner &curr_corner =
+                mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
+            if (uv_vertices.index_range().contains(curr_corner.uv_vert_index)) {
+              uv_map.span[face[idx]] = uv_vertices[curr_corner.uv_vert_index];
+              added = true;
+            }
+            else {
+              uv_map.span[face[idx]] = {0.0f, 0.0f};
+            }
+          }
+        }
+        return added;
+      },
+      [](const bool a, const bool b) { return a || b; });
 
   uv_map.finish();
 
@@ -397,19 +402,22 @@ void MeshFromGeometry::create_normals(Mesh *mesh)
   }
 
   Array<float3> corner_normals(mesh_geometry_.total_corner_);
-  int corner_index = 0;
-  for (const FaceElem &curr_face : mesh_geometry_.face_elements_) {
-    for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
-      const FaceCorner &curr_corner = mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
-      int n_index = curr_corner.vertex_normal_index;
-      float3 normal(0, 0, 0);
-      if (n_index >= 0 && n_index < global_vertices_.vert_normals.size()) {
-        normal = global_vertices_.vert_normals[n_index];
+  const OffsetIndices faces = mesh->faces();
+  const Span<float3> vert_normals = global_vertices_.vert_normals;
+  threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+    for (const int face_idx : range) {
+      const FaceElem &curr_face = mesh_geometry_.face_elements_[face_idx];
+      const IndexRange face = faces[face_idx];
+      for (const int idx : IndexRange(curr_face.corner_count_)) {
+        const FaceCorner &curr_corner =
+            mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
+        const int n_index = curr_corner.vertex_normal_index;
+        corner_normals[face[idx]] = vert_normals.index_range().contains(n_index) ?
+                                        vert_normals[n_index] :
+                                        float3(0, 0, 0);
       }
-      corner_normals[corner_index] = normal;
-      corner_index++;
     }
-  }
+  });
   BKE_mesh_set_custom_normals(mesh, reinterpret_cast<float(*)[3]>(corner_normals.data()));
 }
 
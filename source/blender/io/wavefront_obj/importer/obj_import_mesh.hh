@@ -34,9 +34,17 @@ class MeshFromGeometry : NonMovable, NonCopyable {
   {
   }
 
+  /**
+   * Create the mesh without adding it to any #Main, so this can be done for many geometries in
+   * parallel. Returns null for empty geometries.
+   */
   Mesh *create_mesh(const OBJImportParams &import_params);
 
+  /**
+   * Create the object for a mesh returned by #create_mesh, taking ownership of the mesh.
+   */
   Object *create_mesh_object(Main *bmain,
+                             Mesh *mesh,
                              Map<std::string, std::unique_ptr<MTLMaterial>> &materials,
                              Map<std::string, Material *> &created_materials,
                              const OBJImportParams &import_params);
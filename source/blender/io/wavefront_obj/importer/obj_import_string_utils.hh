@@ -6,8 +6,11 @@
 
 #include "BLI_string_ref.hh"
 
+#include "IO_string_utils.hh"
+
 /*
- * Various text parsing utilities used by OBJ importer.
+ * Various text parsing utilities used by OBJ importer,
+ * see `IO_string_utils.hh` for the generic ones.
  *
  * Many of these functions take two pointers (p, end) indicating
  * which part of a string to operate on, and return a possibly
@@ -35,58 +38,11 @@ StringRef read_next_line(StringRef &buffer);
  */
 void fixup_line_continuations(char *p, char *end);
 
-/**
- * Drop leading white-space from a string part.
- */
-const char *drop_whitespace(const char *p, const char *end);
-
-/**
- * Drop leading non-white-space from a string part.
- */
-const char *drop_non_whitespace(const char *p, const char *end);
-
-/**
- * Parse an integer from an input string.
- * The parsed result is stored in `dst`. The function skips
- * leading white-space unless `skip_space=false`. If the
- * number can't be parsed (invalid syntax, out of range),
- * `fallback` value is stored instead.
- *
- * Returns the start of remainder of the input string after parsing.
- */
-const char *parse_int(
-    const char *p, const char *end, int fallback, int &dst, bool skip_space = true);
-
-/**
- * Parse a float from an input string.
- * The parsed result is stored in `dst`. The function skips
- * leading white-space unless `skip_space=false`. If the
- * number can't be parsed (invalid syntax, out of range),
- * `fallback` value is stored instead. If `require_trailing_space`
- * is true, the character after the number has to be whitespace.
- *
- * Returns the start of remainder of the input string after parsing.
- */
-const char *parse_float(const char *p,
-                        const char *end,
-                        float fallback,
-                        float &dst,
-                        bool skip_space = true,
-                        bool require_trailing_space = false);
-
-/**
- * Parse a number of white-space separated floats from an input string.
- * The parsed `count` numbers are stored in `dst`. If a
- * number can't be parsed (invalid syntax, out of range),
- * `fallback` value is stored instead.
- *
- * Returns the start of remainder of the input string after parsing.
- */
-const char *parse_floats(const char *p,
-                         const char *end,
-                         float fallback,
-                         float *dst,
-                         int count,
-                         bool require_trailing_space = false);
+/* The generic parsing functions are shared with other importers. */
+using io::drop_non_whitespace;
+using io::drop_whitespace;
+using io::parse_float;
+using io::parse_floats;
+using io::parse_int;
 
 }  // namespace blender::io::obj
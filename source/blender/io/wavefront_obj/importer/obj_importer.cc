@@ -13,6 +13,7 @@
 #include "BLI_sort.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 
 #include "BKE_context.hh"
 #include "BKE_curve_legacy_convert.hh"
@@ -75,18 +76,39 @@ static Collection *find_or_create_collection(Main *bmain,
   return target;
 }
 
+/**
+ * Create the meshes of all mesh geometries in parallel, the other geometries get null.
+ */
+static Array<Mesh *> geometries_to_meshes(const OBJImportParams &import_params,
+                                          const Span<std::unique_ptr<Geometry>> all_geometries,
+                                          const GlobalVertices &global_vertices)
+{
+  Array<Mesh *> meshes(all_geometries.size(), nullptr);
+  threading::parallel_for(all_geometries.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      Geometry &geometry = *all_geometries[i];
+      if (geometry.geom_type_ == GEOM_MESH) {
+        MeshFromGeometry mesh_ob_from_geometry{geometry, global_vertices};
+        meshes[i] = mesh_ob_from_geometry.create_mesh(import_params);
+      }
+    }
+  });
+  return meshes;
+}
+
 static void geometry_to_blender_geometry_set(const OBJImportParams &import_params,
                                              const Span<std::unique_ptr<Geometry>> all_geometries,
                                              const GlobalVertices &global_vertices,
                                              Vector<bke::GeometrySet> &geometries)
 {
-  for (const std::unique_ptr<Geometry> &geometry : all_geometries) {
+  const Array<Mesh *> meshes = geometries_to_meshes(
+      import_params, all_geometries, global_vertices);
+  for (const int i : all_geometries.index_range()) {
+    const std::unique_ptr<Geometry> &geometry = all_geometries[i];
     bke::GeometrySet geometry_set;
 
     if (geometry->geom_type_ == GEOM_MESH) {
-      MeshFromGeometry mesh_ob_from_geometry{*geometry, global_vertices};
-      Mesh *mesh = mesh_ob_from_geometry.create_mesh(import_params);
-      geometry_set = bke::GeometrySet::from_mesh(mesh);
+      geometry_set = bke::GeometrySet::from_mesh(meshes[i]);
     }
     else if (geometry->geom_type_ == GEOM_CURVE) {
       CurveFromGeometry curve_ob_from_geometry(*geometry, global_vertices);
@@ -122,16 +144,21 @@ static void geometry_to_blender_objects(Main *bmain,
         return BLI_strcasecmp(na, nb) < 0;
       });
 
+  /* Building the meshes doesn't need Main, do it for all objects at once. */
+  const Array<Mesh *> meshes = geometries_to_meshes(
+      import_params, all_geometries, global_vertices);
+
   /* Create all the objects. */
   Vector<Object *> objects;
   objects.reserve(all_geometries.size());
   Set<Collection *> collections;
-  for (const std::unique_ptr<Geometry> &geometry : all_geometries) {
+  for (const int i : all_geometries.index_range()) {
+    const std::unique_ptr<Geometry> &geometry = all_geometries[i];
     Object *obj = nullptr;
     if (geometry->geom_type_ == GEOM_MESH) {
       MeshFromGeometry mesh_ob_from_geometry{*geometry, global_vertices};
       obj = mesh_ob_from_geometry.create_mesh_object(
-          bmain, materials, created_materials, import_params);
+          bmain, meshes[i], materials, created_materials, import_params);
     }
     else if (geometry->geom_type_ == GEOM_CURVE) {
       CurveFromGeometry curve_ob_from_geometry(*geometry, global_vertices);
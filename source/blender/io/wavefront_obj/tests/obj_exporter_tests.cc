@@ -243,6 +243,31 @@ parm u 0.0
   ASSERT_EQ(got_string, expected);
 }
 
+TEST(obj_exporter_writer, format_handler_numbers)
+{
+  FormatHandler h;
+  h.write_obj_vertex(0.0f, -0.0f, 1.5f);
+  h.write_obj_vertex(-1e-9f, 0.0078125f, -123456.789f);
+  h.write_obj_vertex_color(1e12f, 3.0f, -2.5f, 0.12345f, 1.0f, 0.0f);
+  h.write_obj_uv(0.9999996f, 1e-6f);
+  h.write_obj_normal(-0.57735f, 0.57735f, 0.00005f);
+  h.write_obj_face_begin();
+  h.write_obj_face_v_uv_normal(1, 2, 3);
+  h.write_obj_face_v_normal(-4, 2147483647);
+  h.write_obj_face_v_uv(5, 6);
+  h.write_obj_face_v(-2147483647 - 1);
+  h.write_obj_face_end();
+
+  const char *expected = R"(v 0.000000 -0.000000 1.500000
+v -0.000000 0.007812 -123456.789062
+v 999999995904.000000 3.000000 -2.500000 0.1235 1.0000 0.0000
+vt 1.000000 0.000001
+vn -0.5774 0.5774 0.0000
+f 1/2/3 -4//2147483647 5/6 -2147483648
+)";
+  ASSERT_EQ(h.get_as_string(), expected);
+}
+
 /* Return true if string #a and string #b are equal after their first newline. */
 static bool strings_equal_after_first_lines(const std::string &a, const std::string &b)
 {
@@ -653,6 +653,14 @@ typedef struct FCurve {
   float color[3];
 
   float prev_norm_factor, prev_offset;
+
+  /**
+   * Runtime: Index of the keyframe at the end of the segment that was found in the last
+   * evaluation. Consecutive evaluations usually fall into the same or the next segment, so this is
+   * checked before searching the keyframes. Not thread-safe, only used as a hint.
+   */
+  int runtime_segment_index;
+  char _pad2[4];
 } FCurve;
 
 /* user-editable flags/settings */
@@ -34,6 +34,7 @@ enum {
   FLUID_DOMAIN_USE_DIFFUSION = (1 << 15), /* Use diffusion (e.g. viscosity, surface tension). */
   FLUID_DOMAIN_USE_RESUMABLE_CACHE = (1 << 16), /* Determine if cache should be resumable. */
   FLUID_DOMAIN_USE_VISCOSITY = (1 << 17),       /* Use viscosity. */
+  FLUID_DOMAIN_USE_ASYNC_CACHE_WRITE = (1 << 18), /* Write cache files in the background. */
 };
 
 /**
@@ -30,6 +30,10 @@ using offset_indices::GroupedSpan;
 using offset_indices::OffsetIndices;
 template<typename T> class MutableSpan;
 template<typename T> class Span;
+namespace index_mask {
+class IndexMask;
+}  // namespace index_mask
+using index_mask::IndexMask;
 namespace bke {
 struct MeshRuntime;
 class AttributeAccessor;
@@ -397,6 +401,12 @@ typedef struct Mesh {
 
   /** Call after changing vertex positions to tag lazily calculated caches for recomputation. */
   void tag_positions_changed();
+  /**
+   * Like #tag_positions_changed, but only the vertices in the mask have been moved. Face and
+   * vertex normals that are already cached are updated for the affected part of the mesh only,
+   * which is faster when a small part of a large mesh is deformed.
+   */
+  void tag_positions_changed(const blender::IndexMask &changed_verts);
   /** Call after moving every mesh vertex by the same translation. */
   void tag_positions_changed_uniformly();
   /** Like #tag_positions_changed but doesn't tag normals; they must be updated separately. */
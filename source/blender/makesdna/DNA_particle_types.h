@@ -389,6 +389,9 @@ typedef struct ParticleSystem {
   /** Influence of the lattice modifier. */
   float lattice_strength;
 
+  /** Hash of the inputs that #childcache was computed from, zero if unknown (runtime). */
+  uint64_t childcache_hash;
+
   void *batch_cache;
 
   /**
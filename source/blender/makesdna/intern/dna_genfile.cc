@@ -24,6 +24,7 @@
 #include "BLI_math_matrix_types.hh"
 #include "BLI_memarena.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLI_ghash.h"
@@ -1261,11 +1262,16 @@ static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
   const int old_block_size = reconstruct_info->oldsdna->types_size[old_struct->type];
   const int new_block_size = reconstruct_info->newsdna->types_size[new_struct->type];
 
-  for (int a = 0; a < blocks; a++) {
-    const char *old_block = old_blocks + a * old_block_size;
-    char *new_block = new_blocks + a * new_block_size;
-    reconstruct_struct(reconstruct_info, new_struct_nr, old_block, new_block);
-  }
+  /* Each block is reconstructed independently, so large arrays of structs (e.g. geometry in
+   * files written by older versions) are converted in parallel. */
+  blender::threading::parallel_for(
+      blender::IndexRange(blocks), 2048, [&](const blender::IndexRange range) {
+        for (const int64_t a : range) {
+          const char *old_block = old_blocks + a * old_block_size;
+          char *new_block = new_blocks + a * new_block_size;
+          reconstruct_struct(reconstruct_info, new_struct_nr, old_block, new_block);
+        }
+      });
 }
 
 void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
@@ -369,6 +369,16 @@ void RNA_property_update_main(Main *bmain, Scene *scene, PointerRNA *ptr, Proper
  */
 bool RNA_property_update_check(PropertyRNA *prop);
 
+/**
+ * Defer the generic depsgraph tags and notifiers sent by #RNA_property_update until the matching
+ * #RNA_property_update_batch_end, so each ID is tagged once when setting many properties.
+ * Update callbacks of properties still run immediately. Calls may be nested.
+ *
+ * \note Only updates from the main thread are batched.
+ */
+void RNA_property_update_batch_begin();
+void RNA_property_update_batch_end();
+
 /* Property Data */
 
 bool RNA_property_boolean_get(PointerRNA *ptr, PropertyRNA *prop);
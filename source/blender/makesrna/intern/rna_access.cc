@@ -27,8 +27,11 @@
 #include "BLI_blenlib.h"
 #include "BLI_dynstr.h"
 #include "BLI_ghash.h"
+#include "BLI_map.hh"
+#include "BLI_set.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector_set.hh"
 
 #include "BLF_api.hh"
 #include "BLT_translation.hh"
@@ -2289,6 +2292,118 @@ bool RNA_property_path_from_ID_check(PointerRNA *ptr, PropertyRNA *prop)
   return ret;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Batched Property Updates
+ *
+ * While a batch is active, the generic depsgraph tags and notifiers of #rna_property_update
+ * are accumulated per ID and only sent once when the batch ends.
+ * Property update callbacks still run immediately.
+ * \{ */
+
+struct RNAUpdateBatch {
+  /** Nesting level of #RNA_property_update_batch_begin calls. */
+  int depth = 0;
+  /** Accumulated recalc flags and the session UID of the tagged ID, to skip freed IDs. */
+  blender::Map<ID *, std::pair<uint, uint>> id_tags;
+  /** Notifier type and reference (an owner ID or null). */
+  blender::VectorSet<std::pair<uint, ID *>> notifiers;
+  bool tag_relations = false;
+};
+
+static RNAUpdateBatch g_update_batch;
+
+static bool rna_property_update_batch_is_active(const Main *bmain)
+{
+  /* Updates from animation evaluation may happen on other threads and are never batched.
+   * Only IDs of the global main database can be validated when the batch ends. */
+  return g_update_batch.depth > 0 && bmain == G_MAIN && BLI_thread_is_main();
+}
+
+static void rna_property_update_id_tag(Main *bmain, ID *id, const uint flags)
+{
+  if (!rna_property_update_batch_is_active(bmain)) {
+    DEG_id_tag_update(id, flags);
+    return;
+  }
+  if (id == nullptr) {
+    return;
+  }
+  std::pair<uint, uint> &tag = g_update_batch.id_tags.lookup_or_add(
+      id, std::pair<uint, uint>(0, id->session_uid));
+  tag.first |= flags;
+}
+
+static void rna_property_update_notifier(Main *bmain, const uint type, ID *reference)
+{
+  if (!rna_property_update_batch_is_active(bmain)) {
+    WM_main_add_notifier(type, reference);
+    return;
+  }
+  g_update_batch.notifiers.add({type, reference});
+}
+
+static void rna_property_update_relations_tag(Main *bmain)
+{
+  if (!rna_property_update_batch_is_active(bmain)) {
+    DEG_relations_tag_update(bmain);
+    return;
+  }
+  g_update_batch.tag_relations = true;
+}
+
+static void rna_property_update_batch_flush()
+{
+  /* IDs may have been freed, or the global main database replaced, while the batch was active.
+   * Only send updates for IDs that still exist. */
+  Main *bmain = G_MAIN;
+  blender::Set<ID *> valid_ids;
+  if (!g_update_batch.id_tags.is_empty() || !g_update_batch.notifiers.is_empty()) {
+    ID *id;
+    FOREACH_MAIN_ID_BEGIN (bmain, id) {
+      const std::pair<uint, uint> *tag = g_update_batch.id_tags.lookup_ptr(id);
+      if (tag == nullptr || tag->second == id->session_uid) {
+        valid_ids.add(id);
+      }
+    }
+    FOREACH_MAIN_ID_END;
+  }
+
+  for (const auto item : g_update_batch.id_tags.items()) {
+    if (valid_ids.contains(item.key)) {
+      DEG_id_tag_update(item.key, item.value.first);
+    }
+  }
+  if (g_update_batch.tag_relations) {
+    DEG_relations_tag_update(bmain);
+  }
+  for (const std::pair<uint, ID *> &notifier : g_update_batch.notifiers) {
+    if (notifier.second == nullptr || valid_ids.contains(notifier.second)) {
+      WM_main_add_notifier(notifier.first, notifier.second);
+    }
+  }
+
+  g_update_batch.id_tags.clear();
+  g_update_batch.notifiers.clear();
+  g_update_batch.tag_relations = false;
+}
+
+void RNA_property_update_batch_begin()
+{
+  BLI_assert(BLI_thread_is_main());
+  g_update_batch.depth++;
+}
+
+void RNA_property_update_batch_end()
+{
+  BLI_assert(BLI_thread_is_main());
+  BLI_assert(g_update_batch.depth > 0);
+  if (--g_update_batch.depth == 0) {
+    rna_property_update_batch_flush();
+  }
+}
+
+/** \} */
+
 static void rna_property_update(
     bContext *C, Main *bmain, Scene *scene, PointerRNA *ptr, PropertyRNA *prop)
 {
@@ -2319,7 +2434,7 @@ static void rna_property_update(
      * for now keep since copy-on-eval, bugs are hard to track when we have other missing updates.
      */
     if (prop->noteflag) {
-      WM_main_add_notifier(prop->noteflag, ptr->owner_id);
+      rna_property_update_notifier(bmain, prop->noteflag, ptr->owner_id);
     }
 #endif
 
@@ -2334,10 +2449,11 @@ static void rna_property_update(
       const short id_type = GS(ptr->owner_id->name);
       if (ID_TYPE_USE_COPY_ON_EVAL(id_type)) {
         if (prop->flag & PROP_DEG_SYNC_ONLY) {
-          DEG_id_tag_update(ptr->owner_id, ID_RECALC_SYNC_TO_EVAL);
+          rna_property_update_id_tag(bmain, ptr->owner_id, ID_RECALC_SYNC_TO_EVAL);
         }
         else {
-          DEG_id_tag_update(ptr->owner_id, ID_RECALC_SYNC_TO_EVAL | ID_RECALC_PARAMETERS);
+          rna_property_update_id_tag(
+              bmain, ptr->owner_id, ID_RECALC_SYNC_TO_EVAL | ID_RECALC_PARAMETERS);
         }
       }
     }
@@ -2358,17 +2474,17 @@ static void rna_property_update(
      * So editing custom properties only causes updates in the UI,
      * keep this exception because it happens to be useful for driving settings.
      * Python developers on the other hand will need to manually 'update_tag', see: #74000. */
-    DEG_id_tag_update(ptr->owner_id,
-                      ID_RECALC_TRANSFORM | ID_RECALC_GEOMETRY | ID_RECALC_PARAMETERS);
+    rna_property_update_id_tag(
+        bmain, ptr->owner_id, ID_RECALC_TRANSFORM | ID_RECALC_GEOMETRY | ID_RECALC_PARAMETERS);
 
     /* When updating an ID pointer property, tag depsgraph for update. */
     if (prop->type == PROP_POINTER && RNA_struct_is_ID(RNA_property_pointer_type(ptr, prop))) {
-      DEG_relations_tag_update(bmain);
+      rna_property_update_relations_tag(bmain);
     }
 
-    WM_main_add_notifier(NC_WINDOW, nullptr);
+    rna_property_update_notifier(bmain, NC_WINDOW, nullptr);
     if (ptr->owner_id) {
-      WM_main_add_notifier(NC_ID | NA_EDITED, nullptr);
+      rna_property_update_notifier(bmain, NC_ID | NA_EDITED, nullptr);
     }
     /* Not nice as well, but the only way to make sure material preview
      * is updated with custom nodes.
@@ -2376,7 +2492,7 @@ static void rna_property_update(
     if ((prop->flag & PROP_IDPROPERTY) != 0 && (ptr->owner_id != nullptr) &&
         (GS(ptr->owner_id->name) == ID_NT))
     {
-      WM_main_add_notifier(NC_MATERIAL | ND_SHADING, nullptr);
+      rna_property_update_notifier(bmain, NC_MATERIAL | ND_SHADING, nullptr);
     }
   }
 }
@@ -4765,6 +4881,34 @@ static int rna_property_array_length_all_dimensions(PointerRNA *ptr, PropertyRNA
   return size;
 }
 
+/**
+ * Copy between \a in and the items of the raw array \a out when their types don't match. Values
+ * are converted through the type \a T of the property, like when accessing items through RNA.
+ */
+template<typename T>
+static void rna_raw_access_convert(const RawArray &in,
+                                   const RawArray &out,
+                                   const int arraylen,
+                                   const bool set)
+{
+  int a = 0;
+  for (int i = 0; i < out.len; i++) {
+    RawArray item = out;
+    item.array = static_cast<char *>(out.array) + size_t(out.stride) * size_t(i);
+    for (int j = 0; j < arraylen; j++, a++) {
+      T value;
+      if (set) {
+        RAW_GET(T, value, in, a);
+        RAW_SET(T, item, j, value);
+      }
+      else {
+        RAW_GET(T, value, item, j);
+        RAW_SET(T, in, a, value);
+      }
+    }
+  }
+}
+
 static int rna_raw_access(ReportList *reports,
                           PointerRNA *ptr,
                           PropertyRNA *prop,
@@ -4857,8 +5001,22 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      /* Converting while copying is still much faster than accessing every item through RNA,
+       * e.g. when reading float attributes into a double precision array. */
+      switch (itemtype) {
+        case PROP_BOOLEAN:
+          rna_raw_access_convert<bool>(in, out, arraylen, set);
+          return 1;
+        case PROP_INT:
+          rna_raw_access_convert<int>(in, out, arraylen, set);
+          return 1;
+        case PROP_FLOAT:
+          rna_raw_access_convert<float>(in, out, arraylen, set);
+          return 1;
+        default:
+          /* Enums are set through RNA to validate the values. */
+          break;
+      }
     }
     BLI_assert_msg(itemlen == 0 || itemtype != PROP_ENUM,
                    "Enum array properties should not exist");
@@ -7443,6 +7443,12 @@ static void rna_def_userdef_experimental(BlenderRNA *brna)
   RNA_def_property_ui_text(
       prop, "New File Import Nodes", "Enables visibility of the new File Import nodes in the UI");
 
+  prop = RNA_def_property(srna, "use_incremental_autosave", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_ui_text(prop,
+                           "Incremental Auto Save",
+                           "Only write the data that changed since the previous auto-save, "
+                           "keeping the unchanged data in a separate file next to it");
+
   prop = RNA_def_property(srna, "use_shader_node_previews", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_ui_text(
       prop, "Shader Node Previews", "Enables previews in the shader node editor");
@@ -10,6 +10,9 @@ struct Object;
 namespace blender::bke::bake {
 struct ModifierCache;
 }
+namespace blender::nodes {
+class GeoNodesResultCache;
+}
 namespace blender::nodes::geo_eval_log {
 class GeoModifierLog;
 }
@@ -37,6 +40,11 @@ struct NodesModifierRuntime {
    * used by the evaluated modifier.
    */
   std::shared_ptr<bke::bake::ModifierCache> cache;
+  /**
+   * Outputs of slow nodes from the previous evaluation. This is shared between the original and
+   * evaluated modifier for the same reason as #cache.
+   */
+  std::shared_ptr<nodes::GeoNodesResultCache> result_cache;
 };
 
 void nodes_modifier_data_block_destruct(NodesModifierDataBlock *data_block, bool do_id_user);
@@ -12,9 +12,12 @@
 
 #include "BLI_utildefines.h"
 
+#include "BLI_array.hh"
 #include "BLI_math_matrix.h"
+#include "BLI_math_matrix_types.hh"
 #include "BLI_math_vector.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "BLT_translation.hh"
 
@@ -390,7 +393,6 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
     return mesh;
   }
 
-  int2 *edge;
   int i, j, c, count;
   float length = amd->length;
   /* offset matrix */
@@ -590,7 +592,6 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
   first_chunk_start = 0;
   first_chunk_nverts = chunk_nverts;
 
-  unit_m4(current_offset);
   blender::Span<blender::float3> src_vert_normals;
   Vector<float3> dst_vert_normals;
   if (!use_recalc_normals) {
@@ -601,87 +602,102 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
         .copy_from(src_vert_normals);
   }
 
-  for (c = 1; c < count; c++) {
-    /* copy customdata to new geometry */
-    CustomData_copy_data(&mesh->vert_data, &result->vert_data, 0, c * chunk_nverts, chunk_nverts);
-    CustomData_copy_data(&mesh->edge_data, &result->edge_data, 0, c * chunk_nedges, chunk_nedges);
-    CustomData_copy_data(
-        &mesh->corner_data, &result->corner_data, 0, c * chunk_nloops, chunk_nloops);
-    CustomData_copy_data(&mesh->face_data, &result->face_data, 0, c * chunk_nfaces, chunk_nfaces);
-
-    const int vert_offset = c * chunk_nverts;
-
-    /* recalculate cumulative offset here */
-    mul_m4_m4m4(current_offset, current_offset, offset);
-
-    /* apply offset to all new verts */
-    for (i = 0; i < chunk_nverts; i++) {
-      const int i_dst = vert_offset + i;
-      mul_m4_v3(current_offset, result_positions[i_dst]);
-
-      /* We have to correct normals too, if we do not tag them as dirty! */
-      if (!dst_vert_normals.is_empty()) {
-        copy_v3_v3(dst_vert_normals[i_dst], src_vert_normals[i]);
-        mul_mat3_m4_v3(current_offset, dst_vert_normals[i_dst]);
-        normalize_v3(dst_vert_normals[i_dst]);
-      }
+  /* Compute the cumulative offset of every chunk upfront, so the chunks are independent and can
+   * be filled in parallel. */
+  Array<float4x4> chunk_offsets(count);
+  unit_m4(current_offset);
+  for (c = 0; c < count; c++) {
+    if (c > 0) {
+      mul_m4_m4m4(current_offset, current_offset, offset);
     }
+    copy_m4_m4(chunk_offsets[c].ptr(), current_offset);
+  }
 
-    /* adjust edge vertex indices */
-    edge = &result_edges[c * chunk_nedges];
-    for (i = 0; i < chunk_nedges; i++, edge++) {
-      (*edge) += c * chunk_nverts;
-    }
+  threading::parallel_for(IndexRange(1, count - 1), 1, [&](const IndexRange chunks) {
+    for (const int chunk : chunks) {
+      /* copy customdata to new geometry */
+      CustomData_copy_data(
+          &mesh->vert_data, &result->vert_data, 0, chunk * chunk_nverts, chunk_nverts);
+      CustomData_copy_data(
+          &mesh->edge_data, &result->edge_data, 0, chunk * chunk_nedges, chunk_nedges);
+      CustomData_copy_data(
+          &mesh->corner_data, &result->corner_data, 0, chunk * chunk_nloops, chunk_nloops);
+      CustomData_copy_data(
+          &mesh->face_data, &result->face_data, 0, chunk * chunk_nfaces, chunk_nfaces);
+
+      const int vert_offset = chunk * chunk_nverts;
+      const float(*chunk_offset)[4] = chunk_offsets[chunk].ptr();
+
+      /* apply offset to all new verts */
+      for (const int vert : IndexRange(chunk_nverts)) {
+        const int i_dst = vert_offset + vert;
+        mul_m4_v3(chunk_offset, result_positions[i_dst]);
+
+        /* We have to correct normals too, if we do not tag them as dirty! */
+        if (!dst_vert_normals.is_empty()) {
+          copy_v3_v3(dst_vert_normals[i_dst], src_vert_normals[vert]);
+          mul_mat3_m4_v3(chunk_offset, dst_vert_normals[i_dst]);
+          normalize_v3(dst_vert_normals[i_dst]);
+        }
+      }
 
-    for (i = 0; i < chunk_nfaces; i++) {
-      result_face_offsets[c * chunk_nfaces + i] = result_face_offsets[i] + c * chunk_nloops;
-    }
+      /* adjust edge vertex indices */
+      for (int2 &edge : result_edges.slice(chunk * chunk_nedges, chunk_nedges)) {
+        edge += chunk * chunk_nverts;
+      }
 
-    /* adjust loop vertex and edge indices */
-    const int chunk_corner_start = c * chunk_nloops;
-    for (i = 0; i < chunk_nloops; i++) {
-      result_corner_verts[chunk_corner_start + i] += c * chunk_nverts;
-      result_corner_edges[chunk_corner_start + i] += c * chunk_nedges;
-    }
+      for (const int face : IndexRange(chunk_nfaces)) {
+        result_face_offsets[chunk * chunk_nfaces + face] = result_face_offsets[face] +
+                                                           chunk * chunk_nloops;
+      }
 
-    /* Handle merge between chunk n and n-1 */
-    if (use_merge && (c >= 1)) {
-      if (!offset_has_scale && (c >= 2)) {
-        /* Mapping chunk 3 to chunk 2 is a translation of mapping 2 to 1
-         * ... that is except if scaling makes the distance grow */
-        int k;
-        int this_chunk_index = c * chunk_nverts;
-        int prev_chunk_index = (c - 1) * chunk_nverts;
-        for (k = 0; k < chunk_nverts; k++, this_chunk_index++, prev_chunk_index++) {
-          int target = full_doubles_map[prev_chunk_index];
-          if (target != -1) {
-            target += chunk_nverts; /* translate mapping */
-            while (target != -1 && !ELEM(full_doubles_map[target], -1, target)) {
-              /* If target is already mapped, we only follow that mapping if final target remains
-               * close enough from current vert (otherwise no mapping at all). */
-              if (compare_len_v3v3(result_positions[this_chunk_index],
-                                   result_positions[full_doubles_map[target]],
-                                   amd->merge_dist))
-              {
-                target = full_doubles_map[target];
-              }
-              else {
-                target = -1;
-              }
+      /* adjust loop vertex and edge indices */
+      const int chunk_corner_start = chunk * chunk_nloops;
+      for (const int corner : IndexRange(chunk_nloops)) {
+        result_corner_verts[chunk_corner_start + corner] += chunk * chunk_nverts;
+        result_corner_edges[chunk_corner_start + corner] += chunk * chunk_nedges;
+      }
+    }
+  });
+
+  /* Handle merge between chunk n and n-1. This depends on the mapping of the previous chunk, so it
+   * runs in order once all positions are in place. */
+  for (c = 1; use_merge && c < count; c++) {
+    if (!offset_has_scale && (c >= 2)) {
+      /* Mapping chunk 3 to chunk 2 is a translation of mapping 2 to 1
+       * ... that is except if scaling makes the distance grow */
+      int k;
+      int this_chunk_index = c * chunk_nverts;
+      int prev_chunk_index = (c - 1) * chunk_nverts;
+      for (k = 0; k < chunk_nverts; k++, this_chunk_index++, prev_chunk_index++) {
+        int target = full_doubles_map[prev_chunk_index];
+        if (target != -1) {
+          target += chunk_nverts; /* translate mapping */
+          while (target != -1 && !ELEM(full_doubles_map[target], -1, target)) {
+            /* If target is already mapped, we only follow that mapping if final target remains
+             * close enough from current vert (otherwise no mapping at all). */
+            if (compare_len_v3v3(result_positions[this_chunk_index],
+                                 result_positions[full_doubles_map[target]],
+                                 amd->merge_dist))
+            {
+              target = full_doubles_map[target];
+            }
+            else {
+              target = -1;
             }
           }
-          full_doubles_map[this_chunk_index] = target;
         }
+        full_doubles_map[this_chunk_index] = target;
       }
-      else {
-        dm_mvert_map_doubles(full_doubles_map,
-                             result_positions,
-                             (c - 1) * chunk_nverts,
-                             chunk_nverts,
-                             c * chunk_nverts,
-                             chunk_nverts,
-                             amd->merge_dist);
-      }
+    }
+    else {
+      dm_mvert_map_doubles(full_doubles_map,
+                           result_positions,
+                           (c - 1) * chunk_nverts,
+                           chunk_nverts,
+                           c * chunk_nverts,
+                           chunk_nverts,
+                           amd->merge_dist);
     }
   }
 
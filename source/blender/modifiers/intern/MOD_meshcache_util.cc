@@ -6,9 +6,20 @@
  * \ingroup modifiers
  */
 
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "BLI_array.hh"
+#include "BLI_endian_defines.h"
+#include "BLI_endian_switch.h"
 #include "BLI_math_base.h"
+#include "BLI_math_vector_types.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
+#include "BLT_translation.hh"
+
 #include "DNA_modifier_types.h"
 
 #include "MOD_meshcache_util.hh"
@@ -49,3 +60,48 @@ void MOD_meshcache_calc_range(const float frame,
     }
   }
 }
+
+bool MOD_meshcache_read_verts(FILE *fp,
+                              float (*vertexCos)[3],
+                              const int verts_tot,
+                              const float factor,
+                              const bool file_is_big_endian,
+                              const char **err_str)
+{
+  using namespace blender;
+  const bool switch_endian = (ENDIAN_ORDER == B_ENDIAN) != file_is_big_endian;
+  MutableSpan<float3> positions(reinterpret_cast<float3 *>(vertexCos), verts_tot);
+
+  errno = 0;
+  if (factor >= 1.0f) {
+    /* Read straight into the destination. */
+    if (fread(positions.data(), sizeof(float3), size_t(verts_tot), fp) != size_t(verts_tot)) {
+      *err_str = errno ? strerror(errno) : RPT_("Vertex coordinate read failed");
+      return false;
+    }
+    if (switch_endian) {
+      threading::parallel_for(positions.index_range(), 8192, [&](const IndexRange range) {
+        BLI_endian_switch_float_array(&positions[range.start()].x, int(range.size()) * 3);
+      });
+    }
+    return true;
+  }
+
+  Array<float3> frame_positions(verts_tot, NoInitialization());
+  if (fread(frame_positions.data(), sizeof(float3), size_t(verts_tot), fp) != size_t(verts_tot))
+  {
+    *err_str = errno ? strerror(errno) : RPT_("Vertex coordinate read failed");
+    return false;
+  }
+
+  const float ifactor = 1.0f - factor;
+  threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+    if (switch_endian) {
+      BLI_endian_switch_float_array(&frame_positions[range.start()].x, int(range.size()) * 3);
+    }
+    for (const int i : range) {
+      positions[i] = positions[i] * ifactor + frame_positions[i] * factor;
+    }
+  });
+  return true;
+}
@@ -50,5 +50,15 @@ bool MOD_meshcache_read_pc2_times(const char *filepath,
 
 void MOD_meshcache_calc_range(
     float frame, char interp, int frame_tot, int r_index_range[2], float *r_factor);
+/**
+ * Read the coordinates of one frame from the current position of `fp`. With a `factor` below one
+ * the frame is blended into the existing coordinates, otherwise they are replaced.
+ */
+bool MOD_meshcache_read_verts(FILE *fp,
+                              float (*vertexCos)[3],
+                              int verts_tot,
+                              float factor,
+                              bool file_is_big_endian,
+                              const char **err_str);
 
 #define FRAME_SNAP_EPS 0.0001f
@@ -21,6 +21,7 @@
 #include "BLI_path_util.h"
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_array_utils.hh"
@@ -93,6 +94,7 @@
 #include "NOD_geometry_nodes_execute.hh"
 #include "NOD_geometry_nodes_gizmos.hh"
 #include "NOD_geometry_nodes_lazy_function.hh"
+#include "NOD_geometry_nodes_result_cache.hh"
 #include "NOD_node_declaration.hh"
 
 #include "FN_field.hh"
@@ -115,6 +117,7 @@ static void init_data(ModifierData *md)
   MEMCPY_STRUCT_AFTER(nmd, DNA_struct_default_get(NodesModifierData), modifier);
   nmd->runtime = MEM_new<NodesModifierRuntime>(__func__);
   nmd->runtime->cache = std::make_shared<bake::ModifierCache>();
+  nmd->runtime->result_cache = std::make_shared<nodes::GeoNodesResultCache>();
 }
 
 static void find_used_ids_from_settings(const NodesModifierSettings &settings, Set<ID *> &ids)
@@ -982,6 +985,18 @@ static void ensure_bake_loaded(bake::NodeBakeCache &bake_cache, bake::FrameCache
   frame_cache.state = std::move(*bake_state);
 }
 
+/**
+ * Load the two frames used for interpolation at the same time, blob reading and geometry
+ * creation of different frames are independent.
+ */
+static void ensure_bake_loaded(bake::NodeBakeCache &bake_cache,
+                               bake::FrameCache &prev_frame_cache,
+                               bake::FrameCache &next_frame_cache)
+{
+  threading::parallel_invoke([&]() { ensure_bake_loaded(bake_cache, prev_frame_cache); },
+                             [&]() { ensure_bake_loaded(bake_cache, next_frame_cache); });
+}
+
 static bool try_find_baked_data(bake::NodeBakeCache &bake,
                                 const Main &bmain,
                                 const Object &object,
@@ -1337,8 +1352,7 @@ class NodesModifierSimulationParams : public nodes::GeoNodesSimulationParams {
   {
     bake::FrameCache &prev_frame_cache = *node_cache.bake.frames[prev_frame_index];
     bake::FrameCache &next_frame_cache = *node_cache.bake.frames[next_frame_index];
-    ensure_bake_loaded(node_cache.bake, prev_frame_cache);
-    ensure_bake_loaded(node_cache.bake, next_frame_cache);
+    ensure_bake_loaded(node_cache.bake, prev_frame_cache, next_frame_cache);
     auto &read_interpolated_info = zone_behavior.output.emplace<sim_output::ReadInterpolated>();
     read_interpolated_info.mix_factor = (float(current_frame_) - float(prev_frame_cache.frame)) /
                                         (float(next_frame_cache.frame) -
@@ -1483,8 +1497,7 @@ class NodesModifierBakeParams : public nodes::GeoNodesBakeParams {
   {
     bake::FrameCache &prev_frame_cache = *node_cache.bake.frames[prev_frame_index];
     bake::FrameCache &next_frame_cache = *node_cache.bake.frames[next_frame_index];
-    ensure_bake_loaded(node_cache.bake, prev_frame_cache);
-    ensure_bake_loaded(node_cache.bake, next_frame_cache);
+    ensure_bake_loaded(node_cache.bake, prev_frame_cache, next_frame_cache);
     if (this->check_read_error(prev_frame_cache, behavior) ||
         this->check_read_error(next_frame_cache, behavior))
     {
@@ -1751,6 +1764,15 @@ static void modifyGeometry(ModifierData *md,
   find_side_effect_nodes(*nmd, *ctx, side_effect_nodes, socket_log_contexts);
   call_data.side_effect_nodes = &side_effect_nodes;
 
+  /* Only reuse results in the active depsgraph, where the user is interactively changing inputs.
+   * Other evaluations (e.g. for rendering) would mostly just increase the memory usage. */
+  nodes::GeoNodesResultCache *result_cache = nullptr;
+  if (DEG_is_active(ctx->depsgraph) && nmd->runtime->result_cache) {
+    result_cache = nmd->runtime->result_cache.get();
+    result_cache->begin_evaluation();
+    call_data.result_cache = result_cache;
+  }
+
   bke::ModifierComputeContext modifier_compute_context{nullptr, nmd->modifier.name};
 
   geometry_set = nodes::execute_geometry_nodes_on_geometry(tree,
@@ -1759,6 +1781,10 @@ static void modifyGeometry(ModifierData *md,
                                                            call_data,
                                                            std::move(geometry_set));
 
+  if (result_cache) {
+    result_cache->end_evaluation();
+  }
+
   if (logging_enabled(ctx)) {
     nmd_orig->runtime->eval_log = std::move(eval_log);
   }
@@ -2462,6 +2488,7 @@ static void blend_read(BlendDataReader *reader, ModifierData *md)
 
   nmd->runtime = MEM_new<NodesModifierRuntime>(__func__);
   nmd->runtime->cache = std::make_shared<bake::ModifierCache>();
+  nmd->runtime->result_cache = std::make_shared<nodes::GeoNodesResultCache>();
 }
 
 static void copy_data(const ModifierData *md, ModifierData *target, const int flag)
@@ -2502,11 +2529,13 @@ static void copy_data(const ModifierData *md, ModifierData *target, const int fl
   if (flag & LIB_ID_COPY_SET_COPIED_ON_WRITE) {
     /* Share the simulation cache between the original and evaluated modifier. */
     tnmd->runtime->cache = nmd->runtime->cache;
+    tnmd->runtime->result_cache = nmd->runtime->result_cache;
     /* Keep bake path in the evaluated modifier. */
     tnmd->bake_directory = nmd->bake_directory ? BLI_strdup(nmd->bake_directory) : nullptr;
   }
   else {
     tnmd->runtime->cache = std::make_shared<bake::ModifierCache>();
+    tnmd->runtime->result_cache = std::make_shared<nodes::GeoNodesResultCache>();
     /* Clear the bake path when duplicating. */
     tnmd->bake_directory = nullptr;
   }
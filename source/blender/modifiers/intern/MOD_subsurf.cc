@@ -91,6 +91,7 @@ static void free_runtime_data(void *runtime_data_v)
   if (runtime_data->subdiv_gpu != nullptr) {
     blender::bke::subdiv::free(runtime_data->subdiv_gpu);
   }
+  BKE_subsurf_modifier_cpu_cache_free(runtime_data);
   MEM_freeN(runtime_data);
 }
 
@@ -20,6 +20,7 @@
 #include "BLI_sort.hh"
 #include "BLI_string.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
@@ -1377,21 +1378,25 @@ void lineart_main_perspective_division(LineartData *ld)
 {
   LISTBASE_FOREACH (LineartElementLinkNode *, eln, &ld->geom.vertex_buffer_pointers) {
     LineartVert *vt = static_cast<LineartVert *>(eln->pointer);
-    for (int i = 0; i < eln->element_count; i++) {
-      if (ld->conf.cam_is_persp) {
-        /* Do not divide Z, we use Z to back transform cut points in later chaining process. */
-        vt[i].fbcoord[0] /= vt[i].fbcoord[3];
-        vt[i].fbcoord[1] /= vt[i].fbcoord[3];
-        /* Re-map z into (0-1) range, because we no longer need NDC (Normalized Device Coordinates)
-         * at the moment.
-         * The algorithm currently doesn't need Z for operation, we use W instead. If Z is needed
-         * in the future, the line below correctly transforms it to view space coordinates. */
-        // `vt[i].fbcoord[2] = -2 * vt[i].fbcoord[2] / (far - near) - (far + near) / (far - near);
+    const blender::IndexRange verts(eln->element_count);
+    blender::threading::parallel_for(verts, 4096, [&](const blender::IndexRange range) {
+      for (const int i : range) {
+        if (ld->conf.cam_is_persp) {
+          /* Do not divide Z, we use Z to back transform cut points in later chaining process. */
+          vt[i].fbcoord[0] /= vt[i].fbcoord[3];
+          vt[i].fbcoord[1] /= vt[i].fbcoord[3];
+          /* Re-map z into (0-1) range, because we no longer need NDC (Normalized Device
+           * Coordinates) at the moment.
+           * The algorithm currently doesn't need Z for operation, we use W instead. If Z is
+           * needed in the future, the line below correctly transforms it to view space
+           * coordinates. */
+          // vt[i].fbcoord[2] = -2 * vt[i].fbcoord[2] / (far - near) - (far + near) / (far - near);
+        }
+        /* Shifting is always needed. */
+        vt[i].fbcoord[0] -= ld->conf.shift_x * 2;
+        vt[i].fbcoord[1] -= ld->conf.shift_y * 2;
       }
-      /* Shifting is always needed. */
-      vt[i].fbcoord[0] -= ld->conf.shift_x * 2;
-      vt[i].fbcoord[1] -= ld->conf.shift_y * 2;
-    }
+    });
   }
 }
 
@@ -1405,24 +1410,27 @@ void lineart_main_discard_out_of_frame_edges(LineartData *ld)
 
   LISTBASE_FOREACH (LineartElementLinkNode *, eln, &ld->geom.line_buffer_pointers) {
     e = (LineartEdge *)eln->pointer;
-    for (int i = 0; i < eln->element_count; i++) {
-      if (!e[i].v1 || !e[i].v2) {
-        e[i].flags = MOD_LINEART_EDGE_FLAG_CHAIN_PICKED;
-        continue;
-      }
-      const blender::float2 vec1(e[i].v1->fbcoord), vec2(e[i].v2->fbcoord);
-      if (LRT_VERT_OUT_OF_BOUND(e[i].v1) && LRT_VERT_OUT_OF_BOUND(e[i].v2)) {
-        /* A line could still cross the image border even when both of the vertices are out of
-         * bound. */
-        if (isect_seg_seg_v2(bounds[0], bounds[1], vec1, vec2) == ISECT_LINE_LINE_NONE &&
-            isect_seg_seg_v2(bounds[0], bounds[2], vec1, vec2) == ISECT_LINE_LINE_NONE &&
-            isect_seg_seg_v2(bounds[1], bounds[3], vec1, vec2) == ISECT_LINE_LINE_NONE &&
-            isect_seg_seg_v2(bounds[2], bounds[3], vec1, vec2) == ISECT_LINE_LINE_NONE)
-        {
+    const blender::IndexRange edges(eln->element_count);
+    blender::threading::parallel_for(edges, 4096, [&](const blender::IndexRange range) {
+      for (const int i : range) {
+        if (!e[i].v1 || !e[i].v2) {
           e[i].flags = MOD_LINEART_EDGE_FLAG_CHAIN_PICKED;
+          continue;
+        }
+        const blender::float2 vec1(e[i].v1->fbcoord), vec2(e[i].v2->fbcoord);
+        if (LRT_VERT_OUT_OF_BOUND(e[i].v1) && LRT_VERT_OUT_OF_BOUND(e[i].v2)) {
+          /* A line could still cross the image border even when both of the vertices are out
+           * of bound. */
+          if (isect_seg_seg_v2(bounds[0], bounds[1], vec1, vec2) == ISECT_LINE_LINE_NONE &&
+              isect_seg_seg_v2(bounds[0], bounds[2], vec1, vec2) == ISECT_LINE_LINE_NONE &&
+              isect_seg_seg_v2(bounds[1], bounds[3], vec1, vec2) == ISECT_LINE_LINE_NONE &&
+              isect_seg_seg_v2(bounds[2], bounds[3], vec1, vec2) == ISECT_LINE_LINE_NONE)
+          {
+            e[i].flags = MOD_LINEART_EDGE_FLAG_CHAIN_PICKED;
+          }
         }
       }
-    }
+    });
   }
 }
 
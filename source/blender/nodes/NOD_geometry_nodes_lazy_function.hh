@@ -43,6 +43,8 @@ namespace blender::nodes {
 using lf::LazyFunction;
 using mf::MultiFunction;
 
+class GeoNodesResultCache;
+
 /** The structs in here describe the different possible behaviors of a simulation input node. */
 namespace sim_input {
 
@@ -239,6 +241,12 @@ struct GeoNodesCallData {
    */
   const Set<ComputeContextHash> *socket_log_contexts = nullptr;
 
+  /**
+   * Optional cache that allows reusing the outputs of slow nodes from the previous evaluation when
+   * their inputs did not change.
+   */
+  GeoNodesResultCache *result_cache = nullptr;
+
   /**
    * Data from the modifier that is being evaluated.
    */
@@ -0,0 +1,163 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup nodes
+ *
+ * Changing a single socket value in a large node tree re-evaluates the entire tree, even though
+ * most nodes receive exactly the same inputs as in the previous evaluation. The result cache
+ * remembers the outputs of expensive nodes, so that they can be reused when the node is evaluated
+ * again with the same inputs in the same compute context.
+ *
+ * Inputs are identified by a #GeoNodeResultKey:
+ * - Geometries are compared by the identity of their implicitly shared data instead of their
+ *   content. Since the key keeps the geometries alive, the shared data cannot be modified in place
+ *   or be freed and reallocated at the same address while the key is still in use.
+ * - Single values are compared by content.
+ * - Fields (and other values that depend on the evaluation context) are not supported, nodes that
+ *   get them as input are just not cached.
+ *
+ * Building a key keeps the input geometries alive, which prevents the node from modifying them in
+ * place. Therefore, keys are only built for nodes that were found to be slow in the previous
+ * evaluation. A node is cached in the evaluation after that and its result is reused from the third
+ * evaluation on.
+ *
+ * Only the entries that have been used in the last evaluation are kept, and the total size of the
+ * cached geometry is limited by a memory budget.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+#include "BLI_compute_context.hh"
+#include "BLI_generic_pointer.hh"
+#include "BLI_map.hh"
+#include "BLI_utility_mixins.hh"
+#include "BLI_vector.hh"
+
+#include "BKE_geometry_set.hh"
+
+#include "NOD_geometry_nodes_log.hh"
+
+struct bNode;
+
+namespace blender::nodes {
+
+/**
+ * Identifies all the data that a node evaluation depends on.
+ */
+class GeoNodeResultKey {
+ private:
+  Vector<uint64_t> tokens_;
+  Vector<std::string> strings_;
+  /** Keeps the data referenced by #tokens_ alive. This is not compared. */
+  Vector<bke::GeometrySet> pinned_geometries_;
+
+ public:
+  /**
+   * Add a value passed into the node. Returns false if the value can't be identified reliably, in
+   * which case the key must not be used.
+   */
+  bool add_value(const CPPType &type, const void *value);
+  /** Add the properties of the node that are not exposed as sockets. */
+  void add_node_properties(const bNode &node);
+  void add_string(std::string str);
+
+  friend bool operator==(const GeoNodeResultKey &a, const GeoNodeResultKey &b)
+  {
+    return a.tokens_ == b.tokens_ && a.strings_ == b.strings_;
+  }
+
+ private:
+  void add_geometry(const bke::GeometrySet &geometry);
+};
+
+/**
+ * Everything a node produced during its evaluation, so that a cache hit is indistinguishable from
+ * evaluating the node again.
+ */
+class GeoNodeCachedResult : NonCopyable, NonMovable {
+ public:
+  /** Output values indexed by the lazy-function output index. Unset outputs are null. */
+  Vector<GMutablePointer> outputs;
+  Vector<geo_eval_log::NodeWarning> warnings;
+  Vector<std::pair<std::string, geo_eval_log::NamedAttributeUsage>> used_named_attributes;
+
+  GeoNodeCachedResult(int outputs_num);
+  ~GeoNodeCachedResult();
+
+  /** Take a copy of the value that the node has written to an output. */
+  void set_output(int index, const CPPType &type, const void *value);
+
+  /** Approximate number of bytes that are kept alive by the cached outputs. */
+  int64_t estimate_memory() const;
+};
+
+class GeoNodesResultCache : NonCopyable, NonMovable {
+ private:
+  struct NodeInContext {
+    ComputeContextHash context_hash;
+    int32_t node_id;
+
+    uint64_t hash() const
+    {
+      return get_default_hash(context_hash.hash(), node_id);
+    }
+
+    BLI_STRUCT_EQUALITY_OPERATORS_2(NodeInContext, context_hash, node_id)
+  };
+
+  struct Entry {
+    /** Null when the node was only found to be slow but has not been cached yet. */
+    std::unique_ptr<GeoNodeResultKey> key;
+    std::shared_ptr<const GeoNodeCachedResult> result;
+    int64_t memory = 0;
+    int last_used_evaluation = 0;
+  };
+
+  std::mutex mutex_;
+  Map<NodeInContext, Entry> entries_;
+  int64_t memory_ = 0;
+  int64_t max_memory_;
+  int evaluation_ = 0;
+
+ public:
+  /**
+   * Nodes that are faster than this are not cached. Holding a reference to their output would
+   * only make the next node copy the geometry instead of modifying it in place.
+   */
+  static constexpr std::chrono::microseconds min_execution_time{1000};
+
+  GeoNodesResultCache(int64_t max_memory = 512 * 1024 * 1024);
+
+  /** Has to be called before the node tree is evaluated. */
+  void begin_evaluation();
+  /** Frees all results that have not been used in the last evaluation. */
+  void end_evaluation();
+
+  /**
+   * True if the node was slow in the previous evaluation, so a #GeoNodeResultKey should be built
+   * for it.
+   */
+  bool is_slow_node(const ComputeContextHash &context_hash, int32_t node_id);
+  /** Find the result of the node that was evaluated with the same inputs before. */
+  std::shared_ptr<const GeoNodeCachedResult> lookup(const ComputeContextHash &context_hash,
+                                                    int32_t node_id,
+                                                    const GeoNodeResultKey &key);
+  /** Remember that the node is slow, so that it is cached in the next evaluation. */
+  void add_slow_node(const ComputeContextHash &context_hash, int32_t node_id);
+  /** Remember a result for the next evaluation, if it fits into the memory budget. */
+  void add(const ComputeContextHash &context_hash,
+           int32_t node_id,
+           std::unique_ptr<GeoNodeResultKey> key,
+           std::shared_ptr<const GeoNodeCachedResult> result);
+  /** Forget about a node that is not slow anymore. */
+  void remove(const ComputeContextHash &context_hash, int32_t node_id);
+
+  void clear();
+};
+
+}  // namespace blender::nodes
@@ -18,7 +18,9 @@ static void node_declare(NodeDeclarationBuilder &b)
 static void node_build_multi_function(NodeMultiFunctionBuilder &builder)
 {
   static auto fn = mf::build::SI1_SO<math::Quaternion, math::Quaternion>(
-      "Invert Quaternion", [](math::Quaternion quat) { return math::invert(quat); });
+      "Invert Quaternion",
+      [](math::Quaternion quat) { return math::invert(quat); },
+      mf::build::exec_presets::AllSpanOrSingle());
   builder.set_matching_fn(fn);
 }
 
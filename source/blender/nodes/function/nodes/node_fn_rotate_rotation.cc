@@ -36,13 +36,17 @@ static void node_build_multi_function(NodeMultiFunctionBuilder &builder)
   switch (RotationSpace(builder.node().custom1)) {
     case RotationSpace::Global: {
       static auto fn = mf::build::SI2_SO<math::Quaternion, math::Quaternion, math::Quaternion>(
-          "Rotate Rotation Global", [](math::Quaternion a, math::Quaternion b) { return b * a; });
+          "Rotate Rotation Global",
+          [](math::Quaternion a, math::Quaternion b) { return b * a; },
+          mf::build::exec_presets::AllSpanOrSingle());
       builder.set_matching_fn(fn);
       break;
     }
     case RotationSpace::Local: {
       static auto fn = mf::build::SI2_SO<math::Quaternion, math::Quaternion, math::Quaternion>(
-          "Rotate Rotation Local", [](math::Quaternion a, math::Quaternion b) { return a * b; });
+          "Rotate Rotation Local",
+          [](math::Quaternion a, math::Quaternion b) { return a * b; },
+          mf::build::exec_presets::AllSpanOrSingle());
       builder.set_matching_fn(fn);
       break;
     }
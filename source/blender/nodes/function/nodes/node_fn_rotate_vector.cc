@@ -20,7 +20,8 @@ static void node_build_multi_function(NodeMultiFunctionBuilder &builder)
 {
   static auto fn = mf::build::SI2_SO<float3, math::Quaternion, float3>(
       "Rotate Vector",
-      [](float3 vector, math::Quaternion quat) { return math::transform_point(quat, vector); });
+      [](float3 vector, math::Quaternion quat) { return math::transform_point(quat, vector); },
+      mf::build::exec_presets::AllSpanOrSingle());
   builder.set_matching_fn(fn);
 }
 
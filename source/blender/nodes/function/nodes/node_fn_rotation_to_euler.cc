@@ -21,7 +21,9 @@ static void node_declare(NodeDeclarationBuilder &b)
 static void node_build_multi_function(NodeMultiFunctionBuilder &builder)
 {
   static auto fn = mf::build::SI1_SO<math::Quaternion, float3>(
-      "Quaternion to Euler XYZ", [](math::Quaternion quat) { return math::to_euler(quat); });
+      "Quaternion to Euler XYZ",
+      [](math::Quaternion quat) { return math::to_euler(quat); },
+      mf::build::exec_presets::AllSpanOrSingle());
   builder.set_matching_fn(fn);
 }
 
@@ -19,9 +19,11 @@ static void node_declare(NodeDeclarationBuilder &b)
 static void node_build_multi_function(NodeMultiFunctionBuilder &builder)
 {
   static auto fn = mf::build::SI2_SO<float3, float4x4, float3>(
-      "Transform Direction", [](float3 direction, float4x4 matrix) {
+      "Transform Direction",
+      [](float3 direction, float4x4 matrix) {
         return math::transform_direction(matrix, direction);
-      });
+      },
+      mf::build::exec_presets::AllSpanOrSingle());
   builder.set_matching_fn(fn);
 }
 
@@ -20,7 +20,8 @@ static void node_build_multi_function(NodeMultiFunctionBuilder &builder)
 {
   static auto fn = mf::build::SI2_SO<float3, float4x4, float3>(
       "Transform Point",
-      [](float3 point, float4x4 matrix) { return math::transform_point(matrix, point); });
+      [](float3 point, float4x4 matrix) { return math::transform_point(matrix, point); },
+      mf::build::exec_presets::AllSpanOrSingle());
   builder.set_matching_fn(fn);
 }
 
@@ -2,11 +2,14 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "BLI_array_utils.hh"
+#include "BLI_bounds.hh"
 #include "BLI_kdtree.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_rotation.h"
 #include "BLI_noise.hh"
 #include "BLI_rand.hh"
+#include "BLI_sort.hh"
 #include "BLI_task.hh"
 
 #include "DNA_pointcloud_types.h"
@@ -162,13 +165,9 @@ BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
   return kdtree;
 }
 
-BLI_NOINLINE static void update_elimination_mask_for_close_points(
+BLI_NOINLINE static void update_elimination_mask_for_close_points_kdtree(
     Span<float3> positions, const float minimum_distance, MutableSpan<bool> elimination_mask)
 {
-  if (minimum_distance <= 0.0f) {
-    return;
-  }
-
   KDTree_3d *kdtree = build_kdtree(positions);
   BLI_SCOPED_DEFER([&]() { BLI_kdtree_3d_free(kdtree); });
 
@@ -197,6 +196,89 @@ BLI_NOINLINE static void update_elimination_mask_for_close_points(
   }
 }
 
+/**
+ * Points that are closer than the minimum distance are always in the same or in neighboring cells
+ * of a grid with that cell size. Compared to a KD-tree, the grid can be built in parallel and the
+ * lookups are cheaper because only a few cells have to be checked for every point.
+ */
+BLI_NOINLINE static void update_elimination_mask_for_close_points(
+    Span<float3> positions, const float minimum_distance, MutableSpan<bool> elimination_mask)
+{
+  if (minimum_distance <= 0.0f) {
+    return;
+  }
+  const std::optional<Bounds<float3>> bounds = bounds::min_max(positions);
+  if (!bounds) {
+    return;
+  }
+  const float cell_size_inv = 1.0f / minimum_distance;
+  const float max_abs_coord = std::max(math::reduce_max(math::abs(bounds->min)),
+                                       math::reduce_max(math::abs(bounds->max)));
+  if (!(max_abs_coord * cell_size_inv < float(1 << 30))) {
+    /* The cell indices would overflow. */
+    update_elimination_mask_for_close_points_kdtree(positions, minimum_distance, elimination_mask);
+    return;
+  }
+
+  Array<int3> point_cells(positions.size());
+  threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      point_cells[i] = int3(math::floor(positions[i] * cell_size_inv));
+    }
+  });
+
+  /* Sort the points by cell so that the points in every cell are stored contiguously. Ties are
+   * broken by the point index to keep the lookup order deterministic. */
+  Array<int> sorted_points(positions.size());
+  array_utils::fill_index_range<int>(sorted_points);
+  parallel_sort(sorted_points.begin(), sorted_points.end(), [&](const int a, const int b) {
+    const int3 &cell_a = point_cells[a];
+    const int3 &cell_b = point_cells[b];
+    if (cell_a != cell_b) {
+      return std::tie(cell_a.x, cell_a.y, cell_a.z) < std::tie(cell_b.x, cell_b.y, cell_b.z);
+    }
+    return a < b;
+  });
+
+  Map<int3, IndexRange> cell_points;
+  cell_points.reserve(positions.size());
+  for (int start = 0; start < sorted_points.size();) {
+    const int3 &cell = point_cells[sorted_points[start]];
+    int end = start + 1;
+    while (end < sorted_points.size() && point_cells[sorted_points[end]] == cell) {
+      end++;
+    }
+    cell_points.add_new(cell, IndexRange::from_begin_end(start, end));
+    start = end;
+  }
+
+  /* The elimination itself stays serial, because whether a point eliminates others depends on
+   * whether it has been eliminated by a point with a lower index before. */
+  const float minimum_distance_sq = minimum_distance * minimum_distance;
+  for (const int i : positions.index_range()) {
+    if (elimination_mask[i]) {
+      continue;
+    }
+    const float3 &position = positions[i];
+    const int3 &cell = point_cells[i];
+    for (int z = cell.z - 1; z <= cell.z + 1; z++) {
+      for (int y = cell.y - 1; y <= cell.y + 1; y++) {
+        for (int x = cell.x - 1; x <= cell.x + 1; x++) {
+          const IndexRange range = cell_points.lookup_default(int3(x, y, z), {});
+          for (const int other : sorted_points.as_span().slice(range)) {
+            if (other == i) {
+              continue;
+            }
+            if (math::distance_squared(position, positions[other]) <= minimum_distance_sq) {
+              elimination_mask[other] = true;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 BLI_NOINLINE static void update_elimination_mask_based_on_density_factors(
     const Mesh &mesh,
     const Span<float> density_factors,
@@ -205,26 +287,29 @@ BLI_NOINLINE static void update_elimination_mask_based_on_density_factors(
     const MutableSpan<bool> elimination_mask)
 {
   const Span<int3> corner_tris = mesh.corner_tris();
-  for (const int i : bary_coords.index_range()) {
-    if (elimination_mask[i]) {
-      continue;
-    }
+  threading::parallel_for(bary_coords.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (elimination_mask[i]) {
+        continue;
+      }
 
-    const int3 &tri = corner_tris[tri_indices[i]];
-    const float3 bary_coord = bary_coords[i];
+      const int3 &tri = corner_tris[tri_indices[i]];
+      const float3 bary_coord = bary_coords[i];
 
-    const float v0_density_factor = std::max(0.0f, density_factors[tri[0]]);
-    const float v1_density_factor = std::max(0.0f, density_factors[tri[1]]);
-    const float v2_density_factor = std::max(0.0f, density_factors[tri[2]]);
+      const float v0_density_factor = std::max(0.0f, density_factors[tri[0]]);
+      const float v1_density_factor = std::max(0.0f, density_factors[tri[1]]);
+      const float v2_density_factor = std::max(0.0f, density_factors[tri[2]]);
 
-    const float probability = v0_density_factor * bary_coord.x + v1_density_factor * bary_coord.y +
-                              v2_density_factor * bary_coord.z;
+      const float probability = v0_density_factor * bary_coord.x +
+                                v1_density_factor * bary_coord.y +
+                                v2_density_factor * bary_coord.z;
 
-    const float hash = noise::hash_float_to_float(bary_coord);
-    if (hash > probability) {
-      elimination_mask[i] = true;
+      const float hash = noise::hash_float_to_float(bary_coord);
+      if (hash > probability) {
+        elimination_mask[i] = true;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static void eliminate_points_based_on_mask(const Span<bool> elimination_mask,
@@ -122,18 +122,8 @@ static void geometry_set_mesh_to_points(GeometrySet &geometry_set,
       /* Domain interpolation can fail if the source domain is empty. */
       continue;
     }
-
-    if (share_arrays && src.domain == domain && src.sharing_info && src.varray.is_span()) {
-      const bke::AttributeInitShared init(src.varray.get_internal_span().data(),
-                                          *src.sharing_info);
-      dst_attributes.add(attribute_id, AttrDomain::Point, data_type, init);
-    }
-    else {
-      GSpanAttributeWriter dst = dst_attributes.lookup_or_add_for_write_only_span(
-          attribute_id, AttrDomain::Point, data_type);
-      array_utils::gather(src.varray, selection, dst.span);
-      dst.finish();
-    }
+    bke::transfer_attribute(
+        src, attribute_id, AttrDomain::Point, data_type, selection, dst_attributes);
   }
 
   geometry_set.replace_pointcloud(pointcloud);
@@ -2,8 +2,6 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
-#include "BLI_array_utils.hh"
-
 #include "DNA_pointcloud_types.h"
 
 #include "BKE_customdata.hh"
@@ -67,17 +65,7 @@ static void geometry_set_points_to_vertices(
     const AttributeIDRef id = entry.key;
     const eCustomDataType data_type = entry.value.data_type;
     const GAttributeReader src = src_attributes.lookup(id);
-    if (selection.size() == points->totpoint && src.sharing_info && src.varray.is_span()) {
-      const bke::AttributeInitShared init(src.varray.get_internal_span().data(),
-                                          *src.sharing_info);
-      dst_attributes.add(id, AttrDomain::Point, data_type, init);
-    }
-    else {
-      GSpanAttributeWriter dst = dst_attributes.lookup_or_add_for_write_only_span(
-          id, AttrDomain::Point, data_type);
-      array_utils::gather(src.varray, selection, dst.span);
-      dst.finish();
-    }
+    bke::transfer_attribute(src, id, AttrDomain::Point, data_type, selection, dst_attributes);
   }
 
   mesh->tag_loose_edges_none();
@@ -213,6 +213,11 @@ class ProximityFunction : public mf::MultiFunction {
     MutableSpan<bool> is_valid_span = params.uninitialized_single_output_if_required<bool>(
         4, "Is Valid");
 
+    /* Consecutive points are usually close to each other, so the previously found elements are a
+     * good starting bound for the search. */
+    int last_group_index = -1;
+    int last_mesh_index = -1;
+    int last_pointcloud_index = -1;
     mask.foreach_index([&](const int i) {
       const float3 sample_position = sample_positions[i];
       const int sample_id = sample_ids[i];
@@ -235,19 +240,28 @@ class ProximityFunction : public mf::MultiFunction {
        * The first bvhtree query will set `nearest.dist_sq` which is then passed into the second
        * query as a maximum distance. */
       nearest.dist_sq = FLT_MAX;
+      const bool use_hint = group_index == last_group_index;
+      last_group_index = group_index;
       if (trees.mesh_bvh.tree != nullptr) {
-        BLI_bvhtree_find_nearest(trees.mesh_bvh.tree,
-                                 sample_position,
-                                 &nearest,
-                                 trees.mesh_bvh.nearest_callback,
-                                 const_cast<BVHTreeFromMesh *>(&trees.mesh_bvh));
+        nearest.index = -1;
+        BLI_bvhtree_find_nearest_with_hint(*trees.mesh_bvh.tree,
+                                           sample_position,
+                                           nearest,
+                                           trees.mesh_bvh.nearest_callback,
+                                           const_cast<BVHTreeFromMesh *>(&trees.mesh_bvh),
+                                           use_hint ? last_mesh_index : -1);
+        last_mesh_index = nearest.index;
       }
       if (trees.pointcloud_bvh.tree != nullptr) {
-        BLI_bvhtree_find_nearest(trees.pointcloud_bvh.tree,
-                                 sample_position,
-                                 &nearest,
-                                 trees.pointcloud_bvh.nearest_callback,
-                                 const_cast<BVHTreeFromPointCloud *>(&trees.pointcloud_bvh));
+        nearest.index = -1;
+        BLI_bvhtree_find_nearest_with_hint(
+            *trees.pointcloud_bvh.tree,
+            sample_position,
+            nearest,
+            trees.pointcloud_bvh.nearest_callback,
+            const_cast<BVHTreeFromPointCloud *>(&trees.pointcloud_bvh),
+            use_hint ? last_pointcloud_index : -1);
+        last_pointcloud_index = nearest.index;
       }
 
       if (!positions.is_empty()) {
@@ -147,6 +147,10 @@ class SampleNearestSurfaceFunction : public mf::MultiFunction {
     MutableSpan<bool> is_valid_span = params.uninitialized_single_output_if_required<bool>(
         4, "Is Valid");
 
+    /* Consecutive points are usually close to each other, so the previously found triangle is a
+     * good starting bound for the search. */
+    int last_group_index = -1;
+    int last_triangle_index = -1;
     mask.foreach_index([&](const int i) {
       const float3 position = positions[i];
       const int sample_id = sample_ids[i];
@@ -162,8 +166,15 @@ class SampleNearestSurfaceFunction : public mf::MultiFunction {
       const BVHTreeFromMesh &bvh = bvh_trees_[group_index];
       BVHTreeNearest nearest;
       nearest.dist_sq = FLT_MAX;
-      BLI_bvhtree_find_nearest(
-          bvh.tree, position, &nearest, bvh.nearest_callback, const_cast<BVHTreeFromMesh *>(&bvh));
+      BLI_bvhtree_find_nearest_with_hint(*bvh.tree,
+                                         position,
+                                         nearest,
+                                         bvh.nearest_callback,
+                                         const_cast<BVHTreeFromMesh *>(&bvh),
+                                         group_index == last_group_index ? last_triangle_index :
+                                                                           -1);
+      last_group_index = group_index;
+      last_triangle_index = nearest.index;
       triangle_index[i] = nearest.index;
       sample_position[i] = nearest.co;
       if (!is_valid_span.is_empty()) {
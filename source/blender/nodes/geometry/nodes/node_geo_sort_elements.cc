@@ -45,6 +45,9 @@ static void node_init(bNodeTree * /*tree*/, bNode *node)
   node->custom1 = int(bke::AttrDomain::Point);
 }
 
+/** Groups larger than this are sorted with a radix sort, which is faster for large arrays. */
+static constexpr int64_t radix_sort_threshold = 4096;
+
 static void grouped_sort(const OffsetIndices<int> offsets,
                          const Span<float> weights,
                          MutableSpan<int> indices)
@@ -62,6 +65,18 @@ static void grouped_sort(const OffsetIndices<int> offsets,
   threading::parallel_for(offsets.index_range(), 250, [&](const IndexRange range) {
     for (const int group_index : range) {
       MutableSpan<int> group = indices.slice(offsets[group_index]);
+      if (group.size() >= radix_sort_threshold) {
+        /* The indices in each group are sorted initially, so the stable radix sort gives the same
+         * order as the comparator. */
+        Array<uint32_t> keys(group.size());
+        threading::parallel_for(group.index_range(), 4096, [&](const IndexRange keys_range) {
+          for (const int i : keys_range) {
+            keys[i] = radix_sort_key(weights[group[i]]);
+          }
+        });
+        parallel_radix_sort(keys, group);
+        continue;
+      }
       parallel_sort(group.begin(), group.end(), comparator);
     }
   });
@@ -110,9 +125,20 @@ static int identifiers_to_indices(MutableSpan<int> r_identifiers_to_indices)
 
   Array<int> indices(deduplicated_identifiers.size());
   array_utils::fill_index_range<int>(indices);
-  parallel_sort(indices.begin(), indices.end(), [&](const int index_a, const int index_b) {
-    return deduplicated_identifiers[index_a] < deduplicated_identifiers[index_b];
-  });
+  if (indices.size() >= radix_sort_threshold) {
+    Array<uint32_t> keys(indices.size());
+    threading::parallel_for(indices.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        keys[i] = radix_sort_key(int32_t(deduplicated_identifiers[i]));
+      }
+    });
+    parallel_radix_sort(keys, indices);
+  }
+  else {
+    parallel_sort(indices.begin(), indices.end(), [&](const int index_a, const int index_b) {
+      return deduplicated_identifiers[index_a] < deduplicated_identifiers[index_b];
+    });
+  }
   Array<int> permutation = invert_permutation(indices);
   parallel_transform(
       r_identifiers_to_indices, 4096, [&](const int index) { return permutation[index]; });
@@ -22,6 +22,7 @@
 
 #include "NOD_geometry_exec.hh"
 #include "NOD_geometry_nodes_lazy_function.hh"
+#include "NOD_geometry_nodes_result_cache.hh"
 #include "NOD_multi_function.hh"
 #include "NOD_node_declaration.hh"
 
@@ -34,6 +35,7 @@
 #include "BLI_hash_md5.hh"
 #include "BLI_lazy_threading.hh"
 #include "BLI_map.hh"
+#include "BLI_profile_trace.hh"
 
 #include "DNA_ID.h"
 
@@ -153,6 +155,80 @@ std::string NodeAnonymousAttributeID::user_name() const
 /**
  * Used for most normal geometry nodes like Subdivision Surface and Set Position.
  */
+/**
+ * Some nodes depend on more than their inputs and properties, e.g. on the scene or on files.
+ * Their results must not be reused by the #GeoNodesResultCache. Nodes with data-block inputs
+ * don't have to be listed here, because those inputs can't be part of a #GeoNodeResultKey.
+ */
+static bool node_supports_result_cache(const bNode &node)
+{
+  switch (node.type) {
+    case GEO_NODE_DEFORM_CURVES_ON_SURFACE:
+    case GEO_NODE_IMPORT_OBJ:
+    case GEO_NODE_IMPORT_STL:
+    case GEO_NODE_MESH_TO_VOLUME:
+      return false;
+  }
+  return !node.input_sockets().is_empty();
+}
+
+/**
+ * Forwards everything to the actual params, but also keeps a copy of every output value so that
+ * it can be reused in the next evaluation.
+ */
+class ResultCachingParams : public lf::Params {
+ private:
+  lf::Params &base_params_;
+  GeoNodeCachedResult &result_;
+
+ public:
+  ResultCachingParams(const LazyFunction &fn, lf::Params &base_params, GeoNodeCachedResult &result)
+      : lf::Params(fn, false), base_params_(base_params), result_(result)
+  {
+  }
+
+  void *try_get_input_data_ptr_impl(const int index) const override
+  {
+    return base_params_.try_get_input_data_ptr(index);
+  }
+
+  void *try_get_input_data_ptr_or_request_impl(const int index) override
+  {
+    return base_params_.try_get_input_data_ptr_or_request(index);
+  }
+
+  void *get_output_data_ptr_impl(const int index) override
+  {
+    return base_params_.get_output_data_ptr(index);
+  }
+
+  void output_set_impl(const int index) override
+  {
+    result_.set_output(index, *fn_.outputs()[index].type, base_params_.get_output_data_ptr(index));
+    base_params_.output_set(index);
+  }
+
+  bool output_was_set_impl(const int index) const override
+  {
+    return base_params_.output_was_set(index);
+  }
+
+  lf::ValueUsage get_output_usage_impl(const int index) const override
+  {
+    return base_params_.get_output_usage(index);
+  }
+
+  void set_input_unused_impl(const int index) override
+  {
+    base_params_.set_input_unused(index);
+  }
+
+  bool try_enable_multi_threading_impl() override
+  {
+    return base_params_.try_enable_multi_threading();
+  }
+};
+
 class LazyFunctionForGeometryNode : public LazyFunction {
  private:
   const bNode &node_;
@@ -163,6 +239,7 @@ class LazyFunctionForGeometryNode : public LazyFunction {
    * does not have to execute.
    */
   Vector<bool> is_attribute_output_bsocket_;
+  bool use_result_cache_;
 
   struct OutputAttributeID {
     int bsocket_index;
@@ -178,7 +255,8 @@ class LazyFunctionForGeometryNode : public LazyFunction {
                               GeometryNodesLazyFunctionGraphInfo &own_lf_graph_info)
       : node_(node),
         own_lf_graph_info_(own_lf_graph_info),
-        is_attribute_output_bsocket_(node.output_sockets().size(), false)
+        is_attribute_output_bsocket_(node.output_sockets().size(), false),
+        use_result_cache_(node_supports_result_cache(node))
   {
     BLI_assert(node.typeinfo->geometry_node_execute != nullptr);
     debug_name_ = node.name;
@@ -254,6 +332,7 @@ class LazyFunctionForGeometryNode : public LazyFunction {
     GeoNodesLFUserData *user_data = dynamic_cast<GeoNodesLFUserData *>(context.user_data);
     BLI_assert(user_data != nullptr);
     const auto &local_user_data = *static_cast<GeoNodesLFLocalUserData *>(context.local_user_data);
+    PROFILE_TRACE_ZONE_DETAIL("Geometry Node", node_.name);
 
     /* Lazily create the required anonymous attribute ids. */
     auto get_output_attribute_id = [&](const int output_bsocket_index) -> AnonymousAttributeIDPtr {
@@ -317,9 +396,35 @@ class LazyFunctionForGeometryNode : public LazyFunction {
       return;
     }
 
+    geo_eval_log::GeoTreeLogger *tree_logger = local_user_data.try_get_tree_logger(*user_data);
+
+    GeoNodesResultCache *result_cache = use_result_cache_ ? user_data->call_data->result_cache :
+                                                            nullptr;
+    const ComputeContextHash &context_hash = user_data->compute_context->hash();
+    std::unique_ptr<GeoNodeResultKey> result_key;
+    if (result_cache && result_cache->is_slow_node(context_hash, node_.identifier)) {
+      result_key = this->build_result_key(params, *user_data);
+      if (result_key) {
+        if (const std::shared_ptr<const GeoNodeCachedResult> result = result_cache->lookup(
+                context_hash, node_.identifier, *result_key))
+        {
+          if (this->try_output_cached_result(params, *result, tree_logger)) {
+            return;
+          }
+        }
+      }
+    }
+
+    std::shared_ptr<GeoNodeCachedResult> result_to_cache;
+    std::optional<ResultCachingParams> caching_params;
+    if (result_key) {
+      result_to_cache = std::make_shared<GeoNodeCachedResult>(outputs_.size());
+      caching_params.emplace(*this, params, *result_to_cache);
+    }
+
     GeoNodeExecParams geo_params{
         node_,
-        params,
+        caching_params ? static_cast<lf::Params &>(*caching_params) : params,
         context,
         own_lf_graph_info_.mapping.lf_input_index_for_output_bsocket_usage,
         own_lf_graph_info_.mapping.lf_input_index_for_attribute_propagation_to_output,
@@ -329,11 +434,105 @@ class LazyFunctionForGeometryNode : public LazyFunction {
     node_.typeinfo->geometry_node_execute(geo_params);
     geo_eval_log::TimePoint end_time = geo_eval_log::Clock::now();
 
-    if (geo_eval_log::GeoTreeLogger *tree_logger = local_user_data.try_get_tree_logger(*user_data))
-    {
+    if (tree_logger) {
       tree_logger->node_execution_times.append(*tree_logger->allocator,
                                                {node_.identifier, start_time, end_time});
     }
+
+    if (result_cache) {
+      if (end_time - start_time < GeoNodesResultCache::min_execution_time) {
+        if (result_key) {
+          result_cache->remove(context_hash, node_.identifier);
+        }
+      }
+      else if (result_key) {
+        if (tree_logger) {
+          this->gather_logged_data(*tree_logger, *result_to_cache);
+        }
+        result_cache->add(
+            context_hash, node_.identifier, std::move(result_key), std::move(result_to_cache));
+      }
+      else {
+        result_cache->add_slow_node(context_hash, node_.identifier);
+      }
+    }
+  }
+
+  std::unique_ptr<GeoNodeResultKey> build_result_key(lf::Params &params,
+                                                     const GeoNodesLFUserData &user_data) const
+  {
+    auto key = std::make_unique<GeoNodeResultKey>();
+    key->add_node_properties(node_);
+    /* The names of the anonymous attributes created by the node depend on the object name. */
+    key->add_string(this->get_self_object(user_data)->id.name);
+    for (const int lf_index : inputs_.index_range()) {
+      const void *value = params.try_get_input_data_ptr(lf_index);
+      if (!key->add_value(*inputs_[lf_index].type, value)) {
+        return nullptr;
+      }
+    }
+    return key;
+  }
+
+  /**
+   * Set all required outputs from the cached result. Nothing is done if some of them are missing,
+   * e.g. because they were not used when the result was cached.
+   */
+  bool try_output_cached_result(lf::Params &params,
+                                const GeoNodeCachedResult &result,
+                                geo_eval_log::GeoTreeLogger *tree_logger) const
+  {
+    if (result.outputs.size() != outputs_.size()) {
+      return false;
+    }
+    for (const int lf_index : outputs_.index_range()) {
+      if (params.output_was_set(lf_index) ||
+          params.get_output_usage(lf_index) == lf::ValueUsage::Unused)
+      {
+        continue;
+      }
+      if (result.outputs[lf_index].type() != outputs_[lf_index].type) {
+        return false;
+      }
+    }
+    for (const int lf_index : outputs_.index_range()) {
+      const GMutablePointer value = result.outputs[lf_index];
+      if (value.get() == nullptr || params.output_was_set(lf_index)) {
+        continue;
+      }
+      value.type()->copy_construct(value.get(), params.get_output_data_ptr(lf_index));
+      params.output_set(lf_index);
+    }
+    if (tree_logger) {
+      for (const geo_eval_log::NodeWarning &warning : result.warnings) {
+        tree_logger->node_warnings.append(*tree_logger->allocator, {node_.identifier, warning});
+      }
+      for (const auto &[name, usage] : result.used_named_attributes) {
+        tree_logger->used_named_attributes.append(
+            *tree_logger->allocator,
+            {node_.identifier, tree_logger->allocator->copy_string(name), usage});
+      }
+    }
+    return true;
+  }
+
+  /** Keep the warnings of the node, so that they are still displayed when the cache is used. */
+  void gather_logged_data(geo_eval_log::GeoTreeLogger &tree_logger,
+                          GeoNodeCachedResult &result) const
+  {
+    for (const geo_eval_log::GeoTreeLogger::WarningWithNode &warning : tree_logger.node_warnings)
+    {
+      if (warning.node_id == node_.identifier) {
+        result.warnings.append(warning.warning);
+      }
+    }
+    for (const geo_eval_log::GeoTreeLogger::AttributeUsageWithNode &usage :
+         tree_logger.used_named_attributes)
+    {
+      if (usage.node_id == node_.identifier) {
+        result.used_named_attributes.append({usage.attribute_name, usage.usage});
+      }
+    }
   }
 
   /**
@@ -0,0 +1,325 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <algorithm>
+
+#include "BLI_listbase.h"
+
+#include "BKE_anonymous_attribute_id.hh"
+#include "BKE_attribute.hh"
+#include "BKE_instances.hh"
+#include "BKE_mesh_types.hh"
+#include "BKE_node_socket_value.hh"
+
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
+#include "DNA_node_types.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "NOD_geometry_nodes_result_cache.hh"
+
+namespace blender::nodes {
+
+static void append_bytes(Vector<uint64_t> &tokens, const void *data, const int64_t size)
+{
+  const int64_t tokens_num = (size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  const int64_t old_size = tokens.size();
+  tokens.append_n_times(0, tokens_num);
+  memcpy(tokens.data() + old_size, data, size_t(size));
+}
+
+static bool append_custom_data_identity(const CustomData &data,
+                                        const int size,
+                                        Vector<uint64_t> &tokens,
+                                        Vector<std::string> &strings)
+{
+  tokens.append(uint64_t(size));
+  tokens.append(uint64_t(data.totlayer));
+  for (const CustomDataLayer &layer : Span(data.layers, data.totlayer)) {
+    if (layer.sharing_info == nullptr) {
+      return false;
+    }
+    tokens.append(uint64_t(layer.type));
+    tokens.append(uint64_t(uintptr_t(layer.sharing_info)));
+    tokens.append(uint64_t(uintptr_t(layer.data)));
+    strings.append(layer.name);
+  }
+  return true;
+}
+
+/**
+ * Identify the mesh by its implicitly shared arrays instead of the mesh pointer. That way, the
+ * same mesh data is still recognized when it has been copied into a new mesh (which happens for
+ * the input of the modifier in every evaluation).
+ */
+static bool append_mesh_identity(const Mesh &mesh,
+                                 Vector<uint64_t> &tokens,
+                                 Vector<std::string> &strings)
+{
+  if (mesh.faces_num > 0 && mesh.runtime->face_offsets_sharing_info == nullptr) {
+    return false;
+  }
+  tokens.append(uint64_t(uintptr_t(mesh.runtime->face_offsets_sharing_info)));
+  tokens.append(uint64_t(uintptr_t(mesh.face_offset_indices)));
+  if (!append_custom_data_identity(mesh.vert_data, mesh.verts_num, tokens, strings) ||
+      !append_custom_data_identity(mesh.edge_data, mesh.edges_num, tokens, strings) ||
+      !append_custom_data_identity(mesh.face_data, mesh.faces_num, tokens, strings) ||
+      !append_custom_data_identity(mesh.corner_data, mesh.corners_num, tokens, strings))
+  {
+    return false;
+  }
+  for (const Material *material : Span(mesh.mat, mesh.totcol)) {
+    tokens.append(uint64_t(uintptr_t(material)));
+  }
+  tokens.append(uint64_t(mesh.totcol));
+  LISTBASE_FOREACH (const bDeformGroup *, group, &mesh.vertex_group_names) {
+    strings.append(group->name);
+  }
+  strings.append(mesh.active_color_attribute ? mesh.active_color_attribute : "");
+  strings.append(mesh.default_color_attribute ? mesh.default_color_attribute : "");
+  return true;
+}
+
+void GeoNodeResultKey::add_geometry(const bke::GeometrySet &geometry)
+{
+  tokens_.append(uint64_t(uintptr_t(&CPPType::get<bke::GeometrySet>())));
+  for (const int i : IndexRange(GEO_COMPONENT_TYPE_ENUM_SIZE)) {
+    const auto type = bke::GeometryComponent::Type(i);
+    const bke::GeometryComponent *component = geometry.get_component(type);
+    tokens_.append(uint64_t(i));
+    if (type == bke::GeometryComponent::Type::Mesh && component != nullptr) {
+      const Mesh *mesh = geometry.get_mesh();
+      const int64_t tokens_num = tokens_.size();
+      const int64_t strings_num = strings_.size();
+      if (mesh != nullptr && append_mesh_identity(*mesh, tokens_, strings_)) {
+        continue;
+      }
+      tokens_.resize(tokens_num);
+      strings_.resize(strings_num);
+    }
+    /* Otherwise fall back to the identity of the component itself. */
+    tokens_.append(uint64_t(uintptr_t(component)));
+  }
+  strings_.append(geometry.name);
+  pinned_geometries_.append(geometry);
+}
+
+bool GeoNodeResultKey::add_value(const CPPType &type, const void *value)
+{
+  if (type.is<bke::GeometrySet>()) {
+    this->add_geometry(*static_cast<const bke::GeometrySet *>(value));
+    return true;
+  }
+  if (type.is<bke::SocketValueVariant>()) {
+    const auto &variant = *static_cast<const bke::SocketValueVariant *>(value);
+    if (variant.is_context_dependent_field() || variant.is_volume_grid()) {
+      return false;
+    }
+    bke::SocketValueVariant single_value = variant;
+    single_value.convert_to_single();
+    const GPointer single_ptr = single_value.get_single_ptr();
+    const CPPType &single_type = *single_ptr.type();
+    tokens_.append(uint64_t(uintptr_t(&single_type)));
+    if (single_type.is<std::string>()) {
+      strings_.append(*single_ptr.get<std::string>());
+      return true;
+    }
+    if (single_type.is_trivially_destructible()) {
+      /* Plain values like numbers, vectors and matrices. */
+      append_bytes(tokens_, single_ptr.get(), single_type.size());
+      return true;
+    }
+    return false;
+  }
+  if (type.is<bool>()) {
+    tokens_.append(*static_cast<const bool *>(value) ? 1 : 2);
+    return true;
+  }
+  if (type.is<bke::AnonymousAttributeSet>()) {
+    const auto &set = *static_cast<const bke::AnonymousAttributeSet *>(value);
+    tokens_.append(uint64_t(uintptr_t(&type)));
+    if (!set.names) {
+      tokens_.append(0);
+      return true;
+    }
+    Vector<std::string> names(set.names->begin(), set.names->end());
+    std::sort(names.begin(), names.end());
+    tokens_.append(uint64_t(names.size()) + 1);
+    strings_.extend(names);
+    return true;
+  }
+  /* Pointers to data-blocks are not supported, because the data-block may have changed. */
+  return false;
+}
+
+void GeoNodeResultKey::add_node_properties(const bNode &node)
+{
+  tokens_.append(uint64_t(node.type));
+  tokens_.append(uint64_t(uint16_t(node.custom1)));
+  tokens_.append(uint64_t(uint16_t(node.custom2)));
+  append_bytes(tokens_, &node.custom3, sizeof(float));
+  append_bytes(tokens_, &node.custom4, sizeof(float));
+  if (node.storage != nullptr) {
+    const int64_t storage_size = int64_t(MEM_allocN_len(node.storage));
+    tokens_.append(uint64_t(storage_size));
+    append_bytes(tokens_, node.storage, storage_size);
+  }
+}
+
+void GeoNodeResultKey::add_string(std::string str)
+{
+  strings_.append(std::move(str));
+}
+
+GeoNodeCachedResult::GeoNodeCachedResult(const int outputs_num)
+    : outputs(outputs_num, GMutablePointer())
+{
+}
+
+GeoNodeCachedResult::~GeoNodeCachedResult()
+{
+  for (GMutablePointer &value : outputs) {
+    if (value.get() != nullptr) {
+      value.destruct();
+      MEM_freeN(value.get());
+    }
+  }
+}
+
+void GeoNodeCachedResult::set_output(const int index, const CPPType &type, const void *value)
+{
+  BLI_assert(outputs[index].get() == nullptr);
+  void *buffer = MEM_mallocN_aligned(type.size(), type.alignment(), __func__);
+  type.copy_construct(value, buffer);
+  outputs[index] = {type, buffer};
+}
+
+static int64_t estimate_geometry_memory(const bke::GeometrySet &geometry)
+{
+  int64_t memory = 0;
+  for (const bke::GeometryComponent *component : geometry.get_components()) {
+    if (const std::optional<bke::AttributeAccessor> attributes = component->attributes()) {
+      attributes->for_all(
+          [&](const bke::AttributeIDRef & /*id*/, const bke::AttributeMetaData &meta_data) {
+            if (const CPPType *type = bke::custom_data_type_to_cpp_type(meta_data.data_type)) {
+              memory += int64_t(attributes->domain_size(meta_data.domain)) * type->size();
+            }
+            return true;
+          });
+    }
+  }
+  if (const bke::Instances *instances = geometry.get_instances()) {
+    for (const bke::InstanceReference &reference : instances->references()) {
+      if (reference.type() == bke::InstanceReference::Type::GeometrySet) {
+        memory += estimate_geometry_memory(reference.geometry_set());
+      }
+    }
+  }
+  return memory;
+}
+
+int64_t GeoNodeCachedResult::estimate_memory() const
+{
+  int64_t memory = 0;
+  for (const GMutablePointer &value : outputs) {
+    if (value.get() == nullptr) {
+      continue;
+    }
+    memory += value.type()->size();
+    if (value.type()->is<bke::GeometrySet>()) {
+      memory += estimate_geometry_memory(*value.get<bke::GeometrySet>());
+    }
+  }
+  return memory;
+}
+
+GeoNodesResultCache::GeoNodesResultCache(const int64_t max_memory) : max_memory_(max_memory) {}
+
+void GeoNodesResultCache::begin_evaluation()
+{
+  std::lock_guard lock{mutex_};
+  evaluation_++;
+}
+
+void GeoNodesResultCache::end_evaluation()
+{
+  std::lock_guard lock{mutex_};
+  entries_.remove_if([&](const auto item) {
+    if (item.value.last_used_evaluation == evaluation_) {
+      return false;
+    }
+    memory_ -= item.value.memory;
+    return true;
+  });
+}
+
+bool GeoNodesResultCache::is_slow_node(const ComputeContextHash &context_hash,
+                                       const int32_t node_id)
+{
+  std::lock_guard lock{mutex_};
+  Entry *entry = entries_.lookup_ptr({context_hash, node_id});
+  if (entry == nullptr) {
+    return false;
+  }
+  entry->last_used_evaluation = evaluation_;
+  return true;
+}
+
+std::shared_ptr<const GeoNodeCachedResult> GeoNodesResultCache::lookup(
+    const ComputeContextHash &context_hash, const int32_t node_id, const GeoNodeResultKey &key)
+{
+  std::lock_guard lock{mutex_};
+  const Entry *entry = entries_.lookup_ptr({context_hash, node_id});
+  if (entry == nullptr || !entry->key || !(*entry->key == key)) {
+    return nullptr;
+  }
+  return entry->result;
+}
+
+void GeoNodesResultCache::add_slow_node(const ComputeContextHash &context_hash,
+                                        const int32_t node_id)
+{
+  std::lock_guard lock{mutex_};
+  Entry &entry = entries_.lookup_or_add_default({context_hash, node_id});
+  entry.last_used_evaluation = evaluation_;
+}
+
+void GeoNodesResultCache::add(const ComputeContextHash &context_hash,
+                              const int32_t node_id,
+                              std::unique_ptr<GeoNodeResultKey> key,
+                              std::shared_ptr<const GeoNodeCachedResult> result)
+{
+  const int64_t memory = result->estimate_memory();
+  std::lock_guard lock{mutex_};
+  Entry &entry = entries_.lookup_or_add_default({context_hash, node_id});
+  memory_ -= entry.memory;
+  entry.last_used_evaluation = evaluation_;
+  if (memory_ + memory > max_memory_) {
+    /* Don't try to cache the node again when it does not fit into the budget anyway. */
+    entries_.remove_contained({context_hash, node_id});
+    return;
+  }
+  entry.key = std::move(key);
+  entry.result = std::move(result);
+  entry.memory = memory;
+  memory_ += memory;
+}
+
+void GeoNodesResultCache::remove(const ComputeContextHash &context_hash, const int32_t node_id)
+{
+  std::lock_guard lock{mutex_};
+  if (const std::optional<Entry> entry = entries_.pop_try({context_hash, node_id})) {
+    memory_ -= entry->memory;
+  }
+}
+
+void GeoNodesResultCache::clear()
+{
+  std::lock_guard lock{mutex_};
+  entries_.clear();
+  memory_ = 0;
+}
+
+}  // namespace blender::nodes
@@ -112,7 +112,9 @@ static int gpu_shader_combrgb(GPUMaterial *mat,
 static void sh_node_combrgb_build_multi_function(NodeMultiFunctionBuilder &builder)
 {
   static auto fn = mf::build::SI3_SO<float, float, float, ColorGeometry4f>(
-      "Combine RGB", [](float r, float g, float b) { return ColorGeometry4f(r, g, b, 1.0f); });
+      "Combine RGB",
+      [](float r, float g, float b) { return ColorGeometry4f(r, g, b, 1.0f); },
+      mf::build::exec_presets::AllSpanOrSingle());
   builder.set_matching_fn(fn);
 }
 
@@ -123,73 +123,91 @@ static const mf::MultiFunction *get_multi_function(const bNode &node)
             "Rotate Axis",
             [](const float3 &in, const float3 &center, const float3 &axis, float angle) {
               return sh_node_vector_rotate_around_axis(in, center, axis, -angle);
-            });
+            },
+            mf::build::exec_presets::SomeSpanOrSingle<0>());
         return &fn;
       }
       static auto fn = mf::build::SI4_SO<float3, float3, float3, float, float3>(
           "Rotate Axis",
           [](const float3 &in, const float3 &center, const float3 &axis, float angle) {
             return sh_node_vector_rotate_around_axis(in, center, axis, angle);
-          });
+          },
+          mf::build::exec_presets::SomeSpanOrSingle<0>());
       return &fn;
     }
     case NODE_VECTOR_ROTATE_TYPE_AXIS_X: {
       float3 axis = float3(1.0f, 0.0f, 0.0f);
       if (invert) {
         static auto fn = mf::build::SI3_SO<float3, float3, float, float3>(
-            "Rotate X-Axis", [=](const float3 &in, const float3 &center, float angle) {
+            "Rotate X-Axis",
+            [=](const float3 &in, const float3 &center, float angle) {
               return sh_node_vector_rotate_around_axis(in, center, axis, -angle);
-            });
+            },
+            mf::build::exec_presets::SomeSpanOrSingle<0>());
         return &fn;
       }
       static auto fn = mf::build::SI3_SO<float3, float3, float, float3>(
-          "Rotate X-Axis", [=](const float3 &in, const float3 &center, float angle) {
+          "Rotate X-Axis",
+          [=](const float3 &in, const float3 &center, float angle) {
             return sh_node_vector_rotate_around_axis(in, center, axis, angle);
-          });
+          },
+          mf::build::exec_presets::SomeSpanOrSingle<0>());
       return &fn;
     }
     case NODE_VECTOR_ROTATE_TYPE_AXIS_Y: {
       float3 axis = float3(0.0f, 1.0f, 0.0f);
       if (invert) {
         static auto fn = mf::build::SI3_SO<float3, float3, float, float3>(
-            "Rotate Y-Axis", [=](const float3 &in, const float3 &center, float angle) {
+            "Rotate Y-Axis",
+            [=](const float3 &in, const float3 &center, float angle) {
               return sh_node_vector_rotate_around_axis(in, center, axis, -angle);
-            });
+            },
+            mf::build::exec_presets::SomeSpanOrSingle<0>());
         return &fn;
       }
       static auto fn = mf::build::SI3_SO<float3, float3, float, float3>(
-          "Rotate Y-Axis", [=](const float3 &in, const float3 &center, float angle) {
+          "Rotate Y-Axis",
+          [=](const float3 &in, const float3 &center, float angle) {
             return sh_node_vector_rotate_around_axis(in, center, axis, angle);
-          });
+          },
+          mf::build::exec_presets::SomeSpanOrSingle<0>());
       return &fn;
     }
     case NODE_VECTOR_ROTATE_TYPE_AXIS_Z: {
       float3 axis = float3(0.0f, 0.0f, 1.0f);
       if (invert) {
         static auto fn = mf::build::SI3_SO<float3, float3, float, float3>(
-            "Rotate Z-Axis", [=](const float3 &in, const float3 &center, float angle) {
+            "Rotate Z-Axis",
+            [=](const float3 &in, const float3 &center, float angle) {
               return sh_node_vector_rotate_around_axis(in, center, axis, -angle);
-            });
+            },
+            mf::build::exec_presets::SomeSpanOrSingle<0>());
         return &fn;
       }
       static auto fn = mf::build::SI3_SO<float3, float3, float, float3>(
-          "Rotate Z-Axis", [=](const float3 &in, const float3 &center, float angle) {
+          "Rotate Z-Axis",
+          [=](const float3 &in, const float3 &center, float angle) {
             return sh_node_vector_rotate_around_axis(in, center, axis, angle);
-          });
+          },
+          mf::build::exec_presets::SomeSpanOrSingle<0>());
       return &fn;
     }
     case NODE_VECTOR_ROTATE_TYPE_EULER_XYZ: {
       if (invert) {
         static auto fn = mf::build::SI3_SO<float3, float3, float3, float3>(
-            "Rotate Euler", [](const float3 &in, const float3 &center, const float3 &rotation) {
+            "Rotate Euler",
+            [](const float3 &in, const float3 &center, const float3 &rotation) {
               return sh_node_vector_rotate_euler(in, center, rotation, true);
-            });
+            },
+            mf::build::exec_presets::SomeSpanOrSingle<0>());
         return &fn;
       }
       static auto fn = mf::build::SI3_SO<float3, float3, float3, float3>(
-          "Rotate Euler", [](const float3 &in, const float3 &center, const float3 &rotation) {
+          "Rotate Euler",
+          [](const float3 &in, const float3 &center, const float3 &rotation) {
             return sh_node_vector_rotate_euler(in, center, rotation, false);
-          });
+          },
+          mf::build::exec_presets::SomeSpanOrSingle<0>());
       return &fn;
     }
     default:
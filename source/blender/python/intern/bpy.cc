@@ -645,6 +645,30 @@ static PyObject *bpy_wm_capabilities(PyObject *self)
   return result;
 }
 
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_rna_update_batch_begin_doc,
+    ".. function:: _rna_update_batch_begin()\n"
+    "\n"
+    "   Begin deferring property update tags, see ``bpy.utils.batch_update``.\n");
+static PyObject *bpy_rna_update_batch_begin(PyObject * /*self*/)
+{
+  RNA_property_update_batch_begin();
+  Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_rna_update_batch_end_doc,
+    ".. function:: _rna_update_batch_end()\n"
+    "\n"
+    "   Send property update tags deferred since the matching begin call.\n");
+static PyObject *bpy_rna_update_batch_end(PyObject * /*self*/)
+{
+  RNA_property_update_batch_end();
+  Py_RETURN_NONE;
+}
+
 #if (defined(__GNUC__) && !defined(__clang__))
 #  pragma GCC diagnostic push
 #  pragma GCC diagnostic ignored "-Wcast-function-type"
@@ -684,6 +708,14 @@ static PyMethodDef bpy_methods[] = {
      bpy_driver_secure_code_test_doc},
     {"_ghost_backend", (PyCFunction)bpy_ghost_backend, METH_NOARGS, bpy_ghost_backend_doc},
     {"_wm_capabilities", (PyCFunction)bpy_wm_capabilities, METH_NOARGS, bpy_wm_capabilities_doc},
+    {"_rna_update_batch_begin",
+     (PyCFunction)bpy_rna_update_batch_begin,
+     METH_NOARGS,
+     bpy_rna_update_batch_begin_doc},
+    {"_rna_update_batch_end",
+     (PyCFunction)bpy_rna_update_batch_end,
+     METH_NOARGS,
+     bpy_rna_update_batch_end_doc},
 
     {nullptr, nullptr, 0, nullptr},
 };
@@ -53,9 +53,11 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_bvhutils.hh"
@@ -337,9 +339,9 @@ static bool cast_ray_highpoly(BVHTreeFromMesh *treeData,
     hit_distance_squared = FLT_MAX;
   }
 
-  BVHTreeRayHit *hits;
-  hits = static_cast<BVHTreeRayHit *>(
-      MEM_mallocN(sizeof(BVHTreeRayHit) * tot_highpoly, "Bake Highpoly to Lowpoly: BVH Rays"));
+  /* Called for every pixel from multiple threads, avoid a heap allocation in the common case of
+   * few high-poly objects. */
+  blender::Array<BVHTreeRayHit, 16> hits(tot_highpoly);
 
   for (i = 0; i < tot_highpoly; i++) {
     float co_high[3], dir_high[3];
@@ -442,7 +444,6 @@ static bool cast_ray_highpoly(BVHTreeFromMesh *treeData,
     pixel_array[pixel_id].seed = 0;
   }
 
-  MEM_freeN(hits);
   return hit_mesh != -1;
 }
 
@@ -556,8 +557,6 @@ bool RE_bake_pixels_populate_from_objects(Mesh *me_low,
                                           Mesh *me_cage)
 {
   size_t i;
-  int primitive_id;
-  float u, v;
   float imat_low[4][4];
   bool is_cage = me_cage != nullptr;
   bool result = true;
@@ -610,56 +609,60 @@ bool RE_bake_pixels_populate_from_objects(Mesh *me_low,
     }
   }
 
-  for (i = 0; i < pixels_num; i++) {
-    float co[3];
-    float dir[3];
-    TriTessFace *tri_low;
-
-    primitive_id = pixel_array_from[i].primitive_id;
-
-    if (primitive_id == -1) {
-      pixel_array_to[i].primitive_id = -1;
-      continue;
-    }
-
-    u = pixel_array_from[i].uv[0];
-    v = pixel_array_from[i].uv[1];
-
-    /* calculate from low poly mesh cage */
-    if (is_custom_cage) {
-      calc_point_from_barycentric_cage(
-          tris_low, tris_cage, mat_low, mat_cage, primitive_id, u, v, co, dir);
-      tri_low = &tris_cage[primitive_id];
-    }
-    else if (is_cage) {
-      calc_point_from_barycentric_extrusion(
-          tris_cage, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, true);
-      tri_low = &tris_cage[primitive_id];
-    }
-    else {
-      calc_point_from_barycentric_extrusion(
-          tris_low, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, false);
-      tri_low = &tris_low[primitive_id];
-    }
-
-    /* cast ray */
-    if (!cast_ray_highpoly(treeData.data(),
-                           tri_low,
-                           tris_high,
-                           pixel_array_from,
-                           pixel_array_to,
-                           mat_low,
-                           highpoly,
-                           co,
-                           dir,
-                           i,
-                           tot_highpoly,
-                           max_ray_distance))
-    {
-      /* if it fails mask out the original pixel array */
-      pixel_array_from[i].primitive_id = -1;
-    }
-  }
+  /* Rays of different pixels are independent, cast them in parallel. */
+  blender::threading::parallel_for(
+      blender::IndexRange(pixels_num), 1024, [&](const blender::IndexRange range) {
+        for (const int64_t pixel_i : range) {
+          float co[3];
+          float dir[3];
+          TriTessFace *tri_low;
+
+          const int primitive_id = pixel_array_from[pixel_i].primitive_id;
+
+          if (primitive_id == -1) {
+            pixel_array_to[pixel_i].primitive_id = -1;
+            continue;
+          }
+
+          const float u = pixel_array_from[pixel_i].uv[0];
+          const float v = pixel_array_from[pixel_i].uv[1];
+
+          /* calculate from low poly mesh cage */
+          if (is_custom_cage) {
+            calc_point_from_barycentric_cage(
+                tris_low, tris_cage, mat_low, mat_cage, primitive_id, u, v, co, dir);
+            tri_low = &tris_cage[primitive_id];
+          }
+          else if (is_cage) {
+            calc_point_from_barycentric_extrusion(
+                tris_cage, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, true);
+            tri_low = &tris_cage[primitive_id];
+          }
+          else {
+            calc_point_from_barycentric_extrusion(
+                tris_low, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, false);
+            tri_low = &tris_low[primitive_id];
+          }
+
+          /* cast ray */
+          if (!cast_ray_highpoly(treeData.data(),
+                                 tri_low,
+                                 tris_high,
+                                 pixel_array_from,
+                                 pixel_array_to,
+                                 mat_low,
+                                 highpoly,
+                                 co,
+                                 dir,
+                                 int(pixel_i),
+                                 tot_highpoly,
+                                 max_ray_distance))
+          {
+            /* if it fails mask out the original pixel array */
+            pixel_array_from[pixel_i].primitive_id = -1;
+          }
+        }
+      });
 
   /* garbage collection */
 cleanup:
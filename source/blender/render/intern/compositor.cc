@@ -509,6 +509,11 @@ class Context : public realtime_compositor::Context {
       BKE_image_ensure_viewer_views(input_data_.render_data, image, &image_user);
     }
 
+    /* Read the result before locking the image, and hand the read buffer over to the image buffer
+     * instead of copying it, which is costly for large outputs. */
+    GPU_memory_barrier(GPU_BARRIER_TEXTURE_UPDATE);
+    float *output_buffer = (float *)GPU_texture_read(viewer_output_texture_, GPU_DATA_FLOAT, 0);
+
     BLI_thread_lock(LOCK_DRAW_IMAGE);
 
     void *lock;
@@ -521,21 +526,14 @@ class Context : public realtime_compositor::Context {
       imb_freerectfloatImBuf(image_buffer);
       image_buffer->x = size.x;
       image_buffer->y = size.y;
-      imb_addrectfloatImBuf(image_buffer, 4);
+      image_buffer->channels = 4;
       image_buffer->userflags |= IB_DISPLAY_BUFFER_INVALID;
     }
+    IMB_assign_float_buffer(image_buffer, output_buffer, IB_TAKE_OWNERSHIP);
 
     BKE_image_release_ibuf(image, image_buffer, lock);
     BLI_thread_unlock(LOCK_DRAW_IMAGE);
 
-    GPU_memory_barrier(GPU_BARRIER_TEXTURE_UPDATE);
-    float *output_buffer = (float *)GPU_texture_read(viewer_output_texture_, GPU_DATA_FLOAT, 0);
-
-    std::memcpy(
-        image_buffer->float_buffer.data, output_buffer, size.x * size.y * 4 * sizeof(float));
-
-    MEM_freeN(output_buffer);
-
     BKE_image_partial_update_mark_full_update(image);
     if (input_data_.node_tree->runtime->update_draw) {
       input_data_.node_tree->runtime->update_draw(input_data_.node_tree->runtime->udh);
@@ -16,6 +16,7 @@
 #include "BLI_math_color.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 
 #include "BKE_attribute.hh"
@@ -1420,19 +1421,18 @@ static void bake_ibuf_normalize_displacement(ImBuf *ibuf,
                                              float displacement_min,
                                              float displacement_max)
 {
-  int i;
-  const float *current_displacement = displacement;
-  const char *current_mask = mask;
-  float max_distance;
+  const float max_distance = max_ff(fabsf(displacement_min), fabsf(displacement_max));
 
-  max_distance = max_ff(fabsf(displacement_min), fabsf(displacement_max));
+  const blender::IndexRange pixels(int64_t(ibuf->x) * ibuf->y);
+  blender::threading::parallel_for(pixels, 4096, [&](const blender::IndexRange range) {
+    for (const int64_t i : range) {
+      if (mask[i] != FILTER_MASK_USED) {
+        continue;
+      }
 
-  for (i = 0; i < ibuf->x * ibuf->y; i++) {
-    if (*current_mask == FILTER_MASK_USED) {
       float normalized_displacement;
-
       if (max_distance > 1e-5f) {
-        normalized_displacement = (*current_displacement + max_distance) / (max_distance * 2);
+        normalized_displacement = (displacement[i] + max_distance) / (max_distance * 2);
       }
       else {
         normalized_displacement = 0.5f;
@@ -1451,10 +1451,7 @@ static void bake_ibuf_normalize_displacement(ImBuf *ibuf,
         cp[3] = 255;
       }
     }
-
-    current_displacement++;
-    current_mask++;
-  }
+  });
 }
 
 /* **************** Common functions public API relates on **************** */
@@ -10,6 +10,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <optional>
 
 #include "MEM_guardedalloc.h"
 
@@ -19,8 +20,10 @@
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_appdir.hh"
 #include "BKE_global.hh"
@@ -206,24 +209,36 @@ static void render_layer_allocate_pass(RenderResult *rr, RenderPass *rp)
    * channels. */
 
   const size_t rectsize = size_t(rr->rectx) * rr->recty * rp->channels;
-  float *buffer_data = MEM_cnew_array<float>(rectsize, rp->name);
-
-  rp->ibuf = IMB_allocImBuf(rr->rectx, rr->recty, get_num_planes_for_pass_ibuf(*rp), 0);
-  rp->ibuf->channels = rp->channels;
-  IMB_assign_float_buffer(rp->ibuf, buffer_data, IB_TAKE_OWNERSHIP);
-  assign_render_pass_ibuf_colorspace(*rp);
 
+  /* Passes that are cleared to zero use zeroed memory from the allocator, which the system only
+   * commits to physical memory once the render engine writes to it. Passes with another clear
+   * value are filled in parallel, without clearing them to zero first. */
+  std::optional<float> clear_value;
   if (STREQ(rp->name, RE_PASSNAME_VECTOR)) {
     /* initialize to max speed */
-    for (int x = rectsize - 1; x >= 0; x--) {
-      buffer_data[x] = PASS_VECTOR_MAX;
-    }
+    clear_value = PASS_VECTOR_MAX;
   }
   else if (STREQ(rp->name, RE_PASSNAME_Z)) {
-    for (int x = rectsize - 1; x >= 0; x--) {
-      buffer_data[x] = 10e10;
-    }
+    clear_value = 10e10;
   }
+
+  float *buffer_data;
+  if (clear_value) {
+    buffer_data = static_cast<float *>(MEM_malloc_arrayN(rectsize, sizeof(float), rp->name));
+    blender::MutableSpan<float> buffer(buffer_data, int64_t(rectsize));
+    blender::threading::parallel_for(
+        buffer.index_range(), 1 << 16, [&](const blender::IndexRange range) {
+          buffer.slice(range).fill(*clear_value);
+        });
+  }
+  else {
+    buffer_data = MEM_cnew_array<float>(rectsize, rp->name);
+  }
+
+  rp->ibuf = IMB_allocImBuf(rr->rectx, rr->recty, get_num_planes_for_pass_ibuf(*rp), 0);
+  rp->ibuf->channels = rp->channels;
+  IMB_assign_float_buffer(rp->ibuf, buffer_data, IB_TAKE_OWNERSHIP);
+  assign_render_pass_ibuf_colorspace(*rp);
 }
 
 RenderPass *render_layer_add_pass(RenderResult *rr,
@@ -804,6 +819,10 @@ static void do_merge_tile(
 
 void render_result_merge(RenderResult *rr, RenderResult *rrpart)
 {
+  /* Gather the passes to merge first, so that they can be copied in parallel. With many passes
+   * copying them one after another is a significant part of finishing a render. */
+  blender::Vector<std::pair<RenderPass *, RenderPass *>> pass_pairs;
+
   LISTBASE_FOREACH (RenderLayer *, rl, &rr->layers) {
     RenderLayer *rlp = RE_GetRenderLayer(rrpart, rl->name);
 
@@ -828,17 +847,25 @@ void render_result_merge(RenderResult *rr, RenderResult *rrpart)
           continue;
         }
 
-        do_merge_tile(rr,
-                      rrpart,
-                      rpass->ibuf->float_buffer.data,
-                      rpassp->ibuf->float_buffer.data,
-                      rpass->channels);
+        pass_pairs.append({rpass, rpassp});
 
         /* manually get next render pass */
         rpassp = rpassp->next;
       }
     }
   }
+
+  blender::threading::parallel_for(
+      pass_pairs.index_range(), 1, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          const auto [rpass, rpassp] = pass_pairs[i];
+          do_merge_tile(rr,
+                        rrpart,
+                        rpass->ibuf->float_buffer.data,
+                        rpassp->ibuf->float_buffer.data,
+                        rpass->channels);
+        }
+      });
 }
 
 /** \} */
@@ -6,10 +6,14 @@
  * \ingroup render
  */
 
+#include "BLI_array.hh"
 #include "BLI_assert.h"
+#include "BLI_math_base.h"
 #include "BLI_math_geom.h"
+#include "BLI_math_interp.hh"
 #include "BLI_math_vector.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "BKE_attribute.hh"
@@ -39,7 +43,6 @@ namespace blender::render::texturemargin {
  */
 class TextureMarginMap {
   static const int directions[8][2];
-  static const int distances[8];
 
   /** Maps UV-edges to their corresponding UV-edge. */
   Vector<int> loop_adjacency_map_;
@@ -140,161 +143,175 @@ class TextureMarginMap {
     }
   }
 
-/* The map contains 2 kinds of pixels: DijkstraPixels and face indices. The top bit determines
- * what kind it is. With the top bit set, it is a 'dijkstra' pixel. The bottom 4 bits encode the
- * direction of the shortest path and the remaining 27 bits are used to store the distance. If
- * the top bit is not set, the rest of the bits is used to store the face index.
+/* The map contains 2 kinds of pixels: margin pixels and face indices. The top bit determines
+ * what kind it is. With the top bit set, it is a margin pixel and the remaining 31 bits store the
+ * index of the closest face pixel. If the top bit is not set, the rest of the bits is used to
+ * store the face index.
  */
-#define PackDijkstraPixel(dist, dir) (0x80000000 + ((dist) << 4) + (dir))
-#define DijkstraPixelGetDistance(dp) (((dp) ^ 0x80000000) >> 4)
-#define DijkstraPixelGetDirection(dp) ((dp) & 0xF)
-#define IsDijkstraPixel(dp) ((dp) & 0x80000000)
-#define DijkstraPixelIsUnset(dp) ((dp) == 0xFFFFFFFF)
+#define PackMarginPixel(face_pixel) (0x80000000 | uint32_t(face_pixel))
+#define MarginPixelGetFacePixel(mp) ((mp) & 0x7FFFFFFF)
+#define IsMarginPixel(mp) ((mp) & 0x80000000)
+#define MarginPixelIsUnset(mp) ((mp) == 0xFFFFFFFF)
 
   /**
-   * Use dijkstra's algorithm to 'grow' a border around the polygons marked in the map.
-   * For each pixel mark which direction is the shortest way to a face.
+   * Use the jump flooding algorithm to 'grow' a border around the polygons marked in the map.
+   * For each pixel within the margin, store the closest pixel that belongs to a face.
+   *
+   * Every pass halves the step size, so the number of passes only grows with the logarithm of
+   * the margin. Within a pass all pixels are independent, which allows processing them in
+   * parallel.
    */
-  void grow_dijkstra(int margin)
+  void grow_jump_flood(int margin)
   {
-    class DijkstraActivePixel {
-     public:
-      DijkstraActivePixel(int dist, int _x, int _y) : distance(dist), x(_x), y(_y) {}
-      int distance;
-      int x, y;
-    };
-    auto cmp_dijkstrapixel_fun = [](DijkstraActivePixel const &a1, DijkstraActivePixel const &a2) {
-      return a1.distance > a2.distance;
+    const int64_t pixels_num = int64_t(w_) * h_;
+    /* The top bit is needed to tag margin pixels, and the all-ones value marks unset pixels. */
+    BLI_assert(pixels_num < 0x7FFFFFFF);
+    constexpr uint32_t no_face_pixel = 0xFFFFFFFF;
+
+    Array<uint32_t> closest(pixels_num);
+    threading::parallel_for(IndexRange(pixels_num), 4096, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        closest[i] = IsMarginPixel(pixel_data_[i]) ? no_face_pixel : uint32_t(i);
+      }
+    });
+
+    const int64_t max_dist_sq = int64_t(margin + 1) * (margin + 1);
+    auto dist_sq_to = [&](const int x, const int y, const uint32_t face_pixel) {
+      const int64_t dx = x - int64_t(face_pixel % w_);
+      const int64_t dy = y - int64_t(face_pixel / w_);
+      return dx * dx + dy * dy;
     };
 
-    Vector<DijkstraActivePixel> active_pixels;
-    for (int y = 0; y < h_; y++) {
-      for (int x = 0; x < w_; x++) {
-        if (DijkstraPixelIsUnset(get_pixel(x, y))) {
-          for (int i = 0; i < 8; i++) {
-            int xx = x - directions[i][0];
-            int yy = y - directions[i][1];
-
-            if (xx >= 0 && xx < w_ && yy >= 0 && yy < w_ && !IsDijkstraPixel(get_pixel(xx, yy))) {
-              set_pixel(x, y, PackDijkstraPixel(distances[i], i));
-              active_pixels.append(DijkstraActivePixel(distances[i], x, y));
-              break;
+    /* The final pass with a step of one fixes most of the errors the larger steps leave behind.
+     */
+    Vector<int> steps;
+    for (int step = power_of_2_max_i(margin + 1); step > 0; step /= 2) {
+      steps.append(step);
+    }
+    steps.append(1);
+
+    Array<uint32_t> closest_next(pixels_num);
+    for (const int step : steps) {
+      threading::parallel_for(IndexRange(h_), 16, [&](const IndexRange rows) {
+        for (const int y : rows) {
+          for (int x = 0; x < w_; x++) {
+            const int64_t index = int64_t(y) * w_ + x;
+            uint32_t best = closest[index];
+            int64_t best_dist_sq = best == no_face_pixel ? INT64_MAX : dist_sq_to(x, y, best);
+            for (int i = 0; i < 8; i++) {
+              const int xx = x + directions[i][0] * step;
+              const int yy = y + directions[i][1] * step;
+              if (xx < 0 || xx >= w_ || yy < 0 || yy >= h_) {
+                continue;
+              }
+              const uint32_t candidate = closest[int64_t(yy) * w_ + xx];
+              if (candidate == no_face_pixel) {
+                continue;
+              }
+              const int64_t candidate_dist_sq = dist_sq_to(x, y, candidate);
+              if (candidate_dist_sq < best_dist_sq) {
+                best = candidate;
+                best_dist_sq = candidate_dist_sq;
+              }
             }
+            closest_next[index] = best;
           }
         }
-      }
+      });
+      std::swap(closest, closest_next);
     }
 
-    /* Not strictly needed because at this point it already is a heap. */
-#if 0
-    std::make_heap(active_pixels.begin(), active_pixels.end(), cmp_dijkstrapixel_fun);
-#endif
-
-    while (active_pixels.size()) {
-      std::pop_heap(active_pixels.begin(), active_pixels.end(), cmp_dijkstrapixel_fun);
-      DijkstraActivePixel p = active_pixels.pop_last();
-
-      int dist = p.distance;
-
-      if (dist < 2 * (margin + 1)) {
-        for (int i = 0; i < 8; i++) {
-          int x = p.x + directions[i][0];
-          int y = p.y + directions[i][1];
-          if (x >= 0 && x < w_ && y >= 0 && y < h_) {
-            uint32_t dp = get_pixel(x, y);
-            if (IsDijkstraPixel(dp) && (DijkstraPixelGetDistance(dp) > dist + distances[i])) {
-              BLI_assert(DijkstraPixelGetDirection(dp) != i);
-              set_pixel(x, y, PackDijkstraPixel(dist + distances[i], i));
-              active_pixels.append(DijkstraActivePixel(dist + distances[i], x, y));
-              std::push_heap(active_pixels.begin(), active_pixels.end(), cmp_dijkstrapixel_fun);
-            }
+    threading::parallel_for(IndexRange(h_), 16, [&](const IndexRange rows) {
+      for (const int y : rows) {
+        for (int x = 0; x < w_; x++) {
+          const int64_t index = int64_t(y) * w_ + x;
+          const uint32_t face_pixel = closest[index];
+          if (!IsMarginPixel(pixel_data_[index]) || face_pixel == no_face_pixel) {
+            continue;
+          }
+          if (dist_sq_to(x, y, face_pixel) <= max_dist_sq) {
+            pixel_data_[index] = PackMarginPixel(face_pixel);
           }
         }
       }
-    }
+    });
   }
 
   /**
-   * Walk over the map and for margin pixels follow the direction stored in the bottom 3
-   * bits back to the face.
+   * Walk over the map and for margin pixels look up the face of the closest face pixel.
    * Then look up the pixel from the next face.
    */
-  void lookup_pixels(ImBuf *ibuf, char *mask, int maxPolygonSteps)
+  void lookup_pixels(ImBuf *ibuf, char *mask, int maxPolygonSteps) const
   {
     float4 *ibuf_ptr_fl = reinterpret_cast<float4 *>(ibuf->float_buffer.data);
     uchar4 *ibuf_ptr_ch = reinterpret_cast<uchar4 *>(ibuf->byte_buffer.data);
-    size_t pixel_index = 0;
-    for (int y = 0; y < h_; y++) {
-      for (int x = 0; x < w_; x++) {
-        uint32_t dp = pixel_data_[pixel_index];
-        if (IsDijkstraPixel(dp) && !DijkstraPixelIsUnset(dp)) {
-          int dist = DijkstraPixelGetDistance(dp);
-          int direction = DijkstraPixelGetDirection(dp);
-
-          int xx = x;
-          int yy = y;
-
-          /* Follow the dijkstra directions to find the face this margin pixels belongs to. */
-          while (dist > 0) {
-            xx -= directions[direction][0];
-            yy -= directions[direction][1];
-            dp = get_pixel(xx, yy);
-            dist -= distances[direction];
-            BLI_assert(!dist || (dist == DijkstraPixelGetDistance(dp)));
-            direction = DijkstraPixelGetDirection(dp);
-          }
-
-          uint32_t face = get_pixel(xx, yy);
-
-          BLI_assert(!IsDijkstraPixel(face));
-
-          float destX, destY;
-
-          int other_poly;
-          bool found_pixel_in_polygon = false;
-          if (lookup_pixel_polygon_neighborhood(x, y, &face, &destX, &destY, &other_poly)) {
-
-            for (int i = 0; i < maxPolygonSteps; i++) {
-              /* Force to pixel grid. */
-              int nx = int(round(destX));
-              int ny = int(round(destY));
-              uint32_t polygon_from_map = get_pixel(nx, ny);
-              if (other_poly == polygon_from_map) {
-                found_pixel_in_polygon = true;
-                break;
-              }
 
-              float dist_to_edge;
-              /* Look up again, but starting from the face we were expected to land in. */
-              if (!lookup_pixel(nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge)) {
-                found_pixel_in_polygon = false;
-                break;
+    /* Sample from a copy of the image, so that margin pixels written by other threads don't
+     * affect the result. */
+    const int64_t pixels_num = int64_t(w_) * h_;
+    const Array<float4> src_fl = ibuf_ptr_fl ? Array<float4>(Span(ibuf_ptr_fl, pixels_num)) :
+                                               Array<float4>();
+    const Array<uchar4> src_ch = ibuf_ptr_ch ? Array<uchar4>(Span(ibuf_ptr_ch, pixels_num)) :
+                                               Array<uchar4>();
+
+    threading::parallel_for(IndexRange(h_), 16, [&](const IndexRange rows) {
+      for (const int y : rows) {
+        for (int x = 0; x < w_; x++) {
+          const int64_t pixel_index = int64_t(y) * w_ + x;
+          const uint32_t mp = pixel_data_[pixel_index];
+          if (IsMarginPixel(mp) && !MarginPixelIsUnset(mp)) {
+            uint32_t face = pixel_data_[MarginPixelGetFacePixel(mp)];
+
+            BLI_assert(!IsMarginPixel(face));
+
+            float destX, destY;
+
+            int other_poly;
+            bool found_pixel_in_polygon = false;
+            if (lookup_pixel_polygon_neighborhood(x, y, &face, &destX, &destY, &other_poly)) {
+
+              for (int i = 0; i < maxPolygonSteps; i++) {
+                /* Force to pixel grid. */
+                int nx = int(round(destX));
+                int ny = int(round(destY));
+                uint32_t polygon_from_map = get_pixel(nx, ny);
+                if (other_poly == polygon_from_map) {
+                  found_pixel_in_polygon = true;
+                  break;
+                }
+
+                float dist_to_edge;
+                /* Look up again, but starting from the face we were expected to land in. */
+                if (!lookup_pixel(nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge))
+                {
+                  found_pixel_in_polygon = false;
+                  break;
+                }
               }
-            }
 
-            if (found_pixel_in_polygon) {
-              if (ibuf_ptr_fl) {
-                ibuf_ptr_fl[pixel_index] = imbuf::interpolate_bilinear_border_fl(
-                    ibuf, destX, destY);
-              }
-              if (ibuf_ptr_ch) {
-                ibuf_ptr_ch[pixel_index] = imbuf::interpolate_bilinear_border_byte(
-                    ibuf, destX, destY);
+              if (found_pixel_in_polygon) {
+                if (ibuf_ptr_fl) {
+                  ibuf_ptr_fl[pixel_index] = math::interpolate_bilinear_border_fl(
+                      reinterpret_cast<const float *>(src_fl.data()), w_, h_, destX, destY);
+                }
+                if (ibuf_ptr_ch) {
+                  ibuf_ptr_ch[pixel_index] = math::interpolate_bilinear_border_byte(
+                      reinterpret_cast<const uchar *>(src_ch.data()), w_, h_, destX, destY);
+                }
+                /* Add our new pixels to the assigned pixel map. */
+                mask[pixel_index] = 1;
               }
-              /* Add our new pixels to the assigned pixel map. */
-              mask[pixel_index] = 1;
             }
           }
+          else if (MarginPixelIsUnset(mp) || !IsMarginPixel(mp)) {
+            /* These are not margin pixels, make sure the extend filter which is run after this
+             * step leaves them alone.
+             */
+            mask[pixel_index] = 1;
+          }
         }
-        else if (DijkstraPixelIsUnset(dp) || !IsDijkstraPixel(dp)) {
-          /* These are not margin pixels, make sure the extend filter which is run after this step
-           * leaves them alone.
-           */
-          mask[pixel_index] = 1;
-        }
-        pixel_index++;
       }
-    }
+    });
   }
 
  private:
@@ -331,12 +348,16 @@ class TextureMarginMap {
 
   /**
    * Call lookup_pixel for the start_poly. If that fails, try the adjacent polygons as well.
-   * Because the Dijkstra is not very exact in determining which face is the closest, the
-   * face we need can be the one next to the one the Dijkstra map provides. To prevent missing
+   * Because the closest face pixel is not necessarily on the face with the closest edge, the
+   * face we need can be the one next to the one the margin map provides. To prevent missing
    * pixels also check the neighboring polygons.
    */
-  bool lookup_pixel_polygon_neighborhood(
-      float x, float y, uint32_t *r_start_poly, float *r_destx, float *r_desty, int *r_other_poly)
+  bool lookup_pixel_polygon_neighborhood(float x,
+                                         float y,
+                                         uint32_t *r_start_poly,
+                                         float *r_destx,
+                                         float *r_desty,
+                                         int *r_other_poly) const
   {
     float found_dist;
     if (lookup_pixel(x, y, *r_start_poly, r_destx, r_desty, r_other_poly, &found_dist)) {
@@ -389,7 +410,7 @@ class TextureMarginMap {
                     float *r_destx,
                     float *r_desty,
                     int *r_other_poly,
-                    float *r_dist_to_edge)
+                    float *r_dist_to_edge) const
   {
     float2 point(x, y);
 
@@ -493,7 +514,6 @@ class TextureMarginMap {
 
 const int TextureMarginMap::directions[8][2] = {
     {-1, 0}, {-1, -1}, {0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}};
-const int TextureMarginMap::distances[8] = {2, 3, 2, 3, 2, 3, 2, 3};
 
 static void generate_margin(ImBuf *ibuf,
                             char *mask,
@@ -515,8 +535,8 @@ static void generate_margin(ImBuf *ibuf,
   TextureMarginMap map(ibuf->x, ibuf->y, uv_offset, edges_num, faces, corner_edges, mloopuv);
 
   bool draw_new_mask = false;
-  /* Now the map contains 3 sorts of values: 0xFFFFFFFF for empty pixels, `0x80000000 + polyindex`
-   * for margin pixels, just `polyindex` for face pixels. */
+  /* Once grown, the map contains 3 sorts of values: 0xFFFFFFFF for empty pixels,
+   * `0x80000000 + face pixel index` for margin pixels, just `polyindex` for face pixels. */
   if (mask) {
     mask = (char *)MEM_dupallocN(mask);
   }
@@ -540,7 +560,7 @@ static void generate_margin(ImBuf *ibuf,
       vec[a][1] = (uv[1] - uv_offset[1]) * float(ibuf->y) - (0.5f + 0.002f);
     }
 
-    /* NOTE: we need the top bit for the dijkstra distance map. */
+    /* NOTE: we need the top bit to tag margin pixels. */
     BLI_assert(tri_faces[i] < 0x80000000);
 
     map.rasterize_tri(vec[0], vec[1], vec[2], tri_faces[i], mask, draw_new_mask);
@@ -552,7 +572,7 @@ static void generate_margin(ImBuf *ibuf,
   IMB_filter_extend(ibuf, tmpmask, 2);
   MEM_freeN(tmpmask);
 
-  map.grow_dijkstra(margin);
+  map.grow_jump_flood(margin);
 
   /* Looking further than 3 polygons away leads to so much cumulative rounding
    * that it isn't worth it. So hard-code it to 3. */
@@ -10,18 +10,23 @@
 #include <ctime>
 #include <memory.h>
 
+#include <zstd.h>
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
 #include "DNA_space_types.h" /* for FILE_MAX. */
 
+#include "IMB_colormanagement.hh"
 #include "IMB_imbuf.hh"
 #include "IMB_imbuf_types.hh"
 
 #include "BLI_fileops_types.h"
 #include "BLI_ghash.h"
+#include "BLI_listbase.h"
 #include "BLI_mempool.h"
+#include "BLI_string.h"
 #include "BLI_threads.h"
 
 #include "BKE_main.hh"
@@ -59,9 +64,18 @@
  * entries one by one in reverse order to their creation.
  *
  * User can exclude caching of some images. Such entries will have is_temp_cache set.
+ *
+ * Compressed tier:
+ * When a final frame is recycled, its pixels are compressed and kept in memory, so that it can
+ * be restored much faster than rendering it again or reading it from the disk cache. This tier
+ * is limited to a fraction of the memory cache limit. The compressed data is allocated with
+ * guarded-alloc, so it counts towards the memory in use which is checked by #seq_cache_is_full
+ * and the uncompressed tier shrinks accordingly. Oldest compressed frames are freed first.
  */
 
 #define THUMB_CACHE_LIMIT 5000
+/** Fast compression level, the frames are compressed while the cache is locked. */
+#define COMPRESSED_CACHE_LEVEL 1
 
 struct SeqCache {
   Main *bmain;
@@ -72,6 +86,11 @@ struct SeqCache {
   SeqCacheKey *last_key;
   SeqDiskCache *disk_cache;
   int thumbnail_count;
+  /** Key is #SeqCacheCompressedItem.key, value is #SeqCacheCompressedItem. */
+  GHash *compressed_hash;
+  /** #SeqCacheCompressedItem ordered from oldest to newest. */
+  ListBase compressed_items;
+  size_t compressed_memory;
 };
 
 struct SeqCacheItem {
@@ -79,6 +98,17 @@ struct SeqCacheItem {
   ImBuf *ibuf;
 };
 
+struct SeqCacheCompressedItem {
+  SeqCacheCompressedItem *next, *prev;
+  /** Copy of the key of the recycled item, it is not linked to other keys. */
+  SeqCacheKey key;
+  void *data;
+  size_t size_compressed;
+  int x, y;
+  bool is_float;
+  char colorspace_name[IM_MAX_SPACE];
+};
+
 static ThreadMutex cache_create_lock = BLI_MUTEX_INITIALIZER;
 
 static bool seq_cmp_render_data(const SeqRenderData *a, const SeqRenderData *b)
@@ -178,6 +208,11 @@ static size_t seq_cache_get_mem_total()
   return size_t(U.memcachelimit) * 1024 * 1024;
 }
 
+static size_t seq_cache_get_compressed_mem_total()
+{
+  return seq_cache_get_mem_total() / 4;
+}
+
 static void seq_cache_keyfree(void *val)
 {
   SeqCacheKey *key = static_cast<SeqCacheKey *>(val);
@@ -195,6 +230,122 @@ static void seq_cache_valfree(void *val)
   BLI_mempool_free(item->cache_owner->items_pool, item);
 }
 
+static void seq_cache_compressed_item_free(SeqCache *cache, SeqCacheCompressedItem *item)
+{
+  BLI_ghash_remove(cache->compressed_hash, &item->key, nullptr, nullptr);
+  BLI_remlink(&cache->compressed_items, item);
+  cache->compressed_memory -= item->size_compressed;
+  MEM_freeN(item->data);
+  MEM_freeN(item);
+}
+
+static void seq_cache_compressed_free_all(SeqCache *cache)
+{
+  while (SeqCacheCompressedItem *item = static_cast<SeqCacheCompressedItem *>(
+             cache->compressed_items.first))
+  {
+    seq_cache_compressed_item_free(cache, item);
+  }
+}
+
+static size_t seq_cache_compressed_raw_size(const int x, const int y, const bool is_float)
+{
+  return size_t(x) * size_t(y) * 4 * (is_float ? sizeof(float) : sizeof(uchar));
+}
+
+/** Keep a compressed copy of the image of a final frame that is about to be recycled. */
+static void seq_cache_compress_item(SeqCache *cache, const SeqCacheKey *key)
+{
+  if (key->type != SEQ_CACHE_STORE_FINAL_OUT || BLI_ghash_haskey(cache->compressed_hash, key)) {
+    return;
+  }
+  const SeqCacheItem *item = static_cast<const SeqCacheItem *>(
+      BLI_ghash_lookup(cache->hash, key));
+  if (item == nullptr || item->ibuf == nullptr || item->ibuf->channels != 4) {
+    return;
+  }
+  ImBuf *ibuf = item->ibuf;
+  /* Same as the disk cache, only one of the buffers is stored. */
+  const bool is_float = ibuf->byte_buffer.data == nullptr;
+  const void *pixels = is_float ? (const void *)ibuf->float_buffer.data :
+                                  (const void *)ibuf->byte_buffer.data;
+  if (pixels == nullptr) {
+    return;
+  }
+
+  const size_t size_raw = seq_cache_compressed_raw_size(ibuf->x, ibuf->y, is_float);
+  const size_t size_bound = ZSTD_compressBound(size_raw);
+  void *data = MEM_mallocN(size_bound, __func__);
+  const size_t size_compressed = ZSTD_compress(
+      data, size_bound, pixels, size_raw, COMPRESSED_CACHE_LEVEL);
+
+  /* Not worth keeping when the image barely compresses. */
+  const size_t mem_total = seq_cache_get_compressed_mem_total();
+  if (ZSTD_isError(size_compressed) || size_compressed > size_raw / 10 * 9 ||
+      size_compressed > mem_total)
+  {
+    MEM_freeN(data);
+    return;
+  }
+
+  while (cache->compressed_memory + size_compressed > mem_total) {
+    seq_cache_compressed_item_free(
+        cache, static_cast<SeqCacheCompressedItem *>(cache->compressed_items.first));
+  }
+
+  SeqCacheCompressedItem *compressed_item = MEM_cnew<SeqCacheCompressedItem>(__func__);
+  compressed_item->key = *key;
+  compressed_item->key.link_prev = nullptr;
+  compressed_item->key.link_next = nullptr;
+  /* Shrink the allocation, so that memory usage matches the compressed size. */
+  compressed_item->data = MEM_reallocN(data, size_compressed);
+  compressed_item->size_compressed = size_compressed;
+  compressed_item->x = ibuf->x;
+  compressed_item->y = ibuf->y;
+  compressed_item->is_float = is_float;
+  STRNCPY(compressed_item->colorspace_name,
+          is_float ? IMB_colormanagement_get_float_colorspace(ibuf) :
+                     IMB_colormanagement_get_rect_colorspace(ibuf));
+
+  BLI_addtail(&cache->compressed_items, compressed_item);
+  BLI_ghash_insert(cache->compressed_hash, &compressed_item->key, compressed_item);
+  cache->compressed_memory += size_compressed;
+}
+
+/**
+ * Restore the image of a compressed final frame. The compressed item is freed, because the image
+ * is going to be stored in the uncompressed tier again.
+ */
+static ImBuf *seq_cache_decompress_item(SeqCache *cache, SeqCacheKey *key)
+{
+  SeqCacheCompressedItem *item = static_cast<SeqCacheCompressedItem *>(
+      BLI_ghash_lookup(cache->compressed_hash, key));
+  if (item == nullptr) {
+    return nullptr;
+  }
+
+  const int flags = (item->is_float ? IB_rectfloat : IB_rect) | IB_uninitialized_pixels;
+  ImBuf *ibuf = IMB_allocImBuf(item->x, item->y, 32, flags);
+  void *pixels = item->is_float ? (void *)ibuf->float_buffer.data :
+                                  (void *)ibuf->byte_buffer.data;
+  const size_t size_raw = seq_cache_compressed_raw_size(item->x, item->y, item->is_float);
+  const size_t size = ZSTD_decompress(pixels, size_raw, item->data, item->size_compressed);
+
+  if (item->is_float) {
+    IMB_colormanagement_assign_float_colorspace(ibuf, item->colorspace_name);
+  }
+  else {
+    IMB_colormanagement_assign_byte_colorspace(ibuf, item->colorspace_name);
+  }
+  seq_cache_compressed_item_free(cache, item);
+
+  if (ZSTD_isError(size) || size != size_raw) {
+    IMB_freeImBuf(ibuf);
+    return nullptr;
+  }
+  return ibuf;
+}
+
 static int get_stored_types_flag(Scene *scene, SeqCacheKey *key)
 {
   int flag;
@@ -457,8 +608,13 @@ bool seq_cache_recycle_item(Scene *scene)
     SeqCacheKey *finalkey = seq_cache_get_item_for_removal(scene);
 
     if (finalkey) {
+      seq_cache_compress_item(cache, finalkey);
       seq_cache_recycle_linked(scene, finalkey);
     }
+    else if (cache->compressed_items.first) {
+      seq_cache_compressed_item_free(
+          cache, static_cast<SeqCacheCompressedItem *>(cache->compressed_items.first));
+    }
     else {
       seq_cache_unlock(scene);
       return false;
@@ -500,6 +656,8 @@ static void seq_cache_create(Main *bmain, Scene *scene)
     cache->keys_pool = BLI_mempool_create(sizeof(SeqCacheKey), 0, 64, BLI_MEMPOOL_NOP);
     cache->items_pool = BLI_mempool_create(sizeof(SeqCacheItem), 0, 64, BLI_MEMPOOL_NOP);
     cache->hash = BLI_ghash_new(seq_cache_hashhash, seq_cache_hashcmp, "SeqCache hash");
+    cache->compressed_hash = BLI_ghash_new(
+        seq_cache_hashhash, seq_cache_hashcmp, "SeqCache compressed hash");
     cache->last_key = nullptr;
     cache->bmain = bmain;
     cache->thumbnail_count = 0;
@@ -588,6 +746,8 @@ void seq_cache_destruct(Scene *scene)
   }
 
   BLI_ghash_free(cache->hash, seq_cache_keyfree, seq_cache_valfree);
+  seq_cache_compressed_free_all(cache);
+  BLI_ghash_free(cache->compressed_hash, nullptr, nullptr);
   BLI_mempool_destroy(cache->keys_pool);
   BLI_mempool_destroy(cache->items_pool);
   BLI_mutex_end(&cache->iterator_mutex);
@@ -630,6 +790,7 @@ void SEQ_cache_cleanup(Scene *scene)
     /* NOTE: no need to call #seq_cache_key_unlink as all keys are removed. */
     BLI_ghash_remove(cache->hash, key, seq_cache_keyfree, seq_cache_valfree);
   }
+  seq_cache_compressed_free_all(cache);
   cache->last_key = nullptr;
   cache->thumbnail_count = 0;
   seq_cache_unlock(scene);
@@ -696,6 +857,15 @@ void seq_cache_cleanup_sequence(Scene *scene,
       BLI_ghash_remove(cache->hash, key, seq_cache_keyfree, seq_cache_valfree);
     }
   }
+
+  /* The compressed tier only contains final frames. */
+  if (invalidate_composite) {
+    LISTBASE_FOREACH_MUTABLE (SeqCacheCompressedItem *, item, &cache->compressed_items) {
+      if (item->key.frame_index >= range_start && item->key.frame_index <= range_end) {
+        seq_cache_compressed_item_free(cache, item);
+      }
+    }
+  }
   cache->last_key = nullptr;
   seq_cache_unlock(scene);
 }
@@ -782,23 +952,30 @@ ImBuf *seq_cache_get(const SeqRenderData *context, Sequence *seq, float timeline
     return ibuf;
   }
 
+  /* Try compressed RAM cache: */
+  if (type == SEQ_CACHE_STORE_FINAL_OUT) {
+    seq_cache_lock(scene);
+    ibuf = seq_cache_decompress_item(cache, &key);
+    seq_cache_unlock(scene);
+  }
+
   /* Try disk cache: */
-  if (seq_disk_cache_is_enabled(context->bmain)) {
+  if (ibuf == nullptr && seq_disk_cache_is_enabled(context->bmain)) {
     if (cache->disk_cache == nullptr) {
       cache->disk_cache = seq_disk_cache_create(context->bmain, context->scene);
     }
 
     ibuf = seq_disk_cache_read_file(cache->disk_cache, &key);
+  }
 
-    if (ibuf == nullptr) {
-      return nullptr;
-    }
+  if (ibuf == nullptr) {
+    return nullptr;
+  }
 
-    /* Store read image in RAM. Only recycle item for final type. */
-    if (key.type != SEQ_CACHE_STORE_FINAL_OUT || seq_cache_recycle_item(scene)) {
-      SeqCacheKey *new_key = seq_cache_allocate_key(cache, context, seq, timeline_frame, type);
-      seq_cache_put_ex(scene, new_key, ibuf);
-    }
+  /* Store read image in RAM. Only recycle item for final type. */
+  if (key.type != SEQ_CACHE_STORE_FINAL_OUT || seq_cache_recycle_item(scene)) {
+    SeqCacheKey *new_key = seq_cache_allocate_key(cache, context, seq, timeline_frame, type);
+    seq_cache_put_ex(scene, new_key, ibuf);
   }
 
   return ibuf;
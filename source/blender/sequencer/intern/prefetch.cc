@@ -19,6 +19,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_threads.h"
+#include "BLI_time.h"
 
 #include "IMB_imbuf.hh"
 #include "IMB_imbuf_types.hh"
@@ -255,8 +256,11 @@ void SEQ_prefetch_stop(Scene *scene)
 
   pfjob->stop = true;
 
+  /* Wake up a suspended job until it notices it should stop. Sleep in between, so this thread
+   * doesn't compete for CPU time with the job that finishes rendering its current frame. */
   while (pfjob->running) {
     BLI_condition_notify_one(&pfjob->prefetch_suspend_cond);
+    BLI_time_sleep_ms(1);
   }
 }
 
@@ -520,6 +524,7 @@ static void *seq_prefetch_frames(void *job)
 static PrefetchJob *seq_prefetch_start_ex(const SeqRenderData *context, float cfra)
 {
   PrefetchJob *pfjob = seq_prefetch_job_get(context->scene);
+  const bool is_new_job = pfjob == nullptr;
 
   if (!pfjob) {
     if (context->scene->ed) {
@@ -544,7 +549,11 @@ static PrefetchJob *seq_prefetch_start_ex(const SeqRenderData *context, float cf
   pfjob->stop = false;
   pfjob->running = true;
 
-  seq_prefetch_update_scene(context->scene);
+  /* A new job has just built its depsgraph. An existing one has to rebuild it, because the scene
+   * may have been edited since the job last ran. */
+  if (!is_new_job) {
+    seq_prefetch_update_scene(context->scene);
+  }
   seq_prefetch_update_context(context);
   seq_prefetch_update_active_seqbase(pfjob);
 
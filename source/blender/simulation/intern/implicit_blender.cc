@@ -17,9 +17,12 @@
 #  include "DNA_scene_types.h"
 #  include "DNA_texture_types.h"
 
+#  include "BLI_array.hh"
 #  include "BLI_math_geom.h"
 #  include "BLI_math_matrix.h"
 #  include "BLI_math_vector.h"
+#  include "BLI_offset_indices.hh"
+#  include "BLI_task.hh"
 #  include "BLI_utildefines.h"
 
 #  include "BKE_cloth.hh"
@@ -42,6 +45,8 @@
 #    include "BLI_time.h"
 #  endif
 
+using namespace blender;
+
 static float I[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
 static float ZERO[3][3] = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}};
 
@@ -173,15 +178,25 @@ DO_INLINE void submul_lfvectorS(float (*to)[3], float (*fLongVector)[3], float s
 /* dot product for big vector */
 DO_INLINE float dot_lfvector(float (*fLongVectorA)[3], float (*fLongVectorB)[3], uint verts)
 {
-  long i = 0;
-  float temp = 0.0;
-  /* XXX brecht, disabled this for now (first schedule line was already disabled),
-   * due to non-commutative nature of floating point ops this makes the sim give
-   * different results each time you run it!
-   * schedule(guided, 2) */
-  // #pragma omp parallel for reduction(+: temp) if (verts > CLOTH_OPENMP_LIMIT)
-  for (i = 0; i < long(verts); i++) {
-    temp += dot_v3v3(fLongVectorA[i], fLongVectorB[i]);
+  /* Due to the non-commutative nature of floating point operations, the sum of every chunk is
+   * computed separately and in a fixed order. Otherwise the simulation would give different
+   * results every time it runs, depending on how the work is distributed between threads. */
+  const int64_t chunk_size = 4096;
+  const IndexRange chunks(divide_ceil_ul(verts, chunk_size));
+  Array<float, 64> chunk_sums(chunks.size());
+  threading::parallel_for(chunks, 4, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      const IndexRange chunk_range = IndexRange(chunk * chunk_size, chunk_size);
+      float temp = 0.0f;
+      for (const int64_t i : chunk_range.intersect(IndexRange(verts))) {
+        temp += dot_v3v3(fLongVectorA[i], fLongVectorB[i]);
+      }
+      chunk_sums[chunk] = temp;
+    }
+  });
+  float temp = 0.0f;
+  for (const float chunk_sum : chunk_sums) {
+    temp += chunk_sum;
   }
   return temp;
 }
@@ -191,21 +206,21 @@ DO_INLINE void add_lfvector_lfvector(float (*to)[3],
                                      float (*fLongVectorB)[3],
                                      uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    add_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
-  }
+  threading::parallel_for(IndexRange(verts), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      add_v3_v3v3(to[i], fLongVectorA[i], fLongVectorB[i]);
+    }
+  });
 }
 /* `A = B + C * float` -> for big vector. */
 DO_INLINE void add_lfvector_lfvectorS(
     float (*to)[3], float (*fLongVectorA)[3], float (*fLongVectorB)[3], float bS, uint verts)
 {
-  uint i = 0;
-
-  for (i = 0; i < verts; i++) {
-    VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
-  }
+  threading::parallel_for(IndexRange(verts), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      VECADDS(to[i], fLongVectorA[i], fLongVectorB[i], bS);
+    }
+  });
 }
 /* `A = B * float + C * float` -> for big vector */
 DO_INLINE void add_lfvectorS_lfvectorS(float (*to)[3],
@@ -582,35 +597,68 @@ DO_INLINE void initdiag_bfmatrix(fmatrix3x3 *matrix, float m3[3][3])
   }
 }
 
-/* SPARSE SYMMETRIC multiply big matrix with long vector. */
-/* STATUS: verified */
-DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector *fLongVector)
+/**
+ * The off-diagonal blocks of a sparse symmetric big matrix that contribute to every block row.
+ * This allows computing the rows of a matrix vector product independently, and therefore in
+ * parallel. All big matrices of the solver share the same block layout.
+ */
+struct BlockRows {
+  Array<int> offsets;
+  /**
+   * Block index times two. One is added for blocks stored in the other triangle of the matrix,
+   * which have to be transposed.
+   */
+  Array<int> blocks;
+};
+
+/* Only the first `blocks_num` off-diagonal blocks are used, the remaining ones are zero. */
+static void build_block_rows(const fmatrix3x3 *matrix, const int blocks_num, BlockRows &rows)
 {
-  uint vcount = from[0].vcount;
-  lfVector *temp = create_lfvector(vcount);
+  const int verts_num = matrix[0].vcount;
+  const IndexRange blocks(verts_num, blocks_num);
+  rows.offsets.reinitialize(verts_num + 1);
+  rows.offsets.fill(0);
+  for (const int i : blocks) {
+    rows.offsets[matrix[i].r]++;
+    rows.offsets[matrix[i].c]++;
+  }
+  const OffsetIndices<int> offsets = offset_indices::accumulate_counts_to_offsets(rows.offsets);
 
-  zero_lfvector(to, vcount);
+  rows.blocks.reinitialize(offsets.total_size());
+  Array<int> counts(verts_num, 0);
+  for (const int i : blocks) {
+    const int r = matrix[i].r;
+    const int c = matrix[i].c;
+    rows.blocks[offsets[r][counts[r]++]] = i * 2;
+    rows.blocks[offsets[c][counts[c]++]] = i * 2 + 1;
+  }
+}
 
-#  pragma omp parallel sections if (vcount > CLOTH_OPENMP_LIMIT)
-  {
-#  pragma omp section
-    {
-      for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
-        /* This is the lower triangle of the sparse matrix,
-         * therefore multiplication occurs with transposed sub-matrices. */
-        muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
-      }
-    }
-#  pragma omp section
-    {
-      for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
-        muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
+/* SPARSE SYMMETRIC multiply big matrix with long vector. */
+/* STATUS: verified */
+DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3],
+                                     const fmatrix3x3 *from,
+                                     const BlockRows &rows,
+                                     const lfVector *fLongVector)
+{
+  const OffsetIndices<int> offsets(rows.offsets);
+  threading::parallel_for(IndexRange(from[0].vcount), 1024, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      zero_v3(to[i]);
+      muladd_fmatrix_fvector(to[i], from[i].m, fLongVector[i]);
+      for (const int entry : rows.blocks.as_span().slice(offsets[i])) {
+        const fmatrix3x3 &block = from[entry >> 1];
+        if (entry & 1) {
+          /* This is the lower triangle of the sparse matrix,
+           * therefore multiplication occurs with transposed sub-matrices. */
+          muladd_fmatrixT_fvector(to[i], block.m, fLongVector[block.r]);
+        }
+        else {
+          muladd_fmatrix_fvector(to[i], block.m, fLongVector[block.c]);
+        }
       }
     }
-  }
-  add_lfvector_lfvector(to, to, temp, from[0].vcount);
-
-  del_lfvector(temp);
+  });
 }
 
 /* SPARSE SYMMETRIC sub big matrix with big matrix. */
@@ -619,12 +667,12 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
 DO_INLINE void subadd_bfmatrixS_bfmatrixS(
     fmatrix3x3 *to, fmatrix3x3 *from, float aS, fmatrix3x3 *matrix, float bS)
 {
-  uint i = 0;
-
-  /* process diagonal elements */
-  for (i = 0; i < matrix[0].vcount + matrix[0].scount; i++) {
-    subadd_fmatrixS_fmatrixS(to[i].m, from[i].m, aS, matrix[i].m, bS);
-  }
+  const IndexRange blocks(matrix[0].vcount + matrix[0].scount);
+  threading::parallel_for(blocks, 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      subadd_fmatrixS_fmatrixS(to[i].m, from[i].m, aS, matrix[i].m, bS);
+    }
+  });
 }
 
 ///////////////////////////////////////////////////////////////////
@@ -652,6 +700,8 @@ struct Implicit_Data {
   lfVector *z;          /* target velocity in constrained directions */
   fmatrix3x3 *S;        /* filtering matrix for constraints */
   fmatrix3x3 *P, *Pinv; /* pre-conditioning matrix */
+
+  BlockRows *block_rows; /* layout of the off-diagonal blocks, for matrix vector products */
 };
 
 Implicit_Data *SIM_mass_spring_solver_create(int numverts, int numsprings)
@@ -677,6 +727,8 @@ Implicit_Data *SIM_mass_spring_solver_create(int numverts, int numsprings)
   id->dV = create_lfvector(numverts);
   id->z = create_lfvector(numverts);
 
+  id->block_rows = MEM_new<BlockRows>(__func__);
+
   initdiag_bfmatrix(id->bigI, I);
 
   return id;
@@ -703,6 +755,8 @@ void SIM_mass_spring_solver_free(Implicit_Data *id)
   del_lfvector(id->dV);
   del_lfvector(id->z);
 
+  MEM_delete(id->block_rows);
+
   MEM_freeN(id);
 }
 
@@ -742,11 +796,11 @@ BLI_INLINE void root_to_world_m3(Implicit_Data *data,
 
 DO_INLINE void filter(lfVector *V, fmatrix3x3 *S)
 {
-  uint i = 0;
-
-  for (i = 0; i < S[0].vcount; i++) {
-    mul_m3_v3(S[i].m, V[S[i].r]);
-  }
+  threading::parallel_for(IndexRange(S[0].vcount), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      mul_m3_v3(S[i].m, V[S[i].r]);
+    }
+  });
 }
 
 /* this version of the CG algorithm does not work very well with partial constraints
@@ -821,6 +875,7 @@ static int cg_filtered(lfVector *ldV, fmatrix3x3 *lA, lfVector *lB, lfVector *z,
 
 static int cg_filtered(lfVector *ldV,
                        fmatrix3x3 *lA,
+                       const BlockRows &rows,
                        lfVector *lB,
                        lfVector *z,
                        fmatrix3x3 *S,
@@ -848,7 +903,7 @@ static int cg_filtered(lfVector *ldV,
   delta_target = conjgrad_epsilon * conjgrad_epsilon * bnorm2;
 
   /* r = filter(B - A * dV) */
-  mul_bfmatrix_lfvector(AdV, lA, ldV);
+  mul_bfmatrix_lfvector(AdV, lA, rows, ldV);
   sub_lfvector_lfvector(r, lB, AdV, numverts);
   filter(r, S);
 
@@ -871,7 +926,7 @@ static int cg_filtered(lfVector *ldV,
 #  endif
 
   while (delta_new > delta_target && conjgrad_loopcount < conjgrad_looplimit) {
-    mul_bfmatrix_lfvector(q, lA, c);
+    mul_bfmatrix_lfvector(q, lA, rows, c);
     filter(q, S);
 
     alpha = delta_new / dot_lfvector(c, q, numverts);
@@ -1131,7 +1186,10 @@ bool SIM_mass_spring_solve_velocities(Implicit_Data *data, float dt, ImplicitSol
 
   subadd_bfmatrixS_bfmatrixS(data->A, data->dFdV, dt, data->dFdX, (dt * dt));
 
-  mul_bfmatrix_lfvector(dFdXmV, data->dFdX, data->V);
+  /* All big matrices have the same layout of off-diagonal blocks. */
+  build_block_rows(data->A, data->num_blocks, *data->block_rows);
+
+  mul_bfmatrix_lfvector(dFdXmV, data->dFdX, *data->block_rows, data->V);
 
   add_lfvectorS_lfvectorS(data->B, data->F, dt, dFdXmV, (dt * dt), numverts);
 
@@ -1140,7 +1198,7 @@ bool SIM_mass_spring_solve_velocities(Implicit_Data *data, float dt, ImplicitSol
 #  endif
 
   /* Conjugate gradient algorithm to solve Ax=b. */
-  cg_filtered(data->dV, data->A, data->B, data->z, data->S, result);
+  cg_filtered(data->dV, data->A, *data->block_rows, data->B, data->z, data->S, result);
 
   // cg_filtered_pre(id->dV, id->A, id->B, id->z, id->S, id->P, id->Pinv, id->bigI);
 
@@ -3802,6 +3802,23 @@ static eHandlerActionFlag wm_event_drag_and_drop_test(wmWindowManager *wm,
   return WM_HANDLER_CONTINUE;
 }
 
+/**
+ * In-between mouse moves are only of use to modal handlers that want every sample (painting,
+ * gestures). When no modal handler runs and another motion event follows, skip the event so a
+ * backlog of mouse moves under heavy load doesn't go through all area and region handlers.
+ */
+static bool wm_event_inbetween_mousemove_skip(const wmWindow *win, const wmEvent *event)
+{
+  if (event->type != INBETWEEN_MOUSEMOVE) {
+    return false;
+  }
+  if (!BLI_listbase_is_empty(&win->modalhandlers)) {
+    return false;
+  }
+  const wmEvent *event_next = event->next;
+  return event_next && ISMOUSE_MOTION(event_next->type);
+}
+
 /**
  * Filter out all events of the pie that spawned the last pie unless it's a release event.
  */
@@ -4054,6 +4071,12 @@ void wm_event_do_handlers(bContext *C)
       }
       const bool event_queue_check_drag_prev = win->event_queue_check_drag;
 
+      if (wm_event_inbetween_mousemove_skip(win, event)) {
+        BLI_remlink(&win->event_queue, event);
+        wm_event_free_last_handled(win, event);
+        continue;
+      }
+
       {
         const bool is_consecutive = WM_event_consecutive_gesture_test(event);
         if (win->event_queue_consecutive_gesture_type != 0) {
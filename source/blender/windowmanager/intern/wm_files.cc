@@ -1978,6 +1978,7 @@ static bool wm_file_write(bContext *C,
                           const char *filepath,
                           int fileflags,
                           eBLO_WritePathRemap remap_mode,
+                          eBLO_WriteCompressionMode compression_mode,
                           bool use_save_as_copy,
                           ReportList *reports)
 {
@@ -2076,6 +2077,7 @@ static bool wm_file_write(bContext *C,
 
   BlendFileWriteParams blend_write_params{};
   blend_write_params.remap_mode = remap_mode;
+  blend_write_params.compression_mode = compression_mode;
   blend_write_params.use_save_versions = true;
   blend_write_params.use_save_as_copy = use_save_as_copy;
   blend_write_params.thumb = thumb;
@@ -2189,6 +2191,13 @@ void WM_autosave_write(wmWindowManager *wm, Main *bmain)
 
   /* Error reporting into console. */
   BlendFileWriteParams params{};
+  if (USER_EXPERIMENTAL_TEST(&U, use_incremental_autosave)) {
+    params.use_chunk_store = true;
+  }
+  else {
+    /* Remove the data of a previous incremental auto-save, if any. */
+    BLO_chunk_store_remove(filepath);
+  }
   BLO_write_file(bmain, filepath, fileflags, &params, nullptr);
 
   /* Restart auto-save timer. */
@@ -2263,6 +2272,7 @@ void wm_autosave_delete()
 
     /* For global undo; remove temporarily saved file, otherwise rename. */
     if (U.uiflag & USER_GLOBALUNDO) {
+      BLO_chunk_store_remove(filepath);
       BLI_delete(filepath, false, false);
     }
     else {
@@ -3556,9 +3566,11 @@ static int wm_save_as_mainfile_exec(bContext *C, wmOperator *op)
 
   /* Set compression flag. */
   SET_FLAG_FROM_TEST(fileflags, RNA_boolean_get(op->ptr, "compress"), G_FILE_COMPRESS);
+  const eBLO_WriteCompressionMode compression_mode = eBLO_WriteCompressionMode(
+      RNA_enum_get(op->ptr, "compression_mode"));
 
   const bool success = wm_file_write(
-      C, filepath, fileflags, remap_mode, use_save_as_copy, op->reports);
+      C, filepath, fileflags, remap_mode, compression_mode, use_save_as_copy, op->reports);
 
   if ((op->flag & OP_IS_INVOKE) == 0) {
     /* OP_IS_INVOKE is set when the operator is called from the GUI.
@@ -3627,6 +3639,35 @@ static std::string wm_save_as_mainfile_get_description(bContext * /*C*/,
   return "";
 }
 
+static void wm_save_mainfile_compression_mode_def(wmOperatorType *ot)
+{
+  static const EnumPropertyItem compression_mode_items[] = {
+      {BLO_WRITE_COMPRESSION_DEFAULT,
+       "DEFAULT",
+       0,
+       "Default",
+       "Balance between writing speed and file size"},
+      {BLO_WRITE_COMPRESSION_FAST,
+       "FAST",
+       0,
+       "Fast",
+       "Compress quickly at the cost of bigger files, useful for big scenes that are saved often"},
+      {BLO_WRITE_COMPRESSION_DENSE,
+       "DENSE",
+       0,
+       "Dense",
+       "Write the smallest files at the cost of slower saving, useful for archival"},
+      {0, nullptr, 0, nullptr, nullptr},
+  };
+  PropertyRNA *prop = RNA_def_enum(ot->srna,
+                                   "compression_mode",
+                                   compression_mode_items,
+                                   BLO_WRITE_COMPRESSION_DEFAULT,
+                                   "Compression Mode",
+                                   "Trade-off between saving speed and file size when compressing");
+  RNA_def_property_flag(prop, PROP_SKIP_SAVE);
+}
+
 void WM_OT_save_as_mainfile(wmOperatorType *ot)
 {
   PropertyRNA *prop;
@@ -3650,6 +3691,7 @@ void WM_OT_save_as_mainfile(wmOperatorType *ot)
                                  FILE_DEFAULTDISPLAY,
                                  FILE_SORT_DEFAULT);
   RNA_def_boolean(ot->srna, "compress", false, "Compress", "Write compressed .blend file");
+  wm_save_mainfile_compression_mode_def(ot);
   RNA_def_boolean(ot->srna,
                   "relative_remap",
                   true,
@@ -3737,6 +3779,7 @@ void WM_OT_save_mainfile(wmOperatorType *ot)
                                  FILE_DEFAULTDISPLAY,
                                  FILE_SORT_DEFAULT);
   RNA_def_boolean(ot->srna, "compress", false, "Compress", "Write compressed .blend file");
+  wm_save_mainfile_compression_mode_def(ot);
   RNA_def_boolean(ot->srna,
                   "relative_remap",
                   false,
@@ -24,6 +24,7 @@
 #include "BLI_fileops.h"
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
+#include "BLI_profile_trace.hh"
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
@@ -196,6 +197,7 @@ static void sound_jack_sync_callback(Main *bmain, int mode, double time)
 
 void WM_init(bContext *C, int argc, const char **argv)
 {
+  PROFILE_TRACE_ZONE("Startup");
 
   if (!G.background) {
     wm_ghost_init(C); /* NOTE: it assigns C to ghost! */
@@ -276,7 +278,10 @@ void WM_init(bContext *C, int argc, const char **argv)
   read_homefile_params.app_template_override = WM_init_state_app_template_get();
   read_homefile_params.is_first_time = true;
 
-  wm_homefile_read_ex(C, &read_homefile_params, nullptr, &params_file_read_post);
+  {
+    PROFILE_TRACE_ZONE("Read Home File");
+    wm_homefile_read_ex(C, &read_homefile_params, nullptr, &params_file_read_post);
+  }
 
   /* NOTE: leave `G_MAIN->filepath` set to an empty string since this
    * matches behavior after loading a new file. */
@@ -312,8 +317,12 @@ void WM_init(bContext *C, int argc, const char **argv)
   ED_spacemacros_init();
 
 #ifdef WITH_PYTHON
-  BPY_python_start(C, argc, argv);
-  BPY_python_reset(C);
+  {
+    /* Includes registering all startup scripts. */
+    PROFILE_TRACE_ZONE("Start Python");
+    BPY_python_start(C, argc, argv);
+    BPY_python_reset(C);
+  }
 #else
   UNUSED_VARS(argc, argv);
 #endif
@@ -414,6 +423,7 @@ void WM_init_splash(bContext *C)
 static void wm_init_scripts_extensions_once(bContext *C)
 {
 #ifdef WITH_PYTHON
+  PROFILE_TRACE_ZONE("Load Add-ons");
   const char *imports[] = {"bpy", nullptr};
   BPY_run_string_eval(C, imports, "bpy.utils.load_scripts_extensions()");
 #else
@@ -678,6 +688,9 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
   BLI_threadapi_exit();
   BLI_task_scheduler_exit();
 
+  /* All threads have finished recording now. */
+  profile_trace::stop();
+
   /* No need to call this early, rather do it late so that other
    * pieces of Blender using sound may exit cleanly, see also #50676. */
   BKE_sound_exit();
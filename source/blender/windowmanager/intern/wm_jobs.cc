@@ -653,6 +653,20 @@ void wm_jobs_timer_end(wmWindowManager *wm, wmTimer *wt)
   }
 }
 
+/**
+ * Start jobs that were suspended because a conflicting job was running. Without this they would
+ * only be started on their next timer step, which adds up for queues of short jobs such as
+ * previews. Jobs that still wait for their initial start delay are left alone.
+ */
+static void wm_jobs_start_suspended(wmWindowManager *wm)
+{
+  LISTBASE_FOREACH (wmJob *, wm_job, &wm->jobs) {
+    if (wm_job->suspended && !wm_job->running && wm_job->start_delay_time == 0.0) {
+      WM_jobs_start(wm, wm_job);
+    }
+  }
+}
+
 void wm_jobs_timer(wmWindowManager *wm, wmTimer *wt)
 {
   wmJob *wm_job = static_cast<wmJob *>(BLI_findptr(&wm->jobs, wt, offsetof(wmJob, wt)));
@@ -726,6 +740,8 @@ void wm_jobs_timer(wmWindowManager *wm, wmTimer *wt)
           wm_job_free(wm, wm_job);
           wm_job = nullptr;
         }
+
+        wm_jobs_start_suspended(wm);
       }
     }
     else if (wm_job->suspended) {
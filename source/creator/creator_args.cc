@@ -25,6 +25,7 @@
 #  include "BLI_fileops.h"
 #  include "BLI_listbase.h"
 #  include "BLI_path_util.h"
+#  include "BLI_profile_trace.hh"
 #  include "BLI_string.h"
 #  include "BLI_string_utf8.h"
 #  include "BLI_system.h"
@@ -763,6 +764,7 @@ static void print_help(bArgs *ba, bool all)
   }
   BLI_args_print_arg_doc(ba, "--debug-all");
   BLI_args_print_arg_doc(ba, "--debug-io");
+  BLI_args_print_arg_doc(ba, "--profile-trace");
 
   PRINT("\n");
   BLI_args_print_arg_doc(ba, "--debug-fpe");
@@ -861,6 +863,9 @@ static void print_help(bArgs *ba, bool all)
   PRINT("  $BLENDER_SYSTEM_EXTENSIONS Directory for system extensions repository.\n");
   PRINT("  $BLENDER_SYSTEM_DATAFILES  Directory to replace bundled datafiles.\n");
   PRINT("  $BLENDER_SYSTEM_PYTHON     Directory to replace bundled Python libraries.\n");
+  PRINT("\n");
+  PRINT("  $BLENDER_LIBRARY_CACHE_DIR Directory to cache decompressed linked libraries in,\n");
+  PRINT("                             shared by all Blender processes using it.\n");
 
   if (defs.with_ocio) {
     PRINT("  $OCIO                      Path to override the OpenColorIO configuration file.\n");
@@ -1285,7 +1290,8 @@ static const char arg_handle_debug_mode_generic_set_doc_depsgraph_tag[] =
     "Enable debug messages from dependency graph related on tagging.";
 static const char arg_handle_debug_mode_generic_set_doc_depsgraph_time[] =
     "\n\t"
-    "Enable debug messages from dependency graph related on timing.";
+    "Enable debug messages from dependency graph related on timing.\n"
+    "\tA timeline of every evaluation is written to the temporary directory as a Chrome trace.";
 static const char arg_handle_debug_mode_generic_set_doc_depsgraph_eval[] =
     "\n\t"
     "Enable debug messages from dependency graph related on evaluation.";
@@ -1317,6 +1323,22 @@ static int arg_handle_debug_mode_io(int /*argc*/, const char ** /*argv*/, void *
   return 0;
 }
 
+static const char arg_handle_profile_trace_set_doc[] =
+    "<filepath>\n"
+    "\tRecord a trace of startup, the depsgraph, modifiers, geometry nodes, drawing\n"
+    "\tand file I/O. The trace is written to the file on exit in the Chrome trace\n"
+    "\tevent format, which can be opened in Perfetto or 'chrome://tracing'.";
+static int arg_handle_profile_trace_set(int argc, const char **argv, void * /*data*/)
+{
+  const char *arg_id = "--profile-trace";
+  if (argc > 1) {
+    blender::profile_trace::start(argv[1]);
+    return 1;
+  }
+  fprintf(stderr, "\nError: '%s' no args given.\n", arg_id);
+  return 0;
+}
+
 static const char arg_handle_debug_mode_all_doc[] =
     "\n\t"
     "Enable all debug messages.";
@@ -2702,6 +2724,7 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
   BLI_args_add(ba, nullptr, "--debug-all", CB(arg_handle_debug_mode_all), nullptr);
 
   BLI_args_add(ba, nullptr, "--debug-io", CB(arg_handle_debug_mode_io), nullptr);
+  BLI_args_add(ba, nullptr, "--profile-trace", CB(arg_handle_profile_trace_set), nullptr);
 
   BLI_args_add(ba, nullptr, "--debug-fpe", CB(arg_handle_debug_fpe_set), nullptr);
 
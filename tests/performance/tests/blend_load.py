@@ -22,6 +22,31 @@ def _run(filepath):
     return result
 
 
+def _run_save(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    filepath, compression_mode = args
+    bpy.ops.wm.open_mainfile(filepath=filepath)
+
+    with tempfile.TemporaryDirectory() as tempdir:
+        save_filepath = os.path.join(tempdir, "save_test.blend")
+        compress = compression_mode is not None
+        save_args = {'compression_mode': compression_mode} if compress else {}
+
+        # Save once so that the file exists and the measurement doesn't include creating it.
+        bpy.ops.wm.save_as_mainfile(filepath=save_filepath, copy=True, compress=compress, **save_args)
+
+        start_time = time.time()
+        bpy.ops.wm.save_as_mainfile(filepath=save_filepath, copy=True, compress=compress, **save_args)
+        elapsed_time = time.time() - start_time
+
+        result = {'time': elapsed_time, 'file_size': os.path.getsize(save_filepath)}
+    return result
+
+
 class BlendLoadTest(api.Test):
     def __init__(self, filepath):
         self.filepath = filepath
@@ -37,6 +62,28 @@ class BlendLoadTest(api.Test):
         return result
 
 
+class BlendSaveTest(api.Test):
+    def __init__(self, filepath, compression_mode):
+        self.filepath = filepath
+        # None saves without compression.
+        self.compression_mode = compression_mode
+
+    def name(self):
+        if self.compression_mode is None:
+            return self.filepath.stem
+        return f"{self.filepath.stem}_compress_{self.compression_mode.lower()}"
+
+    def category(self):
+        return "blend_save"
+
+    def run(self, env, device_id):
+        result, _ = env.run_in_blender(_run_save, (str(self.filepath), self.compression_mode))
+        return result
+
+
 def generate(env):
     filepaths = env.find_blend_files('*/*')
-    return [BlendLoadTest(filepath) for filepath in filepaths]
+    tests = [BlendLoadTest(filepath) for filepath in filepaths]
+    for compression_mode in (None, 'FAST', 'DEFAULT', 'DENSE'):
+        tests += [BlendSaveTest(filepath, compression_mode) for filepath in filepaths]
+    return tests
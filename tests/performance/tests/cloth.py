@@ -0,0 +1,61 @@
+# SPDX-FileCopyrightText: 2024 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import time
+
+    # Start from an empty scene.
+    bpy.ops.wm.read_homefile(use_empty=True)
+
+    # A grid with `resolution * resolution` vertices, falling on a sphere.
+    resolution = args['resolution']
+    bpy.ops.mesh.primitive_grid_add(
+        x_subdivisions=resolution, y_subdivisions=resolution, size=2.0, location=(0, 0, 1))
+    cloth_ob = bpy.context.object
+    md = cloth_ob.modifiers.new("Cloth", 'CLOTH')
+    md.settings.quality = 5
+    md.collision_settings.use_collision = False
+
+    bpy.ops.mesh.primitive_uv_sphere_add(radius=0.5, location=(0, 0, 0))
+    bpy.context.object.modifiers.new("Collision", 'COLLISION')
+
+    scene = bpy.context.scene
+    scene.frame_start = 1
+    scene.frame_end = args['frames']
+    md.point_cache.frame_end = scene.frame_end
+
+    start_time = time.time()
+    for frame in range(scene.frame_start, scene.frame_end + 1):
+        scene.frame_set(frame)
+    elapsed_time = time.time() - start_time
+
+    num_frames = scene.frame_end + 1 - scene.frame_start
+    result = {'time': elapsed_time / num_frames}
+    return result
+
+
+class ClothTest(api.Test):
+    def __init__(self, resolution, frames):
+        self.resolution = resolution
+        self.frames = frames
+
+    def name(self):
+        return f"cloth_grid_{self.resolution}"
+
+    def category(self):
+        return "cloth"
+
+    def run(self, env, device_id):
+        args = {'resolution': self.resolution, 'frames': self.frames}
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    # The largest grid has about 200k vertices.
+    return [ClothTest(100, 20), ClothTest(450, 5)]
@@ -60,6 +60,73 @@ class GeometryNodesTest(api.Test):
         return result
 
 
+def _run_volume(args):
+    import bpy
+    import time
+
+    # Start from an empty scene.
+    bpy.ops.wm.read_homefile(use_empty=True)
+
+    bpy.ops.mesh.primitive_ico_sphere_add(subdivisions=args['subdivisions'], radius=1.0)
+    ob = bpy.context.object
+
+    group = bpy.data.node_groups.new("Volume", 'GeometryNodeTree')
+    group.interface.new_socket("Geometry", in_out='INPUT', socket_type='NodeSocketGeometry')
+    group.interface.new_socket("Geometry", in_out='OUTPUT', socket_type='NodeSocketGeometry')
+    group_input = group.nodes.new('NodeGroupInput')
+    group_output = group.nodes.new('NodeGroupOutput')
+    if args['source'] == 'MESH':
+        node = group.nodes.new('GeometryNodeMeshToVolume')
+        geometry_input = node.inputs['Mesh']
+    else:
+        node = group.nodes.new('GeometryNodePointsToVolume')
+        node.inputs['Radius'].default_value = 0.05
+        geometry_input = node.inputs['Points']
+    node.resolution_mode = 'VOXEL_SIZE'
+    node.inputs['Voxel Size'].default_value = args['voxel_size']
+    group.links.new(group_input.outputs[0], geometry_input)
+    group.links.new(node.outputs[0], group_output.inputs[0])
+
+    md = ob.modifiers.new("Volume", 'NODES')
+    md.node_group = group
+
+    measured_times = []
+    for _ in range(args['measurements']):
+        ob.update_tag()
+        start_time = time.time()
+        bpy.context.view_layer.update()
+        measured_times.append(time.time() - start_time)
+
+    result = {'time': sum(measured_times) / len(measured_times)}
+    return result
+
+
+class GeometryNodesVolumeTest(api.Test):
+    def __init__(self, source, subdivisions, voxel_size):
+        self.source = source
+        self.subdivisions = subdivisions
+        self.voxel_size = voxel_size
+
+    def name(self):
+        return f"{self.source.lower()}_to_volume_{self.subdivisions}"
+
+    def category(self):
+        return "geometry_nodes"
+
+    def run(self, env, device_id):
+        args = {
+            'source': self.source,
+            'subdivisions': self.subdivisions,
+            'voxel_size': self.voxel_size,
+            'measurements': 5,
+        }
+        result, _ = env.run_in_blender(_run_volume, args)
+        return result
+
+
 def generate(env):
     filepaths = env.find_blend_files('geometry_nodes/*')
-    return [GeometryNodesTest(filepath) for filepath in filepaths]
+    tests = [GeometryNodesTest(filepath) for filepath in filepaths]
+    # Generated scenes, so that volume conversion is benchmarked without any test files.
+    tests += [GeometryNodesVolumeTest('MESH', 6, 0.01), GeometryNodesVolumeTest('POINTS', 7, 0.01)]
+    return tests
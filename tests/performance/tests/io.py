@@ -0,0 +1,76 @@
+# SPDX-FileCopyrightText: 2024 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    # Start from an empty scene with a single subdivided mesh.
+    bpy.ops.wm.read_homefile(use_empty=True)
+    bpy.ops.mesh.primitive_grid_add(
+        x_subdivisions=args['resolution'], y_subdivisions=args['resolution'], size=2.0)
+    bpy.ops.object.shade_smooth()
+
+    file_format = args['format']
+    export_op = getattr(bpy.ops.wm, file_format + "_export")
+    import_op = getattr(bpy.ops.wm, file_format + "_import")
+
+    with tempfile.TemporaryDirectory() as tempdir:
+        filepath = os.path.join(tempdir, "io_test." + args['extension'])
+
+        start_time = time.time()
+        export_op(filepath=filepath)
+        export_time = time.time() - start_time
+
+        bpy.ops.wm.read_homefile(use_empty=True)
+
+        start_time = time.time()
+        import_op(filepath=filepath)
+        import_time = time.time() - start_time
+
+        file_size = os.path.getsize(filepath)
+
+    if args['mode'] == 'EXPORT':
+        return {'time': export_time, 'file_size': file_size}
+    return {'time': import_time, 'file_size': file_size}
+
+
+class IOTest(api.Test):
+    def __init__(self, file_format, extension, mode, resolution):
+        self.file_format = file_format
+        self.extension = extension
+        self.mode = mode
+        self.resolution = resolution
+
+    def name(self):
+        return f"{self.file_format}_{self.mode.lower()}_grid_{self.resolution}"
+
+    def category(self):
+        return "io"
+
+    def run(self, env, device_id):
+        args = {
+            'format': self.file_format,
+            'extension': self.extension,
+            'mode': self.mode,
+            'resolution': self.resolution,
+        }
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    # USD and Alembic are left out since they are optional in builds,
+    # the formats below are always available.
+    formats = (('obj', 'obj'), ('ply', 'ply'), ('stl', 'stl'))
+    # The grid has 1M vertices.
+    resolution = 1000
+    return [IOTest(file_format, extension, mode, resolution)
+            for file_format, extension in formats
+            for mode in ('EXPORT', 'IMPORT')]